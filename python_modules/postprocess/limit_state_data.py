@@ -54,7 +54,7 @@ class LimitStateData(object):
         '''Read a Python object from a pickle file.'''
         with open(name + '.pkl', 'r') as f:
             return pickle.load(f)
-    def saveAll(self,feProblem,combContainer,setCalc,fConvIntForc= 1.0,analysisToPerform= defaultAnalysis,lstSteelBeams=None):
+    def saveAll(self,feProblem,combContainer,setCalc,fConvIntForc= 1.0,analysisToPerform= defaultAnalysis,lstSteelBeams=None,superposition= False):
         '''Write internal forces, displacements, .., for each combination
 
         :param feProblem: XC finite element problem to deal with.
@@ -66,6 +66,12 @@ class LimitStateData(object):
                                (The use of this factor won't be allowed in
                                 future versions)
         :param lstSteelBeams: list of steel beams to analyze (defaults to None)
+        :param superposition: if True, the load patterns are solved only 
+                              once (factorizing the stiffness matrix one time)
+                              and the results of each combination are 
+                              obtained by linear superposition. Only valid
+                              for linear models (analysisToPerform is
+                              ignored in that case).
         '''
         if fConvIntForc != 1.0:
           lmsg.warning('fConvIntForc= ' + fConvIntForc + 'conversion factor between units is DEPRECATED' )
@@ -88,12 +94,21 @@ class LimitStateData(object):
         fDisp.write(" Comb. , Node , Ux , Uy , Uz , ROTx , ROTy , ROTz \n")
         fIntF.close()
         fDisp.close()
+        if superposition:
+            analysis= predefined_solutions.simple_static_linear(feProblem)
+            result= loadCombinations.computePrimaryResponses(analysis)
+            if(result!=0):
+                lmsg.warning('superposition failed; solving each combination.')
+                superposition= False
         for key in loadCombinations.getKeys():
             comb= loadCombinations[key]
-            feProblem.getPreprocessor.resetLoadCase()
-            comb.addToDomain() #Combination to analyze.
-            #Solution
-            result= analysisToPerform(feProblem)
+            if superposition:
+                result= loadCombinations.applyBySuperposition(key)
+            else:
+                feProblem.getPreprocessor.resetLoadCase()
+                comb.addToDomain() #Combination to analyze.
+                #Solution
+                result= analysisToPerform(feProblem)
             if lstSteelBeams:
                 for sb in lstSteelBeams:
                     sb.updateLateralBucklingReductionFactor()
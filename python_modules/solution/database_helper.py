@@ -6,6 +6,12 @@ def salvaCombinacion(prb,nmbComb, tagComb, pth,db):
   db.save(tagSaveFase0)
 
 class DatabaseHelperSolve:
+  '''Solves each combination starting from the state reached by its
+     previous combination (if any). The database can be created
+     with feProblem.newDatabase("Memory","") to keep the states in
+     memory instead of writing them to disk or with
+     feProblem.newDatabase("Snapshot",fileName) to write each state
+     as a single compressed block in fileName.'''
   nombrePrevia= ""
   tagPrevia= -1
   db= None
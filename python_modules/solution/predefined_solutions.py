@@ -44,6 +44,9 @@ class SolutionProcedure(object):
     :ivar analysis:  determines what type of analysis is to be performed
     :ivar convergenceTestTol: convergence tolerance (defaults to 1e-9)
     :ivar maxNumIter: maximum number of iterations (defauts to 10)
+    :ivar numThreads: number of threads used to compute the element
+                      tangents and residuals and to update the state
+                      of the mesh (defaults to 1).
     :ivar solu:
     :ivar solCtrl:
     :ivar sm:
@@ -63,10 +66,20 @@ class SolutionProcedure(object):
         self.convergenceTestTol= 1e-9
         self.maxNumIter= 10
         self.printFlag= 0
+        self.numThreads= 1
         
     def clear(self):
         self.solu.clear()
 
+    def setNumThreads(self,prb):
+        '''Set the number of threads used by the integrator and by the
+           mesh of the problem.
+
+        :param prb: problem to solve.
+        '''
+        self.integ.numThreads= self.numThreads
+        prb.getDomain.getMesh.numThreads= self.numThreads
+
     def simpleStaticLinear(self,prb):
         self.solu= prb.getSoluProc
         self.solCtrl= self.solu.getSoluControl
@@ -81,6 +94,7 @@ class SolutionProcedure(object):
         self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
         self.solAlgo= self.analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
         self.integ= self.analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+        self.setNumThreads(prb)
         self.soe= self.analysisAggregation.newSystemOfEqn("band_spd_lin_soe")
         self.solver= self.soe.newSolver("band_spd_lin_lapack_solver")
         self.analysis= self.solu.newAnalysis("static_analysis","analysisAggregation","")
@@ -98,6 +112,7 @@ class SolutionProcedure(object):
         self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
         self.solAlgo= self.analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
         self.integ= self.analysisAggregation.newIntegrator("newmark_integrator",xc.Vector([0.5,0.25]))
+        self.setNumThreads(prb)
         self.soe= self.analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
         self.solver= self.soe.newSolver("band_gen_lin_lapack_solver")
         self.analysis= self.solu.newAnalysis("direct_integration_analysis","analysisAggregation","")
@@ -115,6 +130,7 @@ class SolutionProcedure(object):
         self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
         self.solAlgo= self.analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
         self.integ= self.analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+        self.setNumThreads(prb)
         self.soe= self.analysisAggregation.newSystemOfEqn("sparse_gen_col_lin_soe")
         self.solver= self.soe.newSolver("super_lu_solver")
         self.analysis= self.solu.newAnalysis("static_analysis","analysisAggregation","")
@@ -133,6 +149,7 @@ class SolutionProcedure(object):
         self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
         self.solAlgo= self.analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
         self.integ= self.analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+        self.setNumThreads(prb)
         self.soe= self.analysisAggregation.newSystemOfEqn("sparse_gen_col_lin_soe")
         self.solver= self.soe.newSolver("super_lu_solver")
         self.analysis= self.solu.newAnalysis("static_analysis","analysisAggregation","")
@@ -150,6 +167,7 @@ class SolutionProcedure(object):
         self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
         self.solAlgo= self.analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
         self.integ= self.analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+        self.setNumThreads(prb)
         self.ctest= self.analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
         self.ctest.tol= self.convergenceTestTol
         self.ctest.maxNumIter= self.maxNumIter
@@ -170,6 +188,7 @@ class SolutionProcedure(object):
         self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
         self.solAlgo= self.analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
         self.integ= self.analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+        self.setNumThreads(prb)
         self.ctest= self.analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
         self.ctest.tol= self.convergenceTestTol
         self.ctest.maxNumIter= self.maxNumIter
@@ -190,6 +209,7 @@ class SolutionProcedure(object):
         self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
         self.solAlgo= self.analysisAggregation.newSolutionAlgorithm("modified_newton_soln_algo")
         self.integ= self.analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+        self.setNumThreads(prb)
         self.ctest= self.analysisAggregation.newConvergenceTest("relative_total_norm_disp_incr_conv_test")
         self.ctest.tol= self.convergenceTestTol
         self.ctest.maxNumIter= 150 #Make this configurable
@@ -216,6 +236,7 @@ class SolutionProcedure(object):
         self.ctest.maxNumIter= self.maxNumIter
         self.ctest.printFlag= self.printFlag
         self.integ= self.analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+        self.setNumThreads(prb)
         self.soe= self.analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
         self.solver= self.soe.newSolver("band_gen_lin_lapack_solver")
         self.analysis= self.solu.newAnalysis("static_analysis","analysisAggregation","")
@@ -239,6 +260,7 @@ class SolutionProcedure(object):
         self.ctest.maxNumIter= self.maxNumIter
         self.ctest.printFlag= self.printFlag
         self.integ= self.analysisAggregation.newIntegrator("newmark_integrator",xc.Vector([]))
+        self.setNumThreads(prb)
         self.soe= self.analysisAggregation.newSystemOfEqn("profile_spd_lin_soe")
         self.solver= self.soe.newSolver("profile_spd_lin_direct_solver")
         self.analysis= self.solu.newAnalysis("direct_integration_analysis","analysisAggregation","")
@@ -34,11 +34,14 @@
 #include "utility/handler/DataOutputFileHandler.h"
 #include "utility/handler/DataOutputDatabaseHandler.h"
 #include "utility/handler/DataOutputStreamHandler.h"
+#include "utility/handler/DataOutputHDF5Handler.h"
 #include "utility/database/FE_Datastore.h"
 
 
 #include "utility/actor/objectBroker/FEM_ObjectBrokerAllClasses.h"
 #include "utility/database/FileDatastore.h"
+#include "utility/database/MemoryDatastore.h"
+#include "utility/database/SnapshotDatastore.h"
 #include "utility/database/MySqlDatastore.h"
 #include "utility/database/BerkeleyDbDatastore.h"
 #include "utility/database/SQLiteDatastore.h"
@@ -71,6 +74,10 @@ XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &type, const s
       dataBase= new BerkeleyDbDatastore(nombre, preprocessor, theBroker);
     else if(type == "SQLite")
       dataBase= new SQLiteDatastore(nombre, preprocessor, theBroker);
+    else if(type == "Memory")
+      dataBase= new MemoryDatastore(preprocessor, theBroker);
+    else if(type == "Snapshot")
+      dataBase= new SnapshotDatastore(nombre, preprocessor, theBroker);
     else
       {  
         std::cerr << "WARNING No database type exists ";
@@ -81,12 +88,56 @@ XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &type, const s
     return dataBase; 
   }
 
+//! @brief Output handler definition.
+//!
+//! @param type: type of the handler (only "HDF5" for now).
+//! @param name: name that identifies the handler.
+//! @param fileName: name of the output file.
+//! @param datasetName: name of the dataset that will receive the output.
+//! @return the new handler or null if it can't be created. An existing
+//! handler is never replaced (the recorders keep pointers to it).
+XC::DataOutputHandler *XC::FEProblem::defineOutputHandler(const std::string &type, const std::string &name, const std::string &fileName, const std::string &datasetName)
+  {
+    DataOutputHandler *retval= nullptr;
+    if(output_handlers.find(name)!=output_handlers.end())
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; output handler: '" << name
+                << "' already exists (the recorders may be using it)."
+                << std::endl;
+    else if(type == "HDF5")
+      retval= new DataOutputHDF5Handler(fileName,datasetName);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; output handler type: '" << type
+                << "' unknown." << std::endl;
+    if(retval)
+      output_handlers[name]= retval;
+    return retval;
+  }
+
+//! @brief Returns the output handler with the name being passed as parameter.
+XC::DataOutputHandler *XC::FEProblem::getOutputHandler(const std::string &name)
+  {
+    DataOutputHandler *retval= nullptr;
+    DataOutputHandler::map_output_handlers::iterator i= output_handlers.find(name);
+    if(i!=output_handlers.end())
+      retval= (*i).second;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; output handler: '" << name
+                << "' not found." << std::endl;
+    return retval;
+  }
+
 XC::FEProblem::~FEProblem(void)
   { clearAll(); }
 
 //! @brief Delete all entities in the FE problem
 void XC::FEProblem::clearAll(void)
   {
+    Domain *dom= getDomain();
+    if(dom)
+      dom->flushRecorders(); //Pending rows of the output handlers.
     for(DataOutputHandler::map_output_handlers::iterator i= output_handlers.begin();i!=output_handlers.end();i++)
       {
         DataOutputHandler *tmp= (*i).second;
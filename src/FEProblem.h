@@ -98,6 +98,7 @@ class FEProblem: public CommandEntity
       { return gVERSION_SHORT; }
     void clearAll(void);
     FE_Datastore *defineDatabase(const std::string &, const std::string &);
+    DataOutputHandler *defineOutputHandler(const std::string &, const std::string &, const std::string &, const std::string &);
     inline FE_Datastore *getDataBase(void)
       { return dataBase; }
     inline const Preprocessor &getPreprocessor(void) const
@@ -116,6 +117,7 @@ class FEProblem: public CommandEntity
       { return fields; }
     inline DataOutputHandler::map_output_handlers *getOutputHandlers(void) const
       { return &output_handlers; }
+    DataOutputHandler *getOutputHandler(const std::string &);
   };
 
 inline std::string getXCVersion(void)
@@ -83,6 +83,7 @@
 #define EigenSOLVER_TAGS_SymBandEigenSolver     3
 #define EigenSOLVER_TAGS_BandArpackppSolver 	4
 #define EigenSOLVER_TAGS_FullGenEigenSolver  5
+#define EigenSOLVER_TAGS_SymLanczosSolver  6
 
 #define EigenALGORITHM_TAGS_Frequency 1
 #define EigenALGORITHM_TAGS_Standard  2
@@ -388,6 +389,7 @@
 #define EquiALGORITHM_TAGS_PeriodicNewton       9
 #define EquiALGORITHM_TAGS_SecantNewton         10
 #define EquiALGORITHM_TAGS_AccelNewton          11
+#define EquiALGORITHM_TAGS_AdaptiveNewton       12
 
 #define ACCELERATOR_TAGS_Krylov		1
 #define ACCELERATOR_TAGS_Secant		2
@@ -430,6 +432,7 @@
 #define INTEGRATOR_TAGS_AlphaOSGeneralized              25
 #define INTEGRATOR_TAGS_Collocation 	          	    26
 #define INTEGRATOR_TAGS_CollocationHybridSimulation 	27
+#define INTEGRATOR_TAGS_CentralDifferenceLumpedMass     28
 
 
 
@@ -455,6 +458,7 @@
 #define LinSOE_TAGS_SparseGenRowLinSOE		20
 #define LinSOE_TAGS_DistributedSparseGenRowLinSOE       21
 #define LinSOE_TAGS_DistributedDiagonalSOE 22
+#define LinSOE_TAGS_MatrixFreeLinSOE 23
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
 #define SOLVER_TAGS_BandGenLinLapackSolver  	2
@@ -478,6 +482,10 @@
 #define SOLVER_TAGS_DiagonalDirectSolver 20
 #define SOLVER_TAGS_PetscSparseSeqSolver 21
 #define SOLVER_TAGS_DistributedDiagonalSolver 22
+#define SOLVER_TAGS_SupernodalCholeskySolver 23
+#define SOLVER_TAGS_MatrixFreePCGSolver 24
+#define SOLVER_TAGS_SparseGenColAMGSolver 25
+#define SOLVER_TAGS_SparseGenRowAMGSolver 26
 
 
 #define RECORDER_TAGS_ElementRecorder		1
@@ -501,6 +509,7 @@
 #define DATAHANDLER_TAGS_DataOutputStreamHandler		1
 #define DATAHANDLER_TAGS_DataOutputFileHandler		2
 #define DATAHANDLER_TAGS_DataOutputDatabaseHandler		3
+#define DATAHANDLER_TAGS_DataOutputHDF5Handler		4
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
 
@@ -158,6 +158,7 @@ XC::Domain::Domain(CommandEntity *owr,int numNodes, int numElements, int numSPs,
 //! casting a DomainComponent from theElements to an Element is o.k.
 void XC::Domain::clearAll(void)
   {
+    flushRecorders();
     constraints.clearAll();
     
     // clean out the containers
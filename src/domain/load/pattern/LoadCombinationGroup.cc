@@ -30,7 +30,14 @@
 #include "preprocessor/prep_handlers/LoadHandler.h"
 
 #include "domain/load/pattern/LoadCombination.h"
+#include "domain/load/pattern/LoadPattern.h"
 #include "domain/domain/Domain.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeIter.h"
+#include "solution/analysis/analysis/StaticAnalysis.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/integrator/IncrementalIntegrator.h"
+#include "solution/system_of_eqn/linearSOE/LinearSOE.h"
 
 
 
@@ -167,6 +174,7 @@ boost::python::list XC::LoadCombinationGroup::getKeys(void) const
 //! @brief Deletes all the combinations.
 void XC::LoadCombinationGroup::clear(void)
   {
+    clearPrimaryResponses();
     removeAllFromDomain();
     for(iterator i= begin();i!=end();i++)
       {
@@ -311,3 +319,234 @@ int XC::LoadCombinationGroup::getTagCombPrevia(const std::string &nmb) const
       retval= i->second->getTag();
     return retval;
   }
+
+//! @brief Returns the load patterns that take part in the combinations.
+std::set<XC::LoadPattern *> XC::LoadCombinationGroup::getPrimaryLoadPatterns(void)
+  {
+    std::set<LoadPattern *> retval;
+    MapLoadPatterns &lps= getLoadHandler()->getLoadPatterns();
+    for(const_iterator i= begin();i!=end();i++)
+      {
+        const LoadCombination *comb= i->second;
+        for(LoadCombination::const_iterator j= comb->begin();j!=comb->end();j++)
+          {
+            const LoadPattern *lp= j->getLoadPattern();
+            if(lp)
+              retval.insert(lps.buscaLoadPattern(lp->getTag()));
+          }
+      }
+    retval.erase(nullptr);
+    return retval;
+  }
+
+//! @brief Stores the current trial displacements of the nodes as
+//! the response of the load pattern identified by the argument.
+void XC::LoadCombinationGroup::store_nodal_displacements(const int &lpTag)
+  {
+    Domain *dom= getDomain();
+    if(respNodeTags.empty()) //Set up the layout of the response vectors.
+      {
+        size_t sz= 0;
+        NodeIter &theNodes= dom->getNodes();
+        Node *nodPtr= nullptr;
+        while((nodPtr= theNodes()) != nullptr)
+          {
+            respNodeTags.push_back(nodPtr->getTag());
+            respOffsets.push_back(sz);
+            sz+= nodPtr->getNumberDOF();
+          }
+        respOffsets.push_back(sz);
+      }
+    Vector &resp= primaryResponses[lpTag];
+    resp.resize(respOffsets.back());
+    const size_t numNodes= respNodeTags.size();
+    for(size_t i= 0;i<numNodes;i++)
+      {
+        const Vector &disp= dom->getNode(respNodeTags[i])->getTrialDisp();
+        const size_t offset= respOffsets[i];
+        const size_t ndof= respOffsets[i+1]-offset;
+        for(size_t j= 0;j<ndof;j++)
+          resp[offset+j]= disp[j];
+      }
+  }
+
+//! @brief Computes the nodal displacements produced by each of the load
+//! patterns that take part in the combinations.
+//!
+//! The stiffness matrix is assembled and factorized only once and the
+//! load patterns are solved as successive right hand sides of the same
+//! system of equations. The results are only meaningful if the model
+//! is linear; load patterns containing imposed displacements are
+//! rejected because the constrained degrees of freedom would change
+//! from one combination to another. The load patterns are evaluated
+//! at pseudo-time 1.0 (the one reached by a load control step with
+//! unit increment).
+//!
+//! @param analysis: static analysis whose integrator and system of
+//! equations will be used to compute the responses.
+//! @return 0 if successful, a negative number otherwise.
+int XC::LoadCombinationGroup::computePrimaryResponses(StaticAnalysis &analysis)
+  {
+    clearPrimaryResponses();
+    AnalysisModel *theModel= analysis.getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator= analysis.getIncrementalIntegratorPtr();
+    LinearSOE *theSOE= analysis.getLinearSOEPtr();
+    if((!theModel) || (!theIntegrator) || (!theSOE))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; undefined analysis model,"
+                  << " integrator or system of equations.\n";
+        return -1;
+      }
+    const std::set<LoadPattern *> patterns= getPrimaryLoadPatterns();
+    for(std::set<LoadPattern *>::const_iterator i= patterns.begin();i!=patterns.end();i++)
+      if((*i)->getNumSPs()>0)
+        {
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; load pattern: '" << (*i)->getName()
+                    << "' has imposed displacements;"
+                    << " superposition not available.\n";
+          return -2;
+        }
+
+    // Put all the load patterns in the domain, so the
+    // analysis model is built only once.
+    Domain *dom= getDomain();
+    getLoadHandler()->removeAllFromDomain();
+    dom->resetLoadCase();
+    std::map<LoadPattern *,double> gammas;
+    for(std::set<LoadPattern *>::const_iterator i= patterns.begin();i!=patterns.end();i++)
+      {
+        gammas[*i]= (*i)->GammaF();
+        (*i)->setGammaF(0.0);
+        dom->addLoadPattern(*i);
+      }
+    int retval= analysis.domainChanged();
+    if(retval>=0)
+      retval= theIntegrator->formTangent();
+    if(retval<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; failed to form the tangent stiffness.\n";
+    const Vector zero(theSOE->getNumEqn());
+    for(std::set<LoadPattern *>::const_iterator i= patterns.begin();(retval>=0) && (i!=patterns.end());i++)
+      {
+        LoadPattern *lp= *i;
+        lp->setGammaF(1.0); //Only this pattern is active.
+        dom->applyLoad(1.0);
+        retval= theIntegrator->formUnbalance();
+        if(retval>=0)
+          retval= theSOE->solve(); //Factorizes only the first time.
+        if(retval<0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; failed to solve load pattern: '"
+                      << lp->getName() << "'.\n";
+            break;
+          }
+        theModel->setDisp(theSOE->getX());
+        store_nodal_displacements(lp->getTag());
+        theModel->setDisp(zero);
+        lp->setGammaF(0.0);
+      }
+
+    // Restore the domain.
+    for(std::map<LoadPattern *,double>::iterator i= gammas.begin();i!=gammas.end();i++)
+      {
+        dom->removeLoadPattern(i->first);
+        i->first->setGammaF(i->second);
+      }
+    dom->resetLoadCase();
+    if(retval<0)
+      clearPrimaryResponses();
+    return retval;
+  }
+
+//! @brief Returns true if the responses of the load patterns
+//! have been computed.
+bool XC::LoadCombinationGroup::hasPrimaryResponses(void) const
+  { return !primaryResponses.empty(); }
+
+//! @brief Frees the memory used to store the responses of the load patterns.
+void XC::LoadCombinationGroup::clearPrimaryResponses(void)
+  {
+    respNodeTags.clear();
+    respOffsets.clear();
+    primaryResponses.clear();
+  }
+
+//! @brief Adds the combination to the domain and sets the nodal
+//! displacements as the linear combination of the responses
+//! computed by computePrimaryResponses. Then the state of the elements
+//! is updated and committed and the nodal reactions are computed, so
+//! the internal forces and reactions can be obtained as if the
+//! combination had been analyzed. The
+//! load patterns and combinations previously in the domain are
+//! removed first.
+//!
+//! @param comb_code: name of the combination.
+//! @return 0 if successful, a negative number otherwise.
+int XC::LoadCombinationGroup::applyBySuperposition(const std::string &comb_code)
+  {
+    LoadCombination *comb= find_combination(comb_code);
+    if(!comb)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; load combination: '" 
+                  << comb_code << "' not found." << std::endl;
+        return -1;
+      }
+    if(!hasPrimaryResponses())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; responses of load patterns not computed;"
+                  << " call computePrimaryResponses first." << std::endl;
+        return -2;
+      }
+    Vector u(respOffsets.back());
+    for(LoadCombination::const_iterator i= comb->begin();i!=comb->end();i++)
+      {
+        const LoadPattern *lp= i->getLoadPattern();
+        if(!lp)
+          continue;
+        std::map<int,Vector>::const_iterator j= primaryResponses.find(lp->getTag());
+        if(j==primaryResponses.end())
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; response of load pattern: '" 
+                      << lp->getName() << "' not found." << std::endl;
+            return -3;
+          }
+        u.addVector(1.0,j->second,i->Factor());
+      }
+
+    Domain *dom= getDomain();
+    getLoadHandler()->removeAllFromDomain();
+    dom->resetLoadCase();
+    dom->addLoadCombination(comb);
+    dom->applyLoad(1.0);
+    const size_t numNodes= respNodeTags.size();
+    for(size_t i= 0;i<numNodes;i++)
+      {
+        Node *nodPtr= dom->getNode(respNodeTags[i]);
+        if(!nodPtr)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; node: " << respNodeTags[i]
+                      << " not found; the mesh has changed since"
+                      << " the responses were computed." << std::endl;
+            return -4;
+          }
+        const size_t offset= respOffsets[i];
+        const size_t ndof= respOffsets[i+1]-offset;
+        Vector disp(ndof);
+        for(size_t j= 0;j<ndof;j++)
+          disp[j]= u[offset+j];
+        nodPtr->setTrialDisp(disp);
+      }
+    int retval= dom->update();
+    if(retval>=0)
+      retval= dom->commit();
+    if(retval>=0)
+      retval= dom->calculateNodalReactions(false,1e-4);
+    return retval;
+  }
@@ -31,20 +31,37 @@
 
 #include "preprocessor/prep_handlers/LoadHandlerMember.h"
 #include <map>
+#include <set>
+#include <vector>
 #include "boost/python/list.hpp"
+#include "utility/matrix/Vector.h"
 
 namespace XC {
 class LoadCombination;
 class LoadHandler;
+class LoadPattern;
 class Domain;
+class StaticAnalysis;
 
 typedef std::map<std::string,LoadCombination *> LoadCombinationMap; //!< LoadCombinations.
 
 //! @ingroup LPatterns
 //
 //! @brief Load combination container.
+//!
+//! For linear models the container can compute the response of
+//! each of the load patterns involved in its combinations (see
+//! computePrimaryResponses) and then obtain the response of each
+//! combination by linear superposition (see applyBySuperposition)
+//! instead of solving each combination from scratch.
 class LoadCombinationGroup: public LoadHandlerMember, public LoadCombinationMap
   {
+    std::vector<int> respNodeTags; //!< Tags of the nodes whose displacements are stored.
+    std::vector<size_t> respOffsets; //!< Position of the displacements of each node in the response vectors.
+    std::map<int,Vector> primaryResponses; //!< Nodal displacements for each load pattern (key: load pattern tag).
+
+    std::set<LoadPattern *> getPrimaryLoadPatterns(void);
+    void store_nodal_displacements(const int &);
   protected:
     LoadCombination *find_combination(const std::string &);
     friend class LoadHandler;
@@ -77,6 +94,11 @@ class LoadCombinationGroup: public LoadHandlerMember, public LoadCombinationMap
     const std::string getNombreCombPrevia(const std::string &) const;
     int getTagCombPrevia(const std::string &) const;
 
+    int computePrimaryResponses(StaticAnalysis &);
+    bool hasPrimaryResponses(void) const;
+    void clearPrimaryResponses(void);
+    int applyBySuperposition(const std::string &);
+
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
   };
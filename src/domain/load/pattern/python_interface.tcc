@@ -98,6 +98,10 @@ class_<XC::LoadCombinationGroup, bases<XC::LoadHandlerMember,XC::LoadCombination
   .def("getKeys", &XC::LoadCombinationGroup::getKeys)
   .def("__getitem__",&XC::LoadCombinationGroup::buscaLoadCombination, return_value_policy<reference_existing_object>())
   .def("clear", &XC::LoadCombinationGroup::clear)
+  .def("computePrimaryResponses", &XC::LoadCombinationGroup::computePrimaryResponses,"computePrimaryResponses(staticAnalysis): computes the response of each load pattern used in the combinations (linear models only) factorizing the stiffness matrix only once.")
+  .add_property("hasPrimaryResponses", &XC::LoadCombinationGroup::hasPrimaryResponses,"True if the responses of the load patterns have been computed.")
+  .def("clearPrimaryResponses", &XC::LoadCombinationGroup::clearPrimaryResponses,"Frees the responses of the load patterns.")
+  .def("applyBySuperposition", &XC::LoadCombinationGroup::applyBySuperposition,"applyBySuperposition(combName): adds the combination to the domain and sets its response (displacements, internal forces and reactions) by superposition of the load pattern responses.")
   ;
 
 class_<XC::TimeSeries, bases<CommandEntity,XC::MovableObject>, boost::noncopyable >("TimeSeries", no_init)
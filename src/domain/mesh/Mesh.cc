@@ -52,6 +52,10 @@
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
 
 #include "utility/actor/actor/MovableVector.h"
+#include "utility/threads/parallel_loop.h"
+#include "domain/mesh/MeshResultArrays.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
 
 //! @brief Frees memory occupied by mesh components.
 //! this calls delete on all components of the model,
@@ -113,7 +117,7 @@ void XC::Mesh::init_bounds(void)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr)
   :MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-   theBounds(6), lockers(this)
+   theBounds(6), lockers(this), numThreads(1), arraysBuiltFlag(false)
   {
     alloc_containers();
     alloc_iters();
@@ -125,7 +129,8 @@ XC::Mesh::Mesh(CommandEntity *owr)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStorage &theElementsStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false),
-    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this)
+    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this),
+    numThreads(1), arraysBuiltFlag(false)
   {
     // init the iters
     alloc_iters();
@@ -144,7 +149,7 @@ XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObj
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh),
     eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-    theBounds(6), lockers(this)
+    theBounds(6), lockers(this), numThreads(1), arraysBuiltFlag(false)
   {
     // init the arrays for storing the mesh components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -178,6 +183,7 @@ void XC::Mesh::clearAll(void)
     // rest the flag to be as initial
     nodeGraphBuiltFlag= false;
     eleGraphBuiltFlag= false;
+    arraysBuiltFlag= false;
   }
 
 //! @brief Destructor.
@@ -198,6 +204,7 @@ void XC::Mesh::add_element_to_domain(Element *element)
 
     // mark the domain as having been changed
     dom->domainChange();
+    arraysBuiltFlag= false;
     kdtreeElements.insert(*element);
   }
 //! @brief Must only to be called from recvSelf.
@@ -290,6 +297,7 @@ void XC::Mesh::add_node_to_domain(Node *node)
     Domain *dom= getDomain();
     node->setDomain(dom);
     dom->domainChange();
+    arraysBuiltFlag= false;
     update_bounds(node->getCrds());
     kdtreeNodes.insert(*node);
   }
@@ -365,6 +373,7 @@ bool XC::Mesh::removeElement(int tag)
         if(elem) kdtreeElements.erase(*elem);
 
         dom->domainChange(); //mark the domain as having changed
+        arraysBuiltFlag= false;
       }
     return res;
   }
@@ -392,6 +401,7 @@ bool XC::Mesh::removeNode(int tag)
 
         // mark the domain has having changed
         dom->domainChange();
+        arraysBuiltFlag= false;
       }
     return res;
   }
@@ -641,6 +651,97 @@ size_t XC::Mesh::getNumFreeNodes(void) const
     return retval;
   }
 
+//! @brief Fills the vector with the nodes of the mesh (in the order
+//! of the node iterator).
+void XC::Mesh::get_node_ptrs(std::vector<Node *> &nodes)
+  {
+    nodes.clear();
+    nodes.reserve(getNumNodes());
+    NodeIter &theNodeIter= getNodes();
+    Node *nodPtr= nullptr;
+    while((nodPtr = theNodeIter()) != nullptr)
+      nodes.push_back(nodPtr);
+  }
+
+//! @brief Fills the vector with the elements of the mesh (in the order
+//! of the element iterator).
+void XC::Mesh::get_element_ptrs(std::vector<Element *> &elements)
+  {
+    elements.clear();
+    elements.reserve(getNumElements());
+    ElementIter &theElemIter= getElements();
+    Element *elePtr= nullptr;
+    while((elePtr = theElemIter()) != nullptr)
+      elements.push_back(elePtr);
+  }
+
+//! @brief Returns the tags of the nodes in the order of the rows of
+//! the node arrays (getNodeCoordinateArray, getNodeDisplacementArray,...).
+XC::ID XC::Mesh::getNodeTagArray(void)
+  {
+    std::vector<Node *> nodes;
+    get_node_ptrs(nodes);
+    return get_node_tags(nodes);
+  }
+
+//! @brief Returns the coordinates of the nodes (one row for each node).
+XC::Matrix XC::Mesh::getNodeCoordinateArray(void)
+  {
+    std::vector<Node *> nodes;
+    get_node_ptrs(nodes);
+    return get_node_coordinates(nodes);
+  }
+
+//! @brief Returns the response of the nodes (one row for each node and
+//! one column for each DOF).
+//!
+//! @param response: disp, vel, accel or reaction.
+XC::Matrix XC::Mesh::getNodeResponseArray(const std::string &response)
+  {
+    std::vector<Node *> nodes;
+    get_node_ptrs(nodes);
+    return get_node_response(nodes,response);
+  }
+
+//! @brief Returns the displacements of the nodes (one row for each node).
+XC::Matrix XC::Mesh::getNodeDisplacementArray(void)
+  { return getNodeResponseArray("disp"); }
+
+//! @brief Returns the reactions of the nodes (one row for each node).
+//!
+//! The reactions are not computed here; call calculateNodalReactions
+//! after the analysis step, otherwise the values stored in the nodes
+//! (zero or outdated) are returned.
+XC::Matrix XC::Mesh::getNodeReactionArray(void)
+  { return getNodeResponseArray("reaction"); }
+
+//! @brief Returns the eigenvectors of the nodes for the mode being
+//! passed as parameter (one row for each node).
+XC::Matrix XC::Mesh::getNodeEigenvectorArray(const int &mode)
+  {
+    std::vector<Node *> nodes;
+    get_node_ptrs(nodes);
+    return get_node_eigenvectors(nodes,mode);
+  }
+
+//! @brief Returns the tags of the elements in the order of the rows of
+//! the element arrays (getElementResistingForceArray).
+XC::ID XC::Mesh::getElementTagArray(void)
+  {
+    std::vector<Element *> elements;
+    get_element_ptrs(elements);
+    return get_element_tags(elements);
+  }
+
+//! @brief Returns the resisting forces of the elements (one row for
+//! each element).
+XC::Matrix XC::Mesh::getElementResistingForceArray(void)
+  {
+    std::vector<Element *> elements;
+    get_element_ptrs(elements);
+    return get_element_resisting_forces(elements);
+  }
+
 //! @brief Returns the boundary of the finite element model.
 //!
 //! To return the bounding rectangle for the mesh. The information is
@@ -767,20 +868,102 @@ int XC::Mesh::setRayleighDampingFactors(const RayleighDampingFactors &rF)
     return result;
   }
 
+//! @brief Set the number of threads used to commit, update and
+//! revert the state of the mesh.
+//!
+//! If the number of threads is greater than one, the nodes and the
+//! thread safe elements (see Element::isThreadSafe) are processed
+//! concurrently, in contiguous chunks of the node and element arrays;
+//! the elements that are not thread safe are processed afterwards by
+//! the calling thread.
+//! @param n: number of threads (if zero, the number of concurrent
+//! threads supported by the hardware is used).
+void XC::Mesh::setNumThreads(const size_t &n)
+  {
+    if(n==0)
+      numThreads= getHardwareConcurrency();
+    else
+      numThreads= n;
+  }
+
+//! @brief Fill the node and element arrays used to split the work
+//! between threads (only if the mesh has changed since the last call).
+void XC::Mesh::build_arrays(void)
+  {
+    if(!arraysBuiltFlag)
+      {
+        nodeArray.clear();
+        nodeArray.reserve(getNumNodes());
+        Node *nodePtr= nullptr;
+        NodeIter &theNodeIter= this->getNodes();
+        while((nodePtr = theNodeIter()) != nullptr)
+          nodeArray.push_back(nodePtr);
+
+        parallelElements.clear();
+        serialElements.clear();
+        Element *elePtr= nullptr;
+        ElementIter &theElemIter= this->getElements();
+        while((elePtr = theElemIter()) != nullptr)
+          {
+            if(elePtr->isThreadSafe())
+              parallelElements.push_back(elePtr);
+            else
+              serialElements.push_back(elePtr);
+          }
+        arraysBuiltFlag= true;
+      }
+  }
+
+//! @brief Call the functions being passed as parameters on each node
+//! (if not null) and then on each element of the mesh. Returns the sum
+//! of the values returned by the element functions.
+int XC::Mesh::sweep(NodeStateFunction nodeFunction,ElementStateFunction elementFunction)
+  {
+    int ok= 0;
+    if(numThreads<2)
+      {
+        if(nodeFunction)
+          {
+            Node *nodePtr= nullptr;
+            NodeIter &theNodeIter= this->getNodes();
+            while((nodePtr = theNodeIter()) != nullptr)
+              (nodePtr->*nodeFunction)();
+          }
+        Element *elePtr= nullptr;
+        ElementIter &theElemIter= this->getElements();
+        while((elePtr = theElemIter()) != nullptr)
+          ok+= (elePtr->*elementFunction)();
+      }
+    else
+      {
+        build_arrays();
+        if(nodeFunction)
+          parallel_for(nodeArray.size(),numThreads,[&](size_t b,size_t e,size_t)
+            {
+              for(size_t i= b;i<e;i++)
+                (nodeArray[i]->*nodeFunction)();
+            });
+        std::vector<int> partialOk(numThreads,0);
+        parallel_for(parallelElements.size(),numThreads,[&](size_t b,size_t e,size_t t)
+          {
+            int tmp= 0;
+            for(size_t i= b;i<e;i++)
+              tmp+= (parallelElements[i]->*elementFunction)();
+            partialOk[t]= tmp;
+          });
+        for(std::vector<int>::const_iterator i= partialOk.begin();i!=partialOk.end();i++)
+          ok+= *i;
+        for(std::vector<Element *>::const_iterator i= serialElements.begin();i!=serialElements.end();i++)
+          ok+= ((*i)->*elementFunction)();
+      }
+    return ok;
+  }
+
 //! @brief Commits mesh state.
 int XC::Mesh::commit(void)
   {
     // invoke commit on all nodes and elements in the mesh
-    Node *nodePtr= nullptr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      { nodePtr->commitState(); }
-
-    Element *elePtr= nullptr;
-    ElementIter &theElemIter = this->getElements();
-    while((elePtr = theElemIter()) != 0)
-      { elePtr->commitState(); }
-
+    sweep(&Node::commitState,&Element::commitState);
     return 0;
   }
 
@@ -790,17 +973,7 @@ int XC::Mesh::revertToLastCommit(void)
     //
     // first invoke revertToLastCommit  on all nodes and elements in the mesh
     //
-
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToLastCommit();
-
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();
-    while((elePtr = theElemIter()) != 0)
-      { elePtr->revertToLastCommit(); }
-
+    sweep(&Node::revertToLastCommit,&Element::revertToLastCommit);
     return update();
   }
 
@@ -811,33 +984,20 @@ int XC::Mesh::revertToStart(void)
     // first invoke revertToStart  on all nodes and
     // elements in the mesh
     //
-
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToStart();
-
-    Element *elePtr;
-    ElementIter &theElements = this->getElements();
-    while((elePtr = theElements()) != 0)
-      { elePtr->revertToStart(); }
-
+    sweep(&Node::revertToStart,&Element::revertToStart);
     return update();
   }
 
 //! @brief Update the element's state.
 //! 
 //! Called by the domain to update the state of the
-//! mesh. Iterates over all the elements and invokes {\em update()}. 
+//! mesh. Iterates over all the elements and invokes {\em update()}
+//! (concurrently if the number of threads is greater than one,
+//! see setNumThreads).
 int XC::Mesh::update(void)
   {
-    int ok = 0;
-
     // invoke update on all the ele's
-    ElementIter &theEles = this->getElements();
-    Element *theEle;
-    while((theEle = theEles()) != 0)
-      { ok += theEle->update(); }
+    const int ok= sweep(nullptr,&Element::update);
 
     if(ok != 0)
       std::cerr << getClassName() << "::" << __FUNCTION__
@@ -852,6 +1012,8 @@ void XC::Mesh::setGraphBuiltFlags(const bool &f)
   {
     nodeGraphBuiltFlag= f;
     eleGraphBuiltFlag= f;
+    if(!f)
+      arraysBuiltFlag= false;
   }
 
 //! @brief Imprime el domain.
@@ -1175,11 +1337,25 @@ bool XC::Mesh::checkNodalReactions(const double &tol)
 //! @param tol: tolerance for the checking of reactions.
 int XC::Mesh::calculateNodalReactions(bool inclInertia, const double &tol)
   {
-    Node *theNode= nullptr;
-    NodeIter &theNodes = this->getNodes();
-    while((theNode = theNodes()) != nullptr)
-      { theNode->resetReactionForce(inclInertia); }
+    if(numThreads<2)
+      {
+        Node *theNode= nullptr;
+        NodeIter &theNodes = this->getNodes();
+        while((theNode = theNodes()) != nullptr)
+          { theNode->resetReactionForce(inclInertia); }
+      }
+    else
+      {
+        build_arrays();
+        parallel_for(nodeArray.size(),numThreads,[&](size_t b,size_t e,size_t)
+          {
+            for(size_t i= b;i<e;i++)
+              nodeArray[i]->resetReactionForce(inclInertia);
+          });
+      }
 
+    // the elements add its forces to the reactions of the nodes
+    // they share, so they are processed by the calling thread.
     Element *theElement= nullptr;
     ElementIter &theElements = this->getElements();
     while((theElement = theElements()) != 0)
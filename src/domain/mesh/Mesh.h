@@ -53,6 +53,8 @@ class ElementGraph;
 class FEM_ObjectBroker;
 class TaggedObjectStorage;
 class RayleighDampingFactors;
+class ID;
+class Matrix;
 
 //! @ingroup Dom
 //
@@ -85,6 +87,19 @@ class Mesh: public MeshComponentContainer
 
     NodeLockers lockers; //!< To block deactivated (dead) nodes.
 
+    size_t numThreads; //!< number of threads used to commit, update and revert the mesh state.
+    bool arraysBuiltFlag; //!< true if the component arrays are up to date.
+    std::vector<Node *> nodeArray; //!< mesh nodes.
+    std::vector<Element *> parallelElements; //!< thread safe elements.
+    std::vector<Element *> serialElements; //!< elements that are not thread safe.
+
+    typedef int (Node::*NodeStateFunction)(void);
+    typedef int (Element::*ElementStateFunction)(void);
+    void build_arrays(void);
+    int sweep(NodeStateFunction,ElementStateFunction);
+    void get_node_ptrs(std::vector<Node *> &);
+    void get_element_ptrs(std::vector<Element *> &);
+
     void alloc_containers(void);
     void alloc_iters(void);
     bool check_containers(void) const;
@@ -124,6 +139,12 @@ class Mesh: public MeshComponentContainer
 
     void setGraphBuiltFlags(const bool &f);
 
+    //! @brief Return the number of threads used to commit, update
+    //! and revert the state of the mesh.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
+
     int initialize(void);
     virtual int setRayleighDampingFactors(const RayleighDampingFactors &rF);
 
@@ -165,6 +186,16 @@ class Mesh: public MeshComponentContainer
     size_t getNumFreeNodes(void) const;
     virtual const Vector &getPhysicalBounds(void);
 
+    // methods to retrieve the results of all the nodes and elements at once
+    ID getNodeTagArray(void);
+    Matrix getNodeCoordinateArray(void);
+    Matrix getNodeResponseArray(const std::string &);
+    Matrix getNodeDisplacementArray(void);
+    Matrix getNodeReactionArray(void);
+    Matrix getNodeEigenvectorArray(const int &);
+    ID getElementTagArray(void);
+    Matrix getElementResistingForceArray(void);
+
     inline const std::vector<std::string> &getNombresCoordenadas(void) const
       { return nombresCoordenadas; }
     inline std::string getNombreUnidades(void) const
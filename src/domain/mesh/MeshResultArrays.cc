@@ -0,0 +1,164 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MeshResultArrays.cc
+
+#include "MeshResultArrays.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/Element.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+//! @brief Pointer to a method of Node that returns a vector.
+typedef const XC::Vector &(XC::Node::*NodeVectorGetter)(void) const;
+
+//! @brief Returns a matrix with one row for each node that contains the
+//! vector returned by the method (the rows of the nodes with fewer
+//! values are completed with zeros).
+XC::Matrix get_node_rows(const std::vector<XC::Node *> &nodes, NodeVectorGetter f)
+  {
+    const size_t numRows= nodes.size();
+    size_t numCols= 0;
+    for(std::vector<XC::Node *>::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      numCols= std::max(numCols,size_t(((*i)->*f)().Size()));
+    XC::Matrix retval(numRows,numCols);
+    double *data= retval.getDataPtr(); // stored by columns.
+    for(size_t i= 0;i<numRows;i++)
+      {
+        const XC::Vector &v= (nodes[i]->*f)();
+        const size_t sz= v.Size();
+        const double *src= v.getDataPtr();
+        for(size_t j= 0;j<sz;j++)
+          data[j*numRows+i]= src[j];
+      }
+    return retval;
+  }
+}
+
+//! @brief Returns the tags of the nodes.
+XC::ID XC::get_node_tags(const std::vector<Node *> &nodes)
+  {
+    const size_t sz= nodes.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= nodes[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns the coordinates of the nodes (one row for each node).
+XC::Matrix XC::get_node_coordinates(const std::vector<Node *> &nodes)
+  {
+    const Vector &(Node::*getCrds)(void) const= &Node::getCrds;
+    return get_node_rows(nodes,getCrds);
+  }
+
+//! @brief Returns the response of the nodes (one row for each node and
+//! one column for each DOF).
+//!
+//! @param nodes: nodes to query.
+//! @param response: disp, vel, accel or reaction.
+XC::Matrix XC::get_node_response(const std::vector<Node *> &nodes,const std::string &response)
+  {
+    NodeVectorGetter f= nullptr;
+    if(response=="disp")
+      f= &Node::getDisp;
+    else if(response=="vel")
+      f= &Node::getVel;
+    else if(response=="accel")
+      f= &Node::getAccel;
+    else if(response=="reaction")
+      f= &Node::getReaction;
+    if(f)
+      return get_node_rows(nodes,f);
+    std::cerr << __FUNCTION__ << "; response: '" << response
+              << "' unknown (disp, vel, accel, reaction)." << std::endl;
+    return Matrix();
+  }
+
+//! @brief Returns the eigenvector of the nodes for the mode being passed
+//! as parameter (one row for each node and one column for each DOF).
+//!
+//! @param nodes: nodes to query.
+//! @param mode: mode index (starting at 1).
+XC::Matrix XC::get_node_eigenvectors(const std::vector<Node *> &nodes,const int &mode)
+  {
+    const size_t numRows= nodes.size();
+    const int column= mode-1;
+    size_t numCols= 0;
+    for(std::vector<Node *>::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      numCols= std::max(numCols,size_t((*i)->getNumberDOF()));
+    Matrix retval(numRows,numCols);
+    double *data= retval.getDataPtr(); // stored by columns.
+    for(size_t i= 0;i<numRows;i++)
+      {
+        const Matrix &ev= nodes[i]->getEigenvectors();
+        if((column>=0) && (column<ev.noCols()))
+          {
+            const size_t sz= ev.noRows();
+            for(size_t j= 0;j<sz;j++)
+              data[j*numRows+i]= ev(j,column);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Returns the tags of the elements.
+XC::ID XC::get_element_tags(const std::vector<Element *> &elements)
+  {
+    const size_t sz= elements.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= elements[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns the resisting forces of the elements (one row for each
+//! element; the rows of the elements with fewer values are completed
+//! with zeros). The vector returned by getResistingForce can be shared
+//! by the elements of the same type, so it's copied as soon as it's
+//! computed.
+XC::Matrix XC::get_element_resisting_forces(const std::vector<Element *> &elements)
+  {
+    const size_t numRows= elements.size();
+    size_t numCols= 0;
+    for(std::vector<Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+      numCols= std::max(numCols,size_t((*i)->getNumDOF()));
+    Matrix retval(numRows,numCols);
+    double *data= retval.getDataPtr(); // stored by columns.
+    for(size_t i= 0;i<numRows;i++)
+      {
+        const Vector &v= elements[i]->getResistingForce();
+        const size_t sz= std::min(size_t(v.Size()),numCols);
+        const double *src= v.getDataPtr();
+        for(size_t j= 0;j<sz;j++)
+          data[j*numRows+i]= src[j];
+      }
+    return retval;
+  }
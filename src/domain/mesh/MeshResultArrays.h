@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MeshResultArrays.h
+
+#ifndef MeshResultArrays_h
+#define MeshResultArrays_h
+
+#include <vector>
+#include <string>
+
+namespace XC {
+class Node;
+class Element;
+class ID;
+class Matrix;
+
+//! @ingroup Mesh
+//
+//! @brief Bulk copy of node and element data into arrays (one row for
+//! each node or element) so the results of large meshes can be
+//! retrieved from Python without calling a method for each node. The
+//! returned matrices support the Python buffer protocol, so
+//! numpy.asarray can use their data without copying it.
+ID get_node_tags(const std::vector<Node *> &);
+Matrix get_node_coordinates(const std::vector<Node *> &);
+Matrix get_node_response(const std::vector<Node *> &,const std::string &);
+Matrix get_node_eigenvectors(const std::vector<Node *> &,const int &);
+ID get_element_tags(const std::vector<Element *> &);
+Matrix get_element_resisting_forces(const std::vector<Element *> &);
+
+} // end of XC namespace
+
+#endif
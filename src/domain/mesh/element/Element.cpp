@@ -82,14 +82,12 @@
 #include "utility/matrix/DqMatrices.h"
 #include "utility/matrix/DqVectors.h"
 #include "utility/tagged/DefaultTag.h"
+#include "utility/threads/ThreadWorkspace.h"
 
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 #include "utility/actor/actor/CommMetaData.h"
 #include "vtkCellType.h"
 
-std::deque<XC::Matrix> XC::Element::theMatrices;
-std::deque<XC::Vector> XC::Element::theVectors1;
-std::deque<XC::Vector> XC::Element::theVectors2;
 double XC::Element::dead_srf= 1e-6;//Stiffness reduction factor for dead (non active) elements.
 XC::DefaultTag XC::Element::defaultTag;
 
@@ -145,21 +143,11 @@ int XC::Element::setRayleighDampingFactors(const RayleighDampingFactors &rF) con
   {
     rayFactors= rF;
 
-    // check that memory has been allocated to store compute/return
-    // damping matrix & residual force calculations
+    // the memory used to compute/return damping matrix & residual
+    // force is taken from the workspace of the calling thread
+    // (see get_work_matrix).
     if(index == -1)
-      {
-        int numDOF = this->getNumDOF();
-
-        setup_matrices(theMatrices,numDOF);
-        if(theVectors1.size()<theMatrices.size())
-          {
-            Vector theVector1(numDOF);
-            Vector theVector2(numDOF);
-            theVectors1.push_back(theVector1);
-            theVectors2.push_back(theVector2);
-         }
-      }
+      index= 0;
     // if need storage for Kc go get it
     if(rayFactors.getBetaKc() != 0.0)
       Kc= Matrix(this->getTangentStiff());
@@ -222,6 +210,19 @@ void XC::Element::compute_damping_matrix(Matrix &theMatrix) const
 
 //! @brief Returns the damping matrix.
 //!
+//! @brief Return the scratch matrix (numDOF x numDOF) of the calling
+//! thread used to compute the mass and damping matrices.
+XC::Matrix &XC::Element::get_work_matrix(void) const
+  {
+    const size_t numDOF= getNumDOF();
+    return ThreadWorkspace::get().getMatrix(numDOF,numDOF);
+  }
+
+//! @brief Return the scratch vector (size numDOF) of the calling
+//! thread identified by the slot being passed as parameter.
+XC::Vector &XC::Element::get_work_vector(const size_t &slot) const
+  { return ThreadWorkspace::get().getVector(getNumDOF(),slot); }
+
 //! To return the damping matrix. The element is to compute its
 //! damping matrix based on the original location of the nodes and the
 //! current trial response quantities at the nodes. 
@@ -234,7 +235,7 @@ const XC::Matrix &XC::Element::getDamp(void) const
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // now compute the damping matrix
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= get_work_matrix();
     compute_damping_matrix(theMatrix);
     // return the computed matrix
     return theMatrix;
@@ -255,7 +256,7 @@ const XC::Matrix &XC::Element::getMass(void) const
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // zero the matrix & return it
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= get_work_matrix();
     theMatrix.Zero();
     return theMatrix;
   }
@@ -267,9 +268,9 @@ const XC::Vector &XC::Element::getResistingForceIncInertia(void) const
     if(index == -1)
       setRayleighDampingFactors(RayleighDampingFactors()); //Zeroes dumping factors.
 
-    Matrix &theMatrix= theMatrices[index];
-    Vector &theVector= theVectors2[index];
-    Vector &theVector2= theVectors1[index];
+    Matrix &theMatrix= get_work_matrix();
+    Vector &theVector= get_work_vector(1);
+    Vector &theVector2= get_work_vector(0);
 
     //
     // perform: R = P(U) - Pext(t);
@@ -391,9 +392,9 @@ const XC::Vector &XC::Element::getRayleighDampingForces(void) const
     if(index == -1)
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
-    Matrix &theMatrix= theMatrices[index];
-    Vector &theVector= theVectors2[index];
-    Vector &theVector2= theVectors1[index];
+    Matrix &theMatrix= get_work_matrix();
+    Vector &theVector= get_work_vector(1);
+    Vector &theVector2= get_work_vector(0);
 
     //
     // perform: R = (rayFactors.getAlphaM() * M + rayFactors.getBetaK0() * K0 + rayFactors.getBetaK() * K) * v
@@ -424,6 +425,18 @@ const XC::Vector &XC::Element::getRayleighDampingForces(void) const
 bool XC::Element::isSubdomain(void)
   { return false; }
 
+//! @brief Returns true if the element state determination (tangent
+//! stiffness and resisting force computation) can run concurrently
+//! with the one of other elements.
+//!
+//! That's true only if the computation modifies no data shared with other
+//! objects (class wide matrices and vectors, shared materials,...). The
+//! default implementation returns false, so the element is processed
+//! by the calling thread during parallel assembly (see
+//! IncrementalIntegrator::setNumThreads).
+bool XC::Element::isThreadSafe(void) const
+  { return false; }
+
 //! setResponse() is a method invoked to determine if the element
 //! will respond to a request for a certain of information. The
 //! information requested of the element is passed in the array of char
@@ -508,7 +521,7 @@ const XC::Matrix &XC::Element::getDampSensitivity(int gradNumber)
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // now compute the damping matrix
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= get_work_matrix();
     theMatrix.Zero();
     if(rayFactors.getAlphaM() != 0.0)
       theMatrix.addMatrix(0.0, this->getMassSensitivity(gradNumber), rayFactors.getAlphaM());
@@ -544,48 +557,7 @@ int XC::Element::addResistingForceToNodalReaction(bool inclInertia)
     NodePtrs &theNodes= getNodePtrs();
 
     //
-    // first we create the nodes in static arrays as presume
-    // we are going to do this many times & save new/delete
-    //
-    if(nodeIndex == -1)
-      {
-        int numLastDOF = -1;
-        const size_t numMatrices= theMatrices.size();
-        for(int i=0; i<numNodes; i++)
-          {
-            const int numNodalDOF = theNodes[i]->getNumberDOF();
-
-            if(numNodalDOF != 0 && numNodalDOF != numLastDOF)
-              {
-                // see if an existing vector will do
-                size_t j;
-                for(j=0; j<numMatrices; j++)
-                  {
-                    if(theVectors1[j].Size() == numNodalDOF)
-                    nodeIndex = j;
-                    j = numMatrices+2;
-                  }
-
-                // if not we need to enlarge the bool of temp vectors, matrices
-                if(j != (numMatrices+2))
-                  {
-                    Matrix theMatrix(numNodalDOF, numNodalDOF);
-                    theMatrices.push_back(theMatrix);
-
-                    Vector theVector1(numNodalDOF);
-                    Vector theVector2(numNodalDOF);
-                    theVectors1.push_back(theVector1);
-                    theVectors2.push_back(theVector2);
-
-                    nodeIndex= numMatrices;
-                  }
-              }
-            numLastDOF = numNodalDOF;
-          }
-      }
-
-    //
-    // now determine the resisting force
+    // determine the resisting force
     //
 
     const Vector *theResistingForce= nullptr;
@@ -594,35 +566,20 @@ int XC::Element::addResistingForceToNodalReaction(bool inclInertia)
     else
       theResistingForce= &(getResistingForceIncInertia());
 
-    if(nodeIndex == -1)
-      {
-        std::cerr << getClassName() << "::" << __FUNCTION__
-	          << "; HUH!\n";
-        return -1;
-      }
-
     //
     // iterate over the elements nodes; determine nodes contribution & add it
+    // (the vectors are taken from the workspace of the calling thread).
     //
 
     int nodalDOFCount = 0;
 
-    const size_t numMatrices= theMatrices.size();
+    ThreadWorkspace &workspace= ThreadWorkspace::get();
     for(int i=0; i<numNodes; i++)
       {
         Node *theNode= theNodes[i];
 
-        int numNodalDOF= theNode->getNumberDOF();
-        Vector &theVector= theVectors1[nodeIndex];
-        if(theVector.Size() != numNodalDOF)
-          {
-            for(size_t j=0; j<numMatrices; j++)
-            if(theVectors1[j].Size() == numNodalDOF)
-              {
-                j = numMatrices;
-                theVector= theVectors1[j];
-              }
-          }
+        const int numNodalDOF= theNode->getNumberDOF();
+        Vector &theVector= workspace.getVector(numNodalDOF);
         for(int j=0; j<numNodalDOF; j++)
           {
             theVector(j) = (*theResistingForce)(nodalDOFCount);
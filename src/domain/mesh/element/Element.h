@@ -118,10 +118,8 @@ class Element: public MeshComponent
   private:
     int nodeIndex;
 
-    static std::deque<Matrix> theMatrices;
-    static std::deque<Vector> theVectors1;
-    static std::deque<Vector> theVectors2;
-
+    Matrix &get_work_matrix(void) const;
+    Vector &get_work_vector(const size_t &) const;
     void compute_damping_matrix(Matrix &) const;
     static DefaultTag defaultTag; //<! default tag for next new element.
   protected:
@@ -176,6 +174,7 @@ class Element: public MeshComponent
     virtual int revertToStart(void);
     virtual int update(void);
     virtual bool isSubdomain(void);
+    virtual bool isThreadSafe(void) const;
 
     // methods to return the current linearized stiffness,
     // damping and mass matrices
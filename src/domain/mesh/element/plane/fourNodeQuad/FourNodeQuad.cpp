@@ -71,10 +71,10 @@
 
 
 
-double XC::FourNodeQuad::matrixData[64];
-XC::Matrix XC::FourNodeQuad::K(matrixData, 8, 8);
-XC::Vector XC::FourNodeQuad::P(8);
-double XC::FourNodeQuad::shp[3][4]; //Values of shape functions.
+thread_local double XC::FourNodeQuad::matrixData[64];
+thread_local XC::Matrix XC::FourNodeQuad::K(matrixData, 8, 8);
+thread_local XC::Vector XC::FourNodeQuad::P(8);
+thread_local double XC::FourNodeQuad::shp[3][4]; //Values of shape functions.
 
 //! @brief Constructor.
 XC::FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
@@ -138,7 +138,7 @@ int XC::FourNodeQuad::update(void)
     const Vector &disp3 = theNodes[2]->getTrialDisp();
     const Vector &disp4 = theNodes[3]->getTrialDisp();
 
-    static double u[2][4];
+    static thread_local double u[2][4];
 
     u[0][0] = disp1(0);
     u[1][0] = disp1(1);
@@ -149,7 +149,7 @@ int XC::FourNodeQuad::update(void)
     u[0][3] = disp4(0);
     u[1][3] = disp4(1);
 
-    static XC::Vector eps(3);
+    static thread_local XC::Vector eps(3);
 
     int ret = 0;
 
@@ -176,6 +176,10 @@ int XC::FourNodeQuad::update(void)
     return ret;
   }
 
+//! @brief Return true if the materials of the element are thread safe.
+bool XC::FourNodeQuad::isThreadSafe(void) const
+  { return physicalProperties.getMaterialsVector().isThreadSafe(); }
+
 //! @brief Return the tangent stiffness matrix.
 const XC::Matrix &XC::FourNodeQuad::getTangentStiff(void) const
   {
@@ -293,7 +297,7 @@ const XC::Matrix &XC::FourNodeQuad::getMass(void) const
   {
     K.Zero();
 
-    static Vector rhoi(4);
+    static thread_local Vector rhoi(4);
     rhoi= physicalProperties.getRhoi();
     double sum = this->physicalProperties.getRho();
     for(int i= 0;i<rhoi.Size();i++)
@@ -342,7 +346,7 @@ int XC::FourNodeQuad::addLoad(ElementalLoad *theLoad, double loadFactor)
 //! @brief Adds inertia loads.
 int XC::FourNodeQuad::addInertiaLoadToUnbalance(const XC::Vector &accel)
   {
-    static Vector rhoi(4);
+    static thread_local Vector rhoi(4);
     rhoi= physicalProperties.getRhoi();
     double sum = this->physicalProperties.getRho();
     for(int i= 0;i<rhoi.Size();i++)
@@ -363,7 +367,7 @@ int XC::FourNodeQuad::addInertiaLoadToUnbalance(const XC::Vector &accel)
         return -1;
       }
 
-    static double ra[8];
+    static thread_local double ra[8];
 
     ra[0] = Raccel1(0);
     ra[1] = Raccel1(1);
@@ -438,7 +442,7 @@ const XC::Vector &XC::FourNodeQuad::getResistingForce(void) const
 //! inertia.
 const XC::Vector &XC::FourNodeQuad::getResistingForceIncInertia(void) const
   {
-    static Vector rhoi(4);
+    static thread_local Vector rhoi(4);
     rhoi= physicalProperties.getRhoi();
     double sum = this->physicalProperties.getRho();
     for(int i= 0;i<rhoi.Size();i++)
@@ -459,7 +463,7 @@ const XC::Vector &XC::FourNodeQuad::getResistingForceIncInertia(void) const
     const XC::Vector &accel3 = theNodes[2]->getTrialAccel();
     const XC::Vector &accel4 = theNodes[3]->getTrialAccel();
 
-    static double a[8];
+    static thread_local double a[8];
 
     a[0] = accel1(0);
     a[1] = accel1(1);
@@ -79,10 +79,10 @@ class FourNodeQuad: public QuadBase4N<SolidMech2D>
     double pressure; //!< Normal surface traction (pressure) over entire element (note: positive for outward normal).
     mutable Matrix *Ki;
 
-    static double matrixData[64]; //!< array data for matrix
-    static Matrix K; //!< Element stiffness, damping, and mass Matrix
-    static Vector P; //!< Element resisting force vector
-    static double shp[3][4]; //!< Stores shape functions and derivatives (overwritten)
+    static thread_local double matrixData[64]; //!< array data for matrix
+    static thread_local Matrix K; //!< Element stiffness, damping, and mass Matrix
+    static thread_local Vector P; //!< Element resisting force vector
+    static thread_local double shp[3][4]; //!< Stores shape functions and derivatives (overwritten)
 
     // private member functions - only objects of this class can call these
     double shapeFunction(const GaussPoint &gp) const;
@@ -104,6 +104,7 @@ class FourNodeQuad: public QuadBase4N<SolidMech2D>
 
     // public methods to set the state of the element    
     int update(void);
+    bool isThreadSafe(void) const;
 
     // public methods to obtain stiffness, mass, damping and residual information    
     const Matrix &getTangentStiff(void) const;
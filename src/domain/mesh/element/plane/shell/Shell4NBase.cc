@@ -75,9 +75,9 @@
 
 
 //static data
-XC::Matrix XC::Shell4NBase::stiff(24,24);
-XC::Vector XC::Shell4NBase::resid(24);
-XC::Matrix XC::Shell4NBase::mass(24,24);
+thread_local XC::Matrix XC::Shell4NBase::stiff(24,24);
+thread_local XC::Vector XC::Shell4NBase::resid(24);
+thread_local XC::Matrix XC::Shell4NBase::mass(24,24);
 
 //! @brief Releases memory.
 void XC::Shell4NBase::free_mem(void)
@@ -141,7 +141,7 @@ const XC::ShellUniformLoad *XC::Shell4NBase::vector3dUniformLoadLocal(const Vect
     if(preprocessor)
       {
         MapLoadPatterns &lPatterns= preprocessor->getLoadHandler().getLoadPatterns();
-        static ID eTags(1);
+        static thread_local ID eTags(1);
         eTags[0]= getTag(); //Load for this element.
         const int &loadTag= lPatterns.getCurrentElementLoadTag(); //Load identifier.
 
@@ -194,7 +194,7 @@ void XC::Shell4NBase::strainLoad(const Matrix &strains)
     if(preprocessor)
       {
         MapLoadPatterns &lPatterns= preprocessor->getLoadHandler().getLoadPatterns();
-        static ID eTags(1);
+        static thread_local ID eTags(1);
         eTags[0]= getTag(); //Load for this element.
         const int &loadTag= lPatterns.getCurrentElementLoadTag(); //Load identifier.
         LoadPattern *lp= lPatterns.getCurrentLoadPatternPtr();
@@ -280,6 +280,10 @@ int XC::Shell4NBase::update(void)
     return QuadBase4N<SectionFDPhysicalProperties>::update();
   }
 
+//! @brief Return true if the sections of the element are thread safe.
+bool XC::Shell4NBase::isThreadSafe(void) const
+  { return (theCoordTransf && physicalProperties.getMaterialsVector().isThreadSafe()); }
+
 //! @brief return stiffness matrix
 const XC::Matrix &XC::Shell4NBase::getTangentStiff(void) const
   {
@@ -373,7 +377,7 @@ XC::Vector XC::Shell4NBase::getInterpolationFactors(const ParticlePos3d &pos) co
     static const int massIndex= nShape - 1;
 
     double xsj;  // determinant of the jacobian matrix
-    static double shp[nShape][numberNodes];  //shape functions at a gauss point
+    static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
     Vector retval(numberNodes);
 
 
@@ -461,8 +465,8 @@ void XC::Shell4NBase::formInertiaTerms( int tangFlag ) const
 
     double xsj;  // determinant of the jacobian matrix
     double dvol; //volume element
-    static double shp[nShape][numberNodes];  //shape functions at a gauss point
-    static Vector momentum(ndf);
+    static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
+    static thread_local Vector momentum(ndf);
 
 
     double temp, rhoH, massJK;
@@ -554,7 +558,7 @@ void XC::Shell4NBase::shape2d(const double &ss, const double &tt,const double x[
     static const double s[]= { -0.5,  0.5, 0.5, -0.5 };
     static const double t[]= { -0.5, -0.5, 0.5,  0.5 };
 
-    static double xs[2][2];
+    static thread_local double xs[2][2];
 
     for(int i= 0; i < 4; i++ )
       {
@@ -59,10 +59,10 @@ class Shell4NBase : public QuadBase4N<SectionFDPhysicalProperties>
 
 
     //static data
-    static Matrix stiff;
-    static Vector resid;
-    static Matrix mass;
-    static Matrix damping;
+    static thread_local Matrix stiff;
+    static thread_local Vector resid;
+    static thread_local Matrix mass;
+    static thread_local Matrix damping;
 
     void formInertiaTerms(int tangFlag) const;
     virtual void formResidAndTangent(int tang_flag) const= 0;
@@ -86,6 +86,8 @@ class Shell4NBase : public QuadBase4N<SectionFDPhysicalProperties>
     int getNumDOF(void) const;
 	
     int update(void);
+	
+    bool isThreadSafe(void) const;
 
     //return stiffness matrix 
     const Matrix &getTangentStiff(void) const;
@@ -160,8 +160,13 @@ XC::ParticlePos3d XC::ShellCrdTransf3dBase::getNaturalCoordinates(const Pos3d &p
 
 //! @brief Return the transformation matrix.
 XC::Matrix XC::ShellCrdTransf3dBase::getTrfMatrix(void) const
+  { return getFixedTrfMatrix().getMatrix(); }
+
+//! @brief Return the transformation matrix (stack storage,
+//! used in the computations).
+XC::FixedMatrix<3,3> XC::ShellCrdTransf3dBase::getFixedTrfMatrix(void) const
   {
-    Matrix R(3,3);
+    FixedMatrix<3,3> R;
     // Fill in transformation matrix
     R(0,0)= g1(0); R(0,1)= g1(1); R(0,2)= g1(2);
     R(1,0)= g2(0); R(1,1)= g2(1); R(1,2)= g2(2);
@@ -169,10 +174,13 @@ XC::Matrix XC::ShellCrdTransf3dBase::getTrfMatrix(void) const
     return R;
   }
 
-//! @brief Returns the vector in global coordinates.
-XC::Vector XC::ShellCrdTransf3dBase::local_to_global(const Matrix &R,const Vector &pl) const
+//! @brief Computes the vector in global coordinates.
+//!
+//! @param R: transformation matrix.
+//! @param pl: vector in local coordinates.
+//! @param retval: vector in global coordinates.
+void XC::ShellCrdTransf3dBase::local_to_global(const FixedMatrix<3,3> &R,const Vector &pl,Vector &retval) const
   {
-    Vector retval(24);
     //Node 1.
     retval(0)= R(0,0)*pl[0] + R(1,0)*pl[1] + R(2,0)*pl[2];
     retval(1)= R(0,1)*pl[0] + R(1,1)*pl[1] + R(2,1)*pl[2];
@@ -208,14 +216,16 @@ XC::Vector XC::ShellCrdTransf3dBase::local_to_global(const Matrix &R,const Vecto
     retval(21)= R(0,0)*pl[21] + R(1,0)*pl[22] + R(2,0)*pl[23];
     retval(22)= R(0,1)*pl[21] + R(1,1)*pl[22] + R(2,1)*pl[23];
     retval(23)= R(0,2)*pl[21] + R(1,2)*pl[22] + R(2,2)*pl[23];
-
-    return retval;
   }
 
-//! @brief Returns the matrix in global coordinates.
-XC::Matrix XC::ShellCrdTransf3dBase::local_to_global(const Matrix &R,const Matrix &kl) const
+//! @brief Computes the matrix in global coordinates.
+//!
+//! @param R: transformation matrix.
+//! @param kl: matrix in local coordinates.
+//! @param retval: matrix in global coordinates.
+void XC::ShellCrdTransf3dBase::local_to_global(const FixedMatrix<3,3> &R,const Matrix &kl,Matrix &retval) const
   {
-    static Matrix tmp(24,24);
+    static thread_local Matrix tmp(24,24);
 
     // Transform local matrix to global system
     // First compute kl*T_{lg}
@@ -254,7 +264,6 @@ XC::Matrix XC::ShellCrdTransf3dBase::local_to_global(const Matrix &R,const Matri
         tmp(m,23)= kl(m,21)*R(0,2) + kl(m,22)*R(1,2) + kl(m,23)*R(2,2);
       }
 
-    Matrix retval(24,24); // Global matrix for return
     // Now compute T'_{lg}*(kl*T_{lg})
     for(int m = 0;m<24;m++)
       {
@@ -290,7 +299,6 @@ XC::Matrix XC::ShellCrdTransf3dBase::local_to_global(const Matrix &R,const Matri
         retval(22,m) = R(0,1)*tmp(21,m) + R(1,1)*tmp(22,m) + R(2,1)*tmp(23,m);
         retval(23,m) = R(0,2)*tmp(21,m) + R(1,2)*tmp(22,m) + R(2,2)*tmp(23,m);
       }
-    return retval;
   }
 
 //! @brief Return the tangent stiffness matrix expressed in
@@ -308,8 +316,8 @@ void XC::ShellCrdTransf3dBase::getGlobalResidAndTangent(Vector &resid,Matrix &st
 //! @brief Returns the vector expressed in global coordinates.
 const XC::Vector &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const Vector &localCoords) const
   {
-    const Matrix &R= getTrfMatrix();
-    static Vector retval(3);
+    const FixedMatrix<3,3> R= getFixedTrfMatrix();
+    static thread_local Vector retval(3);
     // retval = Rlj'*localCoords (Multiplica el vector por R traspuesta).
     retval(0)= R(0,0)*localCoords(0) + R(1,0)*localCoords(1) + R(2,0)*localCoords(2);
     retval(1)= R(0,1)*localCoords(0) + R(1,1)*localCoords(1) + R(2,1)*localCoords(2);
@@ -320,8 +328,8 @@ const XC::Vector &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const
 //! @brief Returns the vectors expressed in global coordinates.
 const XC::Matrix &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const Matrix &localCoords) const
   {
-    const Matrix &R= getTrfMatrix();
-    static Matrix retval;
+    const FixedMatrix<3,3> R= getFixedTrfMatrix();
+    static thread_local Matrix retval;
     const size_t numPts= localCoords.noRows(); //Number of vectors to transform
     retval.resize(numPts,3);
     for(size_t i= 0;i<numPts;i++)
@@ -337,8 +345,8 @@ const XC::Matrix &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const
 //! @brief Returns the vector expresado en local coordinates.
 const XC::Vector &XC::ShellCrdTransf3dBase::getVectorLocalCoordFromGlobal(const Vector &globalCoords) const
   {
-    static Vector vectorCoo(3);
-    const Matrix &R= getTrfMatrix();
+    static thread_local Vector vectorCoo(3);
+    const FixedMatrix<3,3> R= getFixedTrfMatrix();
     vectorCoo[0]= R(0,0)*globalCoords[0] + R(0,1)*globalCoords[1] + R(0,2)*globalCoords[2];
     vectorCoo[1]= R(1,0)*globalCoords[0] + R(1,1)*globalCoords[1] + R(1,2)*globalCoords[2];
     vectorCoo[2]= R(2,0)*globalCoords[0] + R(2,1)*globalCoords[1] + R(2,2)*globalCoords[2];
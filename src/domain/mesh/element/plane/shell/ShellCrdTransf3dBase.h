@@ -32,6 +32,7 @@
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include "utility/actor/actor/MovableObject.h"
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/FixedMatrix.h"
 #include "domain/mesh/element/utils/ParticlePos3d.h"
 
 class Plane;
@@ -57,8 +58,9 @@ class ShellCrdTransf3dBase: public CommandEntity, public MovableObject
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
 
-    Vector local_to_global(const Matrix &,const Vector &) const;
-    Matrix local_to_global(const Matrix &,const Matrix &) const;
+    FixedMatrix<3,3> getFixedTrfMatrix(void) const;
+    void local_to_global(const FixedMatrix<3,3> &,const Vector &,Vector &) const;
+    void local_to_global(const FixedMatrix<3,3> &,const Matrix &,Matrix &) const;
 
   public:
     ShellCrdTransf3dBase(void);
@@ -74,7 +74,7 @@
 
 
 //static data
-XC::ShellBData XC::ShellMITC4Base::BData;
+thread_local XC::ShellBData XC::ShellMITC4Base::BData;
 
 //! @brief Constructor
 XC::ShellMITC4Base::ShellMITC4Base(int classTag, const ShellCrdTransf3dBase *crdTransf)
@@ -97,8 +97,8 @@ void XC::ShellMITC4Base::setDomain(Domain *theDomain)
   {
     Shell4NBase::setDomain(theDomain);
 
-    static Vector eig(3);
-    static Matrix ddMembrane(3,3);
+    static thread_local Vector eig(3);
+    static thread_local Matrix ddMembrane(3,3);
 
     //compute drilling stiffness penalty parameter
     const Matrix &dd= physicalProperties[0]->getInitialTangent();
@@ -159,7 +159,7 @@ void XC::ShellMITC4Base::alive(void)
   }
 
 //! @brief Computes the matrix G.
-const XC::Matrix XC::ShellMITC4Base::calculateG(void) const
+XC::FixedMatrix<4,12> XC::ShellMITC4Base::calculateG(void) const
   {
     const double dx34= xl[0][2]-xl[0][3];
     const double dy34= xl[1][2]-xl[1][3];
@@ -173,8 +173,7 @@ const XC::Matrix XC::ShellMITC4Base::calculateG(void) const
     const double dx41= xl[0][3]-xl[0][0];
     const double dy41= xl[1][3]-xl[1][0];
 
-    Matrix G(4,12);
-    G.Zero();
+    FixedMatrix<4,12> G;
     double one_over_four= 0.25;
     G(0,0)=-0.5;
     G(0,1)=-dy41*one_over_four;
@@ -219,43 +218,41 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
 
     double volume= 0.0;
 
-    static double xsj;  // determinant of the jacobian matrix 
-    static double dvol[ngauss]; //volume element
-    static double shp[3][numnodes];  //shape functions at a gauss point
+    static thread_local double xsj;  // determinant of the jacobian matrix 
+    static thread_local double dvol[ngauss]; //volume element
+    static thread_local double shp[3][numnodes];  //shape functions at a gauss point
 
     //  static double Shape[3][numnodes][ngauss]; //all the shape functions
 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Matrix dd(nstress,nstress);  //material tangent
-    static Matrix J0(2,2);  //Jacobian at center
-    static Matrix J0inv(2,2); //inverse of Jacobian at center
+    static thread_local Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
+    static thread_local Matrix dd(nstress,nstress);  //material tangent
+    static thread_local Matrix J0(2,2);  //Jacobian at center
+    static thread_local Matrix J0inv(2,2); //inverse of Jacobian at center
 
     //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
+    static thread_local Matrix BJ(nstress,ndf);      // B matrix node J
+    static thread_local Matrix BJtran(ndf,nstress);
+    static thread_local Matrix BK(nstress,ndf);      // B matrix node k
+    static thread_local Matrix BJtranD(ndf,nstress);
+    static thread_local Matrix Bbend(3,3);  // bending B matrix
+    static thread_local Matrix Bshear(2,3); // shear B matrix
+    static thread_local Matrix Bmembrane(3,2); // membrane B matrix
+    static thread_local double BdrillJ[ndf]; //drill B matrix
+    static thread_local double BdrillK[ndf];  
 
     double *drillPointer;
 
-    static double saveB[nstress][ndf][numnodes];
+    static thread_local double saveB[nstress][ndf][numnodes];
 
     //-------------------------------------------------------
 
     stiff.Zero( );
  
-    Matrix G= calculateG();
+    const FixedMatrix<4,12> G= calculateG();
 
 
-    Matrix Ms(2,4);
-    Ms.Zero();
-    Matrix Bsv(2,12);
-    Bsv.Zero();
+    FixedMatrix<2,4> Ms;
+    FixedMatrix<2,12> Bsv;
 
     const double Ax= -xl[0][0]+xl[0][1]+xl[0][2]-xl[0][3];
     const double Bx=  xl[0][0]-xl[0][1]+xl[0][2]-xl[0][3];
@@ -267,13 +264,12 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
 
     double alph= atan2(Ay,Ax);
     double beta= 3.141592653589793/2-atan2(Cx,Cy);
-    Matrix Rot(2,2);
-    Rot.Zero();
+    FixedMatrix<2,2> Rot;
     Rot(0,0)=sin(beta);
     Rot(0,1)=-sin(alph);
     Rot(1,0)=-cos(beta);
     Rot(1,1)=cos(alph);
-    Matrix Bs(2,12);
+    FixedMatrix<2,12> Bs;
   
     double r1= 0;
     double r2= 0;
@@ -479,7 +475,7 @@ const XC::Vector &XC::ShellMITC4Base::getResistingForce(void) const
 //! @brief get residual with inertia terms
 const XC::Vector &XC::ShellMITC4Base::getResistingForceIncInertia(void) const
   {
-    static Vector res(24);
+    static thread_local Vector res(24);
     res= getResistingForce();
 
     formInertiaTerms(0);
@@ -545,36 +541,36 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
     
     double volume= 0.0;
 
-    static double xsj;  // determinant jacaobian matrix 
-    static double dvol[ngauss]; //volume element
-    static Vector strain(nstress);  //strain
-    static double shp[3][numnodes];  //shape functions at a gauss point
+    static thread_local double xsj;  // determinant jacaobian matrix 
+    static thread_local double dvol[ngauss]; //volume element
+    static thread_local Vector strain(nstress);  //strain
+    static thread_local double shp[3][numnodes];  //shape functions at a gauss point
 
     //  static double Shape[3][numnodes][ngauss]; //all the shape functions
-    static Vector residJ(ndf); //nodeJ residual 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Vector stress(nstress);  //stress resultants
-    static Matrix dd(nstress,nstress);  //material tangent
-    static Matrix J0(2,2);  //Jacobian at center
-    static Matrix J0inv(2,2); //inverse of Jacobian at center
+    static thread_local Vector residJ(ndf); //nodeJ residual 
+    static thread_local Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
+    static thread_local Vector stress(nstress);  //stress resultants
+    static thread_local Matrix dd(nstress,nstress);  //material tangent
+    static thread_local Matrix J0(2,2);  //Jacobian at center
+    static thread_local Matrix J0inv(2,2); //inverse of Jacobian at center
 
     double epsDrill= 0.0;  //drilling "strain"
     double tauDrill= 0.0; //drilling "stress"
 
     //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
+    static thread_local Matrix BJ(nstress,ndf);      // B matrix node J
+    static thread_local Matrix BJtran(ndf,nstress);
+    static thread_local Matrix BK(nstress,ndf);      // B matrix node k
+    static thread_local Matrix BJtranD(ndf,nstress);
+    static thread_local Matrix Bbend(3,3);  // bending B matrix
+    static thread_local Matrix Bshear(2,3); // shear B matrix
+    static thread_local Matrix Bmembrane(3,2); // membrane B matrix
+    static thread_local double BdrillJ[ndf]; //drill B matrix
+    static thread_local double BdrillK[ndf];  
 
     double *drillPointer;
 
-    static double saveB[nstress][ndf][numnodes];
+    static thread_local double saveB[nstress][ndf][numnodes];
 
     //------------------------------------------------------- 
 
@@ -582,12 +578,10 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
     stiff.Zero( );
     resid.Zero( );
 
-    const Matrix G= calculateG();
+    const FixedMatrix<4,12> G= calculateG();
 
-    Matrix Ms(2,4);
-    Ms.Zero();
-    Matrix Bsv(2,12);
-    Bsv.Zero();
+    FixedMatrix<2,4> Ms;
+    FixedMatrix<2,12> Bsv;
 
     const double Ax= -xl[0][0]+xl[0][1]+xl[0][2]-xl[0][3];
     const double Bx=  xl[0][0]-xl[0][1]+xl[0][2]-xl[0][3];
@@ -599,13 +593,12 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
 
     const double alph= atan2(Ay,Ax);
     const double beta= 3.141592653589793/2-atan2(Cx,Cy);
-    Matrix Rot(2,2);
-    Rot.Zero();
+    FixedMatrix<2,2> Rot;
     Rot(0,0)=sin(beta);
     Rot(0,1)=-sin(alph);
     Rot(1,0)=-cos(beta);
     Rot(1,1)=cos(alph);
-    Matrix Bs(2,12);
+    FixedMatrix<2,12> Bs;
     
     double r1= 0;
     double r2= 0;
@@ -801,11 +794,11 @@ double *XC::ShellMITC4Base::computeBdrill( int node, const double shp[3][4]) con
   {
 
     //static Matrix Bdrill(1,6);
-    static double Bdrill[6];
+    static thread_local double Bdrill[6];
 
-    static double B1;
-    static double B2;
-    static double B6;
+    static thread_local double B1;
+    static thread_local double B2;
+    static thread_local double B6;
 
 
 //---Bdrill Matrix in standard {1,2,3} mechanics notation---------
@@ -848,7 +841,7 @@ double *XC::ShellMITC4Base::computeBdrill( int node, const double shp[3][4]) con
 const XC::Matrix &XC::ShellMITC4Base::computeBmembrane( int node, const double shp[3][4] ) const
   {
 
-    static Matrix Bmembrane(3,2);
+    static thread_local Matrix Bmembrane(3,2);
 
 //---Bmembrane matrix in standard {1,2,3} mechanics notation---------
 //
@@ -878,12 +871,12 @@ const XC::Matrix &XC::ShellMITC4Base::computeBmembrane( int node, const double s
 const XC::Matrix &XC::ShellMITC4Base::assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const
   {
 
-    static Matrix B(8,6);
-    static Matrix BmembraneShell(3,3);
-    static Matrix BbendShell(3,3);
-    static Matrix BshearShell(2,6);
-    static Matrix Gmem(2,3);
-    static Matrix Gshear(3,6);
+    static thread_local Matrix B(8,6);
+    static thread_local Matrix BmembraneShell(3,3);
+    static thread_local Matrix BbendShell(3,3);
+    static thread_local Matrix BshearShell(2,6);
+    static thread_local Matrix Gmem(2,3);
+    static thread_local Matrix Gshear(3,6);
 
 //
 // For Shell :
@@ -982,7 +975,7 @@ const XC::Matrix &XC::ShellMITC4Base::assembleB(const Matrix &Bmembrane, const M
 const XC::Matrix &XC::ShellMITC4Base::computeBbend( int node, const double shp[3][4] ) const
   {
 
-      static XC::Matrix Bbend(3,2);
+      static thread_local XC::Matrix Bbend(3,2);
 
 //---Bbend matrix in standard {1,2,3} mechanics notation---------
 //
@@ -30,6 +30,7 @@
 #define ShellMITC4Base_h
 
 #include "Shell4NBase.h"
+#include "utility/matrix/FixedMatrix.h"
 
 namespace XC {
 
@@ -43,14 +44,14 @@ class ShellMITC4Base : public Shell4NBase
     FVectorShell p0; //!< Reactions in the basic system due to element loads
     std::vector<Vector> inicDisp; //!< Initial displacements.
 
-    static ShellBData BData; //!< B-bar data
+    static thread_local ShellBData BData; //!< B-bar data
 
     void setupInicDisp(void);
     void capturaInicDisp(void);
     void zeroInicDisp(void);
 
     void formResidAndTangent(int tang_flag) const;
-    const Matrix calculateG(void) const;
+    FixedMatrix<4,12> calculateG(void) const;
     double *computeBdrill(int node, const double shp[3][4]) const;
     const Matrix& assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const;
     const Matrix& computeBmembrane(int node, const double shp[3][4] ) const;
@@ -74,9 +74,9 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::Matrix XC::ElasticBeam3d::K(12,12);
-XC::Vector XC::ElasticBeam3d::P(12);
-XC::Matrix XC::ElasticBeam3d::kb(6,6);
+thread_local XC::Matrix XC::ElasticBeam3d::K(12,12);
+thread_local XC::Vector XC::ElasticBeam3d::P(12);
+thread_local XC::Matrix XC::ElasticBeam3d::kb(6,6);
 
 void XC::ElasticBeam3d::set_transf(const CrdTransf *trf)
   {
@@ -265,7 +265,7 @@ int XC::ElasticBeam3d::setInitialSectionDeformation(const Vector &def)
 //! @brief Return the section generalized strain.
 const XC::Vector &XC::ElasticBeam3d::getSectionDeformation(void) const
   {
-    static Vector retval(5);
+    static thread_local Vector retval(5);
     theCoordTransf->update();
     const double L = theCoordTransf->getInitialLength();
     // retval(0)= dx2-dx1: Element elongation/L.
@@ -348,7 +348,7 @@ const XC::Matrix &XC::ElasticBeam3d::getTangentStiff(void) const
     kb(4,3) = kb(3,4)= EIy2/L;
     kb(5,5) = GJ/L;
 
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= theCoordTransf->getGlobalStiffMatrix(kb,q);
     if(isDead())
       retval*=dead_srf;
@@ -356,6 +356,11 @@ const XC::Matrix &XC::ElasticBeam3d::getTangentStiff(void) const
     return retval;
   }
 
+//! @brief Return true; the element scratch matrices and those of
+//! the coordinate transformation are per-thread objects.
+bool XC::ElasticBeam3d::isThreadSafe(void) const
+  { return (theCoordTransf!=nullptr); }
+
 
 const XC::Matrix &XC::ElasticBeam3d::getInitialStiff(void) const
   {
@@ -387,7 +392,7 @@ const XC::Matrix &XC::ElasticBeam3d::getInitialStiff(void) const
     kb(4,3) = kb(3,4) = EIyoverL2;
     kb(5,5) = GJoverL;
 
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= theCoordTransf->getInitialGlobalStiffMatrix(kb);
     if(isDead())
       retval*=dead_srf;
@@ -709,9 +714,9 @@ void XC::ElasticBeam3d::Print(std::ostream &s, int flag)
          }
        else if(flag == 2)
          {
-           static XC::Vector xAxis(3);
-           static XC::Vector yAxis(3);
-           static XC::Vector zAxis(3);
+           static thread_local XC::Vector xAxis(3);
+           static thread_local XC::Vector yAxis(3);
+           static thread_local XC::Vector zAxis(3);
 
            theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
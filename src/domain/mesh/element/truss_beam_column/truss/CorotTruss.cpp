@@ -332,7 +332,7 @@ const XC::Matrix &XC::CorotTruss::getTangentStiff(void) const
     static Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = get_matrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -348,8 +348,8 @@ const XC::Matrix &XC::CorotTruss::getTangentStiff(void) const
           }
       }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_matrix()*=dead_srf;
+    return get_matrix();
   }
 
 //! @brief Return initial stiffness matrix.
@@ -369,7 +369,7 @@ const XC::Matrix &XC::CorotTruss::getInitialStiff(void) const
     static Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = get_matrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -385,8 +385,8 @@ const XC::Matrix &XC::CorotTruss::getInitialStiff(void) const
           }
       }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_matrix()*=dead_srf;
+    return get_matrix();
   }
 
 const XC::Material *XC::CorotTruss::getMaterial(void) const
@@ -399,7 +399,7 @@ double XC::CorotTruss::getRho(void) const
 
 const XC::Matrix &XC::CorotTruss::getMass(void) const
   {
-    Matrix &Mass = *theMatrix;
+    Matrix &Mass = get_matrix();
     Mass.Zero();
 
     const double rho= getRho();
@@ -415,8 +415,8 @@ const XC::Matrix &XC::CorotTruss::getMass(void) const
         Mass(i+numDOF2,i+numDOF2) = M;
       }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_matrix()*=dead_srf;
+    return get_matrix();
   }
 
 //! @brief Zeroes loads on element.
@@ -477,7 +477,7 @@ const XC::Vector &XC::CorotTruss::getResistingForce(void) const
     static Vector qg(3);
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
-    Vector &P = *theVector;
+    Vector &P = get_vector();
     P.Zero();
 
     // Copy forces into appropriate places
@@ -488,15 +488,15 @@ const XC::Vector &XC::CorotTruss::getResistingForce(void) const
         P(i+numDOF2) =  qg(i);
       }
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      get_vector()*=dead_srf;
+    return get_vector();
   }
 
 
 
 const XC::Vector &XC::CorotTruss::getResistingForceIncInertia(void) const
   {
-    Vector &P = *theVector;
+    Vector &P = get_vector();
     P = this->getResistingForce();
 
     const double rho= getRho();
@@ -516,11 +516,11 @@ const XC::Vector &XC::CorotTruss::getResistingForceIncInertia(void) const
 
     // add the damping forces if rayleigh damping
     if(!rayFactors.nullValues())
-      *theVector+= this->getRayleighDampingForces();
+      get_vector()+= this->getRayleighDampingForces();
 
     if(isDead())
-      (*theVector)*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
-    return *theVector;
+      get_vector()*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
+    return get_vector();
   }
 
 
@@ -352,7 +352,7 @@ const XC::Matrix &XC::CorotTrussSection::getTangentStiff(void) const
     static XC::Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = get_matrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -366,8 +366,8 @@ const XC::Matrix &XC::CorotTrussSection::getTangentStiff(void) const
         }
     }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_matrix()*=dead_srf;
+    return get_matrix();
   }
 
 const XC::Matrix &XC::CorotTrussSection::getInitialStiff(void) const
@@ -397,7 +397,7 @@ const XC::Matrix &XC::CorotTrussSection::getInitialStiff(void) const
     static Matrix kg(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = get_matrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -411,8 +411,8 @@ const XC::Matrix &XC::CorotTrussSection::getInitialStiff(void) const
       }
     }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_matrix()*=dead_srf;
+    return get_matrix();
 }
 
 const XC::Material *XC::CorotTrussSection::getMaterial(void) const
@@ -426,7 +426,7 @@ double XC::CorotTrussSection::getRho(void) const
 
 const XC::Matrix &XC::CorotTrussSection::getMass(void) const
   {
-    Matrix &Mass = *theMatrix;
+    Matrix &Mass = get_matrix();
     Mass.Zero();
 
     const double rho= getRho();
@@ -442,8 +442,8 @@ const XC::Matrix &XC::CorotTrussSection::getMass(void) const
     }
 
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_matrix()*=dead_srf;
+    return get_matrix();
   }
 
 int XC::CorotTrussSection::addLoad(ElementalLoad *theLoad, double loadFactor)
@@ -482,7 +482,7 @@ const XC::Vector &XC::CorotTrussSection::getResistingForce(void) const
     static XC::Vector qg(3);
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
-    Vector &P = *theVector;
+    Vector &P = get_vector();
     P.Zero();
 
     // Copy forces into appropriate places
@@ -493,13 +493,13 @@ const XC::Vector &XC::CorotTrussSection::getResistingForce(void) const
     }
 
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      get_vector()*=dead_srf;
+    return get_vector();
 }
 
 const XC::Vector &XC::CorotTrussSection::getResistingForceIncInertia(void) const
   {
-    Vector &P = *theVector;
+    Vector &P = get_vector();
     P = this->getResistingForce();
 
     const double rho= getRho();
@@ -518,11 +518,11 @@ const XC::Vector &XC::CorotTrussSection::getResistingForceIncInertia(void) const
 
     // add the damping forces if rayleigh damping
     if(!rayFactors.nullValues())
-      *theVector+= this->getRayleighDampingForces();
+      get_vector()+= this->getRayleighDampingForces();
 
     if(isDead())
-      (*theVector)*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
-    return *theVector;
+      get_vector()*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
+    return get_vector();
   }
 
 int XC::CorotTrussSection::sendSelf(CommParameters &cp)
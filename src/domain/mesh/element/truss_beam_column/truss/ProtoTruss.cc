@@ -31,27 +31,25 @@
 
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
-// initialise the class wide variables
- XC::Matrix XC::ProtoTruss::trussM2(2,2);
- XC::Matrix XC::ProtoTruss::trussM3(3,3);
- XC::Matrix XC::ProtoTruss::trussM4(4,4);
- XC::Matrix XC::ProtoTruss::trussM6(6,6);
- XC::Matrix XC::ProtoTruss::trussM12(12,12);
- XC::Vector XC::ProtoTruss::trussV2(2);
- XC::Vector XC::ProtoTruss::trussV3(3);
- XC::Vector XC::ProtoTruss::trussV4(4);
- XC::Vector XC::ProtoTruss::trussV6(6);
- XC::Vector XC::ProtoTruss::trussV12(12);
+// initialise the class wide variables (one copy for each thread)
+thread_local XC::Matrix XC::ProtoTruss::trussM2(2,2);
+thread_local XC::Matrix XC::ProtoTruss::trussM4(4,4);
+thread_local XC::Matrix XC::ProtoTruss::trussM6(6,6);
+thread_local XC::Matrix XC::ProtoTruss::trussM12(12,12);
+thread_local XC::Vector XC::ProtoTruss::trussV2(2);
+thread_local XC::Vector XC::ProtoTruss::trussV4(4);
+thread_local XC::Vector XC::ProtoTruss::trussV6(6);
+thread_local XC::Vector XC::ProtoTruss::trussV12(12);
 
 //! Default constructor.
 XC::ProtoTruss::ProtoTruss(int tag, int classTag,int Nd1,int Nd2,int ndof,int ndim)
-  : Element1D(tag,classTag,Nd1,Nd2),numDOF(ndof),dimSpace(ndim), theMatrix(nullptr), theVector(nullptr)
+  : Element1D(tag,classTag,Nd1,Nd2),numDOF(ndof),dimSpace(ndim)
   {}
 
 
 //! @brief Copy constructor.
 XC::ProtoTruss::ProtoTruss(const ProtoTruss &other)
-  : Element1D(other),numDOF(other.numDOF),dimSpace(other.dimSpace),theMatrix(other.theMatrix), theVector(other.theVector)
+  : Element1D(other),numDOF(other.numDOF),dimSpace(other.dimSpace)
   {}
 
 //! @brief Assignment operator.
@@ -60,8 +58,6 @@ XC::ProtoTruss &XC::ProtoTruss::operator=(const ProtoTruss &other)
     Element1D::operator=(other);
     numDOF= other.numDOF;
     dimSpace= other.dimSpace;
-    theMatrix= other.theMatrix;
-    theVector= other.theVector;
     return *this;
   }
 
@@ -82,39 +78,63 @@ XC::Material &XC::ProtoTruss::getMaterialRef(void)
     return *ptr;
   }
 
-//! @brief Set the number of dof for element and set matrix and vector pointers.
+//! @brief Return the matrix used to compute and return the element
+//! matrices (a class wide matrix of the calling thread).
+XC::Matrix &XC::ProtoTruss::get_matrix(void) const
+  {
+    switch(numDOF)
+      {
+      case 2:
+        return trussM2;
+      case 4:
+        return trussM4;
+      case 12:
+        return trussM12;
+      default:
+        return trussM6;
+      }
+  }
+
+//! @brief Return the vector used to compute and return the element
+//! vectors (a class wide vector of the calling thread).
+XC::Vector &XC::ProtoTruss::get_vector(void) const
+  {
+    switch(numDOF)
+      {
+      case 2:
+        return trussV2;
+      case 4:
+        return trussV4;
+      case 12:
+        return trussV12;
+      default:
+        return trussV6;
+      }
+  }
+
+//! @brief Set the number of dof for element.
 void XC::ProtoTruss::setup_matrix_vector_ptrs(int dofNd1)
   {
     const int numDim= getNumDIM();
     if(numDim == 1 && dofNd1 == 1)
       {
         numDOF = 2;
-        theMatrix = &trussM2;
-        theVector = &trussV2;
       }
     else if(numDim == 2 && dofNd1 == 2)
       {
         numDOF = 4;
-        theMatrix = &trussM4;
-        theVector = &trussV4;
       }
     else if(numDim == 2 && dofNd1 == 3)
       {
         numDOF = 6;
-        theMatrix = &trussM6;
-        theVector = &trussV6;
       }
     else if(numDim == 3 && dofNd1 == 3)
       {
         numDOF = 6;
-        theMatrix = &trussM6;
-        theVector = &trussV6;
       }
     else if(numDim == 3 && dofNd1 == 6)
       {
         numDOF = 12;
-        theMatrix = &trussM12;
-        theVector = &trussV12;
       }
     else
       {
@@ -130,8 +150,6 @@ void XC::ProtoTruss::setup_matrix_vector_ptrs(int dofNd1)
 
         // fill this in so don't segment fault later
         numDOF = 6;
-        theMatrix = &trussM6;
-        theVector = &trussV6;
         return;
       }
   }
@@ -141,8 +159,10 @@ int XC::ProtoTruss::sendData(CommParameters &cp)
   {
     int res= Element1D::sendData(cp);
     res+= cp.sendInts(numDOF,dimSpace,getDbTagData(),CommMetaData(7));
-    res+= cp.sendMatrixPtr(theMatrix,getDbTagData(),MatrixCommMetaData(8,9,10,11)); 
-    res+= cp.sendVectorPtr(theVector,getDbTagData(),ArrayCommMetaData(12,13,14)); 
+    // The scratch matrix and vector of the calling thread keep
+    // the slots 8 to 14 of the original layout.
+    res+= cp.sendMatrixPtr(&get_matrix(),getDbTagData(),MatrixCommMetaData(8,9,10,11)); 
+    res+= cp.sendVectorPtr(&get_vector(),getDbTagData(),ArrayCommMetaData(12,13,14)); 
     return res;
   }
 
@@ -151,7 +171,9 @@ int XC::ProtoTruss::recvData(const CommParameters &cp)
   {
     int res= Element1D::recvData(cp);
     res+= cp.receiveInts(numDOF,dimSpace,getDbTagData(),CommMetaData(7));
-    theMatrix= cp.receiveMatrixPtr(theMatrix,getDbTagData(),MatrixCommMetaData(8,9,10,11)); 
-    theVector= cp.receiveVectorPtr(theVector,getDbTagData(),ArrayCommMetaData(12,13,14)); 
+    Matrix *theMatrix= &get_matrix();
+    cp.receiveMatrixPtr(theMatrix,getDbTagData(),MatrixCommMetaData(8,9,10,11)); 
+    Vector *theVector= &get_vector();
+    cp.receiveVectorPtr(theVector,getDbTagData(),ArrayCommMetaData(12,13,14)); 
     return res;
   }
@@ -137,8 +137,6 @@ void XC::Spring::setDomain(Domain *theDomain)
           {
             // fill this in so don't segment fault later
             numDOF= 2;
-            theMatrix= &trussM2;
-            theVector= &trussV2;
             return;
           }
 
@@ -155,8 +153,6 @@ void XC::Spring::setDomain(Domain *theDomain)
 
             // fill this in so don't segment fault later
             numDOF= 2;
-            theMatrix= &trussM2;
-            theVector= &trussV2;
             return;
           }
 
@@ -164,32 +160,22 @@ void XC::Spring::setDomain(Domain *theDomain)
         if(getNumDIM() == 1 && dofNd1 == 1)
           {
             numDOF= 2;
-            theMatrix= &trussM2;
-            theVector= &trussV2;
           }
         else if(getNumDIM() == 2 && dofNd1 == 2)
           {
             numDOF= 4;
-            theMatrix= &trussM4;
-            theVector= &trussV4;
           }
         else if(getNumDIM() == 2 && dofNd1 == 3)
           {
             numDOF= 6;
-            theMatrix= &trussM6;
-            theVector= &trussV6;
           }
         else if(getNumDIM() == 3 && dofNd1 == 3)
           {
             numDOF= 6;
-            theMatrix= &trussM6;
-            theVector= &trussV6;
           }
         else if(getNumDIM() == 3 && dofNd1 == 6)
           {
             numDOF= 12;
-            theMatrix= &trussM12;
-            theVector= &trussV12;
           }
         else
           {
@@ -197,8 +183,6 @@ void XC::Spring::setDomain(Domain *theDomain)
               dofNd1  << " problem\n";
 
             numDOF= 2;
-            theMatrix= &trussM2;
-            theVector= &trussV2;
             return;
           }
 
@@ -285,7 +269,7 @@ const XC::Matrix &XC::Spring::getTangentStiff(void) const
     const double K= theMaterial->getTangent();
 
     // come back later and redo this if too slow
-    Matrix &stiff= *theMatrix;
+    Matrix &stiff= get_matrix();
 
     const int numDOF2= numDOF/2;
     double temp;
@@ -301,7 +285,7 @@ const XC::Matrix &XC::Spring::getTangentStiff(void) const
           }
       }
     if(isDead())
-      (*theMatrix)*=dead_srf;
+      get_matrix()*=dead_srf;
     return stiff;
   }
 
@@ -311,7 +295,7 @@ const XC::Matrix &XC::Spring::getInitialStiff(void) const
     const double K= theMaterial->getInitialTangent();
 
     // come back later and redo this if too slow
-    Matrix &stiff= *theMatrix;
+    Matrix &stiff= get_matrix();
 
     const int numDOF2= numDOF/2;
     double temp;
@@ -327,8 +311,8 @@ const XC::Matrix &XC::Spring::getInitialStiff(void) const
           }
       }
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_matrix()*=dead_srf;
+    return get_matrix();
   }
 
 //! @brief Returns the matrix de amortiguamiento.
@@ -337,7 +321,7 @@ const XC::Matrix &XC::Spring::getDamp(void) const
     const double eta= theMaterial->getDampTangent();
 
     // come back later and redo this if too slow
-    Matrix &damp= *theMatrix;
+    Matrix &damp= get_matrix();
 
     const int numDOF2= numDOF/2;
     double temp;
@@ -370,7 +354,7 @@ double XC::Spring::getRho(void) const
 const XC::Matrix &XC::Spring::getMass(void) const
   {
     // zero the matrix
-    Matrix &mass= *theMatrix;
+    Matrix &mass= get_matrix();
     mass.Zero();
 
     const double M= getRho();//Here rho is the concentrated mass.
@@ -442,15 +426,15 @@ const XC::Vector &XC::Spring::getResistingForce(void) const
     for(int i= 0;i<getNumDIM();i++)
       {
         temp= cosX[i]*force;
-        (*theVector)(i)= -temp;
-        (*theVector)(i+numDOF2)= temp;
+        get_vector()(i)= -temp;
+        get_vector()(i+numDOF2)= temp;
       }
 
     // subtract external load:  Ku - P
-    (*theVector)-= load;
+    get_vector()-= load;
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      get_vector()*=dead_srf;
+    return get_vector();
   }
 
 //! @brief Returns the reaction of the element including inertia forces.
@@ -469,23 +453,23 @@ const XC::Vector &XC::Spring::getResistingForceIncInertia(void) const
         const int numDOF2= numDOF/2;
         for(int i= 0;i<getNumDIM();i++)
           {
-            (*theVector)(i) += M*accel1(i);
-            (*theVector)(i+numDOF2) += M*accel2(i);
+            get_vector()(i) += M*accel1(i);
+            get_vector()(i+numDOF2) += M*accel2(i);
           }
 
         // add the damping forces if rayleigh damping
         if(!rayFactors.nullValues())
-          (*theVector)+= this->getRayleighDampingForces();
+          get_vector()+= this->getRayleighDampingForces();
       }
     else
       {
         // add the damping forces if rayleigh damping
         if(!rayFactors.nullKValues())
-          (*theVector)+= this->getRayleighDampingForces();
+          get_vector()+= this->getRayleighDampingForces();
       }
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      get_vector()*=dead_srf;
+    return get_vector();
   }
 
 //! @brief Print spring data.
@@ -508,10 +492,10 @@ void XC::Spring::Print(std::ostream &s, int flag)
         for(int i= 0; i < getNumDIM(); i++)
           {
             temp= cosX[i]*force;
-            (*theVector)(i)= -temp;
-            (*theVector)(i+numDOF2)= temp;
+            get_vector()(i)= -temp;
+            get_vector()(i+numDOF2)= temp;
           }
-        s << " \n\t unbalanced load: " << *theVector;
+        s << " \n\t unbalanced load: " << get_vector();
         s << " \t XC::Material: " << *theMaterial;
         s << std::endl;
       }
@@ -564,7 +548,7 @@ XC::Response *XC::Spring::setResponse(const std::vector<std::string> &argv, Info
       return new ElementResponse(this, 2, 0.0);
     // tangent stiffness matrix
     else if(argv[0] == "stiff")
-      return new ElementResponse(this, 3, *theMatrix);
+      return new ElementResponse(this, 3, get_matrix());
     // a material quantity
     else if(argv[0] == "material" || argv[0] == "-material")
       return  setMaterialResponse(theMaterial,argv,1,eleInfo);
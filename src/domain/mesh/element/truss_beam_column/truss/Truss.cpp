@@ -220,8 +220,6 @@ void XC::Truss::setDomain(Domain *theDomain)
       {
         // fill this in so don't segment fault later
         numDOF = 2;
-        theMatrix = &trussM2;
-        theVector = &trussV2;
         return;
       }
 
@@ -238,8 +236,6 @@ void XC::Truss::setDomain(Domain *theDomain)
 
         // fill this in so don't segment fault later
         numDOF = 2;
-        theMatrix = &trussM2;
-        theVector = &trussV2;
         return;
       }
 
@@ -308,19 +304,24 @@ int XC::Truss::update(void)
     return theMaterial->setTrialStrain(strain, rate);
   }
 
+//! @brief Return true if the element can be computed concurrently
+//! with other elements (i.e. its material is thread safe).
+bool XC::Truss::isThreadSafe(void) const
+  { return (theMaterial && theMaterial->isThreadSafe()); }
+
 //! @brief Returns the tangent stiffness matrix.
 const XC::Matrix &XC::Truss::getTangentStiff(void) const
   {
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        get_matrix().Zero();
+        return get_matrix();
       }
 
     double E = theMaterial->getTangent();
 
     // come back later and redo this if too slow
-    Matrix &stiff= *theMatrix;
+    Matrix &stiff= get_matrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -346,14 +347,14 @@ const XC::Matrix &XC::Truss::getInitialStiff(void) const
   {
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        get_matrix().Zero();
+        return get_matrix();
       }
 
     const double E = theMaterial->getInitialTangent();
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = get_matrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -369,8 +370,8 @@ const XC::Matrix &XC::Truss::getInitialStiff(void) const
     }
 
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_matrix()*=dead_srf;
+    return get_matrix();
   }
 
 //! @brief Returns the damping matrix.
@@ -378,14 +379,14 @@ const XC::Matrix &XC::Truss::getDamp(void) const
   {
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        get_matrix().Zero();
+        return get_matrix();
       }
 
     double eta = theMaterial->getDampTangent();
 
     // come back later and redo this if too slow
-    Matrix &damp = *theMatrix;
+    Matrix &damp = get_matrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -418,7 +419,7 @@ double XC::Truss::getRho(void) const
 const XC::Matrix &XC::Truss::getMass(void) const
   {
     // zero the matrix
-    Matrix &mass= *theMatrix;
+    Matrix &mass= get_matrix();
     mass.Zero();
 
     const double rho= getRho();
@@ -598,8 +599,8 @@ const XC::Vector &XC::Truss::getResistingForce(void) const
   {
     if(L == 0.0)
       { // - problem in setDomain() no further warnings
-        theVector->Zero();
-        return *theVector;
+        get_vector().Zero();
+        return get_vector();
       }
 
     // R = Ku - Pext
@@ -610,16 +611,16 @@ const XC::Vector &XC::Truss::getResistingForce(void) const
     for(int i = 0; i < getNumDIM(); i++)
       {
         temp = cosX[i]*force;
-        (*theVector)(i) = -temp;
-        (*theVector)(i+numDOF2) = temp;
+        get_vector()(i) = -temp;
+        get_vector()(i+numDOF2) = temp;
       }
 
     // subtract external load:  Ku - P
-    (*theVector)-= *getLoad();
+    get_vector()-= *getLoad();
 
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      get_vector()*=dead_srf;
+    return get_vector();
   }
 
 //! @brief Returns the reaction of the element includin inertia forces.
@@ -639,23 +640,23 @@ const XC::Vector &XC::Truss::getResistingForceIncInertia(void) const
         const double M = 0.5*rho*L;
         for(int i = 0; i < getNumDIM(); i++)
           {
-            (*theVector)(i) += M*accel1(i);
-            (*theVector)(i+numDOF2) += M*accel2(i);
+            get_vector()(i) += M*accel1(i);
+            get_vector()(i+numDOF2) += M*accel2(i);
           }
 
         // add the damping forces if rayleigh damping
         if(!rayFactors.nullValues())
-          (*theVector)+= this->getRayleighDampingForces();
+          get_vector()+= this->getRayleighDampingForces();
       }
     else
       {
         // add the damping forces if rayleigh damping
         if(!rayFactors.nullKValues())
-          (*theVector) += this->getRayleighDampingForces();
+          get_vector() += this->getRayleighDampingForces();
       }
     if(isDead())
-      (*theVector)*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
-    return *theVector;
+      get_vector()*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
+    return get_vector();
   }
 
 //! @brief Returns a vector to store the dbTags
@@ -741,10 +742,10 @@ void XC::Truss::Print(std::ostream &s, int flag)
             for(int i = 0; i < getNumDIM(); i++)
               {
                 temp = cosX[i]*force;
-                (*theVector)(i) = -temp;
-                (*theVector)(i+numDOF2) = temp;
+                get_vector()(i) = -temp;
+                get_vector()(i+numDOF2) = temp;
               }
-            s << " \n\t unbalanced load: " << *theVector;
+            s << " \n\t unbalanced load: " << get_vector();
           }
         s << " \t XC::Material: " << *theMaterial;
         s << std::endl;
@@ -808,7 +809,7 @@ XC::Response *XC::Truss::setResponse(const std::vector<std::string> &argv, Infor
       return new ElementResponse(this, 2, 0.0);
     // tangent stiffness matrix
     else if(argv[0] == "stiff")
-      return new ElementResponse(this, 3, *theMatrix);
+      return new ElementResponse(this, 3, get_matrix());
     // a material quantity
     else if(argv[0] == "material" || argv[0] == "-material")
       return  setMaterialResponse(theMaterial,argv,1,eleInfo);
@@ -892,7 +893,7 @@ int XC::Truss::activateParameter(int passedParameterID)
 
 const XC::Matrix &XC::Truss::getKiSensitivity(int gradNumber)
   {
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = get_matrix();
     stiff.Zero();
 
     if(parameterID == 0)
@@ -943,7 +944,7 @@ const XC::Matrix &XC::Truss::getKiSensitivity(int gradNumber)
 
 const XC::Matrix &XC::Truss::getMassSensitivity(int gradNumber)
   {
-    Matrix &mass = *theMatrix;
+    Matrix &mass = get_matrix();
     mass.Zero();
 
     if(parameterID == 2)
@@ -962,7 +963,7 @@ const XC::Matrix &XC::Truss::getMassSensitivity(int gradNumber)
 
 const XC::Vector &XC::Truss::getResistingForceSensitivity(int gradNumber)
   {
-    theVector->Zero();
+    get_vector().Zero();
 
     // Initial declarations
     int i;
@@ -1069,15 +1070,15 @@ const XC::Vector &XC::Truss::getResistingForceSensitivity(int gradNumber)
     if(parameterID == 1) {            // Cross-sectional area
       for(i = 0; i < getNumDIM(); i++) {
         temp = (stress + A*stressSensitivity)*cosX[i];
-        (*theVector)(i) = -temp;
-        (*theVector)(i+numDOF2) = temp;
+        get_vector()(i) = -temp;
+        get_vector()(i+numDOF2) = temp;
       }
     }
     else {        // Density, material parameter or nodal coordinate
       for(i = 0; i < getNumDIM(); i++) {
         temp = A*(stressSensitivity*cosX[i] + stress*dcosXdh[i]);
-        (*theVector)(i) = -temp;
-        (*theVector)(i+numDOF2) = temp;
+        get_vector()(i) = -temp;
+        get_vector()(i+numDOF2) = temp;
       }
     }
 
@@ -1085,9 +1086,9 @@ const XC::Vector &XC::Truss::getResistingForceSensitivity(int gradNumber)
     if(!theLoadSens)
       set_load_sens(Vector(numDOF));
 
-    (*theVector)-= *theLoadSens;
+    get_vector()-= *theLoadSens;
 
-    return *theVector;
+    return get_vector();
   }
 
 int XC::Truss::commitSensitivity(int gradNumber, int numGrads)
@@ -159,8 +159,6 @@ void XC::TrussSection::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;
-      theMatrix = &trussM2;
-      theVector = &trussV2;
 
       return;
     }
@@ -175,8 +173,6 @@ void XC::TrussSection::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;
-      theMatrix = &trussM2;
-      theVector = &trussV2;
 
       return;
     }
@@ -241,8 +237,8 @@ int XC::TrussSection::update(void)
 const XC::Matrix &XC::TrussSection::getTangentStiff(void) const
   {
     if(L == 0.0) { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        get_matrix().Zero();
+        return get_matrix();
     }
 
     int order = theSection->getOrder();
@@ -257,7 +253,7 @@ const XC::Matrix &XC::TrussSection::getTangentStiff(void) const
     }
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = get_matrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -273,15 +269,15 @@ const XC::Matrix &XC::TrussSection::getTangentStiff(void) const
     }
 
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_matrix()*=dead_srf;
+    return get_matrix();
   }
 
 const XC::Matrix &XC::TrussSection::getInitialStiff(void) const
   {
     if(L == 0.0) { // - problem in setDomain() no further warnings
-        theMatrix->Zero();
-        return *theMatrix;
+        get_matrix().Zero();
+        return get_matrix();
     }
 
     int order = theSection->getOrder();
@@ -296,7 +292,7 @@ const XC::Matrix &XC::TrussSection::getInitialStiff(void) const
     }
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = get_matrix();
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -312,8 +308,8 @@ const XC::Matrix &XC::TrussSection::getInitialStiff(void) const
     }
 
     if(isDead())
-      (*theMatrix)*=dead_srf;
-    return *theMatrix;
+      get_matrix()*=dead_srf;
+    return get_matrix();
   }
 
 //! @brief Return the element material.
@@ -331,7 +327,7 @@ double XC::TrussSection::getRho(void) const
 const XC::Matrix &XC::TrussSection::getMass(void) const
   {
     // zero the matrix
-    Matrix &mass = *theMatrix;
+    Matrix &mass = get_matrix();
     mass.Zero();
 
     const double rho= getRho();
@@ -406,8 +402,8 @@ int XC::TrussSection::addInertiaLoadToUnbalance(const XC::Vector &accel)
 const XC::Vector &XC::TrussSection::getResistingForce(void) const
   {
     if(L == 0.0) { // - problem in setDomain() no further warnings
-        theVector->Zero();
-        return *theVector;
+        get_vector().Zero();
+        return get_vector();
     }
 
     int order = theSection->getOrder();
@@ -425,16 +421,16 @@ const XC::Vector &XC::TrussSection::getResistingForce(void) const
     double temp;
     for(i = 0; i < getNumDIM(); i++) {
       temp = cosX[i]*force;
-      (*theVector)(i) = -temp;
-      (*theVector)(i+numDOF2) = temp;
+      get_vector()(i) = -temp;
+      get_vector()(i+numDOF2) = temp;
     }
 
     // add P
-    (*theVector)-= *getLoad();
+    get_vector()-= *getLoad();
 
     if(isDead())
-      (*theVector)*=dead_srf;
-    return *theVector;
+      get_vector()*=dead_srf;
+    return get_vector();
   }
 
 
@@ -454,18 +450,18 @@ const XC::Vector &XC::TrussSection::getResistingForceIncInertia(void) const
         const int start = numDOF/2;
         for(int i=0; i<dof; i++)
           {
-            (*theVector)(i)+= M*accel1(i);
-            (*theVector)(i+start)+= M*accel2(i);
+            get_vector()(i)+= M*accel1(i);
+            get_vector()(i+start)+= M*accel2(i);
           }
       }
 
     // add the damping forces if rayleigh damping
     if(!rayFactors.nullValues())
-      *theVector+= this->getRayleighDampingForces();
+      get_vector()+= this->getRayleighDampingForces();
 
     if(isDead())
-      (*theVector)*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
-    return *theVector;
+      get_vector()*=dead_srf; //XXX Se aplica 2 veces sobre getResistingForce: arreglar.
+    return get_vector();
   }
 
 //! @brief Send members through the channel being passed as parameter.
@@ -545,8 +541,8 @@ void XC::TrussSection::Print(std::ostream &s, int flag)
     int numDOF2 = numDOF/2;
     for(int i=0; i<getNumDIM(); i++) {
       temp = force*cosX[i];
-      (*theVector)(i) = -force;
-      (*theVector)(i+numDOF2) = force;
+      get_vector()(i) = -force;
+      get_vector()(i+numDOF2) = force;
     }
 
     if(flag == 0) { // print everything
@@ -556,8 +552,8 @@ void XC::TrussSection::Print(std::ostream &s, int flag)
 
         s << " \n\t strain: " << strain;
         s << " axial load: " << force;
-        if(theVector != 0)
-            s << " \n\t unbalanced load: " << *theVector;
+        if(numDOF>0)
+            s << " \n\t unbalanced load: " << get_vector();
         s << " \t Section: " << *theSection;
         s << std::endl;
     } else if(flag == 1) {
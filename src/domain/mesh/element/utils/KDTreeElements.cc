@@ -29,6 +29,7 @@
 #include "KDTreeElements.h"
 #include "domain/mesh/element/Element.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include <iterator>
 
 //! @brief Constructor.
 XC::ElemPos::ElemPos(const Element &e)
@@ -84,3 +85,23 @@ const XC::Element *XC::KDTreeElements::getNearest(const Pos3d &pos, const double
       retval= found.first->getElementPtr();
     return retval;
   }
+
+//! @brief Returns the elements whose position (centroid of the initial geometry) lies inside
+//! the box defined by the points being passed as parameter
+//! (bounds included).
+//!
+//! @param pMin: vertex of the box with the minimum coordinates.
+//! @param pMax: vertex of the box with the maximum coordinates.
+std::deque<const XC::Element *> XC::KDTreeElements::getInside(const Pos3d &pMin,const Pos3d &pMax) const
+  {
+    tree_type::_Region_ region(std::ptr_fun(ElemPos::tac));
+    region._M_low_bounds[0]= pMin.x(); region._M_high_bounds[0]= pMax.x();
+    region._M_low_bounds[1]= pMin.y(); region._M_high_bounds[1]= pMax.y();
+    region._M_low_bounds[2]= pMin.z(); region._M_high_bounds[2]= pMax.z();
+    std::deque<ElemPos> found;
+    find_within_range(region,std::back_inserter(found));
+    std::deque<const Element *> retval;
+    for(std::deque<ElemPos>::const_iterator i= found.begin();i!=found.end();i++)
+      retval.push_back(i->getElementPtr());
+    return retval;
+  }
@@ -329,7 +329,7 @@ size_t XC::NodePtrs::getDimension(void) const
 //! @brief Returns a matrix with the coordinates of the nodes by rows.
 const XC::Matrix &XC::NodePtrs::getCoordinates(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t sz= size();
     const size_t dim= getDimension();
     retval= Matrix(sz,dim);
@@ -135,7 +135,7 @@ double XC::CrdTransf::getLength(bool initialGeometry) const
 
 const XC::Matrix &XC::CrdTransf::getPointsGlobalCoordFromLocal(const Matrix &localCoords) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t numPts= localCoords.noRows(); //Number of points to transform.
     const size_t dim= localCoords.noCols(); //Space dimension.
     retval.resize(numPts,dim);
@@ -163,7 +163,7 @@ const XC::Vector &XC::CrdTransf::getBasicDisplSensitivity(int gradNumber)
     std::cerr << "WARNING XC::CrdTransf::getBasicDisplSensitivity() - this method "
         << " should not be called." << std::endl;
 
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
@@ -172,7 +172,7 @@ const XC::Vector &XC::CrdTransf::getGlobalResistingForceShapeSensitivity(const X
     std::cerr << "ERROR XC::CrdTransf::getGlobalResistingForceSensitivity() - has not been"
         << " implemented yet for the chosen transformation." << std::endl;
 
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
@@ -181,7 +181,7 @@ const XC::Vector &XC::CrdTransf::getBasicTrialDispShapeSensitivity(void)
     std::cerr << "ERROR CrdTransf::getBasicTrialDispShapeSensitivity() - has not been"
         << " implemented yet for the chosen transformation." << std::endl;
 
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
   }
 
@@ -43,7 +43,7 @@ XC::SmallDispCrdTransf3d::SmallDispCrdTransf3d(int tag, int class_tag, const XC:
 int XC::SmallDispCrdTransf3d::computeElemtLengthAndOrient(void) const
   {
     // element projection
-    static Vector dx(3);
+    static thread_local Vector dx(3);
     
     const Vector &ndICoords = nodeIPtr->getCrds();
     const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -96,7 +96,7 @@ int XC::SmallDispCrdTransf3d::computeLocalAxis(void) const
   {
     // Compute y = v cross x
     // Note: v(i) is stored in R(2,i)
-    static Vector vAxis(3);
+    static thread_local Vector vAxis(3);
     vAxis(0)= R(2,0); vAxis(1)= R(2,1); vAxis(2)= R(2,2);
     
     vectorI(0) = R(0,0); vectorI(1) = R(0,1); vectorI(2) = R(0,2);
@@ -160,17 +160,17 @@ const XC::Vector &XC::SmallDispCrdTransf3d::getBasicTrialDisp(void) const
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-    static double ug[12]; //Desplazamiento of the nodes en global coordinates.
+    static thread_local double ug[12]; //Desplazamiento of the nodes en global coordinates.
     inic_ug(disp1,disp2,ug);
     modif_ug_init_disp(ug);
 
-    static double ul[12]; //Desplazamiento of the nodes en local coordinates.
+    static thread_local double ul[12]; //Desplazamiento of the nodes en local coordinates.
     global_to_local(ug,ul);
 
-    static double Wu[3];
+    static thread_local double Wu[3];
     calc_Wu(ug,ul,Wu);
 
-    static Vector ub(6);
+    static thread_local Vector ub(6);
     return calc_ub(ul,ub);
   }
 
@@ -180,16 +180,16 @@ const XC::Vector &XC::SmallDispCrdTransf3d::getBasicIncrDisp(void) const
     const Vector &disp1 = nodeIPtr->getIncrDisp();
     const Vector &disp2 = nodeJPtr->getIncrDisp();
 
-    static double ug[12];
+    static thread_local double ug[12];
     inic_ug(disp1,disp2,ug);
 
-    static double ul[12];
+    static thread_local double ul[12];
     global_to_local(ug,ul);
 
-    static double Wu[3];
+    static thread_local double Wu[3];
     calc_Wu(ug,ul,Wu);
 
-    static Vector ub(6);
+    static thread_local Vector ub(6);
     return calc_ub(ul,ub);
   }
 
@@ -199,16 +199,16 @@ const XC::Vector &XC::SmallDispCrdTransf3d::getBasicIncrDeltaDisp(void) const
     const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
     const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
 
-    static double ug[12];
+    static thread_local double ug[12];
     inic_ug(disp1,disp2,ug);
 
-    static double ul[12];
+    static thread_local double ul[12];
     global_to_local(ug,ul);
 
-    static double Wu[3];
+    static thread_local double Wu[3];
     calc_Wu(ug,ul,Wu);
 
-    static Vector ub(6);
+    static thread_local Vector ub(6);
     return calc_ub(ul,ub);
   }
 
@@ -218,16 +218,16 @@ const XC::Vector &XC::SmallDispCrdTransf3d::getBasicTrialVel(void) const
     const Vector &vel1 = nodeIPtr->getTrialVel();
     const Vector &vel2 = nodeJPtr->getTrialVel();
 
-    static double vg[12];
+    static thread_local double vg[12];
     inic_ug(vel1,vel2,vg);
 
-    static double vl[12];
+    static thread_local double vl[12];
     global_to_local(vg,vl);
 
-    static double Wu[3];
+    static thread_local double Wu[3];
     calc_Wu(vg,vl,Wu);
 
-    static Vector vb(6);
+    static thread_local Vector vb(6);
     return calc_ub(vl,vb);
   }
 
@@ -238,23 +238,23 @@ const XC::Vector &XC::SmallDispCrdTransf3d::getBasicTrialAccel(void) const
     const Vector &accel1 = nodeIPtr->getTrialAccel();
     const Vector &accel2 = nodeJPtr->getTrialAccel();
 
-    static double ag[12];
+    static thread_local double ag[12];
     inic_ug(accel1,accel2,ag);
 
-    static double al[12];
+    static thread_local double al[12];
     global_to_local(ag,al);
 
-    static double Wu[3];
+    static thread_local double Wu[3];
     calc_Wu(ag,al,Wu);
 
-    static Vector ab(6);
+    static thread_local Vector ab(6);
     return calc_ub(al,ab);
   }
 
 //! @brief Transform resisting forces from the basic system to local coordinates
 XC::Vector &XC::SmallDispCrdTransf3d::basic_to_local_resisting_force(const Vector &pb, const Vector &p0) const
   {
-    static Vector pl(12);
+    static thread_local Vector pl(12);
 
     const double &q0= pb(0);
     const double &q1= pb(1);
@@ -290,7 +290,7 @@ XC::Vector &XC::SmallDispCrdTransf3d::basic_to_local_resisting_force(const Vecto
 const XC::Vector &XC::SmallDispCrdTransf3d::local_to_global_resisting_force(const Vector &pl) const
   {
     // transform resisting forces  from local to global coordinates
-    static Vector pg(12);
+    static thread_local Vector pg(12);
 
     pg(0)= R(0,0)*pl[0] + R(1,0)*pl[1] + R(2,0)*pl[2];
     pg(1)= R(0,1)*pl[0] + R(1,1)*pl[1] + R(2,1)*pl[2];
@@ -321,8 +321,8 @@ const XC::Vector &XC::SmallDispCrdTransf3d::local_to_global_resisting_force(cons
 
 XC::Matrix &XC::SmallDispCrdTransf3d::basic_to_local_stiff_matrix(const XC::Matrix &KB) const
   {
-    static Matrix kl(12,12); // Local stiffness
-    static Matrix tmp(12,12); // Temporary storage
+    static thread_local Matrix kl(12,12); // Local stiffness
+    static thread_local Matrix tmp(12,12); // Temporary storage
 
     const double oneOverL = 1.0/L;
 
@@ -363,9 +363,14 @@ XC::Matrix &XC::SmallDispCrdTransf3d::basic_to_local_stiff_matrix(const XC::Matr
     return kl;
   }
 
-const XC::Matrix &XC::SmallDispCrdTransf3d::computeRW(const Vector &nodeOffset) const
+//! @brief Computes the product of the transformation matrix by
+//! the skew-symmetric matrix of the node offset.
+//!
+//! The result is returned by value (stack storage) so the matrices
+//! for both nodes can be used at the same time.
+XC::FixedMatrix<3,3> XC::SmallDispCrdTransf3d::computeRW(const Vector &nodeOffset) const
   {
-    static Matrix RW(3,3);
+    FixedMatrix<3,3> RW;
 
     // Compute RW
     RW(0,0) = -R(0,1)*nodeOffset(2) + R(0,2)*nodeOffset(1);
@@ -384,10 +389,10 @@ const XC::Matrix &XC::SmallDispCrdTransf3d::computeRW(const Vector &nodeOffset)
 
 const XC::Matrix &XC::SmallDispCrdTransf3d::local_to_global_stiff_matrix(const Matrix &kl) const
   {
-    static Matrix tmp(12,12); // Temporary storage
+    static thread_local Matrix tmp(12,12); // Temporary storage
 
-    const Matrix &RWI= computeRW(nodeIOffset);
-    const Matrix &RWJ= computeRW(nodeJOffset);
+    const FixedMatrix<3,3> RWI= computeRW(nodeIOffset);
+    const FixedMatrix<3,3> RWJ= computeRW(nodeJOffset);
 
     // Transform local stiffness to global system
     // First compute kl*T_{lg}
@@ -419,7 +424,7 @@ const XC::Matrix &XC::SmallDispCrdTransf3d::local_to_global_stiff_matrix(const M
         tmp(m,11)  += kl(m,6)*RWJ(0,2)  + kl(m,7)*RWJ(1,2)  + kl(m,8)*RWJ(2,2);
       }
 
-    static Matrix kg(12,12); // Global stiffness for return
+    static thread_local Matrix kg(12,12); // Global stiffness for return
     // Now compute T'_{lg}*(kl*T_{lg})
     for(m = 0; m < 12; m++)
       {
@@ -30,6 +30,7 @@
 #define SmallDispCrdTransf3d_h
 
 #include "CrdTransf3d.h"
+#include "utility/matrix/FixedMatrix.h"
 
 namespace XC {
 
@@ -38,7 +39,7 @@ namespace XC {
 //! @brief Base class for small displacements 3D coordinate transformations.
 class SmallDispCrdTransf3d: public CrdTransf3d
   {
-    const Matrix &computeRW(const Vector &nodeOffset) const;
+    FixedMatrix<3,3> computeRW(const Vector &nodeOffset) const;
   protected:
     virtual int computeElemtLengthAndOrient(void) const;
     virtual int computeLocalAxis(void) const;
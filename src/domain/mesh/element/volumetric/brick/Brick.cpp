@@ -67,11 +67,11 @@
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 
 //static data
-double  XC::Brick::xl[3][8] ;
+thread_local double  XC::Brick::xl[3][8] ;
 
-XC::Matrix  XC::Brick::stiff(24,24) ;
-XC::Vector  XC::Brick::resid(24) ;
-XC::Matrix  XC::Brick::mass(24,24) ;
+thread_local XC::Matrix  XC::Brick::stiff(24,24) ;
+thread_local XC::Vector  XC::Brick::resid(24) ;
+thread_local XC::Matrix  XC::Brick::mass(24,24) ;
 
 
 //quadrature data
@@ -83,7 +83,7 @@ const double  XC::Brick::wg[] = { 1.0, 1.0, 1.0, 1.0,
                               1.0, 1.0, 1.0, 1.0  } ;
 
 
-static XC::Matrix B(6,3) ;
+static thread_local XC::Matrix B(6,3) ;
 
 const int brick_nstress= 6;
 
@@ -200,8 +200,8 @@ void  XC::Brick::Print( std::ostream &s, int flag )
      }
 
     // spit out the section location & invoke print on the scetion
-    static Vector avgStress(brick_nstress);
-    static Vector avgStrain(brick_nstress);
+    static thread_local Vector avgStress(brick_nstress);
+    static thread_local Vector avgStrain(brick_nstress);
     avgStress= physicalProperties.getCommittedAvgStress();
     avgStrain= physicalProperties.getCommittedAvgStrain();
 
@@ -275,26 +275,26 @@ const XC::Matrix&  XC::Brick::getInitialStiff(void) const
   int jj, kk;
 
 
-  static double volume;
-  static double xsj;  // determinant jacaobian matrix
-  static double dvol[numberGauss]; //volume element
-  static double gaussPoint[ndm];
-  static Vector strain(brick_nstress);  //strain
-  static double shp[nShape][numberNodes];  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
-  static Matrix stiffJK(ndf,ndf); //nodeJK stiffness
-  static Matrix dd(brick_nstress,brick_nstress);  //material tangent
+  static thread_local double volume;
+  static thread_local double xsj;  // determinant jacaobian matrix
+  static thread_local double dvol[numberGauss]; //volume element
+  static thread_local double gaussPoint[ndm];
+  static thread_local Vector strain(brick_nstress);  //strain
+  static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
+  static thread_local double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
+  static thread_local Matrix stiffJK(ndf,ndf); //nodeJK stiffness
+  static thread_local Matrix dd(brick_nstress,brick_nstress);  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static XC::Matrix BJ(brick_nstress,ndf);      // B matrix node J
+    static thread_local XC::Matrix BJ(brick_nstress,ndf);      // B matrix node J
 
-    static XC::Matrix BJtran(ndf,brick_nstress);
+    static thread_local XC::Matrix BJtran(ndf,brick_nstress);
 
-    static XC::Matrix BK(brick_nstress,ndf);      // B matrix node k
+    static thread_local XC::Matrix BK(brick_nstress,ndf);      // B matrix node k
 
-    static XC::Matrix BJtranD(ndf,brick_nstress);
+    static thread_local XC::Matrix BJtranD(ndf,brick_nstress);
 
   //-------------------------------------------------------
 
@@ -469,7 +469,7 @@ const XC::Vector &XC::Brick::getResistingForce(void) const
 //! @brief Get residual with inertia terms.
 const XC::Vector &XC::Brick::getResistingForceIncInertia(void) const
   {
-    static Vector res(24);
+    static thread_local Vector res(24);
 
     int tang_flag = 0; //don't get the tangent
 
@@ -513,13 +513,13 @@ void XC::Brick::formInertiaTerms( int tangFlag ) const
 
   double dvol[numberGauss]; //volume element
 
-  static double shp[nShape][numberNodes];  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
 
-  static double gaussPoint[ndm];
+  static thread_local double gaussPoint[ndm];
 
-  static XC::Vector momentum(ndf);
+  static thread_local XC::Vector momentum(ndf);
 
   int i, j, k, p, q;
   int jj, kk;
@@ -651,29 +651,29 @@ XC::Brick::update(void)
   int i, j, k, p, q;
   int success;
 
-  static double volume;
+  static thread_local double volume;
 
-  static double xsj;  // determinant jacaobian matrix
+  static thread_local double xsj;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss]; //volume element
+  static thread_local double dvol[numberGauss]; //volume element
 
-  static double gaussPoint[ndm];
+  static thread_local double gaussPoint[ndm];
 
-  static XC::Vector strain(brick_nstress);  //strain
+  static thread_local XC::Vector strain(brick_nstress);  //strain
 
-  static double shp[nShape][numberNodes];  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
 
   //---------B-matrices------------------------------------
 
-    static XC::Matrix BJ(brick_nstress,ndf);      // B matrix node J
+    static thread_local XC::Matrix BJ(brick_nstress,ndf);      // B matrix node J
 
-    static XC::Matrix BJtran(ndf,brick_nstress);
+    static thread_local XC::Matrix BJtran(ndf,brick_nstress);
 
-    static XC::Matrix BK(brick_nstress,ndf);      // B matrix node k
+    static thread_local XC::Matrix BK(brick_nstress,ndf);      // B matrix node k
 
-    static XC::Matrix BJtranD(ndf,brick_nstress);
+    static thread_local XC::Matrix BJtranD(ndf,brick_nstress);
 
   //-------------------------------------------------------
 
@@ -795,6 +795,10 @@ XC::Brick::update(void)
   return 0;
 }
 
+//! @brief Return true if the materials of the element are thread safe.
+bool XC::Brick::isThreadSafe(void) const
+  { return physicalProperties.getMaterialsVector().isThreadSafe(); }
+
 
 //*********************************************************************
 //form residual and tangent
@@ -817,36 +821,36 @@ void  XC::Brick::formResidAndTangent( int tang_flag ) const
 
   //int success;
 
-  static double volume;
+  static thread_local double volume;
 
-  static double xsj;  // determinant jacaobian matrix
+  static thread_local double xsj;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss]; //volume element
+  static thread_local double dvol[numberGauss]; //volume element
 
-  static double gaussPoint[ndm];
+  static thread_local double gaussPoint[ndm];
 
-  static double shp[nShape][numberNodes];  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss]; //all the shape functions
 
-  static XC::Vector residJ(ndf); //nodeJ residual
+  static thread_local XC::Vector residJ(ndf); //nodeJ residual
 
-  static XC::Matrix stiffJK(ndf,ndf); //nodeJK stiffness
+  static thread_local XC::Matrix stiffJK(ndf,ndf); //nodeJK stiffness
 
-  static XC::Vector stress(brick_nstress);  //stress
+  static thread_local XC::Vector stress(brick_nstress);  //stress
 
-  static XC::Matrix dd(brick_nstress,brick_nstress);  //material tangent
+  static thread_local XC::Matrix dd(brick_nstress,brick_nstress);  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static XC::Matrix BJ(brick_nstress,ndf);      // B matrix node J
+    static thread_local XC::Matrix BJ(brick_nstress,ndf);      // B matrix node J
 
-    static XC::Matrix BJtran(ndf,brick_nstress);
+    static thread_local XC::Matrix BJtran(ndf,brick_nstress);
 
-    static XC::Matrix BK(brick_nstress,ndf);      // B matrix node k
+    static thread_local XC::Matrix BK(brick_nstress,ndf);      // B matrix node k
 
-    static XC::Matrix BJtranD(ndf,brick_nstress);
+    static thread_local XC::Matrix BJtranD(ndf,brick_nstress);
 
   //-------------------------------------------------------
 
@@ -1155,7 +1159,7 @@ XC::Response *XC::Brick::setResponse(const std::vector<std::string> &argv, Infor
 
 int XC::Brick::getResponse(int responseID, Information &eleInfo)
   {
-    static XC::Vector stresses(48);
+    static thread_local XC::Vector stresses(48);
     if(responseID == 1)
       return eleInfo.setVector(this->getResistingForce());
     else if(responseID == 2)
@@ -29,6 +29,7 @@
 #include "KDTreeNodes.h"
 #include "Node.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include <iterator>
 
 //! @brief Constructor.
 XC::NodePos::NodePos(const Node &n)
@@ -83,3 +84,23 @@ const XC::Node *XC::KDTreeNodes::getNearest(const Pos3d &pos, const double &r) c
       retval= found.first->getNodePtr();
     return retval;
   }
+
+//! @brief Returns the nodes whose position (initial position) lies inside
+//! the box defined by the points being passed as parameter
+//! (bounds included).
+//!
+//! @param pMin: vertex of the box with the minimum coordinates.
+//! @param pMax: vertex of the box with the maximum coordinates.
+std::deque<const XC::Node *> XC::KDTreeNodes::getInside(const Pos3d &pMin,const Pos3d &pMax) const
+  {
+    tree_type::_Region_ region(std::ptr_fun(NodePos::tac));
+    region._M_low_bounds[0]= pMin.x(); region._M_high_bounds[0]= pMax.x();
+    region._M_low_bounds[1]= pMin.y(); region._M_high_bounds[1]= pMax.y();
+    region._M_low_bounds[2]= pMin.z(); region._M_high_bounds[2]= pMax.z();
+    std::deque<NodePos> found;
+    find_within_range(region,std::back_inserter(found));
+    std::deque<const Node *> retval;
+    for(std::deque<NodePos>::const_iterator i= found.begin();i!=found.end();i++)
+      retval.push_back(i->getNodePtr());
+    return retval;
+  }
@@ -96,6 +96,7 @@
 
 std::deque<XC::Matrix> XC::Node::theMatrices;
 XC::DefaultTag XC::Node::defaultTag;
+size_t XC::Node::coordinatesVersion= 0;
 
 //! @brief Default constructor.
 //! @param theClassTag: tag of the class.
@@ -420,6 +421,13 @@ XC::Node::~Node(void)
 XC::DefaultTag &XC::Node::getDefaultTag(void)
   { return defaultTag; }
 
+//! @brief Returns a counter that is incremented each time the
+//! coordinates of any node can change (setPos, Mueve, non-const getCrds,...).
+//! The objects that cache data computed from the node positions
+//! (i.e. the KD trees of the sets) compare it to know if they are stale.
+const size_t &XC::Node::getCoordinatesVersion(void)
+  { return coordinatesVersion; }
+
 //! @brief Introduce en the node una constraint
 //! como la being passed as parameter.
 XC::SFreedom_Constraint *XC::Node::fix(const SFreedom_Constraint &seed)
@@ -498,9 +506,14 @@ const XC::Vector &XC::Node::getCrds(void) const
 //! 
 //! Returns the original coordinates in a Vector. The size of the vector
 //! is 2 if node object was created for a 2d problem and the size is 3 if
-//! created for a 3d problem.
+//! created for a 3d problem. As the coordinates can be modified
+//! through the returned reference, the coordinates version is
+//! incremented.
 XC::Vector &XC::Node::getCrds(void)
-  { return Crd; }
+  {
+    coordinatesVersion++;
+    return Crd;
+  }
 
 //! @brief Returns the node coordinates in a 3D space.
 XC::Vector XC::Node::getCrds3d(void) const
@@ -758,6 +771,7 @@ double XC::Node::getDist(const Pos3d &p,bool initialGeometry) const
 //! @brief Sets the node position.
 void XC::Node::setPos(const Pos3d &p)
   {
+    coordinatesVersion++;
     const size_t sz= getDim();
     if(sz==1)
       Crd[0]= p.x();
@@ -1664,6 +1678,7 @@ int XC::Node::recvData(const CommParameters &cp)
     res+= cp.receiveVector(unbalLoad,getDbTagData(),CommMetaData(7));
     res+= cp.receiveVector(unbalLoadWithInertia,getDbTagData(),CommMetaData(8));
     res+= cp.receiveVector(Crd,getDbTagData(),CommMetaData(9));
+    coordinatesVersion++;
     res+= cp.receiveMatrix(R,getDbTagData(),CommMetaData(10));
     res+= cp.receiveDoubles(alphaM,tributary,getDbTagData(),CommMetaData(11));
     res+= cp.receiveMatrix(theEigenvectors,getDbTagData(),CommMetaData(12));
@@ -1853,6 +1868,7 @@ int XC::Node::updateParameter(int pparameterID, Information &info)
             {
               //Set el value of the coordenada.
               Crd(pparameterID-4) = info.theDouble;
+              coordinatesVersion++;
 
               // Need to "setDomain" to make the change take effect.
               Domain *theDomain = this->getDomain();
@@ -2128,6 +2144,7 @@ int XC::Node::resetReactionForce(bool inclInertia)
 //! @brief Moves the node (intended only for its use from XC::Set).
 void XC::Node::Mueve(const Vector3d &desplaz)
   {
+    coordinatesVersion++;
     Crd(0)+= desplaz.x();
     Crd(1)+= desplaz.y();
     Crd(2)+= desplaz.z();
@@ -145,6 +145,7 @@ class Node: public MeshComponent
     void set_id_constraints(const ID &);
 
     static DefaultTag defaultTag; //<! tag for next new node.
+    static size_t coordinatesVersion; //!< incremented each time the coordinates of a node can change.
   protected:
 
     DbTagData &getDbTagData(void) const;
@@ -169,6 +170,7 @@ class Node: public MeshComponent
     virtual ~Node(void);
 
     static DefaultTag &getDefaultTag(void);
+    static const size_t &getCoordinatesVersion(void);
 
     // public methods dealing with the DOF at the node
     virtual int getNumberDOF(void) const;    
@@ -47,12 +47,21 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .def("meltAliveNodes",&XC::Mesh::melt_alive_nodes,"Allows movement of melted nodes.")
   .def("calculateNodalReactions",&XC::Mesh::calculateNodalReactions,"triggers nodal reaction calculation.")
   .def("checkNodalReactions",&XC::Mesh::checkNodalReactions,"checkNodalReactions(tolerande): check that reactions at nodes correspond to constrained degrees of freedom.")
+  .add_property("numThreads",&XC::Mesh::getNumThreads,&XC::Mesh::setNumThreads,"Number of threads used to commit, update and revert the state of the mesh (if zero, the hardware concurrency is used).")
   .add_property("getElementIter", make_function( &XC::Mesh::getElements, return_internal_reference<>() ),"returns an iterator over the elements of the mesh.")
   .def("getElement", make_function(getElementPtr, return_internal_reference<>() ),"Returns an element from its identifier.")
   .def("getNumElements", &XC::Mesh::getNumElements,"Returns the number of elements.")
   .def("getNumLiveElements", &XC::Mesh::getNumLiveElements,"Returns the number of live elements.")
   .def("getNumDeadElements", &XC::Mesh::getNumDeadElements,"Returns the number of dead elements.")
   .def("getNearestElement",make_function(getNearestElementPtrMesh, return_internal_reference<>() ),"Returns nearest node.")
+  .def("getNodeTagArray",&XC::Mesh::getNodeTagArray,"Returns the tags of the nodes in the order of the rows of the node arrays.")
+  .def("getNodeCoordinateArray",&XC::Mesh::getNodeCoordinateArray,"Returns a matrix with the coordinates of the nodes (one row for each node).")
+  .def("getNodeResponseArray",&XC::Mesh::getNodeResponseArray,"getNodeResponseArray(response): returns a matrix with the response (disp, vel, accel or reaction) of the nodes (one row for each node).")
+  .def("getNodeDisplacementArray",&XC::Mesh::getNodeDisplacementArray,"Returns a matrix with the displacements of the nodes (one row for each node).")
+  .def("getNodeReactionArray",&XC::Mesh::getNodeReactionArray,"Returns a matrix with the reactions of the nodes (one row for each node). The reactions must be computed first with calculateNodalReactions.")
+  .def("getNodeEigenvectorArray",&XC::Mesh::getNodeEigenvectorArray,"getNodeEigenvectorArray(mode): returns a matrix with the eigenvector of the nodes (one row for each node).")
+  .def("getElementTagArray",&XC::Mesh::getElementTagArray,"Returns the tags of the elements in the order of the rows of the element arrays.")
+  .def("getElementResistingForceArray",&XC::Mesh::getElementResistingForceArray,"Returns a matrix with the resisting forces of the elements (one row for each element).")
   .def("setDeadSRF",XC::Mesh::setDeadSRF,"Assigns Stress Reduction Factor for element deactivation. Syntax: setDeadSRF(factor)")
   .staticmethod("setDeadSRF")
   ;
@@ -124,6 +124,15 @@ int XC::Material::getResponse(int responseID, Information &info)
 void XC::Material::update(void)
    {return;}
 
+//! @brief Return true if the methods that compute the material
+//! response (stress, tangent,...) can be called concurrently from
+//! different threads for different material objects.
+//!
+//! Materials that store their results in class-wide (static) objects
+//! are not thread safe; so the default implementation returns false.
+bool XC::Material::isThreadSafe(void) const
+  { return false; }
+
 //! @brief Increments generalized strain
 //! @param incS: strain increment.
 void XC::Material::addInitialGeneralizedStrain(const Vector &incS)
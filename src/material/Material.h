@@ -108,6 +108,7 @@ class Material: public TaggedObject, public MovableObject
     virtual int getResponse(int responseID, Information &info);
 
     virtual void update(void);
+    virtual bool isThreadSafe(void) const;
 
     virtual const Vector &getGeneralizedStress(void) const= 0;
     virtual const Vector &getGeneralizedStrain(void) const= 0;
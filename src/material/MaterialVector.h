@@ -71,6 +71,7 @@ class MaterialVector: public std::vector<MAT *>, public CommandEntity, public Mo
     void setMaterial(size_t i,MAT *);
     void setMaterial(const MAT *,const std::string &);
     bool empty(void) const;
+    bool isThreadSafe(void) const;
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
@@ -209,6 +210,17 @@ bool MaterialVector<MAT>::empty(void) const
       return ((*this)[0]==nullptr);
   }
 
+//! @brief Returns true if all the materials are thread safe
+//! (see Material::isThreadSafe).
+template <class MAT>
+bool MaterialVector<MAT>::isThreadSafe(void) const
+  {
+    bool retval= !empty();
+    for(const_iterator i= mat_vector::begin();retval && (i!=mat_vector::end());i++)
+      retval= ((*i) && (*i)->isThreadSafe());
+    return retval;
+  }
+
 template <class MAT>
 void MaterialVector<MAT>::clearAll(void)
   {
@@ -238,7 +238,7 @@ const XC::Matrix &XC::ElasticIsotropicMaterial::getInitialTangent(void) const
     exit(-1);
 
     // Just to make it compile
-    static Matrix ret;
+    static thread_local Matrix ret;
     return ret;
   }
 
@@ -249,7 +249,7 @@ const XC::Vector &XC::ElasticIsotropicMaterial::getStress(void) const
     exit(-1);
     
     // Just to make it compile
-    static Vector ret= Vector();
+    static thread_local Vector ret= Vector();
     return ret;
   }
 
@@ -297,7 +297,7 @@ const XC::Tensor &XC::ElasticIsotropicMaterial::getTangentTensor(void) const
     exit(-1);
   
     // Just to make it compile
-    static Tensor t;
+    static thread_local Tensor t;
     return t;
   }
 
@@ -308,7 +308,7 @@ const XC::stresstensor &XC::ElasticIsotropicMaterial::getStressTensor(void) cons
     exit(-1);
 
     // Just to make it compile
-    static stresstensor t;
+    static thread_local stresstensor t;
     return t;
   }
 
@@ -319,7 +319,7 @@ const XC::straintensor &XC::ElasticIsotropicMaterial::getStrainTensor(void) cons
     exit(-1);
 
     // Just to make it compile
-    static XC::straintensor t;
+    static thread_local XC::straintensor t;
     return t;
   }
 
@@ -330,7 +330,7 @@ const XC::straintensor &XC::ElasticIsotropicMaterial::getPlasticStrainTensor(voi
     exit(-1);
         
     // Just to make it compile
-    static straintensor t;
+    static thread_local straintensor t;
     return t;
   }
 
@@ -138,6 +138,9 @@ class ElasticIsotropicMaterial : public NDMaterial
     virtual int commitState(void);
     virtual int revertToLastCommit(void);
     virtual int revertToStart(void);
+    //! @brief Scratch storage is per-thread (see thread_local members).
+    virtual bool isThreadSafe(void) const
+      { return true; }
     
     // Create a copy of material parameters AND state variables
     // Called by GenericSectionXD
@@ -70,11 +70,11 @@
 #include <utility/matrix/nDarray/straint.h>
 #include <utility/recorder/response/MaterialResponse.h>
 
-XC::Matrix XC::NDMaterial::errMatrix(1,1);
-XC::Vector XC::NDMaterial::errVector(1);
-XC::Tensor XC::NDMaterial::errTensor(2, def_dim_2, 0.0 );
-XC::stresstensor XC::NDMaterial::errstresstensor;
-XC::straintensor XC::NDMaterial::errstraintensor;
+thread_local XC::Matrix XC::NDMaterial::errMatrix(1,1);
+thread_local XC::Vector XC::NDMaterial::errVector(1);
+thread_local XC::Tensor XC::NDMaterial::errTensor(2, def_dim_2, 0.0 );
+thread_local XC::stresstensor XC::NDMaterial::errstresstensor;
+thread_local XC::straintensor XC::NDMaterial::errstraintensor;
 
 //! @brief Constructor.
 //!
@@ -372,13 +372,13 @@ int XC::NDMaterial::activateParameter(int parameterID)
 
 const XC::Vector &XC::NDMaterial::getStressSensitivity(int gradNumber, bool conditional)
   {
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
 const XC::Vector &XC::NDMaterial::getStrainSensitivity(int gradNumber)
   {
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
@@ -387,13 +387,13 @@ double XC::NDMaterial::getRhoSensitivity(int gradNumber)
 
 const XC::Matrix &XC::NDMaterial::getDampTangentSensitivity(int gradNumber)
   {
-    static XC::Matrix dummy(1,1);
+    static thread_local XC::Matrix dummy(1,1);
     return dummy;
   }
 
 const XC::Matrix &XC::NDMaterial::getTangentSensitivity(int gradNumber)
   {
-    static Matrix dummy(1,1);
+    static thread_local Matrix dummy(1,1);
     return dummy;
   }
 
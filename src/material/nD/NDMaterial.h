@@ -97,11 +97,11 @@ class Response;
 class NDMaterial: public Material
   {
   private:
-    static Matrix errMatrix;
-    static Vector errVector;
-    static Tensor errTensor;
-    static stresstensor errstresstensor;
-    static straintensor errstraintensor;
+    static thread_local Matrix errMatrix;
+    static thread_local Vector errVector;
+    static thread_local Tensor errTensor;
+    static thread_local stresstensor errstresstensor;
+    static thread_local straintensor errstraintensor;
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
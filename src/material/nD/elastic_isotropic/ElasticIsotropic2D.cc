@@ -54,7 +54,7 @@
 #include <utility/matrix/Matrix.h>
 #include "material/nD/NDMaterialType.h"
 
-XC::Matrix XC::ElasticIsotropic2D::D(3,3);
+thread_local XC::Matrix XC::ElasticIsotropic2D::D(3,3);
 
 XC::ElasticIsotropic2D::ElasticIsotropic2D(int tag, int classTag, double E, double nu, double rho)
   : ElasticIsotropicMaterial(tag, classTag, 3, E, nu, rho)
@@ -56,9 +56,9 @@
 #include "utility/matrix/Matrix.h"
 #include "material/nD/NDMaterialType.h"
 
-XC::Matrix XC::ElasticIsotropic3D::D(6,6);	  // global for XC::ElasticIsotropic3D only
-XC::Vector XC::ElasticIsotropic3D::sigma(6);	 // global for XC::ElasticIsotropic3D onyl
-XC::stresstensor XC::ElasticIsotropic3D::Stress;
+thread_local XC::Matrix XC::ElasticIsotropic3D::D(6,6);	  // global for XC::ElasticIsotropic3D only
+thread_local XC::Vector XC::ElasticIsotropic3D::sigma(6);	 // global for XC::ElasticIsotropic3D onyl
+thread_local XC::stresstensor XC::ElasticIsotropic3D::Stress;
 
 XC::ElasticIsotropic3D::ElasticIsotropic3D(int tag, double E, double nu, double rho):
   ElasticIsotropicMaterial(tag, ND_TAG_ElasticIsotropic3D,6, E, nu, rho), Dt()
@@ -202,7 +202,7 @@ const XC::straintensor &XC::ElasticIsotropic3D::getStrainTensor(void) const
 const XC::straintensor &XC::ElasticIsotropic3D::getPlasticStrainTensor(void) const
   {
     //Return zero XC::straintensor
-    static straintensor t;
+    static thread_local straintensor t;
     return t;
   }
 
@@ -53,8 +53,8 @@
 #include <utility/matrix/Matrix.h>
 #include "material/nD/NDMaterialType.h"
 
-XC::Vector XC::ElasticIsotropicAxiSymm::sigma(4);
-XC::Matrix XC::ElasticIsotropicAxiSymm::D(4,4);
+thread_local XC::Vector XC::ElasticIsotropicAxiSymm::sigma(4);
+thread_local XC::Matrix XC::ElasticIsotropicAxiSymm::D(4,4);
 
 XC::ElasticIsotropicAxiSymm::ElasticIsotropicAxiSymm(int tag, double E, double nu, double rho) :
   ElasticIsotropicMaterial(tag, ND_TAG_ElasticIsotropicAxiSymm,4, E, nu, rho)
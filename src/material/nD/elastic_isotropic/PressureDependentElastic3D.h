@@ -66,8 +66,8 @@ namespace XC {
 class PressureDependentElastic3D : public ElasticIsotropicMaterial
   {
   private:
-    static Vector sigma; //!< Stress vector
-    static Matrix D; //!< Elastic constants
+    static thread_local Vector sigma; //!< Stress vector
+    static thread_local Matrix D; //!< Elastic constants
 
     double exp; //!< exponent usually 0.6
     double p_ref; //!< Reference pressure, usually atmosphere pressure, i.e. 100kPa
@@ -70,9 +70,9 @@ class CrossSectionKR: public CommandEntity, public MovableObject
         value= tangent*fiberArea;
         vas1= y*value;
 
-        k[0]+= value; //Axial stiffness
-        k[1]+= vas1;
-        k[2]+= vas1 * y;
+        k[0]+= value; //Axial stiffness (0,0)->0
+        k[1]+= vas1; //(1,0)->1 y (0,1)->2
+        k[3]+= vas1 * y; //(1,1)->3
       }
     inline void updateK2d(const double &fiberArea,const double &y,const double &tangent)
       { updateK2d(kData,fiberArea,y,tangent); }
@@ -0,0 +1,253 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberBatch.cc
+
+#include "FiberBatch.h"
+#include "material/section/fiber_section/fiber/Fiber.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include <map>
+#include <typeinfo>
+#include <typeindex>
+
+//! @brief Constructor.
+XC::FiberBatch::FiberBatch(void)
+  : numSourceFibers(0), includeZeroArea(false), valid(false) {}
+
+//! @brief Copy constructor.
+//!
+//! The arrays point to the materials of the copied container so
+//! they are not copied; the new batch is rebuilt when needed.
+XC::FiberBatch::FiberBatch(const FiberBatch &)
+  : numSourceFibers(0), includeZeroArea(false), valid(false) {}
+
+//! @brief Assignment operator (see copy constructor).
+XC::FiberBatch &XC::FiberBatch::operator=(const FiberBatch &)
+  {
+    clear();
+    return *this;
+  }
+
+//! @brief Free the arrays.
+void XC::FiberBatch::clear(void)
+  {
+    materials.clear();
+    yLoc.clear(); zLoc.clear(); area.clear();
+    strain.clear(); stress.clear(); tangent.clear();
+    fs.clear(); ka.clear(); kay.clear(); kaz.clear();
+    groups.clear();
+    numSourceFibers= 0;
+    valid= false;
+  }
+
+//! @brief Return true if the batch has been built from a container
+//! with the number of fibers being passed as parameter and with the
+//! same treatment of the zero area fibers.
+bool XC::FiberBatch::isValid(const size_t &numFibers,const bool &zeroArea) const
+  { return (valid && (numFibers==numSourceFibers) && (zeroArea==includeZeroArea)); }
+
+//! @brief Fill the arrays from the fibers of the container.
+//!
+//! @param fibers: fiber container.
+//! @param zeroArea: if false, the fibers with zero area are ignored.
+void XC::FiberBatch::build(const std::deque<Fiber *> &fibers,const bool &zeroArea)
+  {
+    clear();
+    const size_t nf= fibers.size();
+    materials.reserve(nf);
+    yLoc.reserve(nf); zLoc.reserve(nf); area.reserve(nf);
+    std::map<std::type_index,size_t> groupIndex;
+    for(std::deque<Fiber *>::const_iterator i= fibers.begin();i!=fibers.end();i++)
+      {
+        Fiber *f= *i;
+        const double a= f->getArea();
+        if(zeroArea || (a!=0.0))
+          {
+            UniaxialMaterial *mat= f->getMaterial();
+            const std::type_index type(typeid(*mat));
+            std::map<std::type_index,size_t>::const_iterator j= groupIndex.find(type);
+            size_t ig= groups.size();
+            if(j==groupIndex.end())
+              {
+                groupIndex.insert(std::make_pair(type,ig));
+                groups.push_back(MaterialGroup(mat->getClassTag()));
+              }
+            else
+              ig= j->second;
+            groups[ig].indexes.push_back(materials.size());
+            materials.push_back(mat);
+            yLoc.push_back(f->getLocY());
+            zLoc.push_back(f->getLocZ());
+            area.push_back(a);
+          }
+      }
+    const size_t sz= materials.size();
+    strain.resize(sz,0.0); stress.resize(sz,0.0); tangent.resize(sz,0.0);
+    fs.resize(sz,0.0); ka.resize(sz,0.0); kay.resize(sz,0.0); kaz.resize(sz,0.0);
+    numSourceFibers= nf;
+    includeZeroArea= zeroArea;
+    valid= true;
+  }
+
+//! @brief Sum of the array components.
+//!
+//! Uses four partial sums so the loop can be vectorized.
+double XC::FiberBatch::sum(const std::vector<double> &a)
+  {
+    const size_t n= a.size();
+    const double *pa= a.data();
+    double s0= 0.0, s1= 0.0, s2= 0.0, s3= 0.0;
+    size_t i= 0;
+    for(;i+4<=n;i+=4)
+      {
+        s0+= pa[i]; s1+= pa[i+1];
+        s2+= pa[i+2]; s3+= pa[i+3];
+      }
+    for(;i<n;i++)
+      s0+= pa[i];
+    return (s0+s1)+(s2+s3);
+  }
+
+//! @brief Dot product of the arrays.
+//!
+//! Uses four partial sums so the loop can be vectorized.
+double XC::FiberBatch::dot(const std::vector<double> &a,const std::vector<double> &b)
+  {
+    const size_t n= a.size();
+    const double *pa= a.data();
+    const double *pb= b.data();
+    double s0= 0.0, s1= 0.0, s2= 0.0, s3= 0.0;
+    size_t i= 0;
+    for(;i+4<=n;i+=4)
+      {
+        s0+= pa[i]*pb[i]; s1+= pa[i+1]*pb[i+1];
+        s2+= pa[i+2]*pb[i+2]; s3+= pa[i+3]*pb[i+3];
+      }
+    for(;i<n;i++)
+      s0+= pa[i]*pb[i];
+    return (s0+s1)+(s2+s3);
+  }
+
+//! @brief Set the trial strain of the materials group by group and
+//! store the resulting stresses and tangents.
+int XC::FiberBatch::updateMaterials(void)
+  {
+    int retval= 0;
+    for(group_vector::const_iterator g= groups.begin();g!=groups.end();g++)
+      {
+        const std::vector<size_t> &idx= g->indexes;
+        if(!idx.empty())
+          {
+            const UniaxialMaterial *prototype= materials[idx[0]];
+            retval+= prototype->setTrialBatch(materials.data(),idx.data(),idx.size(),strain.data(),stress.data(),tangent.data(),packedState);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Set the trial strains of a plane section (e= e0+y*kz).
+int XC::FiberBatch::setTrialStrain(const double &e0,const double &kz)
+  {
+    const size_t n= size();
+    const double *y= yLoc.data();
+    double *e= strain.data();
+    for(size_t i= 0;i<n;i++)
+      e[i]= e0 + y[i]*kz;
+    return updateMaterials();
+  }
+
+//! @brief Set the trial strains of a 3D section (e= e0+y*kz+z*ky).
+int XC::FiberBatch::setTrialStrain(const double &e0,const double &kz,const double &ky)
+  {
+    const size_t n= size();
+    const double *y= yLoc.data();
+    const double *z= zLoc.data();
+    double *e= strain.data();
+    for(size_t i= 0;i<n;i++)
+      e[i]= e0 + y[i]*kz + z[i]*ky;
+    return updateMaterials();
+  }
+
+//! @brief Integrate the stiffness and the stress resultant of a plane section.
+//!
+//! @param ks: stiffness terms (k00, k01, k11).
+//! @param rs: stress resultant (N, Mz).
+void XC::FiberBatch::integrate2d(double ks[3],double rs[2])
+  {
+    const size_t n= size();
+    const double *__restrict__ s= stress.data();
+    const double *__restrict__ t= tangent.data();
+    const double *__restrict__ a= area.data();
+    const double *__restrict__ y= yLoc.data();
+    double *__restrict__ pfs= fs.data();
+    double *__restrict__ pka= ka.data();
+    double *__restrict__ pkay= kay.data();
+    for(size_t i= 0;i<n;i++)
+      {
+        pfs[i]= s[i]*a[i];
+        pka[i]= t[i]*a[i];
+        pkay[i]= y[i]*pka[i];
+      }
+    ks[0]= sum(ka);
+    ks[1]= sum(kay);
+    ks[2]= dot(kay,yLoc);
+    rs[0]= sum(fs);
+    rs[1]= dot(fs,yLoc);
+  }
+
+//! @brief Integrate the stiffness and the stress resultant of a 3D section.
+//!
+//! @param ks: stiffness terms (k00, k01, k02, k11, k12, k22).
+//! @param rs: stress resultant (N, Mz, My).
+void XC::FiberBatch::integrate3d(double ks[6],double rs[3])
+  {
+    const size_t n= size();
+    const double *__restrict__ s= stress.data();
+    const double *__restrict__ t= tangent.data();
+    const double *__restrict__ a= area.data();
+    const double *__restrict__ y= yLoc.data();
+    const double *__restrict__ z= zLoc.data();
+    double *__restrict__ pfs= fs.data();
+    double *__restrict__ pka= ka.data();
+    double *__restrict__ pkay= kay.data();
+    double *__restrict__ pkaz= kaz.data();
+    for(size_t i= 0;i<n;i++)
+      {
+        pfs[i]= s[i]*a[i];
+        pka[i]= t[i]*a[i];
+        pkay[i]= y[i]*pka[i];
+        pkaz[i]= z[i]*pka[i];
+      }
+    ks[0]= sum(ka);
+    ks[1]= sum(kay);
+    ks[2]= sum(kaz);
+    ks[3]= dot(kay,yLoc);
+    ks[4]= dot(kay,zLoc);
+    ks[5]= dot(kaz,zLoc);
+    rs[0]= sum(fs);
+    rs[1]= dot(fs,yLoc);
+    rs[2]= dot(fs,zLoc);
+  }
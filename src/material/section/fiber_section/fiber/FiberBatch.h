@@ -0,0 +1,110 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberBatch.h
+
+#ifndef FiberBatch_h
+#define FiberBatch_h
+
+#include "material/uniaxial/UniaxialPackedState.h"
+#include <vector>
+#include <deque>
+#include <cstddef>
+
+namespace XC {
+class Fiber;
+class UniaxialMaterial;
+
+//! @ingroup MATSCCFibers
+//
+//! @brief Structure of arrays with the state of the fibers of a section.
+//!
+//! Stores the position, area, strain, stress and tangent of the fibers
+//! in contiguous arrays so the computation of the fiber strains and the
+//! integration of the section resultants and stiffness are plain loops
+//! over doubles that the compiler can vectorize. The fibers are grouped
+//! by the type of its material and each group is updated with a single
+//! call to UniaxialMaterial::setTrialBatch.
+class FiberBatch
+  {
+  public:
+    //! @brief Fibers whose material is of the same type.
+    struct MaterialGroup
+      {
+        int classTag; //!< class tag of the material.
+        std::vector<size_t> indexes; //!< indexes of the fibers in the batch.
+        explicit MaterialGroup(const int &tag= 0)
+          : classTag(tag) {}
+      };
+    typedef std::vector<MaterialGroup> group_vector;
+  private:
+    std::vector<UniaxialMaterial *> materials; //!< fiber materials.
+    std::vector<double> yLoc; //!< y coordinates of the fibers.
+    std::vector<double> zLoc; //!< z coordinates of the fibers.
+    std::vector<double> area; //!< fiber areas.
+    std::vector<double> strain; //!< trial strains.
+    std::vector<double> stress; //!< trial stresses.
+    std::vector<double> tangent; //!< trial tangents.
+    std::vector<double> fs; //!< fiber forces (stress*area).
+    std::vector<double> ka; //!< fiber axial stiffness (tangent*area).
+    std::vector<double> kay; //!< ka*y.
+    std::vector<double> kaz; //!< ka*z.
+    group_vector groups; //!< fibers grouped by material.
+    UniaxialPackedState packedState; //!< scratch storage for the material kernels.
+    size_t numSourceFibers; //!< number of fibers of the container.
+    bool includeZeroArea; //!< true if the fibers with zero area are included.
+    bool valid; //!< true if the arrays correspond to the container.
+
+    static double sum(const std::vector<double> &);
+    static double dot(const std::vector<double> &,const std::vector<double> &);
+    int updateMaterials(void);
+  public:
+    FiberBatch(void);
+    FiberBatch(const FiberBatch &);
+    FiberBatch &operator=(const FiberBatch &);
+
+    void clear(void);
+    inline void invalidate(void)
+      { valid= false; }
+    bool isValid(const size_t &,const bool &) const;
+    void build(const std::deque<Fiber *> &,const bool &);
+
+    //! @brief Return the number of fibers in the batch.
+    inline size_t size(void) const
+      { return materials.size(); }
+    //! @brief Return the groups of fibers.
+    inline const group_vector &getGroups(void) const
+      { return groups; }
+
+    int setTrialStrain(const double &,const double &);
+    int setTrialStrain(const double &,const double &,const double &);
+    void integrate2d(double ks[3],double rs[2]);
+    void integrate3d(double ks[6],double rs[3]);
+  };
+
+} // end of XC namespace
+
+#endif
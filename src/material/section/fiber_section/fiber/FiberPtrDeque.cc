@@ -55,12 +55,12 @@
 
 //! @brief Constructor.
 XC::FiberPtrDeque::FiberPtrDeque(const size_t &num)
-  : CommandEntity(), fiber_ptrs_dq(num,static_cast<Fiber *>(nullptr)), MovableObject(0), yCenterOfMass(0.0), zCenterOfMass(0.0)
+  : CommandEntity(), fiber_ptrs_dq(num,static_cast<Fiber *>(nullptr)), MovableObject(0), yCenterOfMass(0.0), zCenterOfMass(0.0), batch()
   {}
 
 //! @brief Copy constructor.
 XC::FiberPtrDeque::FiberPtrDeque(const FiberPtrDeque &other)
-  : CommandEntity(other), fiber_ptrs_dq(other), MovableObject(other), yCenterOfMass(other.yCenterOfMass), zCenterOfMass(other.zCenterOfMass)
+  : CommandEntity(other), fiber_ptrs_dq(other), MovableObject(other), yCenterOfMass(other.yCenterOfMass), zCenterOfMass(other.zCenterOfMass), batch()
   {}
 
 //! @brief Assignment operator.
@@ -71,12 +71,23 @@ XC::FiberPtrDeque &XC::FiberPtrDeque::operator=(const FiberPtrDeque &other)
     MovableObject::operator=(other);
     yCenterOfMass= other.yCenterOfMass;
     zCenterOfMass= other.zCenterOfMass;
+    batch.clear();
     return *this;
   }
 
 //! @brief Adds the fiber to the container.
 void XC::FiberPtrDeque::push_back(Fiber *f)
-   { fiber_ptrs_dq::push_back(f); }
+   {
+     fiber_ptrs_dq::push_back(f);
+     batch.invalidate();
+   }
+
+//! @brief Removes all the fibers from the container.
+void XC::FiberPtrDeque::clear(void)
+   {
+     fiber_ptrs_dq::clear();
+     batch.clear();
+   }
 
 
 //! @brief Search for the fiber identified by the parameter.
@@ -1522,6 +1533,7 @@ int XC::FiberPtrDeque::updateCenterOfMass(void)
 int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSection2d &Section2d,CrossSectionKR &kr2)
   {
     kr2.zero();
+    batch.invalidate(); //Fibers may have changed.
     double Qz= 0.0;
     double Atot= 0.0;//!< Total area of the fibers.
     double fiberArea= 0.0;//!< Area of a fiber.
@@ -1583,30 +1595,15 @@ int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection2d &Sectio
 //! @brief Sets trial strains values.
 int XC::FiberPtrDeque::setTrialSectionDeformation(const FiberSection2d &Section2d,CrossSectionKR &kr2)
   {
-    int retval= 0;
     kr2.zero();
-    UniaxialMaterial *theMat;
-    double y,fiberArea,strain,tangent,stress, fs0; 
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
-      {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            // determine material strain and set it
-            strain= Section2d.get_strain(y);
-            retval+= theMat->setTrial(strain, stress, tangent);
-
-            //Updating stiffness matrix.
-            kr2.updateK2d(fiberArea,y,tangent);
-
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            kr2.updateNMz(fs0,y);
-          }
-      }
+    if(!batch.isValid(size(),false))
+      batch.build(*this,false); //Fibers with zero area are ignored.
+    const Vector &def= Section2d.getSectionDeformation();
+    const int retval= batch.setTrialStrain(def(0),def(1));
+    double ks[3], rs[2];
+    batch.integrate2d(ks,rs);
+    kr2.kData[0]= ks[0]; kr2.kData[1]= ks[1]; kr2.kData[3]= ks[2];
+    kr2.rData[0]= rs[0]; kr2.rData[1]= rs[1];
     kr2.kData[2]= kr2.kData[1]; //Simetría.
     return retval;
   }
@@ -1702,6 +1699,7 @@ int XC::FiberPtrDeque::commitSensitivity(const XC::Vector& defSens, int gradNumb
 int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSection3d &Section3d,CrossSectionKR &kr3)
   {
     kr3.zero();
+    batch.invalidate(); //Fibers may have changed.
     double Qy= 0.0,Qz= 0.0;
     double Atot= 0.0;
     double fiberArea= 0.0;
@@ -1761,31 +1759,16 @@ int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection3d &Sectio
 //! @brief Set the trial strains.
 int XC::FiberPtrDeque::setTrialSectionDeformation(FiberSection3d &Section3d,CrossSectionKR &kr3)
   {
-    int retval= 0;
     kr3.zero();
-    std::deque<Fiber *>::iterator i= begin();
-    UniaxialMaterial *theMat;
-    double y,z,fiberArea,tangent,stress, fs0; 
-    for(;i!= end();i++)
-      {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
-
-        // determine material strain and set it
-        retval+= theMat->setTrial(Section3d.get_strain(y,z), stress, tangent);
-
-        //Updating stiffness matrix.
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            kr3.updateK3d(fiberArea,y,z,tangent);
-
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            kr3.updateNMzMy(fs0,y,z);
-          }
-      }
+    if(!batch.isValid(size(),true))
+      batch.build(*this,true); //All the fibers are strained.
+    const Vector &def= Section3d.getSectionDeformation();
+    const int retval= batch.setTrialStrain(def(0),def(1),def(2));
+    double ks[6], rs[3];
+    batch.integrate3d(ks,rs);
+    kr3.kData[0]= ks[0]; kr3.kData[1]= ks[1]; kr3.kData[2]= ks[2];
+    kr3.kData[4]= ks[3]; kr3.kData[5]= ks[4]; kr3.kData[8]= ks[5];
+    kr3.rData[0]= rs[0]; kr3.rData[1]= rs[1]; kr3.rData[2]= rs[2];
     kr3.kData[3]= kr3.kData[1]; //Stiffness matrix symmetry.
     kr3.kData[6]= kr3.kData[2];
     kr3.kData[7]= kr3.kData[5];
@@ -1854,6 +1837,7 @@ const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSection3d &Sec
 int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSectionGJ &SectionGJ,CrossSectionKR &krGJ)
   {
     krGJ.zero();
+    batch.invalidate(); //Fibers may have changed.
     double Qy= 0.0,Qz= 0.0;
     double Atot= 0.0;
     double fiberArea= 0.0;
@@ -1916,37 +1900,22 @@ int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSectionGJ &Sectio
 //! @brief Sets generalized trial strains values.
 int XC::FiberPtrDeque::setTrialSectionDeformation(FiberSectionGJ &SectionGJ,CrossSectionKR &krGJ)
   {
-    int retval= 0;
     krGJ.zero();
-    UniaxialMaterial *theMat;
-    double y,z,fiberArea,tangent,stress, fs0; 
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
-      {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
-        fiberArea= (*i)->getArea();
-
-        if(fiberArea!=0.0)
-          {
-            // determine material strain and set it
-            retval= theMat->setTrial(SectionGJ.get_strain(y,z), stress, tangent);
-
-            //Updating stiffness matrix.
-            krGJ.updateKGJ(fiberArea,y,z,tangent);
-
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            krGJ.updateNMzMy(fs0,y,z);
-	  }
-      }
+    if(!batch.isValid(size(),false))
+      batch.build(*this,false); //Fibers with zero area are ignored.
+    const Vector &def= SectionGJ.getSectionDeformation();
+    const int retval= batch.setTrialStrain(def(0),def(1),def(2));
+    double ks[6], rs[3];
+    batch.integrate3d(ks,rs);
+    krGJ.kData[0]= ks[0]; krGJ.kData[1]= ks[1]; krGJ.kData[2]= ks[2];
+    krGJ.kData[5]= ks[3]; krGJ.kData[6]= ks[4]; krGJ.kData[10]= ks[5];
+    krGJ.rData[0]= rs[0]; krGJ.rData[1]= rs[1]; krGJ.rData[2]= rs[2];
     krGJ.kData[4]= krGJ.kData[1]; //Stiffness matrix symmetry.
     krGJ.kData[8]= krGJ.kData[2];
     krGJ.kData[9]= krGJ.kData[6];
     krGJ.kData[15]= SectionGJ.getGJ(); //(3,3)->15 //The remaining six elements of krGJ.kData are zero.
 
-    krGJ.rData[3]= SectionGJ.getGJ()*SectionGJ.getSectionDeformation()(3); //Torsion.
+    krGJ.rData[3]= SectionGJ.getGJ()*def(3); //Torsion.
     return retval;
   }
 
@@ -32,6 +32,7 @@
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include "xc_utils/src/geom/GeomObj.h"
 #include "utility/actor/actor/MovableObject.h"
+#include "FiberBatch.h"
 #include <deque>
 
 class Ref3d3d;
@@ -80,9 +81,13 @@ enum ClaseEsfuerzo {SIMPLE_TENSION,COMPOSED_TENSION,FLEXION_SIMPLE,FLEXION_COMPU
     mutable std::deque<std::list<Polygon2d> > dq_ac_effective; //!< (Where appropriate) effective concrete areas for each fiber.
     mutable std::deque<double> recubs; //! Cover for each fiber.
     mutable std::deque<double> seps; //! Spacing for each fiber.
+    FiberBatch batch; //!< Fiber state arrays used to integrate the section.
 
     inline void resize(const size_t &nf)
-      { fiber_ptrs_dq::resize(nf,nullptr); }
+      {
+        fiber_ptrs_dq::resize(nf,nullptr);
+        batch.invalidate();
+      }
 
     inline reference operator[](const size_t &i)
       { return fiber_ptrs_dq::operator[](i); }
@@ -97,6 +102,7 @@ enum ClaseEsfuerzo {SIMPLE_TENSION,COMPOSED_TENSION,FLEXION_SIMPLE,FLEXION_COMPU
   public:
 
     void push_back(Fiber *f);
+    void clear(void);
     inline size_t getNumFibers(void) const
       { return size(); }
 
@@ -61,10 +61,12 @@
 // What: "@(#) ElasticMaterial.C, revA"
 
 #include <material/uniaxial/ElasticMaterial.h>
+#include "material/uniaxial/UniaxialPackedState.h"
 #include "domain/component/Parameter.h"
 #include <utility/matrix/Vector.h>
 
 #include <domain/mesh/element/utils/Information.h>
+#include <typeinfo>
 
 
 //! @brief Constructor.
@@ -105,6 +107,42 @@ int XC::ElasticMaterial::setTrial(double strain, double &stress, double &tangent
     return 0;
   }
 
+//! @brief Sets the trial strain of a group of elastic materials
+//! (see UniaxialMaterial::setTrialBatch).
+//!
+//! The moduli and the initial strains are packed so the stresses are
+//! computed in a single loop over contiguous arrays.
+int XC::ElasticMaterial::setTrialBatch(UniaxialMaterial *const mats[],const size_t idx[],const size_t &n,const double strain[],double stress[],double tangent[],UniaxialPackedState &packed) const
+  {
+    if(typeid(*this)!=typeid(ElasticMaterial)) //Derived class.
+      return UniaxialMaterial::setTrialBatch(mats,idx,n,strain,stress,tangent,packed);
+    packed.resize(n,4);
+    double *__restrict__ pE= packed.getComponent(0);
+    double *__restrict__ pE0= packed.getComponent(1);
+    double *__restrict__ pEps= packed.getComponent(2);
+    double *__restrict__ pSigma= packed.getComponent(3);
+    for(size_t k= 0;k<n;k++) //Gather.
+      {
+        const size_t i= idx[k];
+        const ElasticMaterial *m= static_cast<const ElasticMaterial *>(mats[i]);
+        pE[k]= m->E;
+        pE0[k]= m->ezero;
+        pEps[k]= strain[i];
+      }
+    for(size_t k= 0;k<n;k++)
+      pSigma[k]= pE[k]*(pEps[k]-pE0[k]);
+    for(size_t k= 0;k<n;k++) //Scatter.
+      {
+        const size_t i= idx[k];
+        ElasticMaterial *m= static_cast<ElasticMaterial *>(mats[i]);
+        m->trialStrain= pEps[k];
+        m->trialStrainRate= 0.0;
+        stress[i]= pSigma[k];
+        tangent[i]= pE[k];
+      }
+    return 0;
+  }
+
 //! @brief Returns the product of \f$E * \epsilon\f$, where \f$\epsilon\f$ is
 //! the current trial strain.
 double XC::ElasticMaterial::getStress(void) const
@@ -94,6 +94,7 @@ class ElasticMaterial : public ElasticBaseMaterial
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0); 
+    int setTrialBatch(UniaxialMaterial *const mats[],const size_t idx[],const size_t &n,const double strain[],double stress[],double tangent[],UniaxialPackedState &) const;
     double getStrainRate(void) const {return trialStrainRate;};
     double getStress(void) const;
     double getTangent(void) const {return E;}
@@ -102,6 +103,8 @@ class ElasticMaterial : public ElasticBaseMaterial
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);        
+    bool isThreadSafe(void) const
+      { return true; }
 
     UniaxialMaterial *getCopy(void) const;
     
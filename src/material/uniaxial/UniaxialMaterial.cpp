@@ -92,6 +92,29 @@ int XC::UniaxialMaterial::setTrial(double strain, double &stress, double &tangen
     return res;
   }
 
+//! @brief Sets the trial strain of a group of materials of the
+//! same type as this one and returns their stresses and tangents.
+//!
+//! This default implementation calls setTrial for each material;
+//! the most common models override it with kernels that work on the
+//! packed state of the whole group.
+//! @param mats: materials (all of them of the same type that this one).
+//! @param idx: indexes of the materials of the group.
+//! @param n: number of indexes.
+//! @param strain: trial strains (indexed by idx).
+//! @param stress: resulting stresses (indexed by idx).
+//! @param tangent: resulting tangents (indexed by idx).
+int XC::UniaxialMaterial::setTrialBatch(UniaxialMaterial *const mats[],const size_t idx[],const size_t &n,const double strain[],double stress[],double tangent[],UniaxialPackedState &) const
+  {
+    int retval= 0;
+    for(size_t k= 0;k<n;k++)
+      {
+        const size_t i= idx[k];
+        retval+= mats[i]->setTrial(strain[i],stress[i],tangent[i]);
+      }
+    return retval;
+  }
+
 //! @brief Return the initial strain.
 double XC::UniaxialMaterial::getInitialStrain(void) const
   { return 0.0; }
@@ -104,7 +127,7 @@ double XC::UniaxialMaterial::getStrainRate(void) const
 //! @brief Return the generalized stress.
 const XC::Vector &XC::UniaxialMaterial::getGeneralizedStress(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     retval(0)= getStress();
     return retval;
   }
@@ -112,14 +135,14 @@ const XC::Vector &XC::UniaxialMaterial::getGeneralizedStress(void) const
 //! @brief Return the generalized strain.
 const XC::Vector &XC::UniaxialMaterial::getGeneralizedStrain(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     retval(0)= getStrain();
     return retval;
   }
 
 const XC::Vector &XC::UniaxialMaterial::getInitialGeneralizedStrain(void) const
   {
-    static Vector retval(1);
+    static thread_local Vector retval(1);
     retval(0)= getInitialStrain();
     return retval;
   }
@@ -222,7 +245,7 @@ XC::Response *XC::UniaxialMaterial::setResponse(const std::vector<std::string> &
 
 int XC::UniaxialMaterial::getResponse(int responseID, Information &matInfo)
   {
-    static XC::Vector stressStrain(2);
+    static thread_local XC::Vector stressStrain(2);
     // each subclass must implement its own stuff    
     switch(responseID)
       {
@@ -75,6 +75,7 @@ class Vector;
 class Matrix;
 class Information;
 class Response;
+class UniaxialPackedState;
 
 class SectionForceDeformation;
 
@@ -106,6 +107,7 @@ class UniaxialMaterial : public Material
     //!return 0 if successful, a negative number if not.
     virtual int setTrialStrain(double strain, double strainRate = 0.0)= 0;
     virtual int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0);
+    virtual int setTrialBatch(UniaxialMaterial *const mats[],const size_t idx[],const size_t &n,const double strain[],double stress[],double tangent[],UniaxialPackedState &) const;
 
     virtual double getInitialStrain(void) const;
     virtual double getStrain(void) const= 0;
@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//UniaxialPackedState.h
+
+#ifndef UniaxialPackedState_h
+#define UniaxialPackedState_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+
+//! @ingroup MatUnx
+//
+//! @brief Packed (structure of arrays) state of a group of uniaxial
+//! materials.
+//!
+//! Scratch storage used by UniaxialMaterial::setTrialBatch: the
+//! batch kernels copy the committed state and the parameters of
+//! each material into contiguous components, so the state update
+//! runs as a loop over arrays of doubles. The components never overlap
+//! (the kernels can declare its pointers __restrict__ to let the
+//! compiler vectorize the loops). The storage is owned by the caller
+//! and reused between calls.
+class UniaxialPackedState
+  {
+  private:
+    std::vector<double> data; //!< packed components.
+    size_t numMaterials; //!< number of materials in the group.
+  public:
+    UniaxialPackedState(void)
+      : numMaterials(0) {}
+    //! @brief Reserve room for the components of the materials.
+    //!
+    //! @param numMat: number of materials.
+    //! @param numComponents: number of values of each material.
+    void resize(const size_t &numMat,const size_t &numComponents)
+      {
+        numMaterials= numMat;
+        if(data.size()<numMat*numComponents)
+          data.resize(numMat*numComponents);
+      }
+    //! @brief Return the number of materials.
+    inline size_t size(void) const
+      { return numMaterials; }
+    //! @brief Return a pointer to the k-th component of the materials.
+    inline double *getComponent(const size_t &k)
+      { return data.data()+k*numMaterials; }
+  };
+
+} // end of XC namespace
+
+#endif
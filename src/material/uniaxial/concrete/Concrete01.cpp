@@ -62,12 +62,14 @@
 
 
 #include <material/uniaxial/concrete/Concrete01.h>
+#include "material/uniaxial/UniaxialPackedState.h"
 #include "domain/component/Parameter.h"
 #include <utility/matrix/Vector.h>
 
 #include <domain/mesh/element/utils/Information.h>
 #include <cmath>
 #include <cfloat>
+#include <typeinfo>
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
 //int count= 0;
@@ -237,6 +239,54 @@ int XC::Concrete01::setTrial(double strain, double &stress, double &tangent, dou
     return 0;
   }
 
+//! @brief Sets the trial strain of a group of Concrete01 materials
+//! (see UniaxialMaterial::setTrialBatch).
+//!
+//! The strain increments are computed over packed arrays and used to
+//! classify the materials; the unchanged and the tensioned ones (the
+//! cracked fibers of a section) are resolved without evaluating the
+//! envelope, which is computed only for the remaining materials.
+int XC::Concrete01::setTrialBatch(UniaxialMaterial *const mats[],const size_t idx[],const size_t &n,const double strain[],double stress[],double tangent[],UniaxialPackedState &packed) const
+  {
+    if(typeid(*this)!=typeid(Concrete01)) //Derived class.
+      return UniaxialMaterial::setTrialBatch(mats,idx,n,strain,stress,tangent,packed);
+    packed.resize(n,3);
+    double *__restrict__ pEps= packed.getComponent(0);
+    double *__restrict__ pDStrain= packed.getComponent(1);
+    double *__restrict__ pState= packed.getComponent(2); //0: unchanged, 1: tension, 2: compression.
+    for(size_t k= 0;k<n;k++) //Gather.
+      {
+        const size_t i= idx[k];
+        pEps[k]= strain[i];
+        pDStrain[k]= static_cast<const Concrete01 *>(mats[i])->convergedState.getStrain();
+      }
+    for(size_t k= 0;k<n;k++)
+      {
+        pDStrain[k]= pEps[k]-pDStrain[k];
+        pState[k]= (fabs(pDStrain[k])<DBL_EPSILON) ? 0.0 : ((pEps[k]>0.0) ? 1.0 : 2.0);
+      }
+    for(size_t k= 0;k<n;k++) //Scatter.
+      {
+        const size_t i= idx[k];
+        Concrete01 *m= static_cast<Concrete01 *>(mats[i]);
+        m->commit_to_trial_state();
+        if(pState[k]!=0.0)
+          {
+            m->trialState.Strain()= pEps[k];
+            if(pState[k]==1.0) //Tension.
+              {
+                m->trialState.Stress()= 0.0;
+                m->trialState.Tangent()= 0.0;
+              }
+            else
+              m->calcula_trial_state(pDStrain[k]);
+          }
+        stress[i]= m->trialState.getStress();
+        tangent[i]= m->trialState.getTangent();
+      }
+    return 0;
+  }
+
 //! @brief ??
 void XC::Concrete01::determineTrialState(double dStrain)
   {
@@ -120,6 +120,9 @@ class Concrete01: public ConcreteBase
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);        
+    int setTrialBatch(UniaxialMaterial *const mats[],const size_t idx[],const size_t &n,const double strain[],double stress[],double tangent[],UniaxialPackedState &) const;
+    bool isThreadSafe(void) const
+      { return true; }
 
     UniaxialMaterial *getCopy(void) const;
     
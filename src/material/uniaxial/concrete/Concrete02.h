@@ -175,6 +175,8 @@ class Concrete02: public RawConcrete
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);
+    bool isThreadSafe(void) const
+      { return true; }
     
     int sendSelf(CommParameters &);  
     int recvSelf(const CommParameters &);    
@@ -59,12 +59,14 @@
 
 
 #include <material/uniaxial/steel/Steel01.h>
+#include "material/uniaxial/UniaxialPackedState.h"
 #include "domain/component/Parameter.h"
 #include <utility/matrix/Vector.h>
 
 #include <domain/mesh/element/utils/Information.h>
 #include <cmath>
 #include <cfloat>
+#include <typeinfo>
 #include "utility/actor/actor/MovableVector.h"
 #include "utility/actor/actor/MovableMatrix.h"
 #include "utility/actor/actor/MatrixCommMetaData.h"
@@ -120,7 +122,6 @@ void XC::Steel01::determineTrialState(double dStrain)
   {
     const double fyOneMinusB= fy * (1.0 - b);
     const double Esh= getEsh();
-    const double epsy= getEpsy();
 
     const double c1= Esh*Tstrain;
     const double c2= TshiftN*fyOneMinusB;
@@ -158,40 +159,8 @@ void XC::Steel01::determineTrialState(double dStrain)
     else
       Ttangent = Esh;
 
-    //
     // Determine if a load reversal has occurred due to the trial strain
-    //
-
-    // Determine initial loading condition:  1 = loading (positive strain increment)
-                                         // -1 = unloading (negative strain increment)
-                                         // 0 initially
-    if(Tloading == 0 && dStrain != 0.0)
-      {
-        if(dStrain > 0.0)
-          Tloading = 1;
-        else
-          Tloading = -1;
-      }
-
-    // Transition from loading to unloading, i.e. positive strain increment
-    // to negative strain increment
-    if(Tloading == 1 && dStrain < 0.0)
-      {
-        Tloading = -1;
-        if(Cstrain > TmaxStrain)
-          TmaxStrain = Cstrain;
-        TshiftN= 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
-      }
-
-    // Transition from unloading to loading, i.e. negative strain increment
-    // to positive strain increment
-    if(Tloading == -1 && dStrain > 0.0)
-      {
-        Tloading = 1;
-        if(Cstrain < TminStrain)
-          TminStrain = Cstrain;
-        TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
-      }
+    detectLoadReversal(dStrain);
   }
 
 //! @brief Determines if a load reversal has occurred based on the trial strain
@@ -229,6 +198,86 @@ void XC::Steel01::detectLoadReversal(double dStrain)
      }
   }
 
+//! @brief Sets the trial strain of a group of Steel01 materials
+//! (see UniaxialMaterial::setTrialBatch).
+//!
+//! The committed state and the parameters of the materials are packed
+//! so the trial stresses and tangents are computed in a single
+//! branch-free loop over contiguous arrays; the load reversal
+//! detection (which needs the history variables) is made afterwards
+//! for each material.
+int XC::Steel01::setTrialBatch(UniaxialMaterial *const mats[],const size_t idx[],const size_t &n,const double strain[],double stress[],double tangent[],UniaxialPackedState &packed) const
+  {
+    if(typeid(*this)!=typeid(Steel01)) //Derived class.
+      return UniaxialMaterial::setTrialBatch(mats,idx,n,strain,stress,tangent,packed);
+    packed.resize(n,11);
+    double *__restrict__ pEps= packed.getComponent(0);
+    double *__restrict__ pCStrain= packed.getComponent(1);
+    double *__restrict__ pCStress= packed.getComponent(2);
+    double *__restrict__ pCTangent= packed.getComponent(3);
+    double *__restrict__ pShiftN= packed.getComponent(4);
+    double *__restrict__ pShiftP= packed.getComponent(5);
+    double *__restrict__ pFyOneMinusB= packed.getComponent(6);
+    double *__restrict__ pEsh= packed.getComponent(7);
+    double *__restrict__ pE0= packed.getComponent(8);
+    double *__restrict__ pSigma= packed.getComponent(9);
+    double *__restrict__ pTangent= packed.getComponent(10);
+    for(size_t k= 0;k<n;k++) //Gather.
+      {
+        const size_t i= idx[k];
+        const Steel01 *m= static_cast<const Steel01 *>(mats[i]);
+        pEps[k]= strain[i];
+        if(fabs(pEps[k])>fabs(10.0*m->getEpsy()))
+          std::clog << "Warning: the strain in material SteelBase0103 is very big: "
+                    << pEps[k] << std::endl;
+        pCStrain[k]= m->Cstrain;
+        pCStress[k]= m->Cstress;
+        pCTangent[k]= m->Ctangent;
+        pShiftN[k]= m->CshiftN;
+        pShiftP[k]= m->CshiftP;
+        pFyOneMinusB[k]= m->fy*(1.0-m->b);
+        pEsh[k]= m->getEsh();
+        pE0[k]= m->E0;
+      }
+    for(size_t k= 0;k<n;k++) //Same computation as determineTrialState.
+      {
+        const double dStrain= pEps[k]-pCStrain[k];
+        const double c1= pEsh[k]*pEps[k];
+        const double c2= pShiftN[k]*pFyOneMinusB[k];
+        const double c3= pShiftP[k]*pFyOneMinusB[k];
+        const double c= pCStress[k]+pE0[k]*dStrain;
+        const double s= std::max((c1-c2), std::min((c1+c3),c));
+        const double t= (fabs(s-c)<DBL_EPSILON) ? pE0[k] : pEsh[k];
+        const bool changed= (fabs(dStrain)>DBL_EPSILON);
+        pSigma[k]= changed ? s : pCStress[k];
+        pTangent[k]= changed ? t : pCTangent[k];
+      }
+    for(size_t k= 0;k<n;k++) //Scatter.
+      {
+        const size_t i= idx[k];
+        Steel01 *m= static_cast<Steel01 *>(mats[i]);
+        // Reset history variables to last converged state
+        m->TminStrain= m->CminStrain;
+        m->TmaxStrain= m->CmaxStrain;
+        m->TshiftP= m->CshiftP;
+        m->TshiftN= m->CshiftN;
+        m->Tloading= m->Cloading;
+        m->Tstrain= m->Cstrain;
+
+        const double dStrain= pEps[k]-pCStrain[k];
+        if(fabs(dStrain) > DBL_EPSILON)
+          {
+            m->Tstrain= pEps[k];
+            m->detectLoadReversal(dStrain);
+          }
+        m->Tstress= pSigma[k];
+        m->Ttangent= pTangent[k];
+        stress[i]= pSigma[k];
+        tangent[i]= pTangent[k];
+      }
+    return 0;
+  }
+
 int XC::Steel01::revertToStart(void)
   {
     SteelBase0103::revertToStart();
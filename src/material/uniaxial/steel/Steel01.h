@@ -109,6 +109,9 @@ class Steel01 : public SteelBase0103
     UniaxialMaterial *getCopy(void) const;
 
     int revertToStart(void);
+    int setTrialBatch(UniaxialMaterial *const mats[],const size_t idx[],const size_t &n,const double strain[],double stress[],double tangent[],UniaxialPackedState &) const;
+    bool isThreadSafe(void) const
+      { return true; }
 
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
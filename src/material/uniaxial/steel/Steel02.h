@@ -132,6 +132,8 @@ class Steel02 : public SteelBase
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isThreadSafe(void) const
+      { return true; }
 
     void setInitialStress(const double &);
     inline double getInitialStress(void) const
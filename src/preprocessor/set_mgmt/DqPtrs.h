@@ -34,8 +34,10 @@
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include <deque>
 #include <set>
+#include <unordered_set>
 #include "utility/actor/actor/MovableID.h"
 #include <boost/iterator/indirect_iterator.hpp>
+#include <algorithm>
 
 
 
@@ -52,6 +54,10 @@ namespace XC {
 //!  - Line.
 //!  - Suprface.
 //!  - Body.
+//!
+//!  The pointers are also stored in a hash table so the membership
+//!  queries (in, push_back, push_front, insert_unique,...) don't need
+//!  to traverse the deque.
 template <class T>
 class DqPtrs: public CommandEntity, protected std::deque<T *>
   {
@@ -63,6 +69,14 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     typedef typename lst_ptr::const_reference const_reference;
     typedef typename lst_ptr::size_type size_type;
     typedef boost::indirect_iterator<iterator> indIterator;
+  private:
+    typedef std::unordered_multiset<const T *> ptr_index;
+    ptr_index index; //!< hash table with the pointers of the container.
+    void build_index(void);
+  protected:
+    iterator erase(iterator);
+    template <class Predicate>
+    void remove_if(Predicate);
   public:
     DqPtrs(CommandEntity *owr= nullptr);
     DqPtrs(const DqPtrs &);
@@ -89,7 +103,7 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     inline indIterator indEnd(void)
       { return indIterator(lst_ptr::end()); }
     const T &get(const size_t &i) const;
-    void clear(void);
+    virtual void clear(void);
     void clearAll(void);
     inline size_type size(void) const
       { return lst_ptr::size(); }
@@ -99,7 +113,11 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     const ID &getTags(void) const;
     template <class InputIterator>
     void insert(iterator pos, InputIterator f, InputIterator l)
-      { lst_ptr::insert(pos,f,l); }
+      {
+        for(InputIterator i= f;i!=l;i++)
+	  index.insert(*i);
+        lst_ptr::insert(pos,f,l);
+      }
     template <class InputIterator>
     void insert_unique(iterator pos, InputIterator f, InputIterator l)
       {
@@ -111,7 +129,7 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
 	    if(!this->in(ptr))
 	      { tmp.push_back(ptr); }
 	  }
-	lst_ptr::insert(pos,tmp.begin(),tmp.end()); //Add only new ones.
+	insert(pos,tmp.begin(),tmp.end()); //Add only new ones.
       }
 
     
@@ -128,14 +146,14 @@ DqPtrs<T>::DqPtrs(CommandEntity *owr)
 //! @brief Copy constructor.
 template <class T>
 DqPtrs<T>::DqPtrs(const DqPtrs<T> &other)
-  : CommandEntity(other), lst_ptr(other)
+  : CommandEntity(other), lst_ptr(other), index(other.index)
   {}
 
 //! @brief Copy from deque container.
 template <class T>
 DqPtrs<T>::DqPtrs(const std::deque<T *> &ts)
   : CommandEntity(), lst_ptr(ts)
-  {}
+  { build_index(); }
 
 //! @brief Copy from set container.
 template <class T>
@@ -146,6 +164,7 @@ DqPtrs<T>::DqPtrs(const std::set<const T *> &st)
     k= st.begin();
     for(;k!=st.end();k++)
       lst_ptr::push_back(const_cast<T *>(*k));
+    build_index();
   }
 
 //! @brief Assignment operator.
@@ -154,9 +173,43 @@ DqPtrs<T> &DqPtrs<T>::operator=(const DqPtrs &other)
   {
     CommandEntity::operator=(other);
     lst_ptr::operator=(other);
+    index= other.index;
     return *this;
   }
 
+//! @brief Rebuilds the hash table from the contents of the deque.
+template <class T>
+void DqPtrs<T>::build_index(void)
+  {
+    index.clear();
+    index.reserve(size());
+    for(const_iterator i= begin();i!=end();i++)
+      index.insert(*i);
+  }
+
+//! @brief Removes the pointer at the position being passed as parameter.
+template <class T>
+typename DqPtrs<T>::iterator DqPtrs<T>::erase(iterator pos)
+  {
+    typename ptr_index::iterator j= index.find(*pos);
+    if(j!=index.end())
+      index.erase(j);
+    return lst_ptr::erase(pos);
+  }
+
+//! @brief Removes the pointers for which the predicate returns true
+//! (linear time).
+template <class T> template <class Predicate>
+void DqPtrs<T>::remove_if(Predicate pred)
+  {
+    iterator newEnd= std::remove_if(begin(),end(),pred);
+    if(newEnd!=end())
+      {
+        lst_ptr::erase(newEnd,end());
+        build_index();
+      }
+  }
+
 //! @brief += (union) operator.
 template <class T>
 DqPtrs<T> &DqPtrs<T>::operator+=(const DqPtrs &other)
@@ -178,7 +231,10 @@ void DqPtrs<T>::extend(const DqPtrs &other)
 //! @brief Clears out the list of pointers.
 template<class T>
 void DqPtrs<T>::clear(void)
-  { lst_ptr::clear(); }
+  {
+    lst_ptr::clear();
+    index.clear();
+  }
 
 //! @brief Clears out the list of pointers and erases the properties of the object (if any).
 template<class T>
@@ -199,16 +255,7 @@ const T &DqPtrs<T>::get(const size_t &i) const
 //! @brief Returns true if the pointer is in the container.
 template<class T>
 bool DqPtrs<T>::in(const T *ptr) const
-  {
-    bool retval= false;
-    for(const_iterator i= begin();i!= end();i++)
-      if(*i==ptr)
-        {
-          retval= true;
-          break;
-        }
-    return retval;
-  }
+  { return (index.find(ptr)!=index.end()); }
 
 
 template <class T>
@@ -217,9 +264,10 @@ bool DqPtrs<T>::push_back(T *t)
     bool retval= false;
     if(t)
       {
-        if(find(begin(),end(),t) == end()) //It's a new element.
+        if(!in(t)) //It's a new element.
           {
             lst_ptr::push_back(t);
+            index.insert(t);
             retval= true;
           }
       }
@@ -235,9 +283,10 @@ bool DqPtrs<T>::push_front(T *t)
     bool retval= false;
     if(t)
       {
-        if(find(begin(),end(),t) == end()) //New element.
+        if(!in(t)) //New element.
           {
             lst_ptr::push_front(t);
+            index.insert(t);
             retval= true;
           }
       }
@@ -233,20 +233,14 @@ std::deque<Polyline3d> XC::DqPtrsElem::getContours(const double &factor) const
 //! @brief Return a container with the elements that lie inside the
 //! geometric object.
 //!
+//! The elements are checked in its initial position and only those
+//! whose centroid lies inside the bounding box of the object (found
+//! using the KD tree) are checked.
+//!
 //! @param geomObj: geometric object that must contain the elements.
 //! @param tol: tolerance for "In" function.
 XC::DqPtrsElem XC::DqPtrsElem::pickElemsInside(const GeomObj3d &geomObj, const double &tol)
-  {
-    DqPtrsElem retval;
-    for(iterator i= begin();i!=end();i++)
-      {
-        Element *e= (*i);
-        assert(e);
-	if(e->In(geomObj,tol))
-	  retval.push_back(e);
-      }
-    return retval;    
-  }
+  { return pick_inside<DqPtrsElem>(geomObj,tol); }
 
 //! @brief Return the names of the materials.
 std::set<std::string> XC::DqPtrsElem::getMaterialNames(void) const
@@ -175,26 +175,14 @@ BND3d DqPtrsEntities<T>::Bnd(void) const
 template <class T>
 void DqPtrsEntities<T>::remove(const DqPtrsEntities<T> &other)
   {
-    for(const_iterator i= other.begin();i!= other.end();i++)
-      {
-        const T *t= (*i);
-	iterator j= find(this->begin(),this->end(),t);
-	if(j!=this->end()) //Found.
-	  this->erase(j);
-      }
+    this->remove_if([&other](const T *t){ return other.in(t); }); //Found.
   }
 
-//! @brief Removes the objects that belongs also to the parameter.
+//! @brief Removes the objects that doesn't belong also to the parameter.
 template <class T>
 void DqPtrsEntities<T>::intersect(const DqPtrsEntities<T> &other)
   {
-    for(const_iterator i= other.begin();i!= other.end();i++)
-      {
-        const T *t= (*i);
-	iterator j= find(this->begin(),this->end(),t);
-	if(j==this->end()) //Not found
-	  this->erase(j);
-      }
+    this->remove_if([&other](const T *t){ return !other.in(t); }); //Not found
   }
 
 //! @brief -= (difference) operator.
@@ -230,9 +218,8 @@ DqPtrsEntities<T> operator-(const DqPtrsEntities<T> &a,const DqPtrsEntities<T> &
     DqPtrsEntities<T> retval;
     for(typename DqPtrsEntities<T>::const_iterator i= a.begin();i!= a.end();i++)
       {
-        const T *t= (*i);
-	const typename DqPtrsEntities<T>::const_iterator j= find(b.begin(),b.end(),t);
-	if(j==b.end()) //Not found in b.
+        T *t= (*i);
+	if(!b.in(t)) //Not found in b.
 	  retval.push_back(t);
       }
     return retval;
@@ -245,9 +232,8 @@ DqPtrsEntities<T> operator*(const DqPtrsEntities<T> &a,const DqPtrsEntities<T> &
     DqPtrsEntities<T> retval;
     for(typename DqPtrsEntities<T>::const_iterator i= a.begin();i!= a.end();i++)
       {
-        const T *t= (*i);
-	const typename DqPtrsEntities<T>::const_iterator j= find(b.begin(),b.end(),t);
-	if(j!=b.end()) //Found also in b.
+        T *t= (*i);
+	if(b.in(t)) //Found also in b.
 	  retval.push_back(t);
       }
     return retval;
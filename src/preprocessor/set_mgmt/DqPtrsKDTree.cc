@@ -26,3 +26,42 @@
 //----------------------------------------------------------------------------
 
 #include "DqPtrsKDTree.h"
+#include "xc_utils/src/geom/d3/GeomObj3d.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include "domain/mesh/node/Node.h"
+#include <cmath>
+#include <algorithm>
+
+//! @brief Computes the box used to search the objects that can be
+//! inside the geometric object (its bounding box enlarged with the
+//! tolerance). Returns false if the object is not bounded.
+//!
+//! @param geomObj: geometric object.
+//! @param tol: tolerance for "In" function.
+//! @param pMin: vertex of the box with the minimum coordinates (output).
+//! @param pMax: vertex of the box with the maximum coordinates (output).
+bool XC::get_search_box(const GeomObj3d &geomObj,const double &tol,Pos3d &pMin,Pos3d &pMax)
+  {
+    const double xMin= geomObj.GetXMin(), xMax= geomObj.GetXMax();
+    const double yMin= geomObj.GetYMin(), yMax= geomObj.GetYMax();
+    const double zMin= geomObj.GetZMin(), zMax= geomObj.GetZMax();
+    bool retval= std::isfinite(xMin) && std::isfinite(xMax)
+      && std::isfinite(yMin) && std::isfinite(yMax)
+      && std::isfinite(zMin) && std::isfinite(zMax)
+      && (xMin<=xMax) && (yMin<=yMax) && (zMin<=zMax);
+    if(retval)
+      {
+        //Enlarge the box to avoid missing objects on its boundary
+        //because of rounding errors.
+        const double size= std::max(std::max(xMax-xMin,yMax-yMin),zMax-zMin);
+        const double margin= std::fabs(tol)+1e-9*std::max(size,1.0);
+        pMin= Pos3d(xMin-margin,yMin-margin,zMin-margin);
+        pMax= Pos3d(xMax+margin,yMax+margin,zMax+margin);
+      }
+    return retval;
+  }
+
+//! @brief Returns the version of the node coordinates (see
+//! Node::getCoordinatesVersion).
+size_t XC::get_coordinates_version(void)
+  { return Node::getCoordinatesVersion(); }
@@ -32,23 +32,39 @@
 
 #include "DqPtrs.h"
 #include <set>
+#include <vector>
+#include <unordered_set>
 
 class Pos3d;
 class Vector3d;
+class GeomObj3d;
 
 namespace XC {
 class TrfGeom;
 
+bool get_search_box(const GeomObj3d &,const double &,Pos3d &,Pos3d &);
+size_t get_coordinates_version(void);
+
 //!  @ingroup Set
 //! 
 //!  @brief Container with a KDTree.
 //!
+//! The tree stores the positions of the objects when they are inserted,
+//! so it becomes stale when the nodes are moved (Node::setPos,
+//! Node::Transform,...) by other means than this container. The
+//! tree remembers the version of the node coordinates
+//! (Node::getCoordinatesVersion) it was built with and is rebuilt
+//! before any query if they have changed since then.
 template <class T,class KDTree>
 class DqPtrsKDTree: public DqPtrs<T>
   {
     KDTree kdtree; //!< space-partitioning data structure for organizing objects.
+    size_t treeVersion; //!< version of the node coordinates used to build the tree.
   protected:
     void create_tree(void);
+    void update_tree(void);
+    template <class Container>
+    Container pick_inside(const GeomObj3d &, const double &) const;
   public:
     typedef typename DqPtrs<T>::const_iterator const_iterator;
     typedef typename DqPtrs<T>::iterator iterator;
@@ -66,10 +82,13 @@ class DqPtrsKDTree: public DqPtrs<T>
     //void extend_cond(const DqPtrsKDTree &,const std::string &cond);
     bool push_back(T *);
     bool push_front(T *);
+    void clear(void);
     void clearAll(void);
 
     T *getNearest(const Pos3d &p);
     const T *getNearest(const Pos3d &p) const;
+    std::vector<T *> getNearest(const std::vector<Pos3d> &);
+    std::deque<T *> getInside(const Pos3d &,const Pos3d &);
   };
 
 //! @brief Creates the KD tree.
@@ -83,12 +102,22 @@ void DqPtrsKDTree<T,KDTree>::create_tree(void)
         assert(tPtr);
         kdtree.insert(*tPtr);
       }
+    treeVersion= get_coordinates_version();
+  }
+
+//! @brief Rebuilds the KD tree if the node coordinates have
+//! changed since it was built.
+template <class T,class KDTree>
+void DqPtrsKDTree<T,KDTree>::update_tree(void)
+  {
+    if(treeVersion!=get_coordinates_version())
+      create_tree();
   }
 
 //! @brief Constructor.
 template <class T,class KDTree>
 DqPtrsKDTree<T,KDTree>::DqPtrsKDTree(CommandEntity *owr)
-  : DqPtrs<T>(owr) {}
+  : DqPtrs<T>(owr), treeVersion(get_coordinates_version()) {}
 
 //! @brief Copy constructor.
 template <class T,class KDTree>
@@ -105,7 +134,7 @@ DqPtrsKDTree<T,KDTree>::DqPtrsKDTree(const std::deque<T *> &ts)
 //! @brief Copy constructor.
 template <class T,class KDTree>
 DqPtrsKDTree<T,KDTree>::DqPtrsKDTree(const std::set<const T *> &st)
-  : DqPtrs<T>()
+  : DqPtrs<T>(), treeVersion(get_coordinates_version())
   {
     typename std::set<const T *>::const_iterator k;
     k= st.begin();
@@ -119,6 +148,7 @@ DqPtrsKDTree<T,KDTree> &DqPtrsKDTree<T,KDTree>::operator=(const DqPtrsKDTree &ot
   {
     DqPtrs<T>::operator=(other);
     kdtree= other.kdtree;
+    treeVersion= other.treeVersion;
     return *this;
   }
 
@@ -158,17 +188,28 @@ bool XC::DqPtrsKDTree<T,KDTree>::push_front(T *t)
     return retval;
 }
 
+//! @brief Clears out the list of pointers and the KD tree.
+template <class T,class KDTree>
+void DqPtrsKDTree<T,KDTree>::clear(void)
+  {
+    DqPtrs<T>::clear();
+    kdtree.clear();
+    treeVersion= get_coordinates_version();
+  }
+
 //! @brief Clears out the list of pointers and erases the properties of the object (if any).
 template <class T,class KDTree>
 void DqPtrsKDTree<T,KDTree>::clearAll(void)
   {
     DqPtrs<T>::clear();
     kdtree.clear();
+    treeVersion= get_coordinates_version();
   }
 //! @brief Returns the object closest to the point being passed as parameter.
 template <class T,class KDTree>
 T *DqPtrsKDTree<T,KDTree>::getNearest(const Pos3d &p)
   {
+    update_tree();
     T *retval= const_cast<T *>(kdtree.getNearest(p));
     return retval;
   }
@@ -181,6 +222,78 @@ const T *DqPtrsKDTree<T,KDTree>::getNearest(const Pos3d &p) const
     return this_no_const->getNearest(p);
   }
 
+//! @brief Returns the objects closest to each of the points being
+//! passed as parameter.
+template <class T,class KDTree>
+std::vector<T *> DqPtrsKDTree<T,KDTree>::getNearest(const std::vector<Pos3d> &points)
+  {
+    update_tree();
+    const size_t sz= points.size();
+    std::vector<T *> retval(sz,nullptr);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= const_cast<T *>(kdtree.getNearest(points[i]));
+    return retval;
+  }
+
+//! @brief Returns the objects whose position lies inside the box
+//! defined by the points being passed as parameter.
+//!
+//! @param pMin: vertex of the box with the minimum coordinates.
+//! @param pMax: vertex of the box with the maximum coordinates.
+template <class T,class KDTree>
+std::deque<T *> DqPtrsKDTree<T,KDTree>::getInside(const Pos3d &pMin,const Pos3d &pMax)
+  {
+    update_tree();
+    const std::deque<const T *> found= kdtree.getInside(pMin,pMax);
+    std::deque<T *> retval;
+    for(typename std::deque<const T *>::const_iterator i= found.begin();i!=found.end();i++)
+      {
+        const T *t= *i;
+        if(this->in(t)) //The tree can contain objects removed from the deque.
+          retval.push_back(const_cast<T *>(t));
+      }
+    return retval;
+  }
+
+//! @brief Return the objects that lie inside the geometric object.
+//!
+//! If the geometric object is bounded, only the objects whose position
+//! lies inside its bounding box (enlarged with the tolerance) are
+//! checked. The objects are returned in the order of this container.
+//! @param geomObj: geometric object that must contain the objects.
+//! @param tol: tolerance for "In" function.
+template <class T,class KDTree> template <class Container>
+Container DqPtrsKDTree<T,KDTree>::pick_inside(const GeomObj3d &geomObj, const double &tol) const
+  {
+    Container retval;
+    Pos3d pMin, pMax;
+    if(get_search_box(geomObj,tol,pMin,pMax)) //Bounded object.
+      {
+        DqPtrsKDTree<T,KDTree> *this_no_const= const_cast<DqPtrsKDTree *>(this);
+        const std::deque<T *> candidates= this_no_const->getInside(pMin,pMax);
+        std::unordered_set<const T *> inside;
+        for(typename std::deque<T *>::const_iterator i= candidates.begin();i!=candidates.end();i++)
+          {
+            const T *t= *i;
+            if(t->In(geomObj,0.0,tol))
+              inside.insert(t);
+          }
+        if(!inside.empty())
+          for(const_iterator i= this->begin();i!=this->end();i++)
+            if(inside.find(*i)!=inside.end())
+              retval.push_back(*i);
+      }
+    else
+      for(const_iterator i= this->begin();i!=this->end();i++)
+        {
+          T *t= (*i);
+          assert(t);
+          if(t->In(geomObj,0.0,tol))
+            retval.push_back(t);
+        }
+    return retval;
+  }
+
 //! @brief Return the union of both containers.
 template <class T,class KDTree>
 DqPtrsKDTree<T,KDTree> operator+(const DqPtrsKDTree<T,KDTree> &a,const DqPtrsKDTree<T,KDTree> &b)
@@ -195,19 +195,33 @@ std::set<int> XC::DqPtrsNode::getTags(void) const
 //! @brief Return a container with the nodes that lie inside the
 //! geometric object.
 //!
+//! The nodes are checked in its initial position and only those inside
+//! the bounding box of the object (found using the KD tree) are checked.
+//!
 //! @param geomObj: geometric object that must contain the nodes.
 //! @param tol: tolerance for "In" function.
 XC::DqPtrsNode XC::DqPtrsNode::pickNodesInside(const GeomObj3d &geomObj, const double &tol)
+  { return pick_inside<DqPtrsNode>(geomObj,tol); }
+
+//! @brief Returns the tags of the nodes closest to each of the points
+//! of the list.
+boost::python::list XC::DqPtrsNode::getNearestNodeTagsPy(const boost::python::list &l)
   {
-    DqPtrsNode retval;
-    for(iterator i= begin();i!=end();i++)
+    const size_t sz= len(l);
+    std::vector<Pos3d> points(sz);
+    for(size_t i= 0;i<sz;i++)
+      points[i]= boost::python::extract<Pos3d>(l[i]);
+    const std::vector<Node *> nearest= getNearest(points);
+    boost::python::list retval;
+    for(std::vector<Node *>::const_iterator i= nearest.begin();i!=nearest.end();i++)
       {
-        Node *n= (*i);
-        assert(n);
-	if(n->In(geomObj,tol))
-	  retval.push_back(n);
+        const Node *n= *i;
+        if(n)
+          retval.append(n->getTag());
+        else
+          retval.append(-1);
       }
-    return retval;    
+    return retval;
   }
 
 //! @brief Return the nodes current position boundary.
@@ -65,6 +65,7 @@ class DqPtrsNode: public DqPtrsKDTree<Node,KDTreeNodes>
     bool InNodeTags(const ID &) const;
     std::set<int> getTags(void) const;
     DqPtrsNode pickNodesInside(const GeomObj3d &, const double &tol= 0.0);
+    boost::python::list getNearestNodeTagsPy(const boost::python::list &);
     BND3d Bnd(const double &) const;
     Pos3d getCentroid(const double &) const;
 
@@ -40,6 +40,8 @@
 #include "solution/graph/graph/Graph.h"
 #include "solution/graph/graph/Vertex.h"
 #include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
+#include "domain/mesh/MeshResultArrays.h"
 
 #include "xc_utils/src/geom/pos_vec/SlidingVectorsSystem3d.h"
 #include "xc_utils/src/geom/d2/Plane.h"
@@ -329,6 +331,49 @@ size_t XC::SetMeshComp::getNumLiveNodes(void) const
 size_t XC::SetMeshComp::getNumDeadNodes(void) const
   { return nodes.getNumDeadNodes(); }
 
+//! @brief Returns the tags of the nodes in the order of the rows of
+//! the node arrays (getNodeCoordinateArray, getNodeDisplacementArray,...).
+XC::ID XC::SetMeshComp::getNodeTagArray(void) const
+  { return get_node_tags(std::vector<Node *>(nodes.begin(),nodes.end())); }
+
+//! @brief Returns the coordinates of the nodes (one row for each node).
+XC::Matrix XC::SetMeshComp::getNodeCoordinateArray(void) const
+  { return get_node_coordinates(std::vector<Node *>(nodes.begin(),nodes.end())); }
+
+//! @brief Returns the response of the nodes (one row for each node and
+//! one column for each DOF).
+//!
+//! @param response: disp, vel, accel or reaction.
+XC::Matrix XC::SetMeshComp::getNodeResponseArray(const std::string &response) const
+  { return get_node_response(std::vector<Node *>(nodes.begin(),nodes.end()),response); }
+
+//! @brief Returns the displacements of the nodes (one row for each node).
+XC::Matrix XC::SetMeshComp::getNodeDisplacementArray(void) const
+  { return getNodeResponseArray("disp"); }
+
+//! @brief Returns the reactions of the nodes (one row for each node).
+//!
+//! The reactions are not computed here; call calculateNodalReactions
+//! after the analysis step, otherwise the values stored in the nodes
+//! (zero or outdated) are returned.
+XC::Matrix XC::SetMeshComp::getNodeReactionArray(void) const
+  { return getNodeResponseArray("reaction"); }
+
+//! @brief Returns the eigenvectors of the nodes for the mode being
+//! passed as parameter (one row for each node).
+XC::Matrix XC::SetMeshComp::getNodeEigenvectorArray(const int &mode) const
+  { return get_node_eigenvectors(std::vector<Node *>(nodes.begin(),nodes.end()),mode); }
+
+//! @brief Returns the tags of the elements in the order of the rows of
+//! the element arrays (getElementResistingForceArray).
+XC::ID XC::SetMeshComp::getElementTagArray(void) const
+  { return get_element_tags(std::vector<Element *>(elements.begin(),elements.end())); }
+
+//! @brief Returns the resisting forces of the elements (one row for
+//! each element).
+XC::Matrix XC::SetMeshComp::getElementResistingForceArray(void) const
+  { return get_element_resisting_forces(std::vector<Element *>(elements.begin(),elements.end())); }
+
 //! @brief Deactivates the elements.
 void XC::SetMeshComp::kill_elements(void)
   { elements.kill_elements(); }
@@ -43,6 +43,7 @@ namespace XC {
 class TrfGeom;
 class SFreedom_Constraint;
 class ID;
+class Matrix;
 class Element;
 class Node;
 class Constraint;
@@ -186,6 +187,16 @@ class SetMeshComp: public SetBase
     std::set<int> getNodeTags(void) const;
     std::set<int> getElementTags(void) const;
     std::set<int> getConstraintTags(void) const;
+
+    // methods to retrieve the results of all the nodes and elements at once
+    ID getNodeTagArray(void) const;
+    Matrix getNodeCoordinateArray(void) const;
+    Matrix getNodeResponseArray(const std::string &) const;
+    Matrix getNodeDisplacementArray(void) const;
+    Matrix getNodeReactionArray(void) const;
+    Matrix getNodeEigenvectorArray(const int &) const;
+    ID getElementTagArray(void) const;
+    Matrix getElementResistingForceArray(void) const;
     Node *getNearestNode(const Pos3d &p);
     const Node *getNearestNode(const Pos3d &p) const;
 
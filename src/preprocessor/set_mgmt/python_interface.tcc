@@ -40,6 +40,7 @@ class_<XC::DqPtrsNode, bases<dq_ptrs_node> >("DqPtrsNode",no_init)
   .add_property("getNumDeadNodes", &XC::DqPtrsNode::getNumDeadNodes)
   .def("getNearestNode",make_function(getNearestNodeDqPtrs, return_internal_reference<>() ),"Returns nearest node.")
   .def("pickNodesInside",&XC::DqPtrsNode::pickNodesInside,"pickNodesInside(geomObj,tol) return the nodes inside the geometric object.")
+  .def("getNearestNodeTags",&XC::DqPtrsNode::getNearestNodeTagsPy,"getNearestNodeTags(positions) return the tags of the nodes nearest to each of the positions of the list.")
   .def("getBnd", &XC::DqPtrsNode::Bnd, "Returns nodes boundary.")
   .def("getCentroid", &XC::DqPtrsNode::getCentroid, "Returns nodes centroid.")
   .def(self += self)
@@ -132,6 +133,14 @@ class_<XC::SetMeshComp, bases<XC::SetBase>>("SetMeshComp",no_init)
   .def("getElementMaterials",&XC::SetMeshComp::getElementMaterialNamesPy,"getElementMaterials() return a list with the names of the element materials in the containe.")
   .def("pickElemsOfMaterial",&XC::SetMeshComp::pickElemsOfMaterial,"pickElemsOfMaterial(materialName) return the elements that have that material.")
   .def("getBnd", &XC::SetMeshComp::Bnd, "Returns set boundary.")
+  .def("getNodeTagArray",&XC::SetMeshComp::getNodeTagArray,"Returns the tags of the nodes in the order of the rows of the node arrays.")
+  .def("getNodeCoordinateArray",&XC::SetMeshComp::getNodeCoordinateArray,"Returns a matrix with the coordinates of the nodes (one row for each node).")
+  .def("getNodeResponseArray",&XC::SetMeshComp::getNodeResponseArray,"getNodeResponseArray(response): returns a matrix with the response (disp, vel, accel or reaction) of the nodes (one row for each node).")
+  .def("getNodeDisplacementArray",&XC::SetMeshComp::getNodeDisplacementArray,"Returns a matrix with the displacements of the nodes (one row for each node).")
+  .def("getNodeReactionArray",&XC::SetMeshComp::getNodeReactionArray,"Returns a matrix with the reactions of the nodes (one row for each node). The reactions must be computed first with calculateNodalReactions.")
+  .def("getNodeEigenvectorArray",&XC::SetMeshComp::getNodeEigenvectorArray,"getNodeEigenvectorArray(mode): returns a matrix with the eigenvector of the nodes (one row for each node).")
+  .def("getElementTagArray",&XC::SetMeshComp::getElementTagArray,"Returns the tags of the elements in the order of the rows of the element arrays.")
+  .def("getElementResistingForceArray",&XC::SetMeshComp::getElementResistingForceArray,"Returns a matrix with the resisting forces of the elements (one row for each element).")
   .def(self += self)
   .def(self -= self)
   .def(self *= self)
@@ -89,6 +89,8 @@ BOOST_PYTHON_MODULE(xc)
       .add_property("getSoluProc", make_function( getSoluProcRef, return_internal_reference<>() ),"Return a reference to the solver")
       .add_property("getDatabase", make_function( &XC::FEProblem::getDataBase, return_internal_reference<>() ),"Return a reference to the data base")
       .def("newDatabase", make_function( &XC::FEProblem::defineDatabase, return_internal_reference<>() ),"Create a data base")
+      .def("newOutputHandler", make_function( &XC::FEProblem::defineOutputHandler, return_internal_reference<>() ),"newOutputHandler(type,name,fileName,datasetName): creates an output handler for the recorders (type: 'HDF5'). Returns None if a handler with the same name already exists.")
+      .def("getOutputHandler", make_function( &XC::FEProblem::getOutputHandler, return_internal_reference<>() ),"getOutputHandler(name): returns the output handler with the given name.")
       .add_property("getFields", make_function( &XC::FEProblem::getFields, return_internal_reference<>() ),"Return fields definition (export).")
       .def("clearAll",&XC::FEProblem::clearAll,"Delete all entities in the FE problem.")
    ;
@@ -87,6 +87,8 @@ bool XC::AnalysisAggregation::alloc_soln_algo(const std::string &nmb)
       theSolnAlgo=new NewtonLineSearch(this);
     else if(nmb=="periodic_newton_soln_algo")
       theSolnAlgo=new PeriodicNewton(this);
+    else if(nmb=="adaptive_newton_soln_algo")
+      theSolnAlgo=new AdaptiveNewton(this);
     else if(nmb=="frequency_soln_algo")
       theSolnAlgo=new FrequencyAlgo(this);
     else if(nmb=="standard_eigen_soln_algo")
@@ -218,6 +220,8 @@ bool XC::AnalysisAggregation::alloc_integrator(const std::string &nmb,const Vect
       theIntegrator=new CentralDifferenceAlternative(this);
     else if(nmb=="central_difference_no_damping_integrator")
       theIntegrator=new CentralDifferenceNoDamping(this);
+    else if(nmb=="central_difference_lumped_mass_integrator")
+      theIntegrator=new CentralDifferenceLumpedMass(this);
     else if(nmb=="collocation_integrator")
       theIntegrator=new Collocation(this);
     else if(nmb=="collocation_hybrid_simulation_integrator")
@@ -321,6 +325,8 @@ bool XC::AnalysisAggregation::alloc_system_of_equations(const std::string &nmb,A
       theSOE=new DistributedDiagonalSOE(this);
     else if(nmb=="full_gen_lin_soe")
       theSOE=new FullGenLinSOE(this);
+    else if(nmb=="matrix_free_lin_soe")
+      theSOE=new MatrixFreeLinSOE(this);
 //     else if(nmb=="itpack_lin_soe")
 //       theSOE=new ItpackLinSOE(this);
     else if(nmb=="profile_spd_lin_soe")
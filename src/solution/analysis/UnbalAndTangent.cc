@@ -61,8 +61,10 @@ void XC::UnbalAndTangent::alloc(void)
       }
     else
       {
-        theResidual= unbalAndTangentArray.setUnbalance(nDOF);
-        theTangent= unbalAndTangentArray.setTangent(nDOF);
+        // class wide storage, the matrix and vector of the
+        // calling thread are used (see getTangent and getResidual).
+        theResidual= nullptr;
+        theTangent= nullptr;
       }             
   }
 
@@ -84,8 +86,8 @@ void XC::UnbalAndTangent::copy(const UnbalAndTangent &other)
       }
     else
       {
-        theResidual= other.theResidual;
-        theTangent= other.theTangent;
+        theResidual= nullptr;
+        theTangent= nullptr;
       }             
   }
 
@@ -118,29 +120,49 @@ XC::UnbalAndTangent::~UnbalAndTangent(void)
   { free_mem(); }
 
 //! @brief Return the tangent stiffness matrix.
+//!
+//! If the matrix is stored in the class wide storage, the
+//! one corresponding to the calling thread is returned.
 const XC::Matrix &XC::UnbalAndTangent::getTangent(void) const
   {
-    assert(theTangent);
-    return *theTangent;
+    if(theTangent)
+      return *theTangent;
+    else
+      return *unbalAndTangentArray.setTangent(nDOF);
   }
 
 //! @brief Return the tangent stiffness matrix.
+//!
+//! If the matrix is stored in the class wide storage, the
+//! one corresponding to the calling thread is returned.
 XC::Matrix &XC::UnbalAndTangent::getTangent(void)
   {
-    assert(theTangent);
-    return *theTangent;
+    if(theTangent)
+      return *theTangent;
+    else
+      return *unbalAndTangentArray.setTangent(nDOF);
   }
 
 //! @brief Returns the residual vector.
+//!
+//! If the vector is stored in the class wide storage, the
+//! one corresponding to the calling thread is returned.
 const XC::Vector &XC::UnbalAndTangent::getResidual(void) const
   {
-    assert(theResidual);
-    return *theResidual;
+    if(theResidual)
+      return *theResidual;
+    else
+      return *unbalAndTangentArray.setUnbalance(nDOF);
   }
 
 //! @brief Return the residual vector.
+//!
+//! If the vector is stored in the class wide storage, the
+//! one corresponding to the calling thread is returned.
 XC::Vector &XC::UnbalAndTangent::getResidual(void)
   {
-    assert(theResidual);
-    return *theResidual;
+    if(theResidual)
+      return *theResidual;
+    else
+      return *unbalAndTangentArray.setUnbalance(nDOF);
   }
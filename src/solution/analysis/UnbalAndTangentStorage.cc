@@ -28,36 +28,87 @@
 
 
 #include "UnbalAndTangentStorage.h"
+#include "utility/threads/parallel_loop.h"
+#include <algorithm>
+#include <cassert>
 
+//! @brief Constructor.
+//!
+//! @param n: size of the banks (objects with n or more degrees of
+//! freedom must allocate their own matrices and vectors).
 XC::UnbalAndTangentStorage::UnbalAndTangentStorage(const size_t &n)
-  : theMatrices(n), theVectors(n) {}
+  : bankSize(n), theMatrices(1,matrix_bank(n)), theVectors(1,vector_bank(n)) {}
+
+//! @brief Set the number of threads that can use the storage
+//! simultaneously (one bank of matrices and vectors for each).
+//!
+//! Must not be called while a parallel computation is running.
+void XC::UnbalAndTangentStorage::setNumThreads(const size_t &n)
+  {
+    const size_t nt= std::max(n,size_t(1));
+    if(nt>theMatrices.size())
+      {
+        theMatrices.resize(nt,matrix_bank(bankSize));
+        theVectors.resize(nt,vector_bank(bankSize));
+      }
+  }
+
+//! @brief Return the bank of matrices of the calling thread.
+XC::UnbalAndTangentStorage::matrix_bank &XC::UnbalAndTangentStorage::getMatrixBank(void)
+  {
+    const size_t idx= getThreadIndex();
+    assert(idx<theMatrices.size());
+    return theMatrices[idx];
+  }
+
+//! @brief Return the bank of matrices of the calling thread.
+const XC::UnbalAndTangentStorage::matrix_bank &XC::UnbalAndTangentStorage::getMatrixBank(void) const
+  {
+    const size_t idx= getThreadIndex();
+    assert(idx<theMatrices.size());
+    return theMatrices[idx];
+  }
+
+//! @brief Return the bank of vectors of the calling thread.
+XC::UnbalAndTangentStorage::vector_bank &XC::UnbalAndTangentStorage::getVectorBank(void)
+  {
+    const size_t idx= getThreadIndex();
+    assert(idx<theVectors.size());
+    return theVectors[idx];
+  }
+
+//! @brief Return the bank of vectors of the calling thread.
+const XC::UnbalAndTangentStorage::vector_bank &XC::UnbalAndTangentStorage::getVectorBank(void) const
+  {
+    const size_t idx= getThreadIndex();
+    assert(idx<theVectors.size());
+    return theVectors[idx];
+  }
 
 const XC::Matrix &XC::UnbalAndTangentStorage::getTangent(const size_t &i) const
-  { return theMatrices[i]; }
+  { return getMatrixBank()[i]; }
 
 XC::Matrix &XC::UnbalAndTangentStorage::getTangent(const size_t &i)
-  { return theMatrices[i]; }
+  { return getMatrixBank()[i]; }
 
 const XC::Vector &XC::UnbalAndTangentStorage::getUnbalance(const size_t &i) const
-  { return theVectors[i]; }
+  { return getVectorBank()[i]; }
 
 XC::Vector &XC::UnbalAndTangentStorage::getUnbalance(const size_t &i)
-  { return theVectors[i]; }
+  { return getVectorBank()[i]; }
 
 XC::Vector *XC::UnbalAndTangentStorage::setUnbalance(const size_t &i)
   {
-    if(theVectors[i].isEmpty())
-      { theVectors[i]= Vector(i); }
-    return &theVectors[i];
+    vector_bank &bank= getVectorBank();
+    if(bank[i].isEmpty())
+      { bank[i]= Vector(i); }
+    return &bank[i];
   }
 
 XC::Matrix *XC::UnbalAndTangentStorage::setTangent(const size_t &i)
   {
-    if(theMatrices[i].isEmpty())
-      { theMatrices[i]= Matrix(i,i); }
-    return &theMatrices[i];
+    matrix_bank &bank= getMatrixBank();
+    if(bank[i].isEmpty())
+      { bank[i]= Matrix(i,i); }
+    return &bank[i];
   }
-
-
-
-
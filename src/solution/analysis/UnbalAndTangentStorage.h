@@ -31,6 +31,7 @@
 #define UnbalAndTangentStorage_h
 
 #include <vector>
+#include <deque>
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
 
@@ -39,12 +40,26 @@ namespace XC {
 //! @ingroup Analysis
 //
 //! @brief Unbalanced force vector and tangent stiffness matrix.
+//!
+//! Class wide storage for the tangent matrices and residual vectors
+//! of the objects with less than size() degrees of freedom. To allow
+//! the concurrent computation of those matrices and vectors, the
+//! storage keeps a bank of matrices and vectors for each thread
+//! (see getThreadIndex); the number of banks must be set from the
+//! main thread (setNumThreads) before the parallel computation starts.
 class UnbalAndTangentStorage
   {
   private:
-    std::vector<Matrix> theMatrices; //!< array of matrices
-    std::vector<Vector> theVectors;  //!< array of vectors
+    typedef std::vector<Matrix> matrix_bank;
+    typedef std::vector<Vector> vector_bank;
+    size_t bankSize; //!< size of each bank.
+    std::deque<matrix_bank> theMatrices; //!< array of matrices for each thread.
+    std::deque<vector_bank> theVectors;  //!< array of vectors for each thread.
 
+    matrix_bank &getMatrixBank(void);
+    const matrix_bank &getMatrixBank(void) const;
+    vector_bank &getVectorBank(void);
+    const vector_bank &getVectorBank(void) const;
   public:
     UnbalAndTangentStorage(const size_t &);    
 
@@ -52,7 +67,10 @@ class UnbalAndTangentStorage
     Matrix *setTangent(const size_t &);
 
     inline size_t size(void) const
+      { return bankSize; }
+    inline size_t getNumThreads(void) const
       { return theMatrices.size(); }
+    void setNumThreads(const size_t &);
 
     const Matrix &getTangent(const size_t &) const;
     Matrix &getTangent(const size_t &);
@@ -84,15 +84,14 @@ void XC::EigenAlgorithm::eigen_to_model(int numModes)
     assert(theModel);
     theModel->setNumEigenvectors(numModes);
     Vector theEigenvalues(numModes);
-    Vector modalParticipationFactors(numModes);
     EigenSOE *theSOE= getEigenSOEPtr();
     assert(theSOE);
     for(int i= 1;i<=numModes;i++)
       {
         theEigenvalues[i-1] = theSOE->getEigenvalue(i);
-        modalParticipationFactors[i-1] = theSOE->getModalParticipationFactor(i);
         theModel->setEigenvector(i, theSOE->getEigenvector(i));
       }
     theModel->setEigenvalues(theEigenvalues);
-    theModel->setModalParticipationFactors(modalParticipationFactors);
+    //All the factors are computed at once.
+    theModel->setModalParticipationFactors(theSOE->getModalParticipationFactors());
   }
@@ -71,7 +71,28 @@
 
 //! @brief Constructor.
 XC::FrequencyAlgo::FrequencyAlgo(AnalysisAggregation *owr)
-  :EigenAlgorithm(owr,EigenALGORITHM_TAGS_Frequency) {}
+  :EigenAlgorithm(owr,EigenALGORITHM_TAGS_Frequency),
+   reuseMatrices(false), matricesFormed(false) {}
+
+//! @brief Return true if the matrices are formed only after a
+//! change in the domain.
+bool XC::FrequencyAlgo::getReuseMatrices(void) const
+  { return reuseMatrices; }
+
+//! @brief If true the stiffness and mass matrices are formed only
+//! in the first solution after a change in the domain.
+void XC::FrequencyAlgo::setReuseMatrices(const bool &b)
+  {
+    reuseMatrices= b;
+    matricesFormed= false;
+  }
+
+//! @brief The matrices must be formed again.
+int XC::FrequencyAlgo::domainChanged(void)
+  {
+    matricesFormed= false;
+    return EigenAlgorithm::domainChanged();
+  }
 
 //! @brief Calculate the eigenvalues for the current step.
 int XC::FrequencyAlgo::solveCurrentStep(int nModes)
@@ -87,20 +108,24 @@ int XC::FrequencyAlgo::solveCurrentStep(int nModes)
         return -1;
       }
 
-    if(theIntegrator->formK()<0) //Builds tangent stiffness matrix.
+    if(!(reuseMatrices && matricesFormed))
       {
-        std::cerr << "WARNING FrequencyAlgo::solverCurrentStep() - ";
-        std::cerr << "the Integrator failed in formK().\n";
-        return -2;
-      }
+        matricesFormed= false;
+        if(theIntegrator->formK()<0) //Builds tangent stiffness matrix.
+          {
+            std::cerr << "WARNING FrequencyAlgo::solverCurrentStep() - ";
+            std::cerr << "the Integrator failed in formK().\n";
+            return -2;
+          }
 
-    if(theIntegrator->formM()<0) //Form the mass matrix.
-      {
-        std::cerr << "WARNING FrequencyAlgo::solverCurrentStep() - ";
-        std::cerr << "the Integrator failed in formM().\n";
-        return -3;
+        if(theIntegrator->formM()<0) //Form the mass matrix.
+          {
+            std::cerr << "WARNING FrequencyAlgo::solverCurrentStep() - ";
+            std::cerr << "the Integrator failed in formM().\n";
+            return -3;
+          }
+        matricesFormed= true;
       }
-
     if(theSOE->solve(nModes) < 0) //Computes eigenmodes.
       {
         std::cerr << "Warning XC::FrequencyAlgo::solveCurrentStep() - ";
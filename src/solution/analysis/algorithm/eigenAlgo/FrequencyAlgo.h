@@ -74,14 +74,26 @@ namespace XC {
 //! @ingroup EigenAlgo
 //
 //! @brief Algorithm to obtain the natural frequencies of the model.
+//!
+//! If reuseMatrices is true the stiffness and mass matrices are formed
+//! only in the first solution after a change in the domain, so the
+//! system of equations can reuse them (i.e. to compute the modes
+//! around different shifts).
 class FrequencyAlgo : public EigenAlgorithm
   {
+    bool reuseMatrices; //!< if true don't form K and M again until the domain changes.
+    bool matricesFormed; //!< true if K and M have been formed.
+
     friend class AnalysisAggregation;
     FrequencyAlgo(AnalysisAggregation *);
     virtual SolutionAlgorithm *getCopy(void) const;
   public:
      
     virtual int solveCurrentStep(int numModes);
+    virtual int domainChanged(void);
+
+    bool getReuseMatrices(void) const;
+    void setReuseMatrices(const bool &);
      
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
@@ -23,7 +23,9 @@
 
 class_<XC::EigenAlgorithm, bases<XC::SolutionAlgorithm>, boost::noncopyable >("EigenAlgorithm", "Solution algorithm for eigenproblems.",no_init);
 
-class_<XC::FrequencyAlgo, bases<XC::EigenAlgorithm>, boost::noncopyable >("FrequencyAlgo","Solution algorithm for obtaining the natural frequencies of the model", no_init);
+class_<XC::FrequencyAlgo, bases<XC::EigenAlgorithm>, boost::noncopyable >("FrequencyAlgo","Solution algorithm for obtaining the natural frequencies of the model", no_init)
+  .add_property("reuseMatrices", &XC::FrequencyAlgo::getReuseMatrices, &XC::FrequencyAlgo::setReuseMatrices,"If true the stiffness and mass matrices are formed only in the first solution after a change in the domain.")
+  ;
 
 class_<XC::LinearBucklingAlgo, bases<XC::EigenAlgorithm>, boost::noncopyable >("LinearBucklingAlgo", "Solution algorithm for linear buckling analysis", no_init);
 
@@ -0,0 +1,378 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveNewton.cc
+
+#include <solution/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.h>
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/integrator/IncrementalIntegrator.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <solution/analysis/convergenceTest/ConvergenceTest.h>
+#include "solution/AnalysisAggregation.h"
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+namespace {
+typedef std::chrono::steady_clock Clock;
+
+//! @brief Return the seconds elapsed between both time points.
+inline double elapsed(const Clock::time_point &t0,const Clock::time_point &t1)
+  { return std::chrono::duration<double>(t1-t0).count(); }
+
+//! @brief Update a running mean of the measured times.
+inline void update_mean(double &mean,const double &value)
+  { mean= (mean>0.0) ? 0.75*mean+0.25*value : value; }
+}
+
+//! @brief Constructor.
+XC::AdaptiveNewton::AdaptiveNewton(AnalysisAggregation *owr,int theTangentToUse)
+  :NewtonBased(owr,EquiALGORITHM_TAGS_AdaptiveNewton,theTangentToUse),
+   maxRatio(0.5), maxReuse(10), reuseAcrossSteps(false), useCostModel(true),
+   tangentValid(false), freshTangent(false), reuseCount(0), freshRate(-1.0),
+   tangentTime(0.0), freshSolveTime(0.0), reusedSolveTime(0.0), residualTime(0.0),
+   numSteps(0), numIterations(0), numFactorizations(0), totalTangentTime(0.0)
+  {}
+
+//! @brief Form the tangent and measure the time spent on it.
+int XC::AdaptiveNewton::form_tangent(IncrementalIntegrator &theIntegrator)
+  {
+    const Clock::time_point t0= Clock::now();
+    const int retval= theIntegrator.formTangent(tangent);
+    if(retval<0)
+      {
+        tangentValid= false;
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the integrator failed in formTangent()\n";
+      }
+    else
+      {
+        tangentTime= elapsed(t0,Clock::now());
+        totalTangentTime+= tangentTime;
+        numFactorizations++;
+        tangentValid= true;
+        freshTangent= true;
+        reuseCount= 0;
+      }
+    return retval;
+  }
+
+//! @brief Return the last norm computed by the convergence test
+//! (or -1 if not available).
+//!
+//! When test() returns -1 the iteration counter has been already
+//! incremented so the last computed norm is the one before it.
+double XC::AdaptiveNewton::get_last_norm(const ConvergenceTest &theTest) const
+  {
+    double retval= -1.0;
+    const Vector &norms= theTest.getNorms();
+    const int k= theTest.getNumTests()-2;
+    if((k>=0) && (k<norms.Size()))
+      retval= norms(k);
+    return retval;
+  }
+
+//! @brief Return true if the tangent must be formed again.
+//!
+//! @param rate: ratio between the last two norms computed by the
+//! convergence test (negative if not available).
+bool XC::AdaptiveNewton::tangent_needed(const double &rate) const
+  {
+    bool retval= false;
+    if(reuseCount>=maxReuse)
+      retval= true;
+    else if(rate>=maxRatio)
+      retval= true;
+    else if(useCostModel && (rate>0.0) && (freshRate>=0.0))
+      {
+        // Reduction of the logarithm of the norm per unit of time
+        // with the current factorization and with a new one.
+        const double iterTime= residualTime+reusedSolveTime;
+        const double factTime= tangentTime+std::max(freshSolveTime-reusedSolveTime,0.0);
+        if(iterTime>0.0)
+          {
+            const double rFresh= std::max(freshRate,1e-12);
+            const double gainReused= -log(rate)/iterTime;
+            const double gainFresh= -log(rFresh)/(iterTime+factTime);
+            retval= (gainFresh>gainReused);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Solves the current step.
+int XC::AdaptiveNewton::solveCurrentStep(void)
+  {
+    AnalysisModel *theAnalysisModel= getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator= getIncrementalIntegratorPtr();
+    LinearSOE *theSOE= getLinearSOEPtr();
+    ConvergenceTest *theTest= getConvergenceTestPtr();
+
+    if(!theAnalysisModel || !theIntegrator || !theSOE || !theTest)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: undefined model, integrator,"
+                  << " system of equations or convergence test.\n";
+        return -5;
+      }
+
+    if(theIntegrator->formUnbalance() < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the integrator failed in formUnbalance()\n";
+        tangentValid= false;
+        return -2;
+      }
+
+    if(!(reuseAcrossSteps && tangentValid))
+      if(form_tangent(*theIntegrator) < 0)
+        return -1;
+
+    theTest->set_owner(getAnalysisAggregation());
+    if(theTest->start() < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the convergence test object failed in start()\n";
+        return -3;
+      }
+
+    int result= -1;
+    int count= 0;
+    double lastNorm= -1.0;
+    do
+      {
+        const Clock::time_point t0= Clock::now();
+        if(theSOE->solve() < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the system of equations failed in solve()\n";
+            tangentValid= false;
+            return -3;
+          }
+        const Clock::time_point t1= Clock::now();
+
+        if(theIntegrator->update(theSOE->getX()) < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the integrator failed in update()\n";
+            tangentValid= false;
+            return -4;
+          }
+
+        if(theIntegrator->formUnbalance() < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the integrator failed in formUnbalance()\n";
+            tangentValid= false;
+            return -2;
+          }
+        const Clock::time_point t2= Clock::now();
+        if(freshTangent)
+          freshSolveTime= elapsed(t0,t1);
+        else
+          update_mean(reusedSolveTime,elapsed(t0,t1));
+        update_mean(residualTime,elapsed(t1,t2));
+        numIterations++;
+        reuseCount++;
+
+        this->record(count++); //Call the record(...) method of all the recorders.
+        result= theTest->test();
+
+        if(result == -1)
+          {
+            const double norm= get_last_norm(*theTest);
+            double rate= -1.0;
+            if((lastNorm>0.0) && (norm>=0.0))
+              rate= norm/lastNorm;
+            if(freshTangent && (rate>=0.0))
+              freshRate= rate;
+            freshTangent= false;
+            lastNorm= norm;
+            if(tangent_needed(rate))
+              if(form_tangent(*theIntegrator) < 0)
+                return -1;
+          }
+      }
+    while(result == -1);
+
+    if(result == -2)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the convergence test object failed in test()"
+                  << std::endl
+                  << "convergence test message: "
+		  << theTest->getStatusMsg(1) << std::endl;
+        tangentValid= false;
+        return -3;
+      }
+    numSteps++;
+    return result;
+  }
+
+//! @brief Invalidate the stored tangent when the model changes.
+int XC::AdaptiveNewton::domainChanged(void)
+  {
+    tangentValid= false;
+    freshTangent= false;
+    return NewtonBased::domainChanged();
+  }
+
+//! @brief Return the rate of convergence over which the tangent
+//! is always formed again.
+double XC::AdaptiveNewton::getMaxRatio(void) const
+  { return maxRatio; }
+
+//! @brief Set the rate of convergence over which the tangent
+//! is always formed again.
+void XC::AdaptiveNewton::setMaxRatio(const double &r)
+  { maxRatio= r; }
+
+//! @brief Return the maximum number of iterations that use the same tangent.
+int XC::AdaptiveNewton::getMaxReuse(void) const
+  { return maxReuse; }
+
+//! @brief Set the maximum number of iterations that use the same tangent.
+void XC::AdaptiveNewton::setMaxReuse(const int &n)
+  { maxReuse= std::max(n,1); }
+
+//! @brief Return true if the tangent is kept from one step to the next one.
+bool XC::AdaptiveNewton::getReuseAcrossSteps(void) const
+  { return reuseAcrossSteps; }
+
+//! @brief Set if the tangent is kept from one step to the next one.
+void XC::AdaptiveNewton::setReuseAcrossSteps(const bool &b)
+  { reuseAcrossSteps= b; }
+
+//! @brief Return true if the measured times are used to decide
+//! when to form the tangent.
+bool XC::AdaptiveNewton::getUseCostModel(void) const
+  { return useCostModel; }
+
+//! @brief Set if the measured times are used to decide when to form
+//! the tangent (if false the decision depends only on the rate of
+//! convergence and the number of iterations, so it's repeatable).
+void XC::AdaptiveNewton::setUseCostModel(const bool &b)
+  { useCostModel= b; }
+
+//! @brief Return the number of steps solved.
+int XC::AdaptiveNewton::getNumSteps(void) const
+  { return numSteps; }
+
+//! @brief Return the number of iterations (one solve each).
+int XC::AdaptiveNewton::getNumIterations(void) const
+  { return numIterations; }
+
+//! @brief Return the number of times the tangent was formed.
+int XC::AdaptiveNewton::getNumFactorizations(void) const
+  { return numFactorizations; }
+
+//! @brief Return the number of factorizations saved with respect
+//! to the Newton-Raphson algorithm (one for each iteration).
+int XC::AdaptiveNewton::getNumFactorizationsSaved(void) const
+  { return numIterations-numFactorizations; }
+
+//! @brief Return the time (in seconds) spent forming the tangent.
+double XC::AdaptiveNewton::getTangentTime(void) const
+  { return totalTangentTime; }
+
+//! @brief Set the statistics to zero.
+void XC::AdaptiveNewton::resetStatistics(void)
+  {
+    numSteps= 0;
+    numIterations= 0;
+    numFactorizations= 0;
+    totalTangentTime= 0.0;
+  }
+
+//! @brief Send object members through the channel being passed as parameter.
+int XC::AdaptiveNewton::sendData(CommParameters &cp)
+  {
+    int res= NewtonBased::sendData(cp);
+    res+= cp.sendDouble(maxRatio,getDbTagData(),CommMetaData(3));
+    res+= cp.sendInts(maxReuse,reuseAcrossSteps,useCostModel,getDbTagData(),CommMetaData(4));
+    return res;
+  }
+
+//! @brief Receives object members through the channel being passed as parameter.
+int XC::AdaptiveNewton::recvData(const CommParameters &cp)
+  {
+    int res= NewtonBased::recvData(cp);
+    res+= cp.receiveDouble(maxRatio,getDbTagData(),CommMetaData(3));
+    int reuse= reuseAcrossSteps, cost= useCostModel;
+    res+= cp.receiveInts(maxReuse,reuse,cost,getDbTagData(),CommMetaData(4));
+    reuseAcrossSteps= reuse;
+    useCostModel= cost;
+    tangentValid= false;
+    return res;
+  }
+
+//! @brief Sends object through the channel being passed as parameter.
+int XC::AdaptiveNewton::sendSelf(CommParameters &cp)
+  {
+    setDbTag(cp);
+    const int dataTag= getDbTag();
+    inicComm(5);
+    int res= sendData(cp);
+
+    res+= cp.sendIdData(getDbTagData(),dataTag);
+    if(res < 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; failed to send data\n";
+    return res;
+  }
+
+//! @brief Receives object through the channel being passed as parameter.
+int XC::AdaptiveNewton::recvSelf(const CommParameters &cp)
+  {
+    inicComm(5);
+    const int dataTag= getDbTag();
+    int res= cp.receiveIdData(getDbTagData(),dataTag);
+
+    if(res<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to receive ids.\n";
+    else
+      {
+        res+= recvData(cp);
+        if(res<0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+		    << "; failed to receive data.\n";
+      }
+    return res;
+  }
+
+void XC::AdaptiveNewton::Print(std::ostream &s, int flag)
+  {
+    if(flag == 0)
+      {
+        s << getClassName() << std::endl;
+        s << "Max ratio: " << maxRatio
+          << " max reuse: " << maxReuse << std::endl;
+        s << "Iterations: " << numIterations
+          << " factorizations: " << numFactorizations
+          << " saved: " << getNumFactorizationsSaved() << std::endl;
+      }
+  }
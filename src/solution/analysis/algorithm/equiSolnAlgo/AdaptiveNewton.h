@@ -0,0 +1,121 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveNewton.h
+
+#ifndef AdaptiveNewton_h
+#define AdaptiveNewton_h
+
+#include <solution/analysis/algorithm/equiSolnAlgo/NewtonBased.h>
+
+namespace XC {
+class ConvergenceTest;
+
+//! @ingroup EQSolAlgo
+//
+//! @brief Newton-Raphson algorithm that reuses the factorized tangent
+//! while it keeps giving a good rate of convergence.
+//!
+//! After each iteration the contraction rate is estimated as the ratio
+//! between the last two norms computed by the convergence test. The
+//! tangent is formed (and factorized) again when:
+//! - the rate is greater than maxRatio (the iteration stagnates or
+//!   diverges).
+//! - the tangent has been used in maxReuse iterations.
+//! - (if the cost model is enabled) the estimated reduction of the norm
+//!   per unit of time obtained with a new tangent is greater than the
+//!   one obtained with the current one. The estimation uses the
+//!   measured time of the last tangent formation and factorization,
+//!   the mean time of the iterations that reuse the factorization and
+//!   the rate observed on the first iteration after the last
+//!   factorization.
+//!
+//! With reuseAcrossSteps the tangent of the previous step is used
+//! to begin the next one, until the analysis model changes.
+class AdaptiveNewton: public NewtonBased
+  {
+  private:
+    double maxRatio; //!< rate over which the tangent is always formed.
+    int maxReuse; //!< maximum number of iterations with the same tangent.
+    bool reuseAcrossSteps; //!< if true the tangent is kept between steps.
+    bool useCostModel; //!< if true use the timings to decide.
+
+    bool tangentValid; //!< true if the SOE has a tangent factorized.
+    bool freshTangent; //!< true if the tangent has not been used yet.
+    int reuseCount; //!< iterations done with the current tangent.
+    double freshRate; //!< rate observed with the last formed tangent.
+    double tangentTime; //!< time spent forming the last tangent.
+    double freshSolveTime; //!< time of the first solve with it.
+    double reusedSolveTime; //!< mean time of the solves with reused factors.
+    double residualTime; //!< mean time to update and form the unbalance.
+
+    // statistics.
+    int numSteps; //!< number of solved steps.
+    int numIterations; //!< number of iterations (solves).
+    int numFactorizations; //!< number of tangent formations.
+    double totalTangentTime; //!< time spent forming the tangents.
+
+    int form_tangent(IncrementalIntegrator &);
+    double get_last_norm(const ConvergenceTest &) const;
+    bool tangent_needed(const double &) const;
+  protected:
+    int sendData(CommParameters &);
+    int recvData(const CommParameters &);
+
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    AdaptiveNewton(AnalysisAggregation *,int tangent = CURRENT_TANGENT);
+    virtual SolutionAlgorithm *getCopy(void) const;
+  public:
+    int solveCurrentStep(void);
+    int domainChanged(void);
+
+    double getMaxRatio(void) const;
+    void setMaxRatio(const double &);
+    int getMaxReuse(void) const;
+    void setMaxReuse(const int &);
+    bool getReuseAcrossSteps(void) const;
+    void setReuseAcrossSteps(const bool &);
+    bool getUseCostModel(void) const;
+    void setUseCostModel(const bool &);
+
+    int getNumSteps(void) const;
+    int getNumIterations(void) const;
+    int getNumFactorizations(void) const;
+    int getNumFactorizationsSaved(void) const;
+    double getTangentTime(void) const;
+    void resetStatistics(void);
+
+    virtual int sendSelf(CommParameters &);
+    virtual int recvSelf(const CommParameters &);
+
+    void Print(std::ostream &s, int flag =0);
+  };
+inline SolutionAlgorithm *AdaptiveNewton::getCopy(void) const
+  { return new AdaptiveNewton(*this); }
+} // end of XC namespace
+
+#endif
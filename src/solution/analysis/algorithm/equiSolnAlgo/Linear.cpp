@@ -93,6 +93,9 @@ int XC::Linear::resuelve(void)
         return -5;
       }
 
+    if(theIncIntegrator->solvesCurrentStep()) //Explicit integrator that doesn't use the SOE.
+      return theIncIntegrator->solveCurrentStep();
+
     if(theIncIntegrator->formTangent()<0) //Builds tangent stiffness matrix.
       {
         std::cerr << getClassName() << "::" << __FUNCTION__
@@ -45,4 +45,17 @@ class_<XC::NewtonRaphson, bases<XC::NewtonBased>, boost::noncopyable >("NewtonRa
 
 class_<XC::PeriodicNewton, bases<XC::NewtonBased>, boost::noncopyable >("PeriodicNewton", no_init);
 
+class_<XC::AdaptiveNewton, bases<XC::NewtonBased>, boost::noncopyable >("AdaptiveNewton", no_init)
+  .add_property("maxRatio",&XC::AdaptiveNewton::getMaxRatio,&XC::AdaptiveNewton::setMaxRatio,"Rate of convergence (ratio between two successive norms of the convergence test) over which the tangent is always formed again.")
+  .add_property("maxReuse",&XC::AdaptiveNewton::getMaxReuse,&XC::AdaptiveNewton::setMaxReuse,"Maximum number of iterations that use the same tangent.")
+  .add_property("reuseAcrossSteps",&XC::AdaptiveNewton::getReuseAcrossSteps,&XC::AdaptiveNewton::setReuseAcrossSteps,"If true the tangent of the previous step is used to begin the next one.")
+  .add_property("useCostModel",&XC::AdaptiveNewton::getUseCostModel,&XC::AdaptiveNewton::setUseCostModel,"If true the measured times of factorization and iteration are used to decide when to form the tangent.")
+  .add_property("numSteps",&XC::AdaptiveNewton::getNumSteps,"Number of steps solved.")
+  .add_property("numIterations",&XC::AdaptiveNewton::getNumIterations,"Number of iterations.")
+  .add_property("numFactorizations",&XC::AdaptiveNewton::getNumFactorizations,"Number of times the tangent was formed.")
+  .add_property("numFactorizationsSaved",&XC::AdaptiveNewton::getNumFactorizationsSaved,"Factorizations saved with respect to the Newton-Raphson algorithm.")
+  .add_property("tangentTime",&XC::AdaptiveNewton::getTangentTime,"Time (seconds) spent forming the tangent.")
+  .def("resetStatistics",&XC::AdaptiveNewton::resetStatistics,"Set the statistics to zero.")
+  ;
+
 #include "lineSearch/python_interface.tcc"
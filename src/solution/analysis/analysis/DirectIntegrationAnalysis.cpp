@@ -265,9 +265,10 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 //! - It then invokes domainChanged() on \p theIntegrator and
 //!   theAlgorithm to inform these objects that changes have occurred
 //!   in the model.
-//! - It invokes {\em setSize(theModel.getDOFGraph())} on {\em
+//! - It invokes {\em updateSize(theModel)} on {\em
 //!   theSOE} which causes the system of equation to determine its size
-//!   based on the connectivity of the dofs in the analysis model. 
+//!   based on the connectivity of the dofs in the analysis model (if
+//!   that connectivity has not changed the previous size is kept). 
 //! - Finally it invokes domainChanged() on \p theIntegrator and theAlgorithm. 
 //!   Returns \f$0\f$ if successful. At any stage above, if an error occurs the
 //!   method is stopped, a warning message is printed and a negative number
@@ -297,9 +298,10 @@ int XC::DirectIntegrationAnalysis::domainChanged(void)
     solution_method->getModelWrapperPtr()->getConstraintHandlerPtr()->doneNumberingDOF();
 
     // we invoke setGraph() on the XC::LinearSOE which
-    // causes that object to determine its size
+    // causes that object to determine its size (the graph
+    // is not rebuilt if the sparsity has not changed).
 
-    solution_method->getLinearSOEPtr()->setSize(solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFGraph());
+    solution_method->getLinearSOEPtr()->updateSize(*solution_method->getModelWrapperPtr()->getAnalysisModelPtr());
 
     // we invoke domainChange() on the integrator and algorithm
     solution_method->getTransientIntegratorPtr()->domainChanged();
@@ -464,8 +466,8 @@ int XC::DirectIntegrationAnalysis::setLinearSOE(LinearSOE &theNewSOE)
       }
     else
       {
-        Graph &theGraph = solution_method->getModelWrapperPtr()->getAnalysisModelPtr()->getDOFGraph();
-        if(solution_method->getLinearSOEPtr()->setSize(theGraph) < 0)
+        AnalysisModel &theModel= *solution_method->getModelWrapperPtr()->getAnalysisModelPtr();
+        if(solution_method->getLinearSOEPtr()->updateSize(theModel) < 0)
           {
 	    std::cerr << getClassName() << "::" << __FUNCTION__
 		      << "; LinearSOE::setSize() failed";
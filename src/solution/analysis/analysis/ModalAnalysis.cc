@@ -33,10 +33,19 @@
 
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeIter.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/ElementIter.h"
+#include "xc_utils/src/kernel/python_utils.h"
+#include <algorithm>
+#include <cmath>
 
 //! @brief Constructor.
 XC::ModalAnalysis::ModalAnalysis(AnalysisAggregation *analysis_aggregation)
-  :EigenAnalysis(analysis_aggregation), espectro() {}
+  :EigenAnalysis(analysis_aggregation), espectro(), cqcTol(1e-6) {}
 
 //! @brief Returns the acceleration that corresponds to the period
 //! being passed as parameter.
@@ -90,3 +99,420 @@ XC::Matrix XC::ModalAnalysis::getCQCModalCrossCorrelationCoefficients(const Vect
     return retval;
   }
 
+
+//! @brief Returns the SRSS combination of the modal responses.
+//! @param modalValues: matrix with the peak modal values of each
+//! response component (rows) for each mode (columns).
+XC::Vector XC::ModalAnalysis::getSRSSCombination(const Matrix &modalValues)
+  {
+    const size_t nRows= modalValues.noRows();
+    const size_t nModes= modalValues.noCols();
+    Vector retval(nRows);
+    double *acc= retval.getDataPtr();
+    const double *data= modalValues.getDataPtr();
+    for(size_t i= 0;i<nModes;i++)
+      {
+        const double *ci= data+i*nRows; //Matrix data is stored by columns.
+        for(size_t k= 0;k<nRows;k++)
+          acc[k]+= ci[k]*ci[k];
+      }
+    for(size_t k= 0;k<nRows;k++)
+      acc[k]= sqrt(acc[k]);
+    return retval;
+  }
+
+//! @brief Returns the CQC combination of the modal responses.
+//!
+//! The response components are processed in blocks small enough to
+//! keep the partial sums in cache while the mode pairs are traversed;
+//! the loops over the components of each block run over contiguous
+//! memory. The cross terms whose correlation coefficient is not greater
+//! than tol are not computed.
+//! @param modalValues: matrix with the peak modal values of each
+//! response component (rows) for each mode (columns).
+//! @param rho: modal cross-correlation coefficients (see
+//! getCQCModalCrossCorrelationCoefficients).
+//! @param tol: cross terms with |rho(i,j)|<=tol are ignored.
+XC::Vector XC::ModalAnalysis::getCQCCombination(const Matrix &modalValues,const Matrix &rho,const double &tol)
+  {
+    const size_t nRows= modalValues.noRows();
+    const size_t nModes= modalValues.noCols();
+    Vector retval(nRows);
+    if((size_t(rho.noRows())!=nModes) || (size_t(rho.noCols())!=nModes))
+      {
+        std::cerr << "ModalAnalysis::" << __FUNCTION__
+                  << "; ERROR the correlation matrix has dimension "
+                  << rho.noRows() << "x" << rho.noCols()
+                  << " and there are " << nModes << " modes." << std::endl;
+        return retval;
+      }
+    //Mode pairs to combine.
+    std::vector<std::pair<size_t,size_t> > pairs;
+    std::vector<double> factors;
+    for(size_t i= 0;i<nModes;i++)
+      for(size_t j= i+1;j<nModes;j++)
+        if(std::abs(rho(i,j))>tol)
+          {
+            pairs.push_back(std::make_pair(i,j));
+            factors.push_back(rho(i,j)+rho(j,i));
+          }
+    const size_t numPairs= pairs.size();
+    double *acc= retval.getDataPtr();
+    const double *data= modalValues.getDataPtr();
+    const size_t blockSize= 512;
+    for(size_t b= 0;b<nRows;b+= blockSize)
+      {
+        const size_t e= std::min(b+blockSize,nRows);
+        for(size_t i= 0;i<nModes;i++)
+          {
+            const double rii= rho(i,i);
+            const double *ci= data+i*nRows;
+            for(size_t k= b;k<e;k++)
+              acc[k]+= rii*ci[k]*ci[k];
+          }
+        for(size_t p= 0;p<numPairs;p++)
+          {
+            const double f= factors[p];
+            const double *ci= data+pairs[p].first*nRows;
+            const double *cj= data+pairs[p].second*nRows;
+            for(size_t k= b;k<e;k++)
+              acc[k]+= f*ci[k]*cj[k];
+          }
+        for(size_t k= b;k<e;k++)
+          acc[k]= sqrt(std::max(acc[k],0.0));
+      }
+    return retval;
+  }
+
+//! @brief Fills the vector with the nodes of the domain and returns
+//! the maximum number of degrees of freedom of those nodes.
+size_t XC::ModalAnalysis::get_nodes(std::vector<Node *> &nodes)
+  {
+    size_t retval= 0;
+    nodes.clear();
+    Domain *dom= getDomainPtr();
+    if(dom)
+      {
+        nodes.reserve(dom->getNumNodes());
+        Node *nodePtr= nullptr;
+        NodeIter &theNodeIter= dom->getNodes();
+        while((nodePtr= theNodeIter()) != nullptr)
+          {
+            nodes.push_back(nodePtr);
+            retval= std::max(retval,size_t(nodePtr->getNumberDOF()));
+          }
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; ERROR the domain is not set." << std::endl;
+    return retval;
+  }
+
+//! @brief Fills the vector with the elements of the domain and returns
+//! the maximum dimension of their resisting force vectors.
+size_t XC::ModalAnalysis::get_elements(std::vector<Element *> &elements)
+  {
+    size_t retval= 0;
+    elements.clear();
+    Domain *dom= getDomainPtr();
+    if(dom)
+      {
+        elements.reserve(dom->getNumElements());
+        Element *elePtr= nullptr;
+        ElementIter &theElemIter= dom->getElements();
+        while((elePtr= theElemIter()) != nullptr)
+          {
+            elements.push_back(elePtr);
+            retval= std::max(retval,size_t(elePtr->getResistingForce().Size()));
+          }
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; ERROR the domain is not set." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the modal participation factors. If the dofs argument
+//! is not empty the modes are "projected" over the selected DOFs using
+//! the masses of the nodes (see Node::getModalParticipationFactor).
+//! @param nodes: nodes of the domain.
+//! @param dofs: degrees of freedom to project on.
+XC::Vector XC::ModalAnalysis::get_participation_factors(const std::vector<Node *> &nodes,const std::set<int> &dofs) const
+  {
+    const int nm= getNumModes();
+    if(dofs.empty())
+      return getModalParticipationFactors();
+    Vector num(nm);
+    Vector denom(nm);
+    for(std::vector<Node *>::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      {
+        Node *n= *i;
+        const Matrix &mass= n->getMass();
+        const Matrix &ev= n->getEigenvectors();
+        const int sz= ev.noRows();
+        if((mass.noRows()!=sz) || (mass.noCols()!=sz) || (ev.noCols()<nm))
+          continue;
+        Vector J(sz);
+        for(std::set<int>::const_iterator j= dofs.begin();j!=dofs.end();j++)
+          if((*j>=0) && (*j<sz))
+            J[*j]= 1.0;
+        const Vector MJ= mass*J;
+        for(int m= 0;m<nm;m++)
+          {
+            const Vector phi= ev.getCol(m);
+            num[m]+= dot(phi,MJ);
+            denom[m]+= dot(phi,mass*phi);
+          }
+      }
+    Vector retval(nm);
+    for(int m= 0;m<nm;m++)
+      if(denom[m]!=0.0)
+        retval[m]= num[m]/denom[m];
+    return retval;
+  }
+
+//! @brief Returns the tags of the nodes in the order used for the rows
+//! of the displacement matrices (see getModalPeakDisplacements).
+XC::ID XC::ModalAnalysis::getResponseNodeTags(void)
+  {
+    std::vector<Node *> nodes;
+    get_nodes(nodes);
+    const size_t sz= nodes.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= nodes[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns the tags of the elements in the order used for the rows
+//! of the element force matrices (see getModalPeakElementForces).
+XC::ID XC::ModalAnalysis::getResponseElementTags(void)
+  {
+    std::vector<Element *> elements;
+    get_elements(elements);
+    const size_t sz= elements.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= elements[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns the peak modal displacements of all the nodes
+//! obtained from the response spectrum.
+//!
+//! The value for the DOF k of the i-th node (see getResponseNodeTags)
+//! is placed in the row i*ndof+k, where ndof is the maximum number
+//! of DOFs of the nodes; each column corresponds to a mode.
+//! @param dofs: degrees of freedom excited by the ground motion (if
+//! empty the modal participation factors of the eigenproblem are used).
+XC::Matrix XC::ModalAnalysis::getModalPeakDisplacements(const std::set<int> &dofs)
+  {
+    std::vector<Node *> nodes;
+    const size_t ndof= get_nodes(nodes);
+    const size_t numNodes= nodes.size();
+    const int nm= getNumModes();
+    Matrix retval(numNodes*ndof,nm);
+    if(nm<1)
+      return retval;
+    const Vector tau= get_participation_factors(nodes,dofs);
+    const Vector accel= getModalAccelerations();
+    const Vector omega= getAngularFrequencies();
+    const size_t nRows= retval.noRows();
+    double *data= retval.getDataPtr();
+    for(size_t i= 0;i<numNodes;i++)
+      {
+        const Matrix &ev= nodes[i]->getEigenvectors();
+        const size_t sz= std::min(size_t(ev.noRows()),ndof);
+        const int nc= std::min(ev.noCols(),nm);
+        for(int m= 0;m<nc;m++)
+          {
+            const double factor= tau[m]*accel[m]/sqr(omega[m]);
+            double *col= data+m*nRows+i*ndof;
+            for(size_t k= 0;k<sz;k++)
+              col[k]= factor*ev(k,m);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Returns the peak modal displacements of all the nodes.
+//! @param l: degrees of freedom excited by the ground motion.
+XC::Matrix XC::ModalAnalysis::getModalPeakDisplacementsForDOFs(const boost::python::list &l)
+  {
+    const std::set<int> dofs= set_int_from_py_list(l);
+    return getModalPeakDisplacements(dofs);
+  }
+
+//! @brief Returns the element resisting forces that correspond
+//! to the peak modal displacements.
+//!
+//! The force vector of each mode is computed as the difference between
+//! the resisting force of the element with the peak modal displacements
+//! added to the committed ones and the resisting force for the committed
+//! displacements. The component k of the i-th element (see
+//! getResponseElementTags) is placed in the row i*nf+k, where nf is the
+//! maximum dimension of the element resisting force vectors; each column
+//! corresponds to a mode. The trial state of the mesh is reverted to the
+//! last committed one.
+//! @param dofs: degrees of freedom excited by the ground motion (if
+//! empty the modal participation factors of the eigenproblem are used).
+XC::Matrix XC::ModalAnalysis::getModalPeakElementForces(const std::set<int> &dofs)
+  {
+    std::vector<Node *> nodes;
+    const size_t ndof= get_nodes(nodes);
+    std::vector<Element *> elements;
+    const size_t nf= get_elements(elements);
+    const size_t numElements= elements.size();
+    const int nm= getNumModes();
+    Matrix retval(numElements*nf,nm);
+    Domain *dom= getDomainPtr();
+    if((nm<1) || !dom)
+      return retval;
+    const Matrix modalDisp= getModalPeakDisplacements(dofs);
+    Mesh &mesh= dom->getMesh();
+
+    //Resisting forces for the committed state.
+    mesh.revertToLastCommit();
+    const size_t nRows= retval.noRows();
+    double *data= retval.getDataPtr();
+    for(size_t i= 0;i<numElements;i++)
+      {
+        const Vector &f= elements[i]->getResistingForce();
+        const size_t sz= std::min(size_t(f.Size()),nf);
+        for(int m= 0;m<nm;m++)
+          {
+            double *col= data+m*nRows+i*nf;
+            for(size_t k= 0;k<sz;k++)
+              col[k]= -f[k];
+          }
+      }
+    const size_t numNodes= nodes.size();
+    for(int m= 0;m<nm;m++)
+      {
+        for(size_t i= 0;i<numNodes;i++)
+          {
+            Node *n= nodes[i];
+            Vector trialDisp= n->getDisp();
+            const size_t sz= std::min(size_t(trialDisp.Size()),ndof);
+            for(size_t k= 0;k<sz;k++)
+              trialDisp[k]+= modalDisp(i*ndof+k,m);
+            n->setTrialDisp(trialDisp);
+          }
+        dom->update();
+        double *col= data+m*nRows;
+        for(size_t i= 0;i<numElements;i++)
+          {
+            const Vector &f= elements[i]->getResistingForce();
+            const size_t sz= std::min(size_t(f.Size()),nf);
+            for(size_t k= 0;k<sz;k++)
+              col[i*nf+k]+= f[k];
+          }
+      }
+    mesh.revertToLastCommit();
+    return retval;
+  }
+
+//! @brief Returns the element resisting forces that correspond
+//! to the peak modal displacements.
+//! @param l: degrees of freedom excited by the ground motion.
+XC::Matrix XC::ModalAnalysis::getModalPeakElementForcesForDOFs(const boost::python::list &l)
+  {
+    const std::set<int> dofs= set_int_from_py_list(l);
+    return getModalPeakElementForces(dofs);
+  }
+
+//! @brief Copies the values of the vector in a matrix with
+//! the number of columns being passed as parameter.
+static XC::Matrix reshape_by_rows(const XC::Vector &v,const size_t &nCols)
+  {
+    const size_t nRows= (nCols>0 ? v.Size()/nCols : 0);
+    XC::Matrix retval(nRows,nCols);
+    for(size_t i= 0;i<nRows;i++)
+      for(size_t j= 0;j<nCols;j++)
+        retval(i,j)= v[i*nCols+j];
+    return retval;
+  }
+
+//! @brief Returns the SRSS combination of the peak modal displacements;
+//! the row i of the returned matrix corresponds to the i-th node
+//! (see getResponseNodeTags) and the column k to its k-th DOF.
+//! @param dofs: degrees of freedom excited by the ground motion.
+XC::Matrix XC::ModalAnalysis::getSRSSDisplacements(const std::set<int> &dofs)
+  {
+    std::vector<Node *> nodes;
+    const size_t ndof= get_nodes(nodes);
+    return reshape_by_rows(getSRSSCombination(getModalPeakDisplacements(dofs)),ndof);
+  }
+
+//! @brief Returns the SRSS combination of the peak modal displacements.
+//! @param l: degrees of freedom excited by the ground motion.
+XC::Matrix XC::ModalAnalysis::getSRSSDisplacementsForDOFs(const boost::python::list &l)
+  {
+    const std::set<int> dofs= set_int_from_py_list(l);
+    return getSRSSDisplacements(dofs);
+  }
+
+//! @brief Returns the CQC combination of the peak modal displacements;
+//! the row i of the returned matrix corresponds to the i-th node
+//! (see getResponseNodeTags) and the column k to its k-th DOF.
+//! @param zetas: damping for each mode.
+//! @param dofs: degrees of freedom excited by the ground motion.
+XC::Matrix XC::ModalAnalysis::getCQCDisplacements(const Vector &zetas,const std::set<int> &dofs)
+  {
+    std::vector<Node *> nodes;
+    const size_t ndof= get_nodes(nodes);
+    const Matrix rho= getCQCModalCrossCorrelationCoefficients(zetas);
+    return reshape_by_rows(getCQCCombination(getModalPeakDisplacements(dofs),rho,cqcTol),ndof);
+  }
+
+//! @brief Returns the CQC combination of the peak modal displacements.
+//! @param zetas: damping for each mode.
+//! @param l: degrees of freedom excited by the ground motion.
+XC::Matrix XC::ModalAnalysis::getCQCDisplacementsForDOFs(const Vector &zetas,const boost::python::list &l)
+  {
+    const std::set<int> dofs= set_int_from_py_list(l);
+    return getCQCDisplacements(zetas,dofs);
+  }
+
+//! @brief Returns the SRSS combination of the modal element forces;
+//! the row i of the returned matrix corresponds to the i-th element
+//! (see getResponseElementTags) and the column k to the k-th component
+//! of its resisting force.
+//! @param dofs: degrees of freedom excited by the ground motion.
+XC::Matrix XC::ModalAnalysis::getSRSSElementForces(const std::set<int> &dofs)
+  {
+    std::vector<Element *> elements;
+    const size_t nf= get_elements(elements);
+    return reshape_by_rows(getSRSSCombination(getModalPeakElementForces(dofs)),nf);
+  }
+
+//! @brief Returns the SRSS combination of the modal element forces.
+//! @param l: degrees of freedom excited by the ground motion.
+XC::Matrix XC::ModalAnalysis::getSRSSElementForcesForDOFs(const boost::python::list &l)
+  {
+    const std::set<int> dofs= set_int_from_py_list(l);
+    return getSRSSElementForces(dofs);
+  }
+
+//! @brief Returns the CQC combination of the modal element forces;
+//! the row i of the returned matrix corresponds to the i-th element
+//! (see getResponseElementTags) and the column k to the k-th component
+//! of its resisting force.
+//! @param zetas: damping for each mode.
+//! @param dofs: degrees of freedom excited by the ground motion.
+XC::Matrix XC::ModalAnalysis::getCQCElementForces(const Vector &zetas,const std::set<int> &dofs)
+  {
+    std::vector<Element *> elements;
+    const size_t nf= get_elements(elements);
+    const Matrix rho= getCQCModalCrossCorrelationCoefficients(zetas);
+    return reshape_by_rows(getCQCCombination(getModalPeakElementForces(dofs),rho,cqcTol),nf);
+  }
+
+//! @brief Returns the CQC combination of the modal element forces.
+//! @param zetas: damping for each mode.
+//! @param l: degrees of freedom excited by the ground motion.
+XC::Matrix XC::ModalAnalysis::getCQCElementForcesForDOFs(const Vector &zetas,const boost::python::list &l)
+  {
+    const std::set<int> dofs= set_int_from_py_list(l);
+    return getCQCElementForces(zetas,dofs);
+  }
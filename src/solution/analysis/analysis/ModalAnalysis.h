@@ -32,9 +32,14 @@
 
 #include "EigenAnalysis.h"
 #include "xc_utils/src/geom/d1/function_from_points/FunctionFromPointsR_R.h"
+#include <set>
+#include <vector>
 
 namespace XC {
 class Matrix;
+class ID;
+class Node;
+class Element;
 
 //! @ingroup AnalysisType
 //
@@ -43,6 +48,11 @@ class ModalAnalysis : public EigenAnalysis
   {
   protected:
     FunctionFromPointsR_R espectro;
+    double cqcTol; //!< cross terms whose correlation coefficient is below this value are ignored (CQC).
+
+    size_t get_nodes(std::vector<Node *> &);
+    size_t get_elements(std::vector<Element *> &);
+    Vector get_participation_factors(const std::vector<Node *> &,const std::set<int> &) const;
 
     friend class ProcSolu;
     ModalAnalysis(AnalysisAggregation *analysis_aggregation);
@@ -59,6 +69,28 @@ class ModalAnalysis : public EigenAnalysis
 
     //Equivalent static load.
     Vector getEquivalentStaticLoad(int mode) const;
+
+    //Response spectrum combination.
+    inline const double &getCQCTolerance(void) const
+      { return cqcTol; }
+    inline void setCQCTolerance(const double &d)
+      { cqcTol= d; }
+    static Vector getSRSSCombination(const Matrix &);
+    static Vector getCQCCombination(const Matrix &,const Matrix &,const double &tol= 0.0);
+    ID getResponseNodeTags(void);
+    ID getResponseElementTags(void);
+    Matrix getModalPeakDisplacements(const std::set<int> &dofs);
+    Matrix getModalPeakDisplacementsForDOFs(const boost::python::list &);
+    Matrix getModalPeakElementForces(const std::set<int> &dofs);
+    Matrix getModalPeakElementForcesForDOFs(const boost::python::list &);
+    Matrix getSRSSDisplacements(const std::set<int> &dofs);
+    Matrix getSRSSDisplacementsForDOFs(const boost::python::list &);
+    Matrix getCQCDisplacements(const Vector &zetas,const std::set<int> &dofs);
+    Matrix getCQCDisplacementsForDOFs(const Vector &zetas,const boost::python::list &);
+    Matrix getSRSSElementForces(const std::set<int> &dofs);
+    Matrix getSRSSElementForcesForDOFs(const boost::python::list &);
+    Matrix getCQCElementForces(const Vector &zetas,const std::set<int> &dofs);
+    Matrix getCQCElementForcesForDOFs(const Vector &zetas,const boost::python::list &);
   };
 
 } // end of XC namespace
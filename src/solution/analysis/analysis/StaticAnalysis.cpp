@@ -349,9 +349,10 @@ int XC::StaticAnalysis::initialize(void)
 //! dof's. Once the equation numbers have been set the numberer then
 //! invokes setID() on all the FE\_Elements in the model. Finally
 //! the numberer invokes setNumEqn() on the model.
-//! - It invokes {\em setSize(theModel.getDOFGraph())} on {\em
+//! - It invokes {\em updateSize(theModel)} on {\em
 //! theSOE} which causes the system of equation to determine its size
-//! based on the connectivity of the dofs in the analysis model. 
+//! based on the connectivity of the dofs in the analysis model (if
+//! that connectivity has not changed the previous size is kept). 
 //! - Finally domainChanged() is invoked on both \p theIntegrator and 
 //! \p theAlgorithm. 
 //! Returns \f$0\f$ if successful. At any stage above, if an error occurs the
@@ -399,10 +400,9 @@ int XC::StaticAnalysis::domainChanged(void)
       }
 
     // we invoke setSize() on the LinearSOE which
-    // causes that object to determine its size
-    Graph &theGraph= getAnalysisModelPtr()->getDOFGraph();
-
-    result= getLinearSOEPtr()->setSize(theGraph);
+    // causes that object to determine its size (the graph
+    // is not rebuilt if the sparsity has not changed).
+    result= getLinearSOEPtr()->updateSize(*getAnalysisModelPtr());
     if(result < 0)
       {
         std::cerr << getClassName() << "::" << __FUNCTION__
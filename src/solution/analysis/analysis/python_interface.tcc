@@ -76,6 +76,19 @@ class_<XC::LinearBucklingEigenAnalysis, bases<XC::EigenAnalysis>, boost::noncopy
 class_<XC::ModalAnalysis , bases<XC::EigenAnalysis>, boost::noncopyable >("ModalAnalysis", no_init)
   .add_property("spectrum", make_function(&XC::ModalAnalysis::getSpectrum,return_internal_reference<>()),&XC::ModalAnalysis::setSpectrum,"Response spectrum,") 
   .def("getCQCModalCrossCorrelationCoefficients",&XC::ModalAnalysis::getCQCModalCrossCorrelationCoefficients,"Returns CQC correlation coefficients.")
+  .add_property("cqcTolerance", make_function(&XC::ModalAnalysis::getCQCTolerance,return_value_policy<copy_const_reference>()),&XC::ModalAnalysis::setCQCTolerance,"Cross terms whose correlation coefficient is below this value are ignored in CQC combination.")
+  .def("getSRSSCombination",&XC::ModalAnalysis::getSRSSCombination,"getSRSSCombination(modalValues): returns the SRSS combination of the rows of the matrix (one column per mode).")
+  .staticmethod("getSRSSCombination")
+  .def("getCQCCombination",&XC::ModalAnalysis::getCQCCombination,"getCQCCombination(modalValues,rho,tol): returns the CQC combination of the rows of the matrix (one column per mode) ignoring the cross terms with correlation coefficient below tol.")
+  .staticmethod("getCQCCombination")
+  .def("getResponseNodeTags",&XC::ModalAnalysis::getResponseNodeTags,"Returns the tags of the nodes in the order of the rows of the displacement matrices.")
+  .def("getResponseElementTags",&XC::ModalAnalysis::getResponseElementTags,"Returns the tags of the elements in the order of the rows of the element force matrices.")
+  .def("getModalPeakDisplacements",&XC::ModalAnalysis::getModalPeakDisplacementsForDOFs,"getModalPeakDisplacements(dofs): returns the peak modal displacements (one row for each node DOF and one column for each mode).")
+  .def("getModalPeakElementForces",&XC::ModalAnalysis::getModalPeakElementForcesForDOFs,"getModalPeakElementForces(dofs): returns the element resisting forces for the peak modal displacements (one row for each element force component and one column for each mode).")
+  .def("getSRSSDisplacements",&XC::ModalAnalysis::getSRSSDisplacementsForDOFs,"getSRSSDisplacements(dofs): returns the SRSS combination of the modal displacements (one row for each node).")
+  .def("getCQCDisplacements",&XC::ModalAnalysis::getCQCDisplacementsForDOFs,"getCQCDisplacements(zetas,dofs): returns the CQC combination of the modal displacements (one row for each node).")
+  .def("getSRSSElementForces",&XC::ModalAnalysis::getSRSSElementForcesForDOFs,"getSRSSElementForces(dofs): returns the SRSS combination of the modal element forces (one row for each element).")
+  .def("getCQCElementForces",&XC::ModalAnalysis::getCQCElementForcesForDOFs,"getCQCElementForces(zetas,dofs): returns the CQC combination of the modal element forces (one row for each element).")
   ;
 
 
@@ -65,13 +65,66 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include "utility/matrix/Matrix.h"
+#include "utility/threads/ThreadPool.h"
+#include <algorithm>
+
+namespace {
+  //! @brief Return the FE_Elements of the model in the same order
+  //! as the FE_EleIter.
+  std::vector<XC::FE_Element *> get_fe_elements(XC::AnalysisModel &mdl)
+    {
+      std::vector<XC::FE_Element *> retval;
+      XC::FE_Element *elePtr= nullptr;
+      XC::FE_EleIter &theEles= mdl.getFEs();
+      while((elePtr= theEles()) != nullptr)
+        retval.push_back(elePtr);
+      return retval;
+    }
+}
 
 
 //! @brief Constructor.
 //!
 //! @param owr: set of objects used to perform the analysis.
 XC::IncrementalIntegrator::IncrementalIntegrator(AnalysisAggregation *owr,int clasTag)
-  : Integrator(owr,clasTag), statusFlag(CURRENT_TANGENT) {}
+  : Integrator(owr,clasTag), numThreads(1), batchSize(64), statusFlag(CURRENT_TANGENT) {}
+
+//! @brief Set the number of threads used to compute the element
+//! tangents and residuals.
+//!
+//! If the number of threads is greater than one, the tangent and the
+//! residual of the thread safe elements (see Element::isThreadSafe) are
+//! computed concurrently in batches; the contributions are added to the
+//! system of equations afterwards, by the calling thread and in the same
+//! order as in the serial algorithm, so the results don't depend on the
+//! number of threads. Elements that are not thread safe are computed by
+//! the calling thread.
+//!
+//! @param n: number of threads (if zero, the number of concurrent
+//! threads supported by the hardware is used).
+void XC::IncrementalIntegrator::setNumThreads(const size_t &n)
+  {
+    if(n==0)
+      numThreads= getHardwareConcurrency();
+    else
+      numThreads= n;
+  }
+
+//! @brief Set the number of elements processed by each thread before
+//! adding its results to the system of equations.
+//!
+//! The memory used to store the element contributions is proportional
+//! to numThreads*batchSize.
+void XC::IncrementalIntegrator::setBatchSize(const size_t &sz)
+  {
+    if(sz>0)
+      batchSize= sz;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; batch size must be greater than zero."
+	        << std::endl;
+  }
 
 
 //! @brief Builds tangent stiffness matrix.
@@ -110,20 +163,105 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
 
     theSOE->zeroA(); //Zeroes the matrix elements.
     
-    // the loops to form and add the tangents are broken into two for 
-    // efficiency when performing parallel computations - CHANGE
-
     // loop through the FE_Elements adding their contributions to the tangent
-    FE_Element *elePtr;
-    FE_EleIter &theEles2= mdl->getFEs();    
-    while((elePtr = theEles2()) != 0)     
-      if(theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0)
-        {
-	  std::cerr << getClassName() << "::" << __FUNCTION__
-		    << "; WARNING failed in addA for ID "
-		    << elePtr->getID();	    
-	  result = -3;
-	}
+    result= formElementTangent();
+    return result;
+  }
+
+//! @brief Return true if the integrator computes the response of the
+//! step by itself, without assembling and solving the system of
+//! equations (see Linear::solveCurrentStep).
+bool XC::IncrementalIntegrator::solvesCurrentStep(void) const
+  { return false; }
+
+//! @brief Computes the response of the step without using the system
+//! of equations (only for the integrators that return true from
+//! solvesCurrentStep).
+int XC::IncrementalIntegrator::solveCurrentStep(void)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+	      << "; not implemented for this integrator.\n";
+    return -1;
+  }
+
+//! @brief Adds the tangent matrices of the elements to the system of
+//! equations.
+//!
+//! If the number of threads is greater than one, the tangents are computed
+//! concurrently (see setNumThreads).
+int XC::IncrementalIntegrator::formElementTangent(void)
+  {
+    int result= 0;
+    if(numThreads>1)
+      result= formElementTangentParallel();
+    else
+      {
+        LinearSOE *theSOE= getLinearSOEPtr();
+        AnalysisModel *mdl= getAnalysisModelPtr();
+        FE_Element *elePtr;
+        FE_EleIter &theEles2= mdl->getFEs();    
+        while((elePtr = theEles2()) != 0)     
+          if(theSOE->addElementA(elePtr->getTangent(this),*elePtr) < 0)
+            {
+	      std::cerr << getClassName() << "::" << __FUNCTION__
+		        << "; WARNING failed in addA for ID "
+		        << elePtr->getID();	    
+	      result = -3;
+	    }
+      }
+    return result;
+  }
+
+//! @brief Adds the tangent matrices of the elements to the system of
+//! equations computing them with numThreads threads.
+//!
+//! The elements are processed in chunks of numThreads*batchSize
+//! elements. The tangents of the thread safe elements of each chunk
+//! are computed concurrently by the threads of the shared ThreadPool
+//! (created once, so the thread_local scratch storage of the elements
+//! is reused between chunks and iterations) and stored; then they
+//! are added to the system by the calling thread following the order of the
+//! FE_EleIter (the tangent of the elements that are not thread safe
+//! is computed at this moment), so the assembly is deterministic and
+//! gives the same result that the serial one.
+int XC::IncrementalIntegrator::formElementTangentParallel(void)
+  {
+    int result= 0;
+    LinearSOE *theSOE= getLinearSOEPtr();
+    AnalysisModel *mdl= getAnalysisModelPtr();
+    const std::vector<FE_Element *> elements= get_fe_elements(*mdl);
+    const size_t numEle= elements.size();
+    const size_t chunkSize= numThreads*batchSize;
+    FE_Element::setNumThreads(numThreads);
+    std::vector<Matrix> tangents(std::min(chunkSize,numEle));
+    std::shared_ptr<ThreadPool> thePool= getSharedThreadPool(numThreads);
+    for(size_t first= 0;first<numEle;first+= chunkSize)
+      {
+        const size_t last= std::min(first+chunkSize,numEle);
+        // compute the tangents of the thread safe elements.
+        thePool->run(last-first,numThreads,[&](size_t b,size_t e,size_t)
+          {
+            for(size_t i= b;i<e;i++)
+              {
+                FE_Element *elePtr= elements[first+i];
+                if(elePtr->isThreadSafe())
+                  tangents[i]= elePtr->getTangent(this);
+              }
+          });
+        // add them to the system.
+        for(size_t i= first;i<last;i++)
+          {
+            FE_Element *elePtr= elements[i];
+            const Matrix &K= (elePtr->isThreadSafe() ? tangents[i-first] : elePtr->getTangent(this));
+            if(theSOE->addElementA(K,*elePtr) < 0)
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+		          << "; WARNING failed in addA for ID "
+		          << elePtr->getID();	    
+	        result = -3;
+	      }
+          }
+      }
     return result;
   }
 
@@ -336,6 +474,9 @@ int XC::IncrementalIntegrator::formNodalUnbalance(void)
 //! test is made to ensure setLinks() has been invoked.
 int XC::IncrementalIntegrator::formElementResidual(void)
   {
+    if(numThreads>1)
+      return formElementResidualParallel();
+
     // loop through the FE_Elements and add the residual
     FE_Element *elePtr;
 
@@ -357,3 +498,48 @@ int XC::IncrementalIntegrator::formElementResidual(void)
     return res;	    
   }
 
+//! @brief Adds the residual vectors of the elements to the system of
+//! equations computing them with numThreads threads.
+//!
+//! Same algorithm as in formElementTangentParallel.
+int XC::IncrementalIntegrator::formElementResidualParallel(void)
+  {
+    int res= 0;
+    LinearSOE *theSOE= getLinearSOEPtr();
+    AnalysisModel *mdl= getAnalysisModelPtr();
+    const std::vector<FE_Element *> elements= get_fe_elements(*mdl);
+    const size_t numEle= elements.size();
+    const size_t chunkSize= numThreads*batchSize;
+    FE_Element::setNumThreads(numThreads);
+    std::vector<Vector> residuals(std::min(chunkSize,numEle));
+    std::shared_ptr<ThreadPool> thePool= getSharedThreadPool(numThreads);
+    for(size_t first= 0;first<numEle;first+= chunkSize)
+      {
+        const size_t last= std::min(first+chunkSize,numEle);
+        // compute the residuals of the thread safe elements.
+        thePool->run(last-first,numThreads,[&](size_t b,size_t e,size_t)
+          {
+            for(size_t i= b;i<e;i++)
+              {
+                FE_Element *elePtr= elements[first+i];
+                if(elePtr->isThreadSafe())
+                  residuals[i]= elePtr->getResidual(this);
+              }
+          });
+        // add them to the system.
+        for(size_t i= first;i<last;i++)
+          {
+            FE_Element *elePtr= elements[i];
+            const Vector &R= (elePtr->isThreadSafe() ? residuals[i-first] : elePtr->getResidual(this));
+	    if(theSOE->addB(R,elePtr->getID()) <0)
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+		          << "; WARNING failed in addB for ID: "
+		          << elePtr->getID();
+	        res = -2;
+	      }
+          }
+      }
+    return res;
+  }
+
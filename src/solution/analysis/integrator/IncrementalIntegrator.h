@@ -95,6 +95,12 @@ class Vector;
 //! some function of the solution to the linear system of equations.
 class IncrementalIntegrator : public Integrator
   {
+  private:
+    size_t numThreads; //!< number of threads used to compute the element contributions.
+    size_t batchSize; //!< number of elements processed by each thread before adding its contributions to the system.
+
+    int formElementTangentParallel(void);
+    int formElementResidualParallel(void);
   protected:
     LinearSOE *getLinearSOEPtr(void);
     const LinearSOE *getLinearSOEPtr(void) const;
@@ -102,6 +108,7 @@ class IncrementalIntegrator : public Integrator
     friend class IntegratorVectors;
     virtual int formNodalUnbalance(void);        
     virtual int formElementResidual(void);
+    int formElementTangent(void);
     int statusFlag;
 
     IncrementalIntegrator(AnalysisAggregation *,int classTag);
@@ -110,6 +117,22 @@ class IncrementalIntegrator : public Integrator
     virtual int formTangent(int statusFlag = CURRENT_TANGENT);    
     virtual int formUnbalance(void);
 
+    // explicit integrators that don't use the system of equations.
+    virtual bool solvesCurrentStep(void) const;
+    virtual int solveCurrentStep(void);
+
+    // parallel assembly.
+    //! @brief Return the number of threads used to compute the element
+    //! tangents and residuals.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
+    //! @brief Return the number of elements processed by each thread
+    //! before adding the results to the system of equations.
+    inline size_t getBatchSize(void) const
+      { return batchSize; }
+    void setBatchSize(const size_t &);
+
     // pure virtual methods to define the FE_ELe and DOF_Group contributions
     //! @brief To inform the FE\_Element how to build its tangent matrix for
     //! addition to the system of equations.
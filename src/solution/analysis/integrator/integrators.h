@@ -52,6 +52,7 @@
 //transient
 #include <solution/analysis/integrator/transient/CentralDifferenceAlternative.h>
 #include <solution/analysis/integrator/transient/CentralDifferenceNoDamping.h>
+#include <solution/analysis/integrator/transient/CentralDifferenceLumpedMass.h>
 #include <solution/analysis/integrator/transient/HHT1.h>
 #include <solution/analysis/integrator/transient/newmark/Newmark.h>
 #include <solution/analysis/integrator/transient/newmark/Newmark1.h>
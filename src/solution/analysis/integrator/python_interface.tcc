@@ -24,7 +24,10 @@ class_<XC::Integrator, bases<XC::MovableObject,CommandEntity>, boost::noncopyabl
 
 class_<XC::EigenIntegrator, bases<XC::Integrator>, boost::noncopyable >("EigenIntegrator", no_init);
 
-class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("IncrementalIntegrator", no_init);
+class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("IncrementalIntegrator", no_init)
+  .add_property("numThreads",&XC::IncrementalIntegrator::getNumThreads,&XC::IncrementalIntegrator::setNumThreads,"Number of threads used to compute the element tangents and residuals (0: use hardware concurrency).")
+  .add_property("batchSize",&XC::IncrementalIntegrator::getBatchSize,&XC::IncrementalIntegrator::setBatchSize,"Number of elements computed by each thread before adding its results to the system of equations.")
+  ;
 
 class_<XC::StaticIntegrator, bases<XC::IncrementalIntegrator>, boost::noncopyable >("StaticIntegrator", no_init);
 
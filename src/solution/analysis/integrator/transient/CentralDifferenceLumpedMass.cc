@@ -0,0 +1,461 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CentralDifferenceLumpedMass.cc
+
+#include <solution/analysis/integrator/transient/CentralDifferenceLumpedMass.h>
+#include <solution/analysis/model/fe_ele/FE_Element.h>
+#include <solution/analysis/model/FE_EleIter.h>
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/dof_grp/DOF_Group.h>
+#include <solution/analysis/model/DOF_GrpIter.h>
+#include <utility/matrix/Vector.h>
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/ID.h>
+#include "utility/threads/parallel_loop.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+  //! @brief Returns true if some term of the matrix is not zero.
+  bool non_zero(const XC::Matrix &m)
+    {
+      const int nRows= m.noRows();
+      const int nCols= m.noCols();
+      for(int i= 0;i<nRows;i++)
+        for(int j= 0;j<nCols;j++)
+          if(m(i,j)!=0.0)
+            return true;
+      return false;
+    }
+}
+
+//! @brief Constructor.
+XC::CentralDifferenceLumpedMass::CentralDifferenceLumpedMass(AnalysisAggregation *owr)
+  :CentralDifferenceBase(owr,INTEGRATOR_TAGS_CentralDifferenceLumpedMass),
+   tangentType(MASS), stableTimeStep(0.0), timeStepWarning(false) {}
+
+//! @brief The tangent is not assembled (the lumped mass is computed
+//! in domainChanged).
+int XC::CentralDifferenceLumpedMass::formTangent(int statFlag)
+  {
+    statusFlag= statFlag;
+    return 0;
+  }
+
+//! @brief Computes the unbalanced forces (stored in the force array, the
+//! system of equations is not used).
+int XC::CentralDifferenceLumpedMass::formUnbalance(void)
+  {
+    std::fill(force.begin(),force.end(),0.0);
+    int retval= form_element_forces();
+    if(retval>=0)
+      retval= form_nodal_forces();
+    return retval;
+  }
+
+//! @brief Mass, damping or initial stiffness of the element (used to
+//! compute the lumped mass, to check that there is no damping and to
+//! estimate the stable time step).
+int XC::CentralDifferenceLumpedMass::formEleTangent(FE_Element *theEle)
+  {
+    theEle->zeroTangent();
+    if(tangentType==MASS)
+      theEle->addMtoTang();
+    else if(tangentType==DAMPING)
+      theEle->addCtoTang();
+    else
+      theEle->addKiToTang();
+    return 0;
+  }    
+
+//! @brief Mass or damping of the node.
+int XC::CentralDifferenceLumpedMass::formNodTangent(DOF_Group *theDof)
+  {
+    theDof->zeroTangent();
+    if(tangentType==MASS)
+      theDof->addMtoTang();
+    else if(tangentType==DAMPING)
+      theDof->addCtoTang();
+    return 0;
+  }
+
+int XC::CentralDifferenceLumpedMass::formEleResidual(FE_Element *theEle)
+  {
+    theEle->zeroResidual();
+    theEle->addRtoResidual();
+    return 0;
+  }
+
+int XC::CentralDifferenceLumpedMass::formNodUnbalance(DOF_Group *theDof)
+  {
+    theDof->zeroUnbalance();
+    theDof->addPtoUnbalance();
+    return 0;
+  }
+
+//! @brief Adds the resisting forces of the elements to the force array.
+//!
+//! The residuals of the thread safe elements are computed concurrently
+//! in chunks of getNumThreads()*getBatchSize() elements; then they
+//! are added to the force array following the order of the elements.
+int XC::CentralDifferenceLumpedMass::form_element_forces(void)
+  {
+    const size_t numThreads= getNumThreads();
+    const size_t numEle= elements.size();
+    const size_t chunkSize= (numThreads>1) ? numThreads*getBatchSize() : numEle;
+    if(numThreads>1)
+      FE_Element::setNumThreads(numThreads);
+    std::vector<Vector> residuals((numThreads>1) ? std::min(chunkSize,numEle) : 0);
+    for(size_t first= 0;first<numEle;first+= chunkSize)
+      {
+        const size_t last= std::min(first+chunkSize,numEle);
+        if(numThreads>1)
+          parallel_for(last-first,getNumThreads(),[&](size_t b,size_t e,size_t)
+            {
+              for(size_t i= b;i<e;i++)
+                {
+                  FE_Element *elePtr= elements[first+i];
+                  if(elePtr->isThreadSafe())
+                    residuals[i]= elePtr->getResidual(this);
+                }
+            });
+        for(size_t i= first;i<last;i++)
+          {
+            FE_Element *elePtr= elements[i];
+            const bool computed= (numThreads>1) && elePtr->isThreadSafe();
+            const Vector &R= (computed ? residuals[i-first] : elePtr->getResidual(this));
+            const ID &id= elePtr->getID();
+            const int sz= id.Size();
+            for(int j= 0;j<sz;j++)
+              {
+                const int eq= id(j);
+                if(eq>=0)
+                  force[eq]+= R(j);
+              }
+          }
+      }
+    return 0;
+  }
+
+//! @brief Adds the nodal loads to the force array.
+int XC::CentralDifferenceLumpedMass::form_nodal_forces(void)
+  {
+    for(std::vector<DOF_Group *>::const_iterator i= dofGroups.begin();i!=dofGroups.end();i++)
+      {
+        DOF_Group *dofPtr= *i;
+        const Vector &P= dofPtr->getUnbalance(this);
+        const ID &id= dofPtr->getID();
+        const int sz= id.Size();
+        for(int j= 0;j<sz;j++)
+          {
+            const int eq= id(j);
+            if(eq>=0)
+              force[eq]+= P(j);
+          }
+      }
+    return 0;
+  }
+
+//! @brief Computes the lumped mass of each equation (row sum of the
+//! element and node mass matrices).
+int XC::CentralDifferenceLumpedMass::form_lumped_mass(void)
+  {
+    int retval= 0;
+    const size_t numEqn= lumpedMass.size();
+    std::fill(lumpedMass.begin(),lumpedMass.end(),0.0);
+    tangentType= MASS;
+    for(std::vector<FE_Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+      {
+        const Matrix &M= (*i)->getTangent(this);
+        const ID &id= (*i)->getID();
+        const int sz= id.Size();
+        for(int j= 0;j<sz;j++)
+          {
+            const int eq= id(j);
+            if(eq>=0)
+              for(int k= 0;k<sz;k++)
+                lumpedMass[eq]+= M(j,k);
+          }
+      }
+    for(std::vector<DOF_Group *>::const_iterator i= dofGroups.begin();i!=dofGroups.end();i++)
+      {
+        const Matrix &M= (*i)->getTangent(this);
+        const ID &id= (*i)->getID();
+        const int sz= id.Size();
+        for(int j= 0;j<sz;j++)
+          {
+            const int eq= id(j);
+            if(eq>=0)
+              for(int k= 0;k<sz;k++)
+                lumpedMass[eq]+= M(j,k);
+          }
+      }
+    invMass.resize(numEqn);
+    for(size_t i= 0;i<numEqn;i++)
+      {
+        if(lumpedMass[i]>0.0)
+          invMass[i]= 1.0/lumpedMass[i];
+        else
+          {
+            invMass[i]= 0.0;
+            retval= -1;
+          }
+      }
+    if(retval<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; ERROR some equations have zero or negative mass,"
+                << " they can't be integrated explicitly.\n";
+    return retval;
+  }
+
+//! @brief Returns true if the damping matrix of some element
+//! or node is not zero.
+bool XC::CentralDifferenceLumpedMass::has_damping(void)
+  {
+    bool retval= false;
+    tangentType= DAMPING;
+    for(std::vector<FE_Element *>::const_iterator i= elements.begin();!retval && (i!=elements.end());i++)
+      retval= non_zero((*i)->getTangent(this));
+    for(std::vector<DOF_Group *>::const_iterator i= dofGroups.begin();!retval && (i!=dofGroups.end());i++)
+      retval= non_zero((*i)->getTangent(this));
+    tangentType= MASS;
+    return retval;
+  }
+
+//! @brief Estimates the stable time step.
+//!
+//! The maximum eigenvalue of \f$M^{-1} K\f$ is bounded (Gershgorin)
+//! by the maximum of the sum of the absolute values of the row terms
+//! of the initial stiffness divided by the mass of the equation. The
+//! stable time step of the central difference scheme is
+//! \f$2/\omega_{max}\f$.
+void XC::CentralDifferenceLumpedMass::compute_stable_time_step(void)
+  {
+    std::vector<double> rowSum(lumpedMass.size(),0.0);
+    tangentType= STIFFNESS;
+    for(std::vector<FE_Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+      {
+        const Matrix &K= (*i)->getTangent(this);
+        const ID &id= (*i)->getID();
+        const int sz= id.Size();
+        for(int j= 0;j<sz;j++)
+          {
+            const int eq= id(j);
+            if(eq>=0)
+              for(int k= 0;k<sz;k++)
+                rowSum[eq]+= std::abs(K(j,k));
+          }
+      }
+    tangentType= MASS;
+    double omega2= 0.0;
+    const size_t numEqn= rowSum.size();
+    for(size_t i= 0;i<numEqn;i++)
+      omega2= std::max(omega2,rowSum[i]*invMass[i]);
+    stableTimeStep= (omega2>0.0) ? 2.0/sqrt(omega2) : 0.0;
+  }
+
+//! @brief Gets the committed response of the DOF groups, computes the
+//! lumped mass and estimates the stable time step. Returns a negative
+//! value if the model has damping (not supported) or some equation
+//! has no mass.
+int XC::CentralDifferenceLumpedMass::domainChanged(void)
+  {
+    AnalysisModel *myModel= this->getAnalysisModelPtr();
+    if(!myModel)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; no AnalysisModel set\n";
+        return -1;
+      }
+    const int size= myModel->getNumEqn();
+    if(U.get().Size() != size)
+      U.resize(size);
+    lumpedMass.assign(size,0.0);
+    force.assign(size,0.0);
+
+    elements.clear();
+    FE_Element *elePtr= nullptr;
+    FE_EleIter &theEles= myModel->getFEs();
+    while((elePtr= theEles()) != nullptr)
+      elements.push_back(elePtr);
+
+    dofGroups.clear();
+    DOF_GrpIter &theDOFGroups= myModel->getDOFGroups();
+    DOF_Group *dofGroupPtr= nullptr;
+    while((dofGroupPtr= theDOFGroups()) != nullptr)
+      {
+        dofGroups.push_back(dofGroupPtr);
+        const ID &id= dofGroupPtr->getID();
+        U.setDisp(id,dofGroupPtr->getCommittedDisp());
+        U.setVel(id,dofGroupPtr->getCommittedVel());
+        U.setAccel(id,dofGroupPtr->getCommittedAccel());
+      }
+
+    if(has_damping())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; ERROR the model has damping (i.e. Rayleigh"
+                  << " damping factors) and this integrator ignores"
+                  << " the damping forces; use CentralDifference"
+                  << " or Newmark instead.\n";
+        return -2;
+      }
+    const int retval= form_lumped_mass();
+    if(retval>=0)
+      compute_stable_time_step();
+    timeStepWarning= false;
+    return retval;
+  }
+
+//! @brief Prepares the new step (warns if the time step is greater
+//! than the stable one).
+int XC::CentralDifferenceLumpedMass::newStep(double _deltaT)
+  {
+    const int retval= CentralDifferenceBase::newStep(_deltaT);
+    if((retval==0) && (stableTimeStep>0.0) && (deltaT>stableTimeStep) && !timeStepWarning)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: time step: " << deltaT
+                  << " is greater than the estimated stable time step: "
+                  << stableTimeStep << std::endl;
+        timeStepWarning= true;
+      }
+    return retval;
+  }
+
+//! @brief Return true (the step is solved without the system of
+//! equations).
+bool XC::CentralDifferenceLumpedMass::solvesCurrentStep(void) const
+  { return true; }
+
+//! @brief Computes the accelerations from the unbalanced forces and
+//! the lumped mass and updates the response.
+int XC::CentralDifferenceLumpedMass::solveCurrentStep(void)
+  {
+    if(formUnbalance() < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; failed in formUnbalance()\n";
+        return -2;
+      }
+    Vector &accel= U.getDotDot();
+    const int numEqn= accel.Size();
+    for(int i= 0;i<numEqn;i++)
+      accel(i)= force[i]*invMass[i];
+    return update(accel);
+  }
+
+//! @brief Updates the velocities and displacements from the
+//! accelerations being passed as parameter.
+int XC::CentralDifferenceLumpedMass::update(const Vector &accel)
+  {
+    updateCount++;
+    if(updateCount > 1)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; called more than once -"
+                  << " central difference integration schemes"
+                  << " require a LINEAR solution algorithm\n";
+        return -1;
+      }
+  
+    AnalysisModel *theModel= this->getAnalysisModelPtr();
+    if(!theModel)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; no AnalysisModel set\n";
+        return -2;
+      }	
+  
+    const int numEqn= U.get().Size();
+    if(accel.Size() != numEqn)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; vectors of incompatible size: expecting "
+                  << numEqn << " obtained " << accel.Size() << std::endl;
+        return -3;
+      }
+
+    Vector &disp= U.get();
+    Vector &vel= U.getDot();
+    Vector &a= U.getDotDot();
+    const bool sameVector= (&accel==&a);
+    // vel at t+0.5*deltaT and disp at t+deltaT.
+    parallel_for(numEqn,getNumThreads(),[&](size_t b,size_t e,size_t)
+      {
+        for(size_t i= b;i<e;i++)
+          {
+            if(!sameVector)
+              a(i)= accel(i);
+            vel(i)+= deltaT*a(i);
+            disp(i)+= deltaT*vel(i);
+          }
+      });
+
+    // update the responses at the DOFs
+    theModel->setResponse(disp,vel,a);
+    updateModel();
+    return 0;
+  }    
+
+//! @brief Updates the time and commits the model.
+int XC::CentralDifferenceLumpedMass::commit(void)
+  {
+    AnalysisModel *theModel= this->getAnalysisModelPtr();
+    if(!theModel)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; no AnalysisModel set\n";
+        return -1;
+      }	  
+  
+    // update time in Domain to T + deltaT & commit the domain
+    const double time= getCurrentModelTime() + deltaT;
+    setCurrentModelTime(time);
+    return commitModel();
+  }
+
+//! @brief Return the estimation of the stable time step (0 if
+//! there is no stiffness).
+double XC::CentralDifferenceLumpedMass::getStableTimeStep(void) const
+  { return stableTimeStep; }
+
+//! @brief Return the lumped mass of each equation.
+XC::Vector XC::CentralDifferenceLumpedMass::getLumpedMass(void) const
+  {
+    const int sz= lumpedMass.size();
+    Vector retval(sz);
+    for(int i= 0;i<sz;i++)
+      retval(i)= lumpedMass[i];
+    return retval;
+  }
+
+int XC::CentralDifferenceLumpedMass::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::CentralDifferenceLumpedMass::recvSelf(const CommParameters &cp)
+  { return 0; }
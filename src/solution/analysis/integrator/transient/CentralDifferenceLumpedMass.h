@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CentralDifferenceLumpedMass.h
+                                                                        
+#ifndef CentralDifferenceLumpedMass_h
+#define CentralDifferenceLumpedMass_h
+
+#include <solution/analysis/integrator/transient/CentralDifferenceBase.h>
+#include "solution/analysis/integrator/transient/ResponseQuantities.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup TransientIntegrator
+//
+//! @brief Central difference scheme (as in CentralDifferenceNoDamping)
+//! that doesn't use the system of equations.
+//!
+//! The mass matrix is lumped (row sum) when the domain changes and
+//! stored, together with the unbalanced forces, in flat arrays indexed
+//! by equation number. On each step:
+//! \f$a_n = M^{-1} (P_n - F_n)\f$
+//! \f$v_{n+1/2} = v_{n-1/2} + \Delta t a_n\f$
+//! \f$d_{n+1} = d_n + \Delta t v_{n+1/2}\f$
+//! The element resisting forces are computed with getNumThreads()
+//! threads (see IncrementalIntegrator::setNumThreads) and added to
+//! the force array in the order of the elements, so the results
+//! don't depend on the number of threads. The loops run on the shared
+//! ThreadPool, so the threads are kept alive between steps.
+//!
+//! The step is solved by solveCurrentStep (called by the Linear
+//! algorithm); the system of equations is never assembled nor solved,
+//! so the cheapest one (i.e. diagonal_soe) must be used.
+//!
+//! Damping is not supported: the damping forces would need the
+//! velocity at the end of the step, which is unknown when the
+//! accelerations are computed. domainChanged fails if an element
+//! or a node has a nonzero damping matrix (i.e. Rayleigh damping
+//! factors); use CentralDifference or Newmark for damped models.
+//!
+//! The stable time step is estimated from the Gershgorin bound of the
+//! maximum eigenvalue of \f$M^{-1} K\f$ (initial stiffness); for a
+//! bar with lumped mass it gives the element length divided by the
+//! wave speed.
+class CentralDifferenceLumpedMass: public CentralDifferenceBase
+  {
+  private:
+    //! @brief Matrix returned by the FE_Element and DOF_Group tangents.
+    enum TangentType {MASS,DAMPING,STIFFNESS};
+    TangentType tangentType;
+    ResponseQuantities U; //!< displacement (t+deltaT), velocity (t+deltaT/2) and acceleration (t).
+    std::vector<double> lumpedMass; //!< lumped mass of each equation.
+    std::vector<double> invMass; //!< inverse of the lumped mass of each equation.
+    std::vector<double> force; //!< unbalanced force of each equation.
+    std::vector<FE_Element *> elements; //!< elements of the model.
+    std::vector<DOF_Group *> dofGroups; //!< DOF groups of the model.
+    double stableTimeStep; //!< estimation of the critical time step.
+    bool timeStepWarning; //!< true if a warning about the time step has been printed.
+
+    int form_lumped_mass(void);
+    bool has_damping(void);
+    void compute_stable_time_step(void);
+    int form_element_forces(void);
+    int form_nodal_forces(void);
+
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    CentralDifferenceLumpedMass(AnalysisAggregation *);
+    Integrator *getCopy(void) const;
+  public:
+    int formTangent(int statFlag);
+    int formUnbalance(void);
+
+    // methods which define what the FE_Element and DOF_Groups add
+    // to the system of equation object.
+    int formEleTangent(FE_Element *theEle);
+    int formNodTangent(DOF_Group *theDof);
+    int formEleResidual(FE_Element *theEle);
+    int formNodUnbalance(DOF_Group *theDof);    
+
+    int domainChanged(void);    
+    int newStep(double deltaT);
+    bool solvesCurrentStep(void) const;
+    int solveCurrentStep(void);
+    int update(const Vector &accel);
+
+    int commit(void);
+
+    double getStableTimeStep(void) const;
+    Vector getLumpedMass(void) const;
+
+    virtual int sendSelf(CommParameters &);
+    virtual int recvSelf(const CommParameters &);
+  };
+inline Integrator *CentralDifferenceLumpedMass::getCopy(void) const
+  { return new CentralDifferenceLumpedMass(*this); }
+} // end of XC namespace
+
+#endif
@@ -29,6 +29,11 @@ class_<XC::CentralDifferenceAlternative , bases<XC::CentralDifferenceBase>, boos
 
 class_<XC::CentralDifferenceNoDamping, bases<XC::CentralDifferenceBase>, boost::noncopyable >("CentralDifferenceNoDamping", no_init);
 
+class_<XC::CentralDifferenceLumpedMass, bases<XC::CentralDifferenceBase>, boost::noncopyable >("CentralDifferenceLumpedMass", no_init)
+  .add_property("stableTimeStep",&XC::CentralDifferenceLumpedMass::getStableTimeStep,"Estimation of the stable time step (computed when the domain changes).")
+  .add_property("lumpedMass",&XC::CentralDifferenceLumpedMass::getLumpedMass,"Lumped mass of each equation.")
+  ;
+
 class_<XC::DampingFactorsIntegrator, bases<XC::TransientIntegrator>, boost::noncopyable >("DampingFactorsIntegrator", no_init);
 
 class_<XC::NewmarkBase, bases<XC::DampingFactorsIntegrator>, boost::noncopyable >("NewmarkBase", no_init);
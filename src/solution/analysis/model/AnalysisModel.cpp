@@ -87,6 +87,7 @@
 #include "domain/mesh/node/NodeIter.h"
 #include "solution/analysis/handler/ConstraintHandler.h"
 #include "solution/analysis/handler/TransformationConstraintHandler.h"
+#include <boost/functional/hash.hpp>
 
 //! @brief Constructor.
 //! 
@@ -653,6 +654,83 @@ const XC::Graph &XC::AnalysisModel::getDOFGroupGraph(void) const
     return myGroupGraph;
   }
 
+//! @brief Append the size and the components of the ID to the key.
+static void append_id(std::vector<int> &key,const XC::ID &id)
+  {
+    const int sz= id.Size();
+    key.push_back(sz);
+    for(int i= 0;i<sz;i++)
+      key.push_back(id(i));
+  }
+
+//! @brief Fills the key argument with the data used to build the
+//! DOF\_Group graph (DOF\_Group tags, node tags and number of free DOFs
+//! along with the DOF\_Group tags of each FE\_Element).
+//!
+//! Two calls returning equal keys mean that the DOF\_Group graph is
+//! the same, so the numberer can reuse the ordering computed the
+//! previous time.
+void XC::AnalysisModel::getDOFGroupGraphKey(std::vector<int> &key) const
+  {
+    key.clear();
+    key.push_back(getNumDOF_Groups());
+    const DOF_Group *dofPtr= nullptr;
+    DOF_GrpConstIter &theDOFs= getConstDOFs();
+    while((dofPtr= theDOFs()) != 0)
+      {
+        key.push_back(dofPtr->getTag());
+        key.push_back(dofPtr->getNodeTag());
+        key.push_back(dofPtr->getNumFreeDOF());
+      }
+    const FE_Element *elePtr= nullptr;
+    FE_EleConstIter &theEles= getConstFEs();
+    while((elePtr= theEles()) != 0)
+      append_id(key,elePtr->getDOFtags());
+  }
+
+//! @brief Fills the key argument with the data used to build the
+//! DOF graph (number of equations along with the equation numbers of
+//! each DOF\_Group and each FE\_Element).
+//!
+//! Two calls returning equal keys mean that the sparsity of the
+//! system of equations is the same, so the LinearSOE doesn't need
+//! to be resized.
+void XC::AnalysisModel::getDOFGraphKey(std::vector<int> &key) const
+  {
+    key.clear();
+    key.push_back(numEqn);
+    const DOF_Group *dofPtr= nullptr;
+    DOF_GrpConstIter &theDOFs= getConstDOFs();
+    while((dofPtr= theDOFs()) != 0)
+      append_id(key,dofPtr->getID());
+    const FE_Element *elePtr= nullptr;
+    FE_EleConstIter &theEles= getConstFEs();
+    while((elePtr= theEles()) != 0)
+      append_id(key,elePtr->getID());
+  }
+
+//! @brief Returns a hash of the key computed by getDOFGroupGraphKey.
+//!
+//! Equal values don't guarantee equal graphs (hash collisions), so
+//! the callers that cache data must also compare the keys.
+size_t XC::AnalysisModel::getDOFGroupGraphSignature(void) const
+  {
+    std::vector<int> key;
+    getDOFGroupGraphKey(key);
+    return boost::hash_range(key.begin(),key.end());
+  }
+
+//! @brief Returns a hash of the key computed by getDOFGraphKey.
+//!
+//! Equal values don't guarantee equal graphs (hash collisions), so
+//! the callers that cache data must also compare the keys.
+size_t XC::AnalysisModel::getDOFGraphSignature(void) const
+  {
+    std::vector<int> key;
+    getDOFGraphKey(key);
+    return boost::hash_range(key.begin(),key.end());
+  }
+
 //! @brief Sets the values of the displacement, velocity and acceleration of
 //! the nodes.
 //! 
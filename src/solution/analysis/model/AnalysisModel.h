@@ -212,6 +212,10 @@ class AnalysisModel: public MovableObject, public CommandEntity
     virtual Graph &getDOFGroupGraph(void);
     virtual const Graph &getDOFGraph(void) const;
     virtual const Graph &getDOFGroupGraph(void) const;
+    void getDOFGroupGraphKey(std::vector<int> &) const;
+    void getDOFGraphKey(std::vector<int> &) const;
+    size_t getDOFGroupGraphSignature(void) const;
+    size_t getDOFGraphSignature(void) const;
 
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new_ nodal trial response quantities.
@@ -364,6 +364,26 @@ const XC::Vector &XC::FE_Element::getResidual(Integrator *theNewIntegrator)
   }
 
 
+//! @brief Return true if the tangent and the residual of this object
+//! can be computed concurrently with those of other FE_Elements.
+//!
+//! The base class delegates on the element (see Element::isThreadSafe);
+//! subclasses that use their own class wide storage must return false.
+bool XC::FE_Element::isThreadSafe(void) const
+  {
+    bool retval= false;
+    if(myEle)
+      retval= (!myEle->isSubdomain() && myEle->isThreadSafe());
+    return retval;
+  }
+
+//! @brief Set the number of threads that will compute tangents and
+//! residuals concurrently (allocates the per-thread class wide storage).
+//!
+//! Must be called from the main thread before the parallel computation.
+void XC::FE_Element::setNumThreads(const size_t &n)
+  { unbalAndTangentArray.setNumThreads(n); }
+
 //! @brief Zeros the tangent matrix.
 //!
 //! Zeros the tangent matrix. If the Element is not a Subdomain invokes
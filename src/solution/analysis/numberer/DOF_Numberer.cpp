@@ -79,11 +79,13 @@
 #include <domain/constraints/MFreedom_ConstraintIter.h>
 #include <domain/constraints/MRMFreedom_ConstraintIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include <boost/functional/hash.hpp>
 
 //! @brief Create the graph numberer (
 void XC::DOF_Numberer::alloc(const std::string &str)
   {
     free_mem();
+    clearOrderingCache();
     if(str=="rcm")
       theGraphNumberer=new RCM(); //Reverse Cuthill-Macgee.
     else if(str=="simple")
@@ -98,6 +100,7 @@ void XC::DOF_Numberer::alloc(const std::string &str)
 void XC::DOF_Numberer::copy(const GraphNumberer &gn)
   {
     free_mem();
+    clearOrderingCache();
     theGraphNumberer= gn.getCopy();
   }
 
@@ -114,11 +117,15 @@ void XC::DOF_Numberer::free_mem(void)
 //! @param owr: pointer to the ModelWrapper that ows this object.
 //! @param clsTag: class indentifier. 
 XC::DOF_Numberer::DOF_Numberer(ModelWrapper *owr, int clsTag) 
-  :MovableObject(clsTag), CommandEntity(owr), theGraphNumberer(nullptr) {}
+  :MovableObject(clsTag), CommandEntity(owr), theGraphNumberer(nullptr),
+   reuseOrdering(true), validOrdering(false), orderingSignature(0),
+   orderingHits(0), orderingMisses(0) {}
 
 //! @brief Copy constructor.
 XC::DOF_Numberer::DOF_Numberer(const DOF_Numberer &other)
-  : MovableObject(other), CommandEntity(other), theGraphNumberer(nullptr)
+  : MovableObject(other), CommandEntity(other), theGraphNumberer(nullptr),
+    reuseOrdering(other.reuseOrdering), validOrdering(false),
+    orderingSignature(0), orderingHits(0), orderingMisses(0)
   {
     if(other.theGraphNumberer)
       copy(*other.theGraphNumberer);
@@ -129,11 +136,57 @@ XC::DOF_Numberer &XC::DOF_Numberer::operator=(const DOF_Numberer &other)
   {
     MovableObject::operator=(other);
     CommandEntity::operator=(other);
+    reuseOrdering= other.reuseOrdering;
     if(other.theGraphNumberer)
       copy(*other.theGraphNumberer);
     return *this;
   }
 
+//! @brief Set the value of the reuseOrdering flag.
+void XC::DOF_Numberer::setReuseOrdering(const bool &b)
+  {
+    reuseOrdering= b;
+    if(!reuseOrdering)
+      clearOrderingCache();
+  }
+
+//! @brief Forget the cached ordering and reset the hit/miss counters.
+void XC::DOF_Numberer::clearOrderingCache(void)
+  {
+    validOrdering= false;
+    orderingSignature= 0;
+    orderingKey.clear();
+    cachedOrderedRefs.resize(0);
+    orderingHits= 0;
+    orderingMisses= 0;
+  }
+
+//! @brief Return true if the ordering of the DOF\_Groups computed
+//! in the previous call can be reused, i.e. if the signature of the
+//! DOF\_Group graph and the data it was computed from (computed by the
+//! caller including the last DOF group arguments) are the same as in
+//! the previous call. Updates the hit/miss counters.
+bool XC::DOF_Numberer::checkOrderingCache(const size_t &signature,const std::vector<int> &key)
+  {
+    const bool retval= reuseOrdering && validOrdering && (signature==orderingSignature) && (key==orderingKey);
+    if(retval)
+      orderingHits++;
+    else
+      orderingMisses++;
+    return retval;
+  }
+
+//! @brief Store the ordering computed for the graph whose signature
+//! and data are passed as parameters (the key is swapped to avoid
+//! copying it).
+void XC::DOF_Numberer::storeOrdering(const ID &orderedRefs,const size_t &signature,std::vector<int> &key)
+  {
+    cachedOrderedRefs= orderedRefs;
+    orderingSignature= signature;
+    orderingKey.swap(key);
+    validOrdering= reuseOrdering;
+  }
+
 //! @brief Sets the algorithm to be used for numerating the graph
 //! «Reverse Cuthill-Macgee» o simple.
 void XC::DOF_Numberer::useAlgorithm(const std::string &nmb)
@@ -204,8 +257,19 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
     if(am->getNumDOF_Groups() == 0)
       return 0;
 
-    // we first number the dofs using the dof group graph
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOF_Group);
+    // we first number the dofs using the dof group graph (if it
+    // has not changed since the last call, reuse the previous ordering).
+    size_t signature= 0;
+    std::vector<int> key;
+    if(reuseOrdering)
+      {
+        am->getDOFGroupGraphKey(key);
+        key.push_back(lastDOF_Group);
+        signature= boost::hash_range(key.begin(),key.end());
+      }
+    if(!checkOrderingCache(signature,key))
+      storeOrdering(theGraphNumberer->number(am->getDOFGroupGraph(), lastDOF_Group),signature,key);
+    const ID &orderedRefs= cachedOrderedRefs;
 
     // we now iterate through the DOFs first time setting -2 values  
     if(orderedRefs.Size() != am->getNumDOF_Groups())
@@ -372,9 +436,22 @@ int XC::DOF_Numberer::numberDOF(ID &lastDOFs)
     if(am->getNumDOF_Groups() == 0)
       return 0;
 
-    // we first number the dofs using the dof group graph
-        
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOFs);     
+    // we first number the dofs using the dof group graph (if it
+    // has not changed since the last call, reuse the previous ordering).
+    size_t signature= 0;
+    std::vector<int> key;
+    if(reuseOrdering)
+      {
+        am->getDOFGroupGraphKey(key);
+        const int sz= lastDOFs.Size();
+        key.push_back(sz);
+        for(int i= 0;i<sz;i++)
+          key.push_back(lastDOFs(i));
+        signature= boost::hash_range(key.begin(),key.end());
+      }
+    if(!checkOrderingCache(signature,key))
+      storeOrdering(theGraphNumberer->number(am->getDOFGroupGraph(), lastDOFs),signature,key);
+    const ID &orderedRefs= cachedOrderedRefs;
 
     // we now iterate through the DOFs first time setting -2 values
 
@@ -66,6 +66,7 @@
 
 #include <utility/actor/actor/MovableObject.h>
 #include "xc_utils/src/kernel/CommandEntity.h"
+#include "utility/matrix/ID.h"
 
 namespace XC {
 class AnalysisModel;
@@ -90,6 +91,11 @@ class ModelWrapper;
 //! assigns the equation numbers to the individual degrees-of-freedom. Subtypes
 //! may wish to implement the numbering in a more efficient manner by using
 //! the FE\_Element and DOF\_Group objects directly.
+//!
+//! When the DOF\_Group graph doesn't change between two calls to
+//! numberDOF (i.e. staged analysis where only the loads change)
+//! the ordering of the previous call is reused, avoiding the graph
+//! construction and its renumbering.
 class DOF_Numberer: public MovableObject, public CommandEntity
   {
   private:
@@ -97,6 +103,14 @@ class DOF_Numberer: public MovableObject, public CommandEntity
     const ModelWrapper *getModelWrapper(void) const;
 
     GraphNumberer *theGraphNumberer; //!< Graph (DOF) numberer.
+
+    bool reuseOrdering; //!< if true, reuse the ordering when the graph doesn't change.
+    bool validOrdering; //!< true if cachedOrderedRefs is valid.
+    size_t orderingSignature; //!< signature of the graph used to compute cachedOrderedRefs.
+    std::vector<int> orderingKey; //!< data of the graph used to compute cachedOrderedRefs.
+    ID cachedOrderedRefs; //!< DOF_Group ordering computed in the last call.
+    size_t orderingHits; //!< number of times the ordering was reused.
+    size_t orderingMisses; //!< number of times the ordering was computed.
   protected:
     AnalysisModel *getAnalysisModelPtr(void);
     GraphNumberer *getGraphNumbererPtr(void);
@@ -108,6 +122,8 @@ class DOF_Numberer: public MovableObject, public CommandEntity
     void alloc(const std::string &);
     void copy(const GraphNumberer &);
     void free_mem(void);
+    bool checkOrderingCache(const size_t &,const std::vector<int> &);
+    void storeOrdering(const ID &,const size_t &,std::vector<int> &);
 
     friend class ModelWrapper;
     friend class FEM_ObjectBroker;
@@ -124,6 +140,19 @@ class DOF_Numberer: public MovableObject, public CommandEntity
 
     void useAlgorithm(const std::string &);
 
+    //! @brief Return true if the ordering is reused when the
+    //! DOF_Group graph doesn't change.
+    inline bool getReuseOrdering(void) const
+      { return reuseOrdering; }
+    void setReuseOrdering(const bool &);
+    //! @brief Return the number of times the ordering has been reused.
+    inline size_t getOrderingHits(void) const
+      { return orderingHits; }
+    //! @brief Return the number of times the ordering has been computed.
+    inline size_t getOrderingMisses(void) const
+      { return orderingMisses; }
+    void clearOrderingCache(void);
+
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
   };
@@ -23,6 +23,10 @@
 
 class_<XC::DOF_Numberer, bases<XC::MovableObject,CommandEntity>, boost::noncopyable >("DOFNumberer", "A DOF numberer is responsible for assigning the equation numbers to the individual DOFs in each of the DOF groups in the analysis model.",no_init)
     .def("useAlgorithm", &XC::DOF_Numberer::useAlgorithm,return_internal_reference<>(),"\n""useAlgorithm(nmb)""Set the algorithm to be used for numerating the graph \n" "Parameters: \n""nmb: name of the algorithm, 'rcm' for Reverse Cuthill-Macgee or 'simple' for simple algorithm.")
+    .add_property("reuseOrdering", &XC::DOF_Numberer::getReuseOrdering, &XC::DOF_Numberer::setReuseOrdering,"If true, reuse the previous DOF ordering when the connectivity of the DOF groups doesn't change.")
+    .add_property("orderingHits", &XC::DOF_Numberer::getOrderingHits,"Number of times the DOF ordering has been reused.")
+    .add_property("orderingMisses", &XC::DOF_Numberer::getOrderingMisses,"Number of times the DOF ordering has been computed.")
+    .def("clearOrderingCache", &XC::DOF_Numberer::clearOrderingCache,"Forget the cached DOF ordering and reset the hit/miss counters.")
     ;
 
 // class_<XC::ParallelNumberer, bases<XC::DOF_Numberer>, boost::noncopyable >("ParallelNumberer", no_init);
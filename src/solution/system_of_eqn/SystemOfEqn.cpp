@@ -96,6 +96,14 @@ XC::AnalysisModel *XC::SystemOfEqn::getAnalysisModelPtr(void)
     return sm->getAnalysisModelPtr();
   }
 
+//! @brief Returns a pointer to the integrator.
+XC::Integrator *XC::SystemOfEqn::getIntegratorPtr(void)
+  {
+    AnalysisAggregation *sm= getAnalysisAggregation();
+    assert(sm);
+    return sm->getIntegratorPtr();
+  }
+
 //! @brief Check number of DOFs in the graph.
 int XC::SystemOfEqn::checkSize(Graph &theGraph) const
   {
@@ -71,6 +71,7 @@
 namespace XC {
 class Graph;
 class AnalysisModel;
+class Integrator;
 class FEM_ObjectBroker;
 class AnalysisAggregation;
 
@@ -93,6 +94,7 @@ class SystemOfEqn: public MovableObject, public CommandEntity
   protected:
     virtual AnalysisModel *getAnalysisModelPtr(void);
     virtual const AnalysisModel *getAnalysisModelPtr(void) const;
+    Integrator *getIntegratorPtr(void);
 
     friend class AnalysisAggregation;
     SystemOfEqn(AnalysisAggregation *,int classTag);
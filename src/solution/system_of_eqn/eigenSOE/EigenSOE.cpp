@@ -48,6 +48,7 @@
 #include <solution/system_of_eqn/eigenSOE/BandArpackSolver.h>
 #include <solution/system_of_eqn/eigenSOE/BandArpackppSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymArpackSolver.h>
+#include <solution/system_of_eqn/eigenSOE/SymLanczosSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSolver.h>
 
@@ -57,10 +58,12 @@
 #include "boost/numeric/ublas/vector.hpp"
 #include "boost/numeric/ublas/matrix.hpp"
 #include "utility/matrix/Matrix.h"
+#include <algorithm>
 
 //! @brief Constructor.
 XC::EigenSOE::EigenSOE(AnalysisAggregation *owr,int classTag)
-  :SystemOfEqn(owr,classTag), size(0), factored(false), theSolver(nullptr) {}
+  :SystemOfEqn(owr,classTag), size(0), factored(false), theSolver(nullptr),
+   massCSRUpToDate(false), modalFactorsUpToDate(false) {}
 
 void XC::EigenSOE::free_mem(void)
   {
@@ -123,6 +126,8 @@ XC::EigenSolver &XC::EigenSOE::newSolver(const std::string &type)
       setSolver(new FullGenEigenSolver());
     else if(type=="sym_arpack_solver")
       setSolver(new SymArpackSolver());
+    else if(type=="sym_lanczos_solver")
+      setSolver(new SymLanczosSolver());
     else
       std::cerr << "Solver of type: '"
                 << type << "' unknown." << std::endl;
@@ -134,15 +139,152 @@ XC::EigenSolver &XC::EigenSOE::newSolver(const std::string &type)
 XC::EigenSOE::~EigenSOE(void)
   { free_mem(); }
 
+//! @brief Resizes the mass matrix if its dimensions don't match the
+//! argument. Called by the derived classes before assembling the
+//! mass matrix so it also marks the data computed from it as outdated.
 void XC::EigenSOE::resize_mass_matrix_if_needed(const size_t &sz)
   {
     if((massMatrix.size1() != sz) || (massMatrix.size2() != sz))
       massMatrix= sparse_matrix(sz,sz,0.0);
+    mass_matrix_changed();
+  }
+
+//! @brief Marks the CSR copy of the mass matrix and the modal
+//! factors as outdated.
+void XC::EigenSOE::mass_matrix_changed(void)
+  {
+    massCSRUpToDate= false;
+    modalFactorsUpToDate= false;
+  }
+
+//! @brief Copies the mass matrix in compressed sparse row format.
+void XC::EigenSOE::build_mass_csr(void) const
+  {
+    const size_t n= massMatrix.size1();
+    massRowStart.assign(n+1,0);
+    massColIdx.clear();
+    massValues.clear();
+    massColIdx.reserve(massMatrix.nnz());
+    massValues.reserve(massMatrix.nnz());
+    massJ.resize(n);
+    massJ.Zero();
+    //The entries of the mapped matrix are sorted by rows.
+    for(sparse_matrix::const_iterator1 i1= massMatrix.begin1();i1!=massMatrix.end1();++i1)
+      for(sparse_matrix::const_iterator2 i2= i1.begin();i2!=i1.end();++i2)
+        {
+          const size_t row= i2.index1();
+          const size_t col= i2.index2();
+          const double value= *i2;
+          if((row<n) && (col<massMatrix.size2()) && (value!=0.0))
+            {
+              massColIdx.push_back(col);
+              massValues.push_back(value);
+              massRowStart[row+1]++;
+              massJ(row)+= value;
+            }
+        }
+    for(size_t i= 0;i<n;i++)
+      massRowStart[i+1]+= massRowStart[i];
+    massCSRUpToDate= true;
+  }
+
+//! @brief Computes y= M*x using the CSR copy of the mass matrix.
+void XC::EigenSOE::mass_prod(const Vector &x, Vector &y) const
+  {
+    if(!massCSRUpToDate)
+      build_mass_csr();
+    const size_t n= massRowStart.size()-1;
+    y.resize(n);
+    const int *rowStart= massRowStart.data();
+    const int *colIdx= massColIdx.data();
+    const double *values= massValues.data();
+    for(size_t i= 0;i<n;i++)
+      {
+        double tmp= 0.0;
+        for(int k= rowStart[i];k<rowStart[i+1];k++)
+          tmp+= values[k]*x(colIdx[k]);
+        y(i)= tmp;
+      }
+  }
+
+//! @brief Computes the modal participation factors and the products
+//! (eigenvector)^T*M*J of all the modes.
+//!
+//! The eigenvectors are copied by blocks in a row major array so
+//! each block is multiplied by the mass matrix in a single pass over
+//! its CSR arrays.
+void XC::EigenSOE::compute_modal_factors(void) const
+  {
+    if(!massCSRUpToDate)
+      build_mass_csr();
+    const int nm= getNumModes();
+    modalParticipationFactors.resize(nm);
+    modalMassProducts.resize(nm);
+    const size_t n= massRowStart.size()-1;
+    const int *rowStart= massRowStart.data();
+    const int *colIdx= massColIdx.data();
+    const double *values= massValues.data();
+    const size_t blockSize= 16;
+    std::vector<double> phi(n*blockSize); //Eigenvectors of the block by rows.
+    std::vector<double> num(blockSize), denom(blockSize), tmp(blockSize);
+    for(int first= 0;first<nm;first+= blockSize)
+      {
+        const size_t nb= std::min<size_t>(blockSize,nm-first);
+        for(size_t k= 0;k<nb;k++)
+          {
+            const Vector &ev= getEigenvector(first+k+1);
+            if(size_t(ev.Size())!=n)
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; ERROR the eigenvector has dimension "
+                        << ev.Size() << " and the mass matrix "
+                        << massMatrix.size1() << "x" << massMatrix.size2()
+                        << ".\n";
+            const size_t sz= std::min<size_t>(ev.Size(),n);
+            for(size_t i= 0;i<sz;i++)
+              phi[i*nb+k]= ev(i);
+            for(size_t i= sz;i<n;i++)
+              phi[i*nb+k]= 0.0;
+          }
+        std::fill(num.begin(),num.end(),0.0);
+        std::fill(denom.begin(),denom.end(),0.0);
+        for(size_t i= 0;i<n;i++)
+          {
+            //tmp= row i of M*phi.
+            std::fill(tmp.begin(),tmp.begin()+nb,0.0);
+            for(int p= rowStart[i];p<rowStart[i+1];p++)
+              {
+                const double v= values[p];
+                const double *phiRow= &phi[colIdx[p]*nb];
+                for(size_t k= 0;k<nb;k++)
+                  tmp[k]+= v*phiRow[k];
+              }
+            const double *phiRow= &phi[i*nb];
+            const double mj= massJ(i);
+            for(size_t k= 0;k<nb;k++)
+              {
+                num[k]+= phiRow[k]*mj;
+                denom[k]+= phiRow[k]*tmp[k];
+              }
+          }
+        for(size_t k= 0;k<nb;k++)
+          {
+            modalMassProducts(first+k)= num[k];
+            modalParticipationFactors(first+k)= num[k]/denom[k];
+          }
+      }
+    modalFactorsUpToDate= true;
   }
 
 //! @brief Solve the eigenproblem con the number of modos passed as parameter.
+//!
+//! The eigenvectors change so the modal factors must be recomputed;
+//! the mass matrix doesn't, so its CSR copy is kept (it's invalidated
+//! by addM, zeroM and identityM).
 int XC::EigenSOE::solve(int numModes)
-  { return (theSolver->solve(numModes)); }
+  {
+    modalFactorsUpToDate= false; //New eigenvectors.
+    return (theSolver->solve(numModes));
+  }
 
 //! @brief No hace nada.
 int XC::EigenSOE::solve(void)
@@ -159,6 +301,7 @@ XC::EigenSolver *XC::EigenSOE::getSolver(void)
 void XC::EigenSOE::zeroM(void)
   {
     massMatrix.clear();
+    mass_matrix_changed();
   }
 
 //! @brief Makes M the identity matrix (to find stiffness matrix eigenvalues).
@@ -171,6 +314,7 @@ void XC::EigenSOE::identityM(void)
                 << "mass matrix is not square " << sz1
                 << "x" << sz2 << ".\n";
     massMatrix= boost::numeric::ublas::identity_matrix<double>(std::min(sz1,sz2));
+    mass_matrix_changed();
   }
 
 //! @brief Return the autovector that correspond to the mode
@@ -238,31 +382,17 @@ const int &XC::EigenSOE::getNumModes(void) const
 //! @brief Returns the modal participation factor for the mode.
 double XC::EigenSOE::getModalParticipationFactor(int mode) const
   {
-    const Vector ev= getEigenvector(mode);
-    const size_t sz= ev.Size();
-    if((massMatrix.size1()!=sz) || (massMatrix.size2()!=sz))
-      std::cerr << "EigenSOE::getModalParticipationFactor; ERROR "
-                << "the eigenvector has dimension " << sz
-                << " and the mass matrix " << massMatrix.size1()
-                << "x" << massMatrix.size2() << ".\n";
-    boost::numeric::ublas::vector<double> fi_mode(sz);
-    for(size_t i= 0;i<sz;i++)
-      fi_mode(i)= ev(i);
-    const boost::numeric::ublas::vector<double> J(sz,1.0);
-    const double num= boost::numeric::ublas::inner_prod(fi_mode,prod(massMatrix,J));
-    const boost::numeric::ublas::vector<double> tmp= prod(massMatrix,fi_mode);
-    const double denom= boost::numeric::ublas::inner_prod(fi_mode,tmp);
-    return num/denom;
+    if(!modalFactorsUpToDate)
+      compute_modal_factors();
+    return modalParticipationFactors(mode-1);
   }
 
 //! @brief Returns the modal participation factors.
 XC::Vector XC::EigenSOE::getModalParticipationFactors(void) const
   {
-    const int nm= getNumModes();
-    Vector retval(nm);
-    for(int i= 1;i<=nm;i++)
-      retval[i-1]= getModalParticipationFactor(i);
-    return retval;
+    if(!modalFactorsUpToDate)
+      compute_modal_factors();
+    return modalParticipationFactors;
   }
 
 //! @brief Returns the distribution factors for the i-th mode.
@@ -277,16 +407,16 @@ XC::Matrix XC::EigenSOE::getDistributionFactors(void) const
     const int nm= getNumModes();
     if(nm>0)
       {
-        Vector distribFactor= getDistributionFactor(1);
-        const int n_rows= distribFactor.Size();
+        if(!modalFactorsUpToDate)
+          compute_modal_factors();
+        const int n_rows= getEigenvector(1).Size();
         retval= Matrix(n_rows,nm);
-        for(int i= 0;i<n_rows;i++)
-          retval(i,0)= distribFactor(i);
-        for(int j= 2;j<=nm;j++)
+        for(int j= 1;j<=nm;j++)
           {
-            distribFactor= getDistributionFactor(j);
+            const double tau= modalParticipationFactors(j-1);
+            const Vector &ev= getEigenvector(j);
             for(int i= 0;i<n_rows;i++)
-              retval(i,j-1)= distribFactor(i);
+              retval(i,j-1)= tau*ev(i);
           }
       }
     return retval;
@@ -295,15 +425,9 @@ XC::Matrix XC::EigenSOE::getDistributionFactors(void) const
 //! @brief Return the effective modal mass for the i-th mode.
 double XC::EigenSOE::getEffectiveModalMass(int i) const
   {
-    const double tau= getModalParticipationFactor(i);
-    const Vector ev= getEigenvector(i);
-    const int sz= ev.Size();
-    boost::numeric::ublas::vector<double> fi_mode(sz);
-    for(int i= 0;i<sz;i++)
-      fi_mode(i)= ev(i);
-    boost::numeric::ublas::vector<double> J(sz,1.0);
-    const double p= boost::numeric::ublas::inner_prod(fi_mode,prod(massMatrix,J));
-    return tau*p;
+    if(!modalFactorsUpToDate)
+      compute_modal_factors();
+    return modalParticipationFactors(i-1)*modalMassProducts(i-1);
   }
 
 //! @brief Returns the effective modal masses for each mode.
@@ -319,9 +443,12 @@ XC::Vector XC::EigenSOE::getEffectiveModalMasses(void) const
 //! @brief Return the model total mass.
 double XC::EigenSOE::getTotalMass(void) const
   {
-    const size_t sz= massMatrix.size1();
-    const boost::numeric::ublas::vector<double> J(sz,1.0);
-    const double retval= boost::numeric::ublas::inner_prod(J,prod(massMatrix,J));
+    if(!massCSRUpToDate)
+      build_mass_csr();
+    double retval= 0.0;
+    const int sz= massJ.Size();
+    for(int i= 0;i<sz;i++)
+      retval+= massJ(i);
     return retval;
   }
 
@@ -329,14 +456,9 @@ double XC::EigenSOE::getTotalMass(void) const
 //! passed as parameter.
 XC::Vector XC::EigenSOE::getEquivalentStaticLoad(int mode,const double &accel_mode) const
   {
-    Vector tmp= getDistributionFactor(mode);
-    const int sz= tmp.Size();
-    boost::numeric::ublas::vector<double> df(sz);
-    for(int i= 0;i<sz;i++)
-      df(i)= tmp(i);
-    df= prod(massMatrix,df);
-    for(int i= 0;i<sz;i++)
-      tmp(i)= df(i)*accel_mode;
-    return tmp;
+    const Vector df= getDistributionFactor(mode);
+    Vector retval;
+    mass_prod(df,retval);
+    retval*= accel_mode;
+    return retval;
   }
-
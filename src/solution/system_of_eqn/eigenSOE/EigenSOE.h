@@ -46,11 +46,12 @@
 
 #include <solution/system_of_eqn/SystemOfEqn.h>
 #include "/usr/include/boost/numeric/ublas/matrix_sparse.hpp"
+#include "utility/matrix/Vector.h"
+#include <vector>
 
 namespace XC {
 class EigenSolver;
 class Matrix;
-class Vector;
 class ID;
 
 //!  @ingroup SOE
@@ -60,6 +61,15 @@ class ID;
 //! @ingroup EigenSOE
 //
 //! @brief Base class for eigenproblem systems of equations.
+//!
+//! The mass matrix assembled by the derived classes is copied in
+//! compressed sparse row (CSR) format the first time it's needed;
+//! the copy is kept across the solutions of the eigenproblem and
+//! rebuilt only when the mass matrix changes (zeroM, addM, identityM
+//! or a new size). The modal participation
+//! factors and the effective modal masses of all the modes are
+//! computed at once (one pass over the mass matrix for each block
+//! of modes) and kept until the next solution.
 class EigenSOE : public SystemOfEqn
   {
   public:
@@ -69,11 +79,25 @@ class EigenSOE : public SystemOfEqn
     bool factored;
     sparse_matrix massMatrix; //!< Mass matrix (used in getModalParticipationFactor).
     EigenSolver *theSolver;
-
+  private:
+    mutable std::vector<int> massRowStart; //!< CSR row pointers of the mass matrix.
+    mutable std::vector<int> massColIdx; //!< CSR column indexes of the mass matrix.
+    mutable std::vector<double> massValues; //!< CSR values of the mass matrix.
+    mutable Vector massJ; //!< product of the mass matrix by a vector of ones.
+    mutable Vector modalParticipationFactors; //!< modal participation factors.
+    mutable Vector modalMassProducts; //!< products (eigenvector)^T*M*J.
+    mutable bool massCSRUpToDate; //!< true if the CSR copy of the mass matrix is up to date.
+    mutable bool modalFactorsUpToDate; //!< true if the modal factors correspond to the current eigenvectors.
+
+    void build_mass_csr(void) const;
+    void compute_modal_factors(void) const;
+    void mass_prod(const Vector &, Vector &) const;
+  protected:
     void free_mem(void);
     void copy(const EigenSolver *);
     virtual bool setSolver(EigenSolver *);
     void resize_mass_matrix_if_needed(const size_t &);
+    void mass_matrix_changed(void);
 
     EigenSOE(AnalysisAggregation *,int classTag);
   public:
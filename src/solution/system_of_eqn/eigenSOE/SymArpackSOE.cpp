@@ -37,12 +37,14 @@
 
 #include "solution/system_of_eqn/eigenSOE/SymArpackSOE.h"
 #include "solution/system_of_eqn/eigenSOE/SymArpackSolver.h"
+#include "solution/system_of_eqn/eigenSOE/SymLanczosSolver.h"
 #include "solution/system_of_eqn/linearSOE/sparseSYM/symbolic.h"
 #include <utility/matrix/Matrix.h>
 #include "solution/graph/graph/Graph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <cmath>
+#include <algorithm>
 #include <utility/matrix/Vector.h>
 
 //! @brief Constructor.
@@ -50,18 +52,24 @@ XC::SymArpackSOE::SymArpackSOE(AnalysisAggregation *owr,double theShift)
   :ArpackSOE(owr,EigenSOE_TAGS_SymArpackSOE,theShift),
    nnz(0), colA(0), rowStartA(0), 
    nblks(0), xblk(0), invp(0), diag(0), penv(0), rowblks(0),
-   begblk(0), first(0) {}
+   begblk(0), first(0), assembledShift(theShift) {}
 
 //! @brief Sets the solver that will be used to solve the eigenproblem.
 bool XC::SymArpackSOE::setSolver(EigenSolver *newSolver)
   {
     bool retval= false;
     SymArpackSolver *tmp= dynamic_cast<SymArpackSolver *>(newSolver);
+    SymLanczosSolver *tmpLanczos= dynamic_cast<SymLanczosSolver *>(newSolver);
     if(tmp)
       {
         tmp->setEigenSOE(*this);
         retval= ArpackSOE::setSolver(tmp);
       }
+    else if(tmpLanczos)
+      {
+        tmpLanczos->setEigenSOE(*this);
+        retval= ArpackSOE::setSolver(tmpLanczos);
+      }
     else
       std::cerr << "XC::BandArpackSOE::setSolver; solver incompatible con system of equations." << std::endl;
     return retval;
@@ -164,6 +172,7 @@ int XC::SymArpackSOE::setSize(Graph &theGraph)
 //    nblks = symFactorization(rowStartA, colA, size, LSPARSE);
     nblks = symFactorization(rowStartA.getDataPtr(), colA.getDataPtr(), size, LSPARSE,
 			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
+    setRowSegments();
 
     // invoke setSize() on the XC::Solver
     EigenSolver *theSolvr = this->getSolver();
@@ -308,19 +317,164 @@ int XC::SymArpackSOE::addM(const Matrix &m, const ID &id, double fact)
         std::cerr << "BandArpackSOE::addA(); Matrix and ID not of similar sizes\n";
         return -1;
       }
-    resize_mass_matrix_if_needed(idSize);      
+    resize_mass_matrix_if_needed(size);      
 
     for(int i=0; i<idSize; i++)
-      for(int j=0; j<idSize; j++)
-        massMatrix(i,j)+= m(j,i);
+      {
+        const int col= id(i);
+        if(col < size && col >= 0)
+          for(int j=0; j<idSize; j++)
+            {
+              const int row= id(j);
+              if(row < size && row >= 0)
+                massMatrix(row,col)+= m(j,i)*fact;
+            }
+      }
     //Added by LCPT ends.
 
-    return this->addA(m, id, -shift);
+    return this->addA(m, id, -assembledShift);
+  }
+
+//! @brief Stores the first off-diagonal row segment of each row
+//! of the factor.
+void XC::SymArpackSOE::setRowSegments(void)
+  {
+    rowSegments.assign(size,nullptr);
+    if(first)
+      for(OFFDBLK *p= first;p->row<size;p= p->next)
+        if(!rowSegments[p->row])
+          rowSegments[p->row]= p;
+  }
+
+//! @brief Returns the number of values stored for the matrix A
+//! (diagonal, envelope and off-diagonal row segments).
+size_t XC::SymArpackSOE::getNumValues(void) const
+  {
+    size_t retval= 0;
+    if((size>0) && diag)
+      {
+        retval= size+(penv[size]-penv[0]);
+        for(OFFDBLK *p= first;p->row<size;p= p->next)
+          retval+= xblk[rowblks[p->beg]+1]-p->beg;
+      }
+    return retval;
+  }
+
+//! @brief Copies the values stored for the matrix A (diagonal,
+//! envelope and off-diagonal row segments).
+void XC::SymArpackSOE::getValues(std::vector<double> &v) const
+  {
+    v.resize(getNumValues());
+    if(!v.empty())
+      {
+        std::vector<double>::iterator i= std::copy(diag,diag+size,v.begin());
+        i= std::copy(penv[0],penv[size],i);
+        for(OFFDBLK *p= first;p->row<size;p= p->next)
+          i= std::copy(p->nz,p->nz+(xblk[rowblks[p->beg]+1]-p->beg),i);
+      }
+  }
+
+//! @brief Restores the values of the matrix A from a copy
+//! obtained with getValues.
+void XC::SymArpackSOE::setValues(const std::vector<double> &v)
+  {
+    if(v.size()!=getNumValues())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; wrong number of values: " << v.size()
+                  << " (" << getNumValues() << " expected)." << std::endl;
+        return;
+      }
+    if(!v.empty())
+      {
+        std::vector<double>::const_iterator i= v.begin();
+        std::copy(i,i+size,diag); i+= size;
+        const size_t envSize= penv[size]-penv[0];
+        std::copy(i,i+envSize,penv[0]); i+= envSize;
+        for(OFFDBLK *p= first;p->row<size;p= p->next)
+          {
+            const int len= xblk[rowblks[p->beg]+1]-p->beg;
+            std::copy(i,i+len,p->nz); i+= len;
+          }
+      }
+  }
+
+//! @brief Returns a pointer to the stored value of the entry (row,col)
+//! of A (numbering of the factor, row >= col) or a null pointer
+//! if the entry is outside the profile.
+double *XC::SymArpackSOE::findEntry(const int &row,const int &col)
+  {
+    double *retval= nullptr;
+    if(row==col)
+      retval= diag+row;
+    else if(col>=xblk[rowblks[row]]) // diagonal block.
+      retval= penv[row+1]-row+col;
+    else // row segments.
+      for(OFFDBLK *p= rowSegments[row];p && (p->row==row);p= p->next)
+        if((col>=p->beg) && (col<xblk[rowblks[p->beg]+1]))
+          {
+            retval= p->nz+(col-p->beg);
+            break;
+          }
+    return retval;
+  }
+
+//! @brief Adds the mass matrix multiplied by the factor argument
+//! to the (not factored) matrix A.
+int XC::SymArpackSOE::addMassMatrix(const double &fact)
+  {
+    if(fact==0.0)
+      return 0;
+    for(sparse_matrix::const_iterator1 i1= massMatrix.begin1();i1!=massMatrix.end1();++i1)
+      for(sparse_matrix::const_iterator2 i2= i1.begin();i2!=i1.end();++i2)
+        {
+          const int row= invp[i2.index1()];
+          const int col= invp[i2.index2()];
+          if(row>=col) //lower triangle.
+            {
+              double *entry= findEntry(row,col);
+              if(entry)
+                *entry+= fact*(*i2);
+              else
+                {
+                  std::cerr << getClassName() << "::" << __FUNCTION__
+                            << "; entry (" << i2.index1() << ","
+                            << i2.index2() << ") out of the profile."
+                            << std::endl;
+                  return -1;
+                }
+            }
+        }
+    return 0;
+  }
+
+//! @brief Returns the number of negative pivots of the
+//! factorization \f$A= L D L^t\f$. If the matrix A has been factored
+//! its the number of eigenvalues smaller than the shift
+//! (Sturm sequence property).
+int XC::SymArpackSOE::getNumNegativePivots(void) const
+  {
+    int retval= 0;
+    if(diag)
+      for(int i= 0;i<size;i++)
+        if(diag[i]<0.0)
+          retval++;
+    return retval;
   }
 
 //! @brief Zeroes the matrix A.
 void XC::SymArpackSOE::zeroA(void)
-  { factored = false; }
+  {
+    factored = false;
+    assembledShift= shift;
+    if((size>0) && diag)
+      {
+        std::fill(diag,diag+size,0.0);
+        std::fill(penv[0],penv[size],0.0);
+        for(OFFDBLK *p= first;p->row<size;p= p->next)
+          std::fill(p->nz,p->nz+(xblk[rowblks[p->beg]+1]-p->beg),0.0);
+      }
+  }
 
 //! @brief Zeroes the matrix M.
 void XC::SymArpackSOE::zeroM(void)
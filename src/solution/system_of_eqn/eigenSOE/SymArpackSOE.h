@@ -44,6 +44,7 @@
 #define SymArpackSOE_h
 
 #include <solution/system_of_eqn/eigenSOE/ArpackSOE.h>
+#include <vector>
 
 extern "C" {
    #include <solution/system_of_eqn/linearSOE/sparseSYM/FeStructs.h>
@@ -53,6 +54,7 @@ extern "C" {
 
 namespace XC {
 class SymArpackSolver;
+class SymLanczosSolver;
 
 //! @ingroup EigenSOE
 //
@@ -70,6 +72,16 @@ class SymArpackSOE : public ArpackSOE
     int      *rowblks;
     OFFDBLK  **begblk;
     OFFDBLK  *first;
+    std::vector<OFFDBLK *> rowSegments; //!< first off-diagonal segment of each row.
+    double assembledShift; //!< shift used to assemble A= K-assembledShift*M.
+
+    void setRowSegments(void);
+    size_t getNumValues(void) const;
+    void getValues(std::vector<double> &) const;
+    void setValues(const std::vector<double> &);
+    double *findEntry(const int &,const int &);
+    int addMassMatrix(const double &);
+    int getNumNegativePivots(void) const;
   protected:
     bool setSolver(EigenSolver *);
 
@@ -94,6 +106,7 @@ class SymArpackSOE : public ArpackSOE
     int recvSelf(const CommParameters &);
 
     friend class SymArpackSolver;
+    friend class SymLanczosSolver;
   };
 inline SystemOfEqn *SymArpackSOE::getCopy(void) const
   { return new SymArpackSOE(*this); }
@@ -70,7 +70,7 @@ extern "C" int dseupd_(bool *rvec, char *howmny, long int *select, double *d, do
 //! @brief Constructor.
 XC::SymArpackSolver::SymArpackSolver(int numE)
  :EigenSolver(EigenSOLVER_TAGS_SymArpackSolver, numE),
-theSOE(nullptr), factored(false)
+theSOE(nullptr)
   {
     // nothing to do.
   }
@@ -101,7 +101,7 @@ int XC::SymArpackSolver::solve(void)
       return 0;
 
 //        timer (FACTOR);
-    if(factored == false)
+    if(!theSOE->factored) //A has been assembled again.
       {
         //factor the matrix
         //call the "C" function to do the numerical factorization.
@@ -112,7 +112,7 @@ int XC::SymArpackSolver::solve(void)
             std::cerr << "In XC::SymArpackSolver: error in factorization.\n";
             return -1;
           }
-        factored = true;
+        theSOE->factored= true;
       }
 
     int nev = numModes;
@@ -194,7 +194,7 @@ int XC::SymArpackSolver::solve(void)
             std::cerr << "XC::BandArpackSolver::No Shifts could be applied during implicit," << std::endl;
             std::cerr << "Arnoldi update, try increasing NCV." << std::endl;
           }
-        double sigma = theSOE->shift;
+        double sigma = theSOE->assembledShift; //shift used to assemble A.
         if(iparam[4] > 0)
           {
             dseupd_(&rvec, &howmy, &select[0], d.getDataPtr(), v.getDataPtr(), &ldv, &sigma, &bmat, &n, eleeme,
@@ -53,7 +53,6 @@ class SymArpackSolver : public EigenSolver
   {
   private:
     SymArpackSOE *theSOE;
-    bool factored;
 
     Vector value;
     Vector vector;
@@ -69,7 +68,8 @@ class SymArpackSolver : public EigenSolver
     bool setEigenSOE(EigenSOE *theSOE);
   public:
     virtual int solve(void);
-    virtual int solve(int numModes) {return this->solve();};    
+    virtual int solve(int nModes)
+      { numModes= nModes; return this->solve(); }
     virtual int setSize(void);
     const int &getSize(void) const;
 
@@ -0,0 +1,593 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SymLanczosSolver.cc
+
+#include "solution/system_of_eqn/eigenSOE/SymLanczosSolver.h"
+#include "solution/system_of_eqn/eigenSOE/SymArpackSOE.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+extern "C" {
+  #include <solution/system_of_eqn/linearSOE/sparseSYM/FeStructs.h>
+  #include "solution/system_of_eqn/linearSOE/sparseSYM/nmat.h"
+}
+
+extern "C" int dstev_(char *JOBZ, int *N, double *D, double *E, double *Z,
+                      int *LDZ, double *WORK, int *INFO);
+
+//! @brief Minimum number of equations to use the threads in the
+//! products (below that the synchronization costs more than the work).
+const size_t minParallelRows= 2048;
+
+//! @brief Constructor.
+XC::SymLanczosSolver::SymLanczosSolver(int numE)
+  :EigenSolver(EigenSOLVER_TAGS_SymLanczosSolver, numE),
+   theSOE(nullptr), tol(1e-10), numThreads(1),
+   factoredShift(std::numeric_limits<double>::quiet_NaN()),
+   numFactorizations(0), numLanczosSteps(0), numNegativePivots(0) {}
+
+//! @brief Return the shifts used in the solution (if empty the shift
+//! of the system of equations is used).
+const XC::Vector &XC::SymLanczosSolver::getShifts(void) const
+  { return shifts; }
+
+//! @brief Set the shifts used in the solution, the requested modes
+//! are distributed among them (if empty the shift of the system of
+//! equations is used).
+void XC::SymLanczosSolver::setShifts(const Vector &v)
+  { shifts= v; }
+
+//! @brief Return the relative tolerance for the Ritz values.
+const double &XC::SymLanczosSolver::getTolerance(void) const
+  { return tol; }
+
+//! @brief Set the relative tolerance for the Ritz values.
+void XC::SymLanczosSolver::setTolerance(const double &t)
+  { tol= std::max(t,std::numeric_limits<double>::epsilon()); }
+
+//! @brief Set the number of threads (if zero use the number of
+//! concurrent threads supported by the hardware).
+void XC::SymLanczosSolver::setNumThreads(const int &nt)
+  { numThreads= std::max(nt,0); }
+
+//! @brief Return the number of threads (zero means the number of
+//! concurrent threads supported by the hardware).
+int XC::SymLanczosSolver::getNumThreads(void) const
+  { return numThreads; }
+
+//! @brief Return the number of numerical factorizations computed
+//! by the solver.
+int XC::SymLanczosSolver::getNumFactorizations(void) const
+  { return numFactorizations; }
+
+//! @brief Return the number of Lanczos steps of the last solution.
+int XC::SymLanczosSolver::getNumLanczosSteps(void) const
+  { return numLanczosSteps; }
+
+//! @brief Return the number of negative pivots of the last factorization
+//! (number of eigenvalues smaller than the shift).
+int XC::SymLanczosSolver::getNumNegativePivots(void) const
+  { return numNegativePivots; }
+
+//! @brief Return the number of chunks used to process n rows.
+size_t XC::SymLanczosSolver::getNumChunks(const size_t &n) const
+  {
+    size_t retval= 1;
+    if(n>=minParallelRows)
+      retval= std::min(n,getThreadCount(numThreads));
+    return std::max(retval,size_t(1));
+  }
+
+//! @brief Runs the function on the rows [0,n) using the threads
+//! of the shared pool if the number of rows is big enough.
+void XC::SymLanczosSolver::parallel_rows(const size_t &n,const ChunkFunction &f)
+  { parallel_for(n,getNumChunks(n),f); }
+
+//! @brief Copies the mass matrix of the system of equations in
+//! compressed sparse row format using the numbering of the factor.
+void XC::SymLanczosSolver::build_mass_csr(void)
+  {
+    const int n= theSOE->size;
+    const int *invp= theSOE->invp;
+    const EigenSOE::sparse_matrix &m= theSOE->massMatrix;
+    mRowStart.assign(n+1,0);
+    mColIdx.clear();
+    mValues.clear();
+    if((m.size1()!=size_t(n)) || (m.size2()!=size_t(n)))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the mass matrix has not been assembled."
+                  << std::endl;
+        return;
+      }
+    typedef EigenSOE::sparse_matrix::const_iterator1 const_iterator1;
+    typedef EigenSOE::sparse_matrix::const_iterator2 const_iterator2;
+    for(const_iterator1 i1= m.begin1();i1!=m.end1();++i1)
+      for(const_iterator2 i2= i1.begin();i2!=i1.end();++i2)
+        if(*i2!=0.0)
+          mRowStart[invp[i2.index1()]+1]++;
+    for(int i= 0;i<n;i++)
+      mRowStart[i+1]+= mRowStart[i];
+    mColIdx.resize(mRowStart[n]);
+    mValues.resize(mRowStart[n]);
+    std::vector<int> pos(mRowStart.begin(),mRowStart.end()-1);
+    for(const_iterator1 i1= m.begin1();i1!=m.end1();++i1)
+      for(const_iterator2 i2= i1.begin();i2!=i1.end();++i2)
+        if(*i2!=0.0)
+          {
+            const int k= pos[invp[i2.index1()]]++;
+            mColIdx[k]= invp[i2.index2()];
+            mValues[k]= *i2;
+          }
+  }
+
+//! @brief Computes y= M*x (factor numbering).
+void XC::SymLanczosSolver::mass_prod(const std::vector<double> &x,std::vector<double> &y)
+  {
+    const size_t n= x.size();
+    y.resize(n);
+    parallel_rows(n,[&](size_t b,size_t e,size_t)
+      {
+        for(size_t i= b;i<e;i++)
+          {
+            double tmp= 0.0;
+            for(int k= mRowStart[i];k<mRowStart[i+1];k++)
+              tmp+= mValues[k]*x[mColIdx[k]];
+            y[i]= tmp;
+          }
+      });
+  }
+
+//! @brief Returns the dot product of the arguments. The partial sums
+//! of each chunk are added in order so the result doesn't depend
+//! on the timing of the threads.
+double XC::SymLanczosSolver::dot(const std::vector<double> &a,const std::vector<double> &b)
+  {
+    const size_t n= a.size();
+    std::vector<double> partial(getNumChunks(n),0.0);
+    parallel_rows(n,[&](size_t first,size_t last,size_t t)
+      {
+        double tmp= 0.0;
+        for(size_t i= first;i<last;i++)
+          tmp+= a[i]*b[i];
+        partial[t]= tmp;
+      });
+    double retval= 0.0;
+    for(size_t t= 0;t<partial.size();t++)
+      retval+= partial[t];
+    return retval;
+  }
+
+//! @brief Makes w M-orthogonal to the vectors of Q (classical
+//! Gram-Schmidt). Returns the coefficients in coef.
+//!
+//! @param Q: Lanczos vectors.
+//! @param MQ: products of the mass matrix by the Lanczos vectors.
+void XC::SymLanczosSolver::orthogonalize(const std::vector<std::vector<double> > &Q,const std::vector<std::vector<double> > &MQ,std::vector<double> &w,std::vector<double> &coef)
+  {
+    const size_t n= w.size();
+    const size_t m= Q.size();
+    const size_t nc= getNumChunks(n);
+    std::vector<double> partial(nc*m,0.0);
+    parallel_rows(n,[&](size_t first,size_t last,size_t t)
+      {
+        for(size_t j= 0;j<m;j++)
+          {
+            const std::vector<double> &mq= MQ[j];
+            double tmp= 0.0;
+            for(size_t i= first;i<last;i++)
+              tmp+= mq[i]*w[i];
+            partial[t*m+j]= tmp;
+          }
+      });
+    coef.assign(m,0.0);
+    for(size_t t= 0;t<nc;t++)
+      for(size_t j= 0;j<m;j++)
+        coef[j]+= partial[t*m+j];
+    parallel_rows(n,[&](size_t first,size_t last,size_t)
+      {
+        for(size_t j= 0;j<m;j++)
+          {
+            const std::vector<double> &q= Q[j];
+            const double c= coef[j];
+            for(size_t i= first;i<last;i++)
+              w[i]-= c*q[i];
+          }
+      });
+  }
+
+//! @brief Factors the matrix \f$K-\sigma M\f$.
+//!
+//! The factorization is reused if the matrix has not been assembled
+//! again and the shift doesn't change. Otherwise the values saved
+//! after the last assembly are restored and the mass matrix is added
+//! to get the new shift (the element contributions are not assembled
+//! again).
+int XC::SymLanczosSolver::factor(const double &sigma)
+  {
+    if(theSOE->factored && (sigma==factoredShift) && !assembledValues.empty())
+      return 0; //Reuse the factorization.
+    if(!theSOE->factored) //Values just assembled.
+      theSOE->getValues(assembledValues);
+    else if(!assembledValues.empty() && (assembledValues.size()==theSOE->getNumValues()))
+      theSOE->setValues(assembledValues);
+    else
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the matrix has been factored by other solver;"
+                  << " it must be assembled again." << std::endl;
+        return -1;
+      }
+    if(theSOE->addMassMatrix(theSOE->assembledShift-sigma)<0)
+      return -1;
+    const int info= pfsfct(theSOE->size, theSOE->diag, theSOE->penv, theSOE->nblks, theSOE->xblk, theSOE->begblk, theSOE->first, theSOE->rowblks);
+    theSOE->factored= true; //The values of A are not valid anymore.
+    numFactorizations++;
+    if(info>0)
+      {
+        factoredShift= std::numeric_limits<double>::quiet_NaN();
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; error in factorization with shift: "
+                  << sigma << " (is it an eigenvalue?)." << std::endl;
+        return -1;
+      }
+    factoredShift= sigma;
+    numNegativePivots= theSOE->getNumNegativePivots();
+    return 0;
+  }
+
+//! @brief Computes the eigenpairs nearest to the shift using the
+//! current factorization.
+//!
+//! Runs Lanczos steps with full reorthogonalization until the k
+//! Ritz values nearest to the shift converge (or an invariant subspace
+//! is found). Returns the converged eigenpairs, the nearest to the
+//! shift first.
+//!
+//! @param sigma: shift.
+//! @param k: number of eigenpairs to compute.
+//! @param values: eigenvalues.
+//! @param vectors: eigenvectors (factor numbering) normalized
+//!                 with respect to the mass matrix.
+int XC::SymLanczosSolver::lanczos(const double &sigma,const int &k,std::vector<double> &values,std::vector<std::vector<double> > &vectors)
+  {
+    const int n= theSOE->size;
+    values.clear();
+    vectors.clear();
+
+    // Starting vector in the range of the operator (deterministic
+    // pseudo-random values).
+    std::vector<double> w(n), Mw(n);
+    unsigned long seed= 12345;
+    for(int i= 0;i<n;i++)
+      {
+        seed= (seed*1103515245UL+12345UL)%2147483648UL;
+        w[i]= double(seed)/2147483648.0-0.5;
+      }
+    mass_prod(w,Mw);
+    w= Mw;
+    pfsslv(n, theSOE->diag, theSOE->penv, theSOE->nblks, theSOE->xblk, w.data(), theSOE->begblk);
+    mass_prod(w,Mw);
+    const double b0= std::sqrt(std::max(dot(w,Mw),0.0));
+    if(b0==0.0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the mass matrix is null." << std::endl;
+        return -1;
+      }
+    for(int i= 0;i<n;i++)
+      { w[i]/= b0; Mw[i]/= b0; }
+    std::vector<std::vector<double> > Q(1,w), MQ(1,Mw);
+
+    std::vector<double> alpha, beta, coef;
+    std::vector<double> theta, z, work;
+    std::vector<int> order;
+    const double eps= std::numeric_limits<double>::epsilon();
+    double normT= 0.0;
+    int nextCheck= std::min(std::max(2*k,k+8),n);
+    const int checkStep= std::max(k/2,5);
+    bool finished= false;
+    while(!finished)
+      {
+        const int j= Q.size()-1;
+        w= MQ[j];
+        pfsslv(n, theSOE->diag, theSOE->penv, theSOE->nblks, theSOE->xblk, w.data(), theSOE->begblk);
+        double a= dot(MQ[j],w);
+        const std::vector<double> &qj= Q[j];
+        for(int i= 0;i<n;i++)
+          w[i]-= a*qj[i];
+        if(j>0)
+          {
+            const std::vector<double> &qj1= Q[j-1];
+            const double bj1= beta[j-1];
+            for(int i= 0;i<n;i++)
+              w[i]-= bj1*qj1[i];
+          }
+        // Full reorthogonalization (twice is enough).
+        orthogonalize(Q,MQ,w,coef);
+        a+= coef[j];
+        orthogonalize(Q,MQ,w,coef);
+        mass_prod(w,Mw);
+        const double b2= dot(w,Mw);
+        normT= std::max(normT,std::fabs(a)+(j>0 ? beta[j-1] : 0.0));
+        if(b2<-std::sqrt(eps)*normT*normT)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; the mass matrix is not positive semidefinite."
+                      << std::endl;
+            return -1;
+          }
+        const double b= std::sqrt(std::max(b2,0.0));
+        alpha.push_back(a);
+        beta.push_back(b);
+        normT= std::max(normT,std::fabs(a)+b);
+        const int m= alpha.size();
+        const bool breakdown= (b<=100.0*eps*normT); //Invariant subspace.
+        if(breakdown || (m>=nextCheck) || (m==n))
+          {
+            // Eigenpairs of the tridiagonal matrix.
+            theta= alpha;
+            std::vector<double> e(beta.begin(),beta.end()-1);
+            e.push_back(0.0);
+            z.resize(m*m);
+            work.resize(std::max(1,2*m-2));
+            int M= m, ldz= m, info= 0;
+            char jobz= 'V';
+            dstev_(&jobz,&M,theta.data(),e.data(),z.data(),&ldz,work.data(),&info);
+            if(info!=0)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; error in dstev: " << info << std::endl;
+                return -1;
+              }
+            // The Ritz values with bigger magnitude correspond to
+            // the eigenvalues nearest to the shift.
+            order.resize(m);
+            for(int i= 0;i<m;i++)
+              order[i]= i;
+            std::stable_sort(order.begin(),order.end(),[&](int p,int q)
+              { return std::fabs(theta[p])>std::fabs(theta[q]); });
+            std::vector<bool> converged(m);
+            int nconv= 0;
+            for(int i= 0;i<m;i++)
+              {
+                const int idx= order[i];
+                converged[i]= breakdown || (m==n) || (std::fabs(b*z[idx*m+m-1])<=tol*std::fabs(theta[idx]));
+                if(converged[i] && (i<k))
+                  nconv++;
+              }
+            finished= breakdown || (m==n) || (nconv>=std::min(k,m));
+            if(finished)
+              {
+                for(int i= 0;i<m;i++)
+                  if(converged[i] && (theta[order[i]]!=0.0))
+                    {
+                      const double *s= &z[order[i]*m];
+                      std::vector<double> x(n,0.0);
+                      parallel_rows(n,[&](size_t first,size_t last,size_t)
+                        {
+                          for(int l= 0;l<m;l++)
+                            {
+                              const std::vector<double> &q= Q[l];
+                              const double c= s[l];
+                              for(size_t r= first;r<last;r++)
+                                x[r]+= c*q[r];
+                            }
+                        });
+                      values.push_back(sigma+1.0/theta[order[i]]);
+                      vectors.push_back(x);
+                    }
+                numLanczosSteps+= m;
+              }
+            else
+              nextCheck= std::min(m+checkStep,n);
+          }
+        if(!finished)
+          {
+            for(int i= 0;i<n;i++)
+              { w[i]/= b; Mw[i]/= b; }
+            Q.push_back(w);
+            MQ.push_back(Mw);
+          }
+      }
+    return 0;
+  }
+
+//! @brief Solves the eigenproblem.
+int XC::SymLanczosSolver::solve(void)
+  { return solve(numModes); }
+
+//! @brief Computes the eigenpairs nearest to the shifts.
+//!
+//! @param nModes: number of modes to compute.
+int XC::SymLanczosSolver::solve(int nModes)
+  {
+    if(!theSOE)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; no EigenSOE object has been set." << std::endl;
+        return -1;
+      }
+    const int n= theSOE->size;
+    numModes= std::min(std::max(nModes,0),n);
+    eigenvalues.clear();
+    eigenvectors.clear();
+    numLanczosSteps= 0;
+    if(numModes==0) // check for quick return
+      return 0;
+
+    build_mass_csr();
+    std::vector<double> theShifts;
+    if(shifts.Size()==0)
+      theShifts.push_back(theSOE->shift);
+    else
+      for(int i= 0;i<shifts.Size();i++)
+        theShifts.push_back(shifts(i));
+    const int numShifts= std::min(int(theShifts.size()),numModes);
+
+    // Eigenpairs of all the shifts. The first ones of each
+    // shift (primary) are always kept.
+    std::vector<double> candValues;
+    std::vector<std::vector<double> > candVectors;
+    std::vector<bool> primary;
+    std::vector<double> values, Mx;
+    std::vector<std::vector<double> > vectors;
+    for(int s= 0;s<numShifts;s++)
+      {
+        const int k= numModes/numShifts+((s<numModes%numShifts) ? 1 : 0);
+        if(factor(theShifts[s])<0)
+          return -1;
+        if(lanczos(theShifts[s],k,values,vectors)<0)
+          return -1;
+        for(size_t i= 0;i<values.size();i++)
+          {
+            mass_prod(vectors[i],Mx);
+            // Already computed from other shift?
+            size_t dup= candValues.size();
+            for(size_t c= 0;c<candValues.size();c++)
+              {
+                const double scale= std::max(std::fabs(values[i]),std::fabs(candValues[c]));
+                if((std::fabs(values[i]-candValues[c])<=1e-8*scale) && (std::fabs(dot(candVectors[c],Mx))>=0.5))
+                  { dup= c; break; }
+              }
+            if(dup<candValues.size())
+              primary[dup]= primary[dup] || (int(i)<k);
+            else
+              {
+                candValues.push_back(values[i]);
+                candVectors.push_back(vectors[i]);
+                primary.push_back(int(i)<k);
+              }
+          }
+      }
+
+    // Selection: primary eigenpairs first then the lowest ones.
+    std::vector<size_t> order(candValues.size());
+    for(size_t i= 0;i<order.size();i++)
+      order[i]= i;
+    std::stable_sort(order.begin(),order.end(),[&](size_t p,size_t q)
+      {
+        if(primary[p]!=primary[q])
+          return bool(primary[p]);
+        return candValues[p]<candValues[q];
+      });
+    if(order.size()>size_t(numModes))
+      order.resize(numModes);
+    std::stable_sort(order.begin(),order.end(),[&](size_t p,size_t q)
+      { return candValues[p]<candValues[q]; });
+    for(size_t i= 0;i<order.size();i++)
+      {
+        eigenvalues.push_back(candValues[order[i]]);
+        eigenvectors.push_back(candVectors[order[i]]);
+      }
+    if(int(eigenvalues.size())<numModes)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; only " << eigenvalues.size() << " of "
+                  << numModes << " modes found." << std::endl;
+        numModes= eigenvalues.size();
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Sets the size of the system.
+int XC::SymLanczosSolver::setSize(void)
+  {
+    const int size= theSOE->size;
+    if(eigenV.Size() != size)
+      eigenV.resize(size);
+    assembledValues.clear(); //New profile.
+    factoredShift= std::numeric_limits<double>::quiet_NaN();
+    eigenvalues.clear();
+    eigenvectors.clear();
+    return 0;
+  }
+
+//! @brief Return the eigenvectors dimension.
+const int &XC::SymLanczosSolver::getSize(void) const
+  { return theSOE->size; }
+
+//! @brief Sets the eigenproblem to solve.
+bool XC::SymLanczosSolver::setEigenSOE(EigenSOE *soe)
+  {
+    bool retval= false;
+    SymArpackSOE *tmp= dynamic_cast<SymArpackSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; not a suitable system of equations." << std::endl;
+    return retval;
+  }
+
+//! @brief Sets the eigenproblem to solve.
+bool XC::SymLanczosSolver::setEigenSOE(SymArpackSOE &theEigenSOE)
+  { return setEigenSOE(&theEigenSOE); }
+
+//! @brief Returns the eigenvector corresponding to the mode being passed as parameter.
+const XC::Vector &XC::SymLanczosSolver::getEigenvector(int mode) const
+  {
+    if(mode <= 0 || mode > int(eigenvectors.size()))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; mode " << mode << " is out of range (1 - "
+                  << eigenvectors.size() << ")." << std::endl;
+        eigenV.Zero();
+        return eigenV;
+      }
+    const int size= theSOE->size;
+    const int *invp= theSOE->invp;
+    const std::vector<double> &v= eigenvectors[mode-1];
+    for(int i= 0;i<size;i++)
+      eigenV(i)= v[invp[i]];
+    return eigenV;
+  }
+
+//! @brief Returns the eigenvalue corresponding to the mode being passed as parameter.
+const double &XC::SymLanczosSolver::getEigenvalue(int mode) const
+  {
+    static const double zero= 0.0;
+    if(mode <= 0 || mode > int(eigenvalues.size()))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; mode " << mode << " is out of range (1 - "
+                  << eigenvalues.size() << ")." << std::endl;
+        return zero;
+      }
+    return eigenvalues[mode-1];
+  }
+
+int XC::SymLanczosSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::SymLanczosSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,122 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SymLanczosSolver.h
+
+#ifndef SymLanczosSolver_h
+#define SymLanczosSolver_h
+
+#include <solution/system_of_eqn/eigenSOE/EigenSolver.h>
+#include "utility/matrix/Vector.h"
+#include "utility/threads/parallel_loop.h"
+#include <vector>
+
+namespace XC {
+class SymArpackSOE;
+
+//! @ingroup EigenSolver
+//
+//! @brief Shift-invert Lanczos solver for the generalized symmetric
+//! eigenproblem \f$K \phi= \lambda M \phi\f$ stored in a SymArpackSOE.
+//!
+//! The Lanczos vectors are built with the operator
+//! \f$(K-\sigma M)^{-1} M\f$ using the sparse \f$L D L^t\f$ factorization
+//! of the system of equations and they are fully reorthogonalized with
+//! respect to the mass matrix (so the mass matrix must be positive
+//! semidefinite). The eigenpairs nearest to each shift \f$\sigma\f$
+//! are computed; with several shifts the requested modes are
+//! distributed among them and the results are merged and sorted
+//! in ascending order.
+//!
+//! The values of \f$K-\sigma_a M\f$ (being \f$\sigma_a\f$ the shift used
+//! to assemble the system) are saved before the first factorization,
+//! so when only the shift changes the matrix is obtained without
+//! assembling the element contributions again, and the factorization
+//! is reused while neither the matrices nor the shift change. The
+//! products by the mass matrix and the reorthogonalizations are
+//! computed by the threads of the shared ThreadPool.
+class SymLanczosSolver : public EigenSolver
+  {
+  private:
+    SymArpackSOE *theSOE;
+    Vector shifts; //!< shifts (if empty the shift of the SOE is used).
+    double tol; //!< relative tolerance for the Ritz values.
+    int numThreads; //!< number of threads (0: hardware concurrency).
+    std::vector<double> assembledValues; //!< values of A before factorization.
+    double factoredShift; //!< shift of the current factorization.
+    int numFactorizations; //!< number of numerical factorizations.
+    int numLanczosSteps; //!< number of Lanczos steps in the last solution.
+    int numNegativePivots; //!< negative pivots of the last factorization.
+    std::vector<int> mRowStart; //!< CSR row pointers of M (factor numbering).
+    std::vector<int> mColIdx; //!< CSR column indexes of M (factor numbering).
+    std::vector<double> mValues; //!< CSR values of M.
+    std::vector<double> eigenvalues; //!< computed eigenvalues.
+    std::vector<std::vector<double> > eigenvectors; //!< computed eigenvectors (factor numbering).
+    mutable Vector eigenV;
+
+    void parallel_rows(const size_t &,const ChunkFunction &);
+    void build_mass_csr(void);
+    void mass_prod(const std::vector<double> &,std::vector<double> &);
+    int factor(const double &);
+    size_t getNumChunks(const size_t &) const;
+    double dot(const std::vector<double> &,const std::vector<double> &);
+    void orthogonalize(const std::vector<std::vector<double> > &,const std::vector<std::vector<double> > &,std::vector<double> &,std::vector<double> &);
+    int lanczos(const double &,const int &,std::vector<double> &,std::vector<std::vector<double> > &);
+
+    friend class EigenSOE;
+    SymLanczosSolver(int numE = 0);
+    virtual EigenSolver *getCopy(void) const;
+    bool setEigenSOE(EigenSOE *theSOE);
+  public:
+    virtual int solve(void);
+    virtual int solve(int numModes);
+    virtual int setSize(void);
+    const int &getSize(void) const;
+
+    virtual bool setEigenSOE(SymArpackSOE &theSOE);
+
+    const Vector &getShifts(void) const;
+    void setShifts(const Vector &);
+    const double &getTolerance(void) const;
+    void setTolerance(const double &);
+    void setNumThreads(const int &);
+    int getNumThreads(void) const;
+    int getNumFactorizations(void) const;
+    int getNumLanczosSteps(void) const;
+    int getNumNegativePivots(void) const;
+
+    virtual const Vector &getEigenvector(int mode) const;
+    virtual const double &getEigenvalue(int mode) const;
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline EigenSolver *SymLanczosSolver::getCopy(void) const
+   { return new SymLanczosSolver(*this); }
+} // end of XC namespace
+
+#endif
@@ -22,7 +22,7 @@
 //python_interface.tcc
 
 class_<XC::EigenSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("EigenSOE", "Base class for eigenproblem systems of equations.", no_init)
-.def("newSolver", &XC::EigenSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_arpack_solver', 'band_arpackpp_solver', 'sym_band_eigen_solver', 'full_gen_eigen_solver', 'sym_arpack_solver'")
+.def("newSolver", &XC::EigenSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_arpack_solver', 'band_arpackpp_solver', 'sym_band_eigen_solver', 'full_gen_eigen_solver', 'sym_arpack_solver', 'sym_lanczos_solver'")
   ;
 
 class_<XC::ArpackSOE, bases<XC::EigenSOE>, boost::noncopyable >("ArpackSOE", no_init)
@@ -52,6 +52,15 @@ class_<XC::BandArpackppSolver, bases<XC::EigenSolver>, boost::noncopyable >("Ban
 class_<XC::SymArpackSolver, bases<XC::EigenSolver>, boost::noncopyable >("SymArpackSolver", no_init)
   ;
 
+class_<XC::SymLanczosSolver, bases<XC::EigenSolver>, boost::noncopyable >("SymLanczosSolver", "Shift-invert Lanczos solver for symmetric eigenproblems.", no_init)
+  .add_property("shifts", make_function(&XC::SymLanczosSolver::getShifts, return_internal_reference<>()), &XC::SymLanczosSolver::setShifts,"Shifts used in the solution; the requested modes are distributed among them (if empty the shift of the system of equations is used).")
+  .add_property("tol", make_function(&XC::SymLanczosSolver::getTolerance, return_value_policy<copy_const_reference>()), &XC::SymLanczosSolver::setTolerance,"Relative tolerance for the Ritz values.")
+  .add_property("numThreads", &XC::SymLanczosSolver::getNumThreads, &XC::SymLanczosSolver::setNumThreads,"Number of threads (0: number of concurrent threads supported by the hardware).")
+  .add_property("numFactorizations", &XC::SymLanczosSolver::getNumFactorizations,"Number of numerical factorizations computed by the solver.")
+  .add_property("numLanczosSteps", &XC::SymLanczosSolver::getNumLanczosSteps,"Number of Lanczos steps of the last solution.")
+  .add_property("numNegativePivots", &XC::SymLanczosSolver::getNumNegativePivots,"Number of negative pivots of the last factorization (number of eigenvalues smaller than the shift).")
+  ;
+
 class_<XC::BandArpackSolver, bases<XC::EigenSolver>, boost::noncopyable >("BandArpackSolver", no_init)
   ;
 
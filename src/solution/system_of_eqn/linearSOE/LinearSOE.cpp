@@ -67,11 +67,12 @@
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h>
-//#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
 
 #include <solution/system_of_eqn/linearSOE/DomainSolver.h>
 
 #include <solution/system_of_eqn/linearSOE/cg/ConjugateGradientSolver.h>
+#include <solution/system_of_eqn/linearSOE/cg/MatrixFreePCGSolver.h>
 
 #include <solution/system_of_eqn/linearSOE/diagonal/DiagonalSolver.h>
 #include <solution/system_of_eqn/linearSOE/diagonal/DistributedDiagonalSolver.h>
@@ -84,7 +85,7 @@
 
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectBlockSolver.h>
-//#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSkypackSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h>
 //#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h>
@@ -93,10 +94,16 @@
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SuperLU.h>
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SupernodalCholeskySolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColAMGSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowAMGSolver.h>
 
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
 
 #include "utility/matrix/Vector.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/fe_ele/FE_Element.h"
+#include <boost/functional/hash.hpp>
 
 //#include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h>
 
@@ -105,7 +112,9 @@
 //! @param owr: analysis aggregation that owns this object.
 //! @param classTag: identifier of the class.
 XC::LinearSOE::LinearSOE(AnalysisAggregation *owr,int classTag)
-  :SystemOfEqn(owr,classTag), theSolver(nullptr) {}
+  :SystemOfEqn(owr,classTag), theSolver(nullptr), reuseSparsity(true),
+   validSignature(false), sparsitySignature(0), sparsityHits(0),
+   sparsityMisses(0), useScatterMaps(true) {}
 
 //! @brief Frees memory.
 void XC::LinearSOE::free_memory(void)
@@ -168,8 +177,8 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new BandGenLinLapackSolver());
     else if(type=="band_spd_lin_lapack_solver")
       setSolver(new BandSPDLinLapackSolver());
-//     else if(type=="band_spd_lin_thread_solver")
-//       setSolver(new BandSPDLinThreadSolver());
+    else if(type=="band_spd_lin_thread_solver")
+      setSolver(new BandSPDLinThreadSolver());
 //     else if(type=="conjugate_gradient_solver")
 //       setSolver(new ConjugateGradientSolver());
     else if(type=="diagonal_direct_solver")
@@ -180,18 +189,26 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new FullGenLinLapackSolver());
 //     else if(type=="itpack_lin_solver")
 //       setSolver(new ItpackLinSolver());
+    else if(type=="matrix_free_pcg_solver")
+      setSolver(new MatrixFreePCGSolver());
+    else if(type=="sparse_gen_col_amg_solver")
+      setSolver(new SparseGenColAMGSolver());
+    else if(type=="sparse_gen_row_amg_solver")
+      setSolver(new SparseGenRowAMGSolver());
     else if(type=="profile_spd_lin_direct_solver")
       setSolver(new ProfileSPDLinDirectSolver());
     else if(type=="profile_spd_lin_direct_block_solver")
       setSolver(new ProfileSPDLinDirectBlockSolver());
     else if(type=="profile_spd_lin_direct_skypack_solver")
      setSolver(new ProfileSPDLinDirectSkypackSolver());
-//     else if(type=="profile_spd_lin_direct_thread_solver")
-//       setSolver(new ProfileSPDLinDirectThreadSolver());
+    else if(type=="profile_spd_lin_direct_thread_solver")
+      setSolver(new ProfileSPDLinDirectThreadSolver());
 //     else if(type=="profile_spd_lin_substr_solver")
 //       setSolver(new ProfileSPDLinSubstrSolver());
     else if(type=="super_lu_solver")
       setSolver(new SuperLU());
+    else if(type=="supernodal_cholesky_solver")
+      setSolver(new SupernodalCholeskySolver());
     else if(type=="sym_sparse_lin_solver")
       setSolver(new SymSparseLinSolver());
 //     else if(type=="umfpack_gen_lin_solver")
@@ -226,6 +243,110 @@ double XC::LinearSOE::getDeterminant(void)
 XC::LinearSOESolver *XC::LinearSOE::getSolver(void)
   { return theSolver; }
 
+//! @brief Determines and sets the size of the system from the
+//! DOF graph of the model.
+//!
+//! If the signature of the DOF graph of the model (see
+//! AnalysisModel::getDOFGraphSignature) is the same that was used
+//! the last time the system was sized and the data it was computed
+//! from are equal too (so a hash collision can't be taken as a hit),
+//! the graph is not built and setSize is not invoked (so the solver
+//! keeps its symbolic factorization), the matrix \f$A\f$ and the vector
+//! \f$b\f$ are zeroed instead. Otherwise invokes
+//! setSize(theModel.getDOFGraph()).
+int XC::LinearSOE::updateSize(AnalysisModel &theModel)
+  {
+    int retval= 0;
+    size_t signature= 0;
+    std::vector<int> key;
+    if(reuseSparsity)
+      {
+        theModel.getDOFGraphKey(key);
+        signature= boost::hash_range(key.begin(),key.end());
+      }
+    if(reuseSparsity && validSignature && (signature==sparsitySignature) && (key==sparsityKey))
+      {
+        sparsityHits++;
+        zeroA();
+        zeroB();
+      }
+    else
+      {
+        sparsityMisses++;
+        validSignature= false;
+        retval= setSize(theModel.getDOFGraph());
+        if(retval>=0)
+          {
+            sparsitySignature= signature;
+            sparsityKey.swap(key);
+            validSignature= reuseSparsity;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Set the value of the reuseSparsity flag.
+void XC::LinearSOE::setReuseSparsity(const bool &b)
+  {
+    reuseSparsity= b;
+    if(!reuseSparsity)
+      clearSparsityCache();
+  }
+
+//! @brief Forget the stored signature and reset the hit/miss counters.
+void XC::LinearSOE::clearSparsityCache(void)
+  {
+    validSignature= false;
+    sparsitySignature= 0;
+    sparsityKey.clear();
+    sparsityHits= 0;
+    sparsityMisses= 0;
+  }
+
+//! @brief Set the value of the useScatterMaps flag (the maps use
+//! one pointer for each term of each element matrix, so they can be
+//! disabled to save memory).
+void XC::LinearSOE::setUseScatterMaps(const bool &b)
+  {
+    useScatterMaps= b;
+    if(!useScatterMaps)
+      scatterMap.clear();
+  }
+
+//! @brief Return the address of the term \f$a_{row,col}\f$ in the
+//! storage of the matrix (nullptr if the term is not stored). The
+//! default implementation returns nullptr, so no scatter map is built.
+double *XC::LinearSOE::getEntryPtr(const int &, const int &)
+  { return nullptr; }
+
+//! @brief Builds the scatter map of the elements of the model. It must
+//! be called by the setSize method of the systems that implement
+//! getEntryPtr once the storage of the matrix has been allocated.
+void XC::LinearSOE::buildScatterMap(void)
+  {
+    scatterMap.clear();
+    AnalysisModel *mdl= getAnalysisModelPtr();
+    if(useScatterMaps && mdl)
+      scatterMap.build(*mdl,*this);
+  }
+
+//! @brief Assembles \f$fact\cdot M\f$ (the matrix of the element)
+//! into the matrix \f$A\f$.
+//!
+//! If the scatter map has the element (and its ID hasn't changed) the
+//! terms are added to the positions stored in the map; otherwise
+//! calls addA(M,ele.getID(),fact).
+int XC::LinearSOE::addElementA(const Matrix &M, const FE_Element &ele, double fact)
+  {
+    int retval= 0;
+    if(fact != 0.0)
+      {
+        if(!scatterMap.scatter(M,ele,fact))
+          retval= addA(M,ele.getID(),fact);
+      }
+    return retval;
+  }
+
 //! @brief invoke setSize() on the Solver
 int XC::LinearSOE::setSolverSize(void)
   {
@@ -62,12 +62,14 @@
 // What: "@(#) LinearSOE.h, revA"
 
 #include <solution/system_of_eqn/SystemOfEqn.h>
+#include <solution/system_of_eqn/linearSOE/ScatterMap.h>
 
 namespace XC {
 class LinearSOESolver;
 class Matrix;
 class Vector;
 class ID;
+class FE_Element;
 
 //!  @ingroup SOE
 //! 
@@ -88,10 +90,28 @@ class ID;
 //! equations. Each LinearSOE object will be associated with a
 //! LinearSOESolver object. It is the LinearSOESolver objects that is
 //! responsible for solving the linear system of equations.
+//!
+//! The object keeps a signature of the DOF graph used to size the system
+//! (along with the data it was computed from); when the analysis asks for
+//! a new size with the same graph the storage and the symbolic data of
+//! the solver are reused.
+//!
+//! The systems that implement getEntryPtr build, when their size is
+//! set, a ScatterMap with the position of the terms of each element
+//! matrix in the storage of \f$A\f$, so addElementA doesn't need to
+//! search them.
 class LinearSOE : public SystemOfEqn
   {
   private:
     LinearSOESolver *theSolver;
+    bool reuseSparsity; //!< if true, don't resize the system if the sparsity doesn't change.
+    bool validSignature; //!< true if sparsitySignature is valid.
+    size_t sparsitySignature; //!< signature of the graph used in the last call to setSize.
+    std::vector<int> sparsityKey; //!< data of the graph used in the last call to setSize.
+    size_t sparsityHits; //!< number of times the system size has been reused.
+    size_t sparsityMisses; //!< number of times the system has been resized.
+    bool useScatterMaps; //!< if true, build the scatter maps of the elements when the size is set.
+    ScatterMap scatterMap; //!< position of the element matrix terms in the storage of A.
     void free_memory(void);
     void copy(const LinearSOESolver *);
   protected:
@@ -99,6 +119,14 @@ class LinearSOE : public SystemOfEqn
     virtual bool setSolver(LinearSOESolver *);
     int setSolverSize(void);
 
+    friend class ScatterMap;
+    virtual double *getEntryPtr(const int &, const int &);
+    void buildScatterMap(void);
+    //! @brief Removes the scatter map (must be called before
+    //! reallocating the storage of the matrix).
+    inline void clearScatterMap(void)
+      { scatterMap.clear(); }
+
     LinearSOE(AnalysisAggregation *,int classTag);
   public:
     virtual ~LinearSOE(void);
@@ -113,6 +141,27 @@ class LinearSOE : public SystemOfEqn
     //! the connectivity between the vertices in the Graph object \p theGraph.
     //! To return $0$ if sucessfull, a negative number if not.
     virtual int setSize(Graph &theGraph) =0;
+    int updateSize(AnalysisModel &);
+    //! @brief Return true if the system size is reused when the
+    //! sparsity doesn't change.
+    inline bool getReuseSparsity(void) const
+      { return reuseSparsity; }
+    void setReuseSparsity(const bool &);
+    //! @brief Return the number of times the system size has been reused.
+    inline size_t getSparsityHits(void) const
+      { return sparsityHits; }
+    //! @brief Return the number of times the system has been resized.
+    inline size_t getSparsityMisses(void) const
+      { return sparsityMisses; }
+    void clearSparsityCache(void);
+    //! @brief Return true if the scatter maps of the elements are
+    //! built when the size of the system is set.
+    inline bool getUseScatterMaps(void) const
+      { return useScatterMaps; }
+    void setUseScatterMaps(const bool &);
+    //! @brief Return the number of addresses stored in the scatter map.
+    inline size_t getScatterMapSize(void) const
+      { return scatterMap.getNumEntries(); }
     //! @brief Returns the number of equations in the system.
     virtual int getNumEqn(void) const =0;
     
@@ -125,6 +174,7 @@ class LinearSOE : public SystemOfEqn
     //! is not added to $A$. To return $0$ if sucessfull, a
     //! negative number if not.
     virtual int addA(const Matrix &M, const ID &loc, double fact = 1.0) =0;
+    int addElementA(const Matrix &, const FE_Element &, double fact = 1.0);
 
     //! The LinearSOE object assembles \p fact times the Vector \p V into
     //! the vector $b$. The Vector is assembled into $b$ at the locations
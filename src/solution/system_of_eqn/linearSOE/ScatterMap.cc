@@ -0,0 +1,174 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ScatterMap.cc
+
+#include "ScatterMap.h"
+#include "LinearSOE.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/FE_EleIter.h"
+#include "solution/analysis/model/fe_ele/FE_Element.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+#include <algorithm>
+
+//! @brief Constructor.
+XC::ScatterMap::ScatterMap(void)
+  {}
+
+//! @brief Copy constructor.
+//!
+//! The addresses point to the storage of the system of equations
+//! that built the map, so they are not copied (the copy is empty
+//! and its owner will build a new map when its size is set).
+XC::ScatterMap::ScatterMap(const ScatterMap &)
+  {}
+
+//! @brief Assignment operator (see copy constructor).
+XC::ScatterMap &XC::ScatterMap::operator=(const ScatterMap &)
+  {
+    clear();
+    return *this;
+  }
+
+//! @brief Removes the map.
+void XC::ScatterMap::clear(void)
+  {
+    slots.clear();
+    ids.clear();
+    entries.clear();
+  }
+
+//! @brief Builds the map for the elements of the model.
+//!
+//! The address of each term is obtained from LinearSOE::getEntryPtr,
+//! so it must be called once the storage of the system has been
+//! allocated (and it's not valid after reallocating it).
+void XC::ScatterMap::build(AnalysisModel &theModel, LinearSOE &theSOE)
+  {
+    clear();
+    const int numEqn= theSOE.getNumEqn();
+    size_t numIds= 0, numEntries= 0;
+    int maxTag= -1;
+    FE_Element *elePtr= nullptr;
+    FE_EleIter &theEles= theModel.getFEs();
+    while((elePtr= theEles()) != 0)
+      {
+        const size_t n= elePtr->getID().Size();
+        numIds+= n;
+        numEntries+= n*n;
+        maxTag= std::max(maxTag,elePtr->getTag());
+      }
+    if(maxTag<0)
+      return;
+    slots.resize(maxTag+1);
+    ids.reserve(numIds);
+    entries.reserve(numEntries);
+    FE_EleIter &theEles2= theModel.getFEs();
+    while((elePtr= theEles2()) != 0)
+      {
+        const ID &id= elePtr->getID();
+        const int n= id.Size();
+        Slot &s= slots[elePtr->getTag()];
+        s.idStart= ids.size();
+        s.entryStart= entries.size();
+        s.n= n;
+        for(int i= 0;i<n;i++)
+          ids.push_back(id(i));
+        for(int j= 0;j<n;j++) // column.
+          {
+            const int col= id(j);
+            for(int i= 0;i<n;i++) // row.
+              {
+                const int row= id(i);
+                double *ptr= nullptr;
+                if((row>=0) && (row<numEqn) && (col>=0) && (col<numEqn))
+                  ptr= theSOE.getEntryPtr(row,col);
+                entries.push_back(ptr);
+              }
+          }
+      }
+  }
+
+//! @brief Return the data of the element (nullptr if there is no
+//! valid map for it).
+const XC::ScatterMap::Slot *XC::ScatterMap::getSlot(const FE_Element &ele) const
+  {
+    const Slot *retval= nullptr;
+    const int tag= ele.getTag();
+    if((tag>=0) && (tag<int(slots.size())))
+      {
+        const Slot &s= slots[tag];
+        const ID &id= ele.getID();
+        if((s.idStart>=0) && (s.n==id.Size()))
+          {
+            const int *elemIds= &ids[s.idStart];
+            bool same= true;
+            for(int i= 0;i<s.n;i++)
+              if(elemIds[i]!=id(i))
+                { same= false; break; }
+            if(same)
+              retval= &s;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Adds fact*m to the system matrix using the addresses
+//! of the element. Returns false if there is no valid map for the
+//! element (and nothing is added).
+bool XC::ScatterMap::scatter(const Matrix &m, const FE_Element &ele, const double &fact) const
+  {
+    const Slot *s= getSlot(ele);
+    if(!s || (m.noRows()!=s->n) || (m.noCols()!=s->n))
+      return false;
+    const size_t nn= size_t(s->n)*s->n;
+    double *const *ptr= &entries[s->entryStart];
+    const double *data= m.getDataPtr();
+    if(fact==1.0)
+      {
+        for(size_t k= 0;k<nn;k++)
+          if(ptr[k])
+            *ptr[k]+= data[k];
+      }
+    else
+      {
+        for(size_t k= 0;k<nn;k++)
+          if(ptr[k])
+            *ptr[k]+= fact*data[k];
+      }
+    return true;
+  }
+
+//! @brief Return the number of elements in the map.
+size_t XC::ScatterMap::getNumElements(void) const
+  {
+    size_t retval= 0;
+    for(std::vector<Slot>::const_iterator i= slots.begin();i!=slots.end();i++)
+      if(i->idStart>=0)
+        retval++;
+    return retval;
+  }
@@ -0,0 +1,91 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ScatterMap.h
+
+#ifndef ScatterMap_h
+#define ScatterMap_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class AnalysisModel;
+class FE_Element;
+class Matrix;
+class LinearSOE;
+
+//! @ingroup LinearSOE
+//
+//! @brief Precomputed assembly positions of the element matrices.
+//!
+//! For each FE_Element of the model it stores the address in the
+//! storage of the system matrix of each term of the element matrix
+//! (in the column major order of Matrix), or a null pointer if the
+//! term is not stored (fixed DOFs or the other triangle of a symmetric
+//! storage). While the connectivity doesn't change the assembly of an
+//! element matrix is a loop of additions without any search.
+//!
+//! Each element keeps a copy of its ID, so a map built for an older
+//! numbering is never used.
+class ScatterMap
+  {
+  private:
+    //! @brief Position of the data of an element.
+    struct Slot
+      {
+        long int idStart; //!< first entry of the element ID in ids (-1 if no map).
+        long int entryStart; //!< first entry of the element in entries.
+        int n; //!< number of rows of the element matrix.
+        Slot(void)
+          : idStart(-1), entryStart(0), n(0) {}
+      };
+    std::vector<Slot> slots; //!< data of each element (indexed by FE_Element tag).
+    std::vector<int> ids; //!< IDs of the elements.
+    std::vector<double *> entries; //!< addresses of the element matrix terms.
+
+    const Slot *getSlot(const FE_Element &) const;
+  public:
+    ScatterMap(void);
+    ScatterMap(const ScatterMap &);
+    ScatterMap &operator=(const ScatterMap &);
+
+    void clear(void);
+    void build(AnalysisModel &, LinearSOE &);
+    bool scatter(const Matrix &, const FE_Element &, const double &) const;
+
+    //! @brief Return true if the map is empty.
+    inline bool empty(void) const
+      { return entries.empty(); }
+    size_t getNumElements(void) const;
+    //! @brief Return the number of stored addresses.
+    inline size_t getNumEntries(void) const
+      { return entries.size(); }
+  };
+
+} // end of XC namespace
+
+#endif
@@ -56,278 +56,185 @@
 // Revision: A
 //
 // Description: This file contains the class definition for 
-// BandSPDLinThreadSolver. It solves the XC::BandSPDLinSOE object by calling
-// Thread routines.
+// BandSPDLinThreadSolver. It solves the XC::BandSPDLinSOE object using
+// a pool of threads.
 //
 // What: "@(#) BandSPDLinThreadSolver.h, revA"
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h>
-#include <glibmm/thread.h>
-#include <mysql/my_pthread.h>
-
-// global data that will be needed by the threads
-struct thread_control_block {
-  mutex_t start_mutex;
-  mutex_t end_mutex;
-  mutex_t startBlock_mutex;
-  mutex_t endBlock_mutex;
-
-  cond_t start_cond;
-  cond_t end_cond;
-  cond_t startBlock_cond;
-  cond_t endBlock_cond;
-
-  double *A,*X,*B;
-  int n, kd;
-  int blockSize, currentBlock;
-  int workToDo;
-  int info;
-  int threadID;
-  int numThreads;
-  int threadsDone;
-  int threadsDoneBlock;
-} TCB_BandSPDLinThreadSolver;
-
-
-XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver()
-:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), NP(1), 
- running(false), blockSize(1)
-{
-  
-}
-
-XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver(int numProcessors, int blckSize)
-:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), NP(numProcessors),
- running(false), blockSize(blckSize)
-{
-
-}
-
-extern "C" int dpbsv_(char *UPLO, int *N, int *KD, int *NRHS, 
-		      double *A, int *LDA, double *B, int *LDB, 
-		      int *INFO);
-
-extern "C" int dpbtrf_(char *UPLO, int *N, int *KD, double *A, 
-		       int *LDA, int *INFO);
+#include "utility/threads/parallel_loop.h"
+#include <cmath>
+#include <algorithm>
 
 extern "C" int dpbtrs_(char *UPLO, int *N, int *KD, int *NRHS, 
 		       double *A, int *LDA, double *B, int *LDB, 
 		       int *INFO);
-		       
-
-void *BandSPDLinThreadSolver_Worker(void *arg);
-
 
+//! @brief Constructor.
+//!
+//! @param nThreads: number of threads (if zero use the number of
+//!                  concurrent threads supported by the hardware).
+//! @param blckSize: number of columns of each block.
+XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver(int nThreads, int blckSize)
+  :BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver),
+   numThreads(nThreads), blockSize(std::max(blckSize,1))
+  {}
+
+//! @brief Set the number of threads (if zero use the number of
+//! concurrent threads supported by the hardware).
+void XC::BandSPDLinThreadSolver::setNumThreads(const int &nt)
+  { numThreads= std::max(nt,0); }
+
+//! @brief Return the number of threads (zero means the number of
+//! concurrent threads supported by the hardware).
+int XC::BandSPDLinThreadSolver::getNumThreads(void) const
+  { return numThreads; }
+
+//! @brief Set the number of columns of each block.
+void XC::BandSPDLinThreadSolver::setBlockSize(const int &bs)
+  { blockSize= std::max(bs,1); }
+
+//! @brief Return the number of columns of each block.
+int XC::BandSPDLinThreadSolver::getBlockSize(void) const
+  { return blockSize; }
+
+//! @brief Computes the Cholesky factorization \f$A= U^t U\f$ of the
+//! matrix stored in LAPACK upper band format. Returns zero if
+//! successful or i+1 if the leading minor of order i+1 is not
+//! positive definite (as the INFO argument of dpbtrf).
+int XC::BandSPDLinThreadSolver::factor(void)
+  {
+    const int n = theSOE->size;
+    const int kd = theSOE->half_band -1;
+    const int ldA = kd +1;
+    double *Aptr = theSOE->A.getDataPtr();
+    // pointer to the term (i,j) (i<=j, j-i<=kd).
+    auto a= [Aptr,kd,ldA](const int &i,const int &j) -> double &
+      { return Aptr[kd+i-j+j*ldA]; };
+    const size_t nt= getThreadCount(numThreads);
+    for(int k0= 0; k0<n; k0+= blockSize)
+      {
+	const int k1= std::min(k0+blockSize,n);
+	// factor the diagonal block.
+	for(int j= k0; j<k1; j++)
+	  {
+	    const int m0= std::max(k0,j-kd);
+	    for(int i= m0; i<j; i++)
+	      {
+		double tmp= a(i,j);
+		for(int m= m0; m<i; m++)
+		  tmp-= a(m,i)*a(m,j);
+		a(i,j)= tmp/a(i,i);
+	      }
+	    double ajj= a(j,j);
+	    for(int m= m0; m<j; m++)
+	      ajj-= a(m,j)*a(m,j);
+	    if(ajj<=0.0)
+	      return j+1;
+	    a(j,j)= sqrt(ajj);
+	  }
+	// columns at the right of the block that reach it.
+	const int lastCol= std::min(n,k1+kd);
+	if(lastCol<=k1)
+	  continue;
+	// compute the rows of U for those columns.
+	parallel_for(lastCol-k1,nt,[&a,k0,k1,kd](size_t first,size_t last,size_t)
+	  {
+	    for(int j= k1+first; j<k1+int(last); j++)
+	      {
+		const int m0= std::max(k0,j-kd);
+		for(int i= m0; i<k1; i++)
+		  {
+		    double tmp= a(i,j);
+		    for(int m= m0; m<i; m++)
+		      tmp-= a(m,i)*a(m,j);
+		    a(i,j)= tmp/a(i,i);
+		  }
+	      }
+	  });
+	// update the trailing submatrix.
+	parallel_for(lastCol-k1,nt,[&a,k0,k1,kd](size_t first,size_t last,size_t)
+	  {
+	    for(int j= k1+first; j<k1+int(last); j++)
+	      {
+		const int m0= std::max(k0,j-kd);
+		for(int l= std::max(k1,j-kd); l<=j; l++)
+		  {
+		    double tmp= 0.0;
+		    for(int m= m0; m<k1; m++)
+		      tmp+= a(m,l)*a(m,j);
+		    a(l,j)-= tmp;
+		  }
+	      }
+	  });
+      }
+    return 0;
+  }
+
+//! Compute solution.
+//! 
+//! The solver first copies the B vector into X. If the system
+//! is marked as not having been factored, it factors the matrix
+//! using the threads and then solves the system calling the LAPACK
+//! routine dpbtrs(). The solve process changes \f$A\f$ and \f$X\f$.   
 int XC::BandSPDLinThreadSolver::solve(void)
   {
-    if(theSOE == 0)
+    if(!theSOE)
       {
-	std::cerr << "XC::BandSPDLinThreadSolver::solve(void)- ";
-	std::cerr << " No XC::LinearSOE object has been set\n";
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
 	return -1;
       }
 
     int n = theSOE->size;
+    if(n==0)
+      return 0;
     int kd = theSOE->half_band -1;
     int ldA = kd +1;
     int nrhs = 1;
     int ldB = n;
-    int info;
-    double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
+    int info= 0;
+    double *Aptr = theSOE->A.getDataPtr();
+    double *Xptr = theSOE->getPtrX();
+    const double *Bptr = theSOE->getPtrB();
 
     // first copy B into X
-    for (int i=0; i<n; i++)
-	*(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
-
-    // now solve AX = Y
-    if (theSOE->factored == false) {
+    for(int i=0; i<n; i++)
+      Xptr[i]= Bptr[i];
 
-      // start threads running
-      if (running == false) {
-	mutex_init(&TCB_BandSPDLinThreadSolver.start_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.end_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.startBlock_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.endBlock_mutex, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.start_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.end_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.startBlock_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.endBlock_cond, USYNC_THREAD, 0);
-	TCB_BandSPDLinThreadSolver.workToDo = 0;
-        
-	// Create the threads - Bound daemon threads
-	for (int j = 0; j < NP; j++) 
-	  thr_create(nullptr,0, BandSPDLinThreadSolver_Worker, nullptr, 
-		     THR_BOUND|THR_DAEMON, nullptr);
-
-        running = true;
+    if(theSOE->factored == false)
+      {
+        info= factor();
+	if(info != 0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING - the leading minor of order "
+		      << info << " is not positive definite.\n";
+	    return -info;
+	  }
+	theSOE->factored = true;
+      }
+    char strU[]= "U";
+    dpbtrs_(strU,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+    if(info != 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - the LAPACK"
+		  << " routine returned " << info << std::endl;
+	return -info;
       }
-      
-  
-      mutex_lock(&TCB_BandSPDLinThreadSolver.start_mutex); 
-        // assign the global variables the threads will need
-        TCB_BandSPDLinThreadSolver.A = Aptr;
-	TCB_BandSPDLinThreadSolver.X = Xptr;
-	TCB_BandSPDLinThreadSolver.B = Bptr;
-	TCB_BandSPDLinThreadSolver.n = n;
-	TCB_BandSPDLinThreadSolver.kd = kd;
-	TCB_BandSPDLinThreadSolver.info = 0;
-        TCB_BandSPDLinThreadSolver.workToDo = NP;
-        TCB_BandSPDLinThreadSolver.blockSize = blockSize;
-        TCB_BandSPDLinThreadSolver.currentBlock = -1;
-	TCB_BandSPDLinThreadSolver.threadID = 0;
-	TCB_BandSPDLinThreadSolver.numThreads = NP;
-        TCB_BandSPDLinThreadSolver.threadsDone = 0;
-        TCB_BandSPDLinThreadSolver.threadsDoneBlock = NP;
-
-        // wake up the threads
-        cond_broadcast(&TCB_BandSPDLinThreadSolver.start_cond);
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.start_mutex); 
-
-      // yield the LWP
-      thr_yield();
- 
-      // wait for all the threads to finish
-      mutex_lock(&TCB_BandSPDLinThreadSolver.end_mutex);
-
-         while (TCB_BandSPDLinThreadSolver.threadsDone < NP) 
-           cond_wait(&TCB_BandSPDLinThreadSolver.end_cond, &TCB_BandSPDLinThreadSolver.end_mutex);
-
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.end_mutex);
-    }
-
-    // solve using factored matrix
-    dpbtrs_("U",&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
-    
-
-    // check if successfull
-    if (info != 0)
-	return info;
-
-    theSOE->factored = true;
-    return 0;
-}
-    
-
-
-int XC::BandSPDLinThreadSolver::setSize()
-{
-    // nothing to do    
     return 0;
-}
+  }
 
+//! @brief Does nothing but return \f$0\f$.
+int XC::BandSPDLinThreadSolver::setSize(void)
+  { return 0; }
 
+//! @brief Does nothing but return \f$0\f$.
 int XC::BandSPDLinThreadSolver::sendSelf(CommParameters &cp)
-{
-    // nothing to do
-    return 0;
-}
+  { return 0; }
 
+//! @brief Does nothing but return \f$0\f$.
 int XC::BandSPDLinThreadSolver::recvSelf(const CommParameters &cp)
-{
-    // nothing to do
-    return 0;
-}
-
-// Thread routine called from thr_create() as a Bound Daemon Thread
-void *BandSPDLinThreadSolver_Worker(void *arg)
-{
-  // Do this loop forever - or until all the Non-Daemon threads have exited
-  while(true)
-    {
-
-      // Wait for some work to do
-      mutex_lock(&TCB_BandSPDLinThreadSolver.start_mutex);
-
-        while (TCB_BandSPDLinThreadSolver.workToDo == 0)
-          cond_wait(&TCB_BandSPDLinThreadSolver.start_cond, &TCB_BandSPDLinThreadSolver.start_mutex);
-
-        TCB_BandSPDLinThreadSolver.workToDo--;
-
-        // get an id;
-	int myID = TCB_BandSPDLinThreadSolver.threadID++;
-
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.start_mutex);
-
-      // do some initialisation for the factorization
-      int currentBlock =0;
-      int n = TCB_BandSPDLinThreadSolver.n;
-      int kd = TCB_BandSPDLinThreadSolver.kd;
-      int blckSize = TCB_BandSPDLinThreadSolver.blockSize;
-      double *Aptr = TCB_BandSPDLinThreadSolver.A;
-      double *Bptr = TCB_BandSPDLinThreadSolver.B;
-      double *Xptr = TCB_BandSPDLinThreadSolver.X;
-      int numThreads = TCB_BandSPDLinThreadSolver.numThreads;
-    
-      int nBlocks = n/blckSize;
-
-      for (int i=0; i<nBlocks; i++) {
-        int currentDiagThread = i%numThreads;
-        if (myID == currentDiagThread) {
-
-	  // wait till last block row is done
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-            while(TCB_BandSPDLinThreadSolver.threadsDoneBlock < numThreads)
-	      cond_wait(&TCB_BandSPDLinThreadSolver.endBlock_cond, &TCB_BandSPDLinThreadSolver.endBlock_mutex);
-
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock = 0;
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);        
-
-          // FACTOR DIAG BLOCK
-       
-          // allow other threads to now proceed
-          mutex_lock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.currentBlock = i;
-
-            cond_broadcast(&TCB_BandSPDLinThreadSolver.startBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);        
-
-          
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-
-          // mark that the thread has finished with row
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock++;
-
-            cond_signal(&TCB_BandSPDLinThreadSolver.endBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);                   
-	}
-        else {
-
-          // wait till diag i is done 
-          mutex_lock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-             while (TCB_BandSPDLinThreadSolver.currentBlock < i)
-                cond_wait(&TCB_BandSPDLinThreadSolver.startBlock_cond, 
-			  &TCB_BandSPDLinThreadSolver.startBlock_mutex); 
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-
-          // mark that the thread has finished with row
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock++;
-
-            cond_signal(&TCB_BandSPDLinThreadSolver.endBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);                             
-	}
-      }
-
-      // signal the XC::main thread that this thread is done with the work
-      mutex_lock(&TCB_BandSPDLinThreadSolver.end_mutex);
-         TCB_BandSPDLinThreadSolver.threadsDone++;
-
-         cond_signal(&TCB_BandSPDLinThreadSolver.end_cond);
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.end_mutex);
-    } 
-  return nullptr;
-}
-
-
-
-
-
-
-
+  { return 0; }
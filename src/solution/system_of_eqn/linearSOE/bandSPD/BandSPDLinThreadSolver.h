@@ -57,7 +57,7 @@
 //
 // Description: This file contains the class definition for 
 // BandSPDLinThreadSolver. It solves the BandSPDLinSOE in parallel
-// using solaris threads.
+// using a pool of threads.
 //
 // What: "@(#) BandSPDLinThreadSolver.h, revA"
 
@@ -67,24 +67,39 @@
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSolver.h>
 
 namespace XC {
+
 //! @ingroup LinearSolver
 //
 //! @brief Solves the BandSPDLinSOE in parallel
-//! using solaris threads.
+//! using threads.
+//!
+//! The matrix is factored (\f$A= U^t U\f$) by blocks of blockSize
+//! columns using a right-looking approach: the calling thread factors
+//! the diagonal block and then the threads of the shared ThreadPool
+//! compute the rows of U at the right of the block and update the
+//! trailing submatrix. The substitution is performed by the LAPACK routine
+//! dpbtrs() so the factor is stored as in BandSPDLinLapackSolver.
 class BandSPDLinThreadSolver : public BandSPDLinSolver
   {
   private:
-    int NP;
-    int running;
-    int blockSize;
+    int numThreads; //!< number of threads (0: hardware concurrency).
+    int blockSize; //!< number of columns of each block.
 
-    BandSPDLinThreadSolver(void);    
-    BandSPDLinThreadSolver(int numProcessors, int blockSize);        
+    int factor(void);
+  protected:
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    BandSPDLinThreadSolver(int numThreads= 0, int blockSize= 32);
     virtual LinearSOESolver *getCopy(void) const;
   public:
 
     int solve(void);
     int setSize(void);
+
+    void setNumThreads(const int &);
+    int getNumThreads(void) const;
+    void setBlockSize(const int &);
+    int getBlockSize(void) const;
     
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);  
@@ -97,4 +112,3 @@ inline LinearSOESolver *BandSPDLinThreadSolver::getCopy(void) const
 
 #endif
 
-
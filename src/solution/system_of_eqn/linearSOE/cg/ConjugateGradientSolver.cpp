@@ -59,27 +59,51 @@
 #include <utility/matrix/Vector.h>
 
 #include <solution/system_of_eqn/linearSOE/LinearSOE.h>
-
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! @param classTag: identifier of the class.
+//! @param theSOE: system of equations to solve.
+//! @param tol: tolerance for the norm of the residual relative to
+//!             the norm of the right hand side.
+//! @param maxIter: maximum number of iterations (if zero, the number of
+//!                 equations).
 XC::ConjugateGradientSolver::ConjugateGradientSolver(int classtag, 
 						 LinearSOE *theSOE,
-						 double tol)
+						 double tol, int maxIter)
 :LinearSOESolver(classtag),
  theLinearSOE(theSOE), 
- tolerance(tol)
+ tolerance(tol), maxNumIter(maxIter), numIter(0), residualNorm(0.0)
   {}
 
+//! @brief Sets the system of equations to solve.
+bool XC::ConjugateGradientSolver::setLinearSOE(LinearSOE *theSOE)
+  {
+    theLinearSOE= theSOE;
+    return (theLinearSOE!=nullptr);
+  }
+
 int XC::ConjugateGradientSolver::setSize(void)
   {
+    if(!theLinearSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set." << std::endl;
+	return -1;
+      }
     int n = theLinearSOE->getNumEqn();
     if(n <= 0)
       {
-	std::cerr << "ConjugateGradientSolver::setSize() - n < 0 \n";
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; n < 0." << std::endl;
 	return -1;
       }
 
     if(r.Size() != n)
       {
         r.resize(n);
+        z.resize(n);
         p.resize(n);
         Ap.resize(n);
         x.resize(n);	
@@ -87,48 +111,98 @@ int XC::ConjugateGradientSolver::setSize(void)
     return 0;
   }
 
+//! @brief Computes the data needed by the preconditioner, called at
+//! the beginning of each call to solve (does nothing by default).
+int XC::ConjugateGradientSolver::formPreconditioner(void)
+  { return 0; }
 
+//! @brief Solves \f$M z= r\f$ where \f$M\f$ is the preconditioner
+//! (the identity by default).
+int XC::ConjugateGradientSolver::applyPreconditioner(const Vector &res, Vector &zz)
+  {
+    zz= res;
+    return 0;
+  }
 
+//! @brief Solves the system using the preconditioned conjugate
+//! gradient method.
+//!
+//! The iteration stops when the norm of the residual is smaller than
+//! tolerance times the norm of the right hand side. Returns -1 if the
+//! residual doesn't converge in maxNumIter iterations.
 int XC::ConjugateGradientSolver::solve(void)
   {
+    if(!theLinearSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set." << std::endl;
+	return -1;
+      }
+    if(r.Size()!=theLinearSOE->getNumEqn())
+      if(setSize()<0)
+        return -1;
+    if(formPreconditioner()<0)
+      return -1;
+
     // initialize
+    numIter= 0;
+    residualNorm= 0.0;
     x.Zero();    
     r= theLinearSOE->getB();
-    p= r;
-    double rdotr= r^r;
+    const double normB= r.Norm();
+    if(normB==0.0)
+      {
+        theLinearSOE->setX(x);
+        return 0;
+      }
+    applyPreconditioner(r, z);
+    p= z;
+    double rdotz= r^z;
     
-    // lopp till convergence
-    while(r.Norm() > tolerance)
+    const int maxIter= (maxNumIter>0 ? maxNumIter : r.Size());
+    residualNorm= 1.0;
+    // loop till convergence
+    while(residualNorm > tolerance)
       {
-	this->formAp(p, Ap);
-
-	double alpha = rdotr/(p ^ Ap);
+        if(numIter>=maxIter)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING - no convergence after "
+		      << numIter << " iterations, relative residual: "
+		      << residualNorm << std::endl;
+            theLinearSOE->setX(x);
+	    return -1;
+          }
+	if(this->formAp(p, Ap)<0)
+          return -1;
+
+        const double pAp= p ^ Ap;
+        if(pAp<=0.0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; the system matrix is not positive definite."
+		      << std::endl;
+	    return -2;
+          }
+	const double alpha = rdotz/pAp;
 
 	// x+= p * alpha;
 	x.addVector(1.0, p, alpha);
 
 	// *r -= *Ap * alpha;
 	r.addVector(1.0, Ap, -alpha);
+        numIter++;
+        residualNorm= r.Norm()/normB;
 
-	double oldrdotr = rdotr;
+	applyPreconditioner(r, z);
+	const double oldrdotz = rdotz;
+	rdotz = r ^ z;
 
-	rdotr = r ^ r;
+	const double beta = rdotz / oldrdotz;
 
-	double beta = rdotr / oldrdotr;
-
-	// p = r + p * beta;
-	p.addVector(beta, r, 1.0);
-    }
+	// p = z + p * beta;
+	p.addVector(beta, z, 1.0);
+      }
+    theLinearSOE->setX(x);
     return 0;
   }
-
-
-
-
-
-
-
-
-
-
-
@@ -72,21 +72,58 @@ class Vector;
 
 //! @ingroup LinearSolver
 //
-//! @brief Base class for conjugate gradient linear SOE solvers.
+//! @brief Base class for (preconditioned) conjugate gradient linear
+//! SOE solvers.
+//!
+//! Implements the preconditioned conjugate gradient method for
+//! symmetric positive definite systems. The product of the system
+//! matrix by a vector (formAp) must be defined by the subclasses, so
+//! the matrix doesn't need to be assembled. The subclasses can also
+//! redefine formPreconditioner and applyPreconditioner (the default
+//! preconditioner is the identity).
 class ConjugateGradientSolver : public LinearSOESolver
   {
   private:
-    Vector r, p, Ap, x;
+    Vector r, z, p, Ap, x;
+  protected:
     LinearSOE *theLinearSOE;
-    double tolerance;
+    double tolerance; //!< tolerance for the norm of the residual relative to the norm of b.
+    int maxNumIter; //!< maximum number of iterations (if zero, the number of equations).
+    int numIter; //!< number of iterations of the last call to solve.
+    double residualNorm; //!< relative norm of the residual at the end of the last call to solve.
 
-    ConjugateGradientSolver(int classTag, LinearSOE *theLinearSOE, double tol);
+    ConjugateGradientSolver(int classTag, LinearSOE *theLinearSOE= nullptr, double tol= 1e-8, int maxNumIter= 0);
+    virtual bool setLinearSOE(LinearSOE *);
+    virtual int formPreconditioner(void);
+    virtual int applyPreconditioner(const Vector &r, Vector &z);
   public:
-    
-
     virtual int setSize(void);    
     virtual int solve(void);
-    virtual int formAp(const Vector &p, Vector &Ap) = 0;    
+    //! @brief Computes the product of the system matrix by p.
+    virtual int formAp(const Vector &p, Vector &Ap) = 0;
+
+    //! @brief Return the tolerance for the norm of the residual
+    //! relative to the norm of the right hand side.
+    inline double getTolerance(void) const
+      { return tolerance; }
+    //! @brief Set the tolerance for the norm of the residual
+    //! relative to the norm of the right hand side.
+    inline void setTolerance(const double &d)
+      { tolerance= d; }
+    //! @brief Return the maximum number of iterations.
+    inline int getMaxNumIter(void) const
+      { return maxNumIter; }
+    //! @brief Set the maximum number of iterations (if zero, the
+    //! number of equations).
+    inline void setMaxNumIter(const int &i)
+      { maxNumIter= i; }
+    //! @brief Return the number of iterations of the last call to solve.
+    inline int getNumIter(void) const
+      { return numIter; }
+    //! @brief Return the relative norm of the residual at the end
+    //! of the last call to solve.
+    inline double getResidualNorm(void) const
+      { return residualNorm; }
   };
 } // end of XC namespace
 
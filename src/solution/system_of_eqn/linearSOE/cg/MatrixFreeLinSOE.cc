@@ -0,0 +1,292 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MatrixFreeLinSOE.cc
+
+#include "MatrixFreeLinSOE.h"
+#include "MatrixFreePCGSolver.h"
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/Vector.h>
+#include <utility/matrix/ID.h>
+#include "solution/graph/graph/Graph.h"
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/fe_ele/FE_Element.h>
+#include <solution/analysis/model/dof_grp/DOF_Group.h>
+#include <solution/analysis/model/FE_EleIter.h>
+#include <solution/analysis/model/DOF_GrpIter.h>
+#include "solution/analysis/integrator/TransientIntegrator.h"
+#include "utility/threads/parallel_loop.h"
+
+namespace {
+  //! @brief Adds the product of the matrix K by the components of p
+  //! that correspond to the equations in id to y.
+  void add_product(const XC::ID &id, const XC::Matrix &K, const XC::Vector &p, XC::Vector &y)
+    {
+      const int n= id.Size();
+      if((K.noRows()<n) || (K.noCols()<n))
+        return;
+      const int size= p.Size();
+      for(int j= 0;j<n;j++)
+        {
+          const int cj= id(j);
+          if((cj<0) || (cj>=size))
+            continue;
+          const double pj= p(cj);
+          if(pj==0.0)
+            continue;
+          for(int i= 0;i<n;i++)
+            {
+              const int ri= id(i);
+              if((ri>=0) && (ri<size))
+                y(ri)+= K(i,j)*pj;
+            }
+        }
+    }
+
+  //! @brief Adds the product of the tangent of the element by the
+  //! components of p that correspond to its equations to y.
+  void add_element_product(XC::FE_Element &fe, XC::Integrator *integ, const XC::Vector &p, XC::Vector &y)
+    { add_product(fe.getID(),fe.getTangent(integ),p,y); }
+}
+
+//! @brief Constructor.
+XC::MatrixFreeLinSOE::MatrixFreeLinSOE(AnalysisAggregation *owr)
+  :LinearSOEData(owr,LinSOE_TAGS_MatrixFreeLinSOE) {}
+
+//! @brief Sets the solver (must be a MatrixFreePCGSolver).
+bool XC::MatrixFreeLinSOE::setSolver(LinearSOESolver *newSolver)
+  {
+    bool retval= false;
+    MatrixFreePCGSolver *tmp= dynamic_cast<MatrixFreePCGSolver *>(newSolver);
+    if(tmp)
+      retval= LinearSOE::setSolver(tmp);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; solver incompatible with system of equations."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Computes the nodal blocks from the equation numbers
+//! of the DOF groups of the analysis model.
+void XC::MatrixFreeLinSOE::setup_blocks(void)
+  {
+    blockStart.clear();
+    blockEqs.clear();
+    blockValStart.clear();
+    eqBlock.assign(size,-1);
+    eqPos.assign(size,-1);
+    blockStart.push_back(0);
+    blockValStart.push_back(0);
+    AnalysisModel *mdl= getAnalysisModelPtr();
+    if(mdl)
+      {
+        DOF_GrpIter &theDOFs= mdl->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while((dofPtr= theDOFs()) != 0)
+          {
+            const ID &id= dofPtr->getID();
+            const int iBlock= blockStart.size()-1;
+            int pos= 0;
+            for(int i= 0;i<id.Size();i++)
+              {
+                const int eq= id(i);
+                if((eq>=0) && (eq<size) && (eqBlock[eq]<0))
+                  {
+                    eqBlock[eq]= iBlock;
+                    eqPos[eq]= pos++;
+                    blockEqs.push_back(eq);
+                  }
+              }
+            if(pos>0)
+              {
+                blockStart.push_back(blockEqs.size());
+                blockValStart.push_back(blockValStart.back()+pos*pos);
+              }
+          }
+      }
+    // equations that don't belong to any DOF group.
+    for(int eq= 0;eq<size;eq++)
+      if(eqBlock[eq]<0)
+        {
+          eqBlock[eq]= blockStart.size()-1;
+          eqPos[eq]= 0;
+          blockEqs.push_back(eq);
+          blockStart.push_back(blockEqs.size());
+          blockValStart.push_back(blockValStart.back()+1);
+        }
+    blockValues.assign(blockValStart.back(),0.0);
+  }
+
+//! @brief Sets the size of the system from the number of vertices
+//! of the graph and computes the nodal blocks.
+int XC::MatrixFreeLinSOE::setSize(Graph &theGraph)
+  {
+    int result= 0;
+    size= checkSize(theGraph);
+    inic(size);
+    diagonal.resize(size);
+    diagonal.Zero();
+    setup_blocks();
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *the_Solver= this->getSolver();
+    if(the_Solver)
+      {
+        const int solverOK= the_Solver->setSize();
+        if(solverOK < 0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING solver failed setSize()\n";
+            result= solverOK;
+          }
+      }
+    return result;
+  }
+
+//! @brief Adds the diagonal and the nodal block terms of
+//! \p fact times \p m (the rest of the terms are not stored).
+int XC::MatrixFreeLinSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    // check for a quick return 
+    if(fact == 0.0)  return 0;
+
+    const int idSize= id.Size();
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; matrix and ID not of similar sizes\n";
+        return -1;
+      }
+    for(int j= 0;j<idSize;j++)
+      {
+        const int cj= id(j);
+        if((cj<0) || (cj>=size))
+          continue;
+        diagonal(cj)+= fact*m(j,j);
+        const int b= eqBlock[cj];
+        const int nb= blockStart[b+1]-blockStart[b];
+        double *values= &blockValues[blockValStart[b]];
+        const int pj= eqPos[cj];
+        for(int i= 0;i<idSize;i++)
+          {
+            const int ri= id(i);
+            if((ri>=0) && (ri<size) && (eqBlock[ri]==b))
+              values[pj*nb+eqPos[ri]]+= fact*m(i,j);
+          }
+      }
+    return 0;
+  }
+
+//! @brief Zeros the diagonal and the nodal blocks.
+void XC::MatrixFreeLinSOE::zeroA(void)
+  {
+    diagonal.Zero();
+    std::fill(blockValues.begin(),blockValues.end(),0.0);
+  }
+
+//! @brief Computes \f$Ap= A p\f$ adding the products of the
+//! tangent matrices of the FE_Element objects by the components
+//! of \p p that correspond to their equations. If the integrator
+//! is a transient one, the products of the tangents of the DOF_Group
+//! objects (nodal mass and damping, see TransientIntegrator::formTangent)
+//! are added too.
+//!
+//! If more than one thread is requested, the
+//! products of the thread safe elements (see FE_Element::isThreadSafe)
+//! are computed concurrently, each thread adding them to its own
+//! vector; these vectors are added in thread order, so the result
+//! is deterministic for a given number of threads. The rest of the
+//! elements are computed by the calling thread.
+int XC::MatrixFreeLinSOE::formAp(const Vector &p, Vector &Ap, const size_t &numThreads)
+  {
+    AnalysisModel *mdl= getAnalysisModelPtr();
+    Integrator *integ= getIntegratorPtr();
+    if(!mdl || !integ)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no AnalysisModel or Integrator have been set\n";
+        return -1;
+      }
+    if(p.Size()!=size)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; vector size: " << p.Size()
+		  << " doesn't match the system size: " << size << std::endl;
+        return -1;
+      }
+    Ap.resize(size);
+    Ap.Zero();
+
+    // nodal contributions (only the transient integrators form them).
+    if(dynamic_cast<TransientIntegrator *>(integ))
+      {
+        DOF_GrpIter &theDOFs= mdl->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while((dofPtr= theDOFs()) != 0)
+          add_product(dofPtr->getID(),dofPtr->getTangent(integ),p,Ap);
+      }
+
+    std::vector<FE_Element *> concurrent;
+    FE_EleIter &theEles= mdl->getFEs();
+    FE_Element *elePtr= nullptr;
+    while((elePtr= theEles()) != 0)
+      {
+        if((numThreads>1) && elePtr->isThreadSafe())
+          concurrent.push_back(elePtr);
+        else
+          add_element_product(*elePtr,integ,p,Ap);
+      }
+    if(!concurrent.empty())
+      {
+        FE_Element::setNumThreads(numThreads);
+        if(threadAp.size()!=numThreads)
+          threadAp.resize(numThreads);
+        for(std::vector<Vector>::iterator i= threadAp.begin();i!=threadAp.end();i++)
+          {
+            if(i->Size()!=size)
+              i->resize(size);
+            i->Zero();
+          }
+        parallel_for(concurrent.size(),numThreads,[&](size_t first,size_t last,size_t t)
+          {
+            Vector &y= threadAp[t];
+            for(size_t i= first;i<last;i++)
+              add_element_product(*concurrent[i],integ,p,y);
+          });
+        for(std::vector<Vector>::const_iterator i= threadAp.begin();i!=threadAp.end();i++)
+          Ap+= *i;
+      }
+    return 0;
+  }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::MatrixFreeLinSOE::sendSelf(CommParameters &cp)
+  { return 0; }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::MatrixFreeLinSOE::recvSelf(const CommParameters &cp)
+  { return 0; }
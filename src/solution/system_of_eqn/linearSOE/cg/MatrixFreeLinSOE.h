@@ -0,0 +1,106 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MatrixFreeLinSOE.h
+
+#ifndef MatrixFreeLinSOE_h
+#define MatrixFreeLinSOE_h
+
+#include <solution/system_of_eqn/linearSOE/LinearSOEData.h>
+#include <vector>
+
+namespace XC {
+class MatrixFreePCGSolver;
+
+//! @ingroup SOE
+//
+//! @brief System of equations whose matrix is not assembled.
+//!
+//! The product of the system matrix by a vector is computed element
+//! by element (see formAp) from the tangent matrices of the FE_Element
+//! objects of the analysis model (and, in transient analysis, of its
+//! DOF_Group objects), so the memory needed doesn't grow
+//! with the bandwidth or the fill-in of the matrix. Only the data
+//! needed by the preconditioners is assembled when the integrator
+//! forms the tangent: the diagonal of the matrix and its nodal blocks
+//! (the terms that couple the equations of the same DOF_Group).
+//!
+//! The matrix must be symmetric and positive definite, so it can be
+//! used with the plain, penalty and transformation constraint
+//! handlers but not with the Lagrange one.
+class MatrixFreeLinSOE: public LinearSOEData
+  {
+  private:
+    Vector diagonal; //!< diagonal of the matrix.
+    std::vector<int> blockStart; //!< first position of each nodal block in blockEqs.
+    std::vector<int> blockEqs; //!< equations of the nodal blocks.
+    std::vector<size_t> blockValStart; //!< first value of each nodal block in blockValues.
+    std::vector<double> blockValues; //!< terms of the nodal blocks (column major).
+    std::vector<int> eqBlock; //!< nodal block of each equation (-1 if none).
+    std::vector<int> eqPos; //!< position of each equation in its nodal block.
+    std::vector<Vector> threadAp; //!< products computed by each thread.
+
+    void setup_blocks(void);
+  protected:
+    virtual bool setSolver(LinearSOESolver *);
+
+    friend class AnalysisAggregation;
+    MatrixFreeLinSOE(AnalysisAggregation *);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    void zeroA(void);
+
+    int formAp(const Vector &, Vector &, const size_t &numThreads= 1);
+
+    //! @brief Return the diagonal of the matrix.
+    inline const Vector &getDiagonal(void) const
+      { return diagonal; }
+    //! @brief Return the number of nodal blocks.
+    inline size_t getNumBlocks(void) const
+      { return (blockStart.empty() ? 0 : blockStart.size()-1); }
+    //! @brief Return the number of equations of the i-th nodal block.
+    inline int getBlockSize(const size_t &i) const
+      { return blockStart[i+1]-blockStart[i]; }
+    //! @brief Return the equations of the i-th nodal block.
+    inline const int *getBlockEquations(const size_t &i) const
+      { return &blockEqs[blockStart[i]]; }
+    //! @brief Return the terms of the i-th nodal block (column major).
+    inline const double *getBlockValues(const size_t &i) const
+      { return &blockValues[blockValStart[i]]; }
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline SystemOfEqn *MatrixFreeLinSOE::getCopy(void) const
+  { return new MatrixFreeLinSOE(*this); }
+} // end of XC namespace
+
+
+#endif
+
@@ -0,0 +1,235 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MatrixFreePCGSolver.cc
+
+#include "MatrixFreePCGSolver.h"
+#include "MatrixFreeLinSOE.h"
+#include <utility/matrix/Vector.h>
+#include "utility/threads/parallel_loop.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+  //! @brief Cholesky factorization of the n x n matrix a (column major,
+  //! only the lower triangle is used). Returns false if the matrix
+  //! is not positive definite.
+  bool cholesky_factor(double *a,const int &n)
+    {
+      for(int j= 0;j<n;j++)
+        {
+          double d= a[j*n+j];
+          for(int k= 0;k<j;k++)
+            d-= a[k*n+j]*a[k*n+j];
+          if(d<=0.0)
+            return false;
+          d= sqrt(d);
+          a[j*n+j]= d;
+          for(int i= j+1;i<n;i++)
+            {
+              double s= a[j*n+i];
+              for(int k= 0;k<j;k++)
+                s-= a[k*n+i]*a[k*n+j];
+              a[j*n+i]= s/d;
+            }
+        }
+      return true;
+    }
+
+  //! @brief Solves L L^t x= b, x overwrites b.
+  void cholesky_solve(const double *l,const int &n,double *b)
+    {
+      for(int i= 0;i<n;i++)
+        {
+          double s= b[i];
+          for(int k= 0;k<i;k++)
+            s-= l[k*n+i]*b[k];
+          b[i]= s/l[i*n+i];
+        }
+      for(int i= n-1;i>=0;i--)
+        {
+          double s= b[i];
+          for(int k= i+1;k<n;k++)
+            s-= l[i*n+k]*b[k];
+          b[i]= s/l[i*n+i];
+        }
+    }
+}
+
+//! @brief Constructor.
+//!
+//! @param precond: preconditioner type (none, jacobi or block_jacobi).
+//! @param tol: tolerance for the norm of the residual relative to
+//!             the norm of the right hand side.
+//! @param maxNumIter: maximum number of iterations (if zero, the number
+//!                    of equations).
+XC::MatrixFreePCGSolver::MatrixFreePCGSolver(const std::string &precond,double tol,int maxNumIter)
+  :ConjugateGradientSolver(SOLVER_TAGS_MatrixFreePCGSolver,nullptr,tol,maxNumIter),
+   theSOE(nullptr), preconditioner("jacobi"), numThreads(1)
+  { setPreconditioner(precond); }
+
+//! @brief Sets the system of equations to solve.
+bool XC::MatrixFreePCGSolver::setLinearSOE(LinearSOE *soe)
+  {
+    bool retval= false;
+    MatrixFreeLinSOE *tmp= dynamic_cast<MatrixFreeLinSOE *>(soe);
+    if(tmp)
+      retval= setLinearSOE(*tmp);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; system of equations incompatible with solver."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Sets the system of equations to solve.
+bool XC::MatrixFreePCGSolver::setLinearSOE(MatrixFreeLinSOE &soe)
+  {
+    theSOE= &soe;
+    return ConjugateGradientSolver::setLinearSOE(&soe);
+  }
+
+//! @brief Set the preconditioner type (none, jacobi or block_jacobi).
+void XC::MatrixFreePCGSolver::setPreconditioner(const std::string &str)
+  {
+    if((str=="none") || (str=="jacobi") || (str=="block_jacobi"))
+      preconditioner= str;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; unknown preconditioner: '" << str
+		<< "', use 'none', 'jacobi' or 'block_jacobi'."
+		<< std::endl;
+  }
+
+//! @brief Return the preconditioner type.
+const std::string &XC::MatrixFreePCGSolver::getPreconditioner(void) const
+  { return preconditioner; }
+
+//! @brief Set the number of threads used to compute the products
+//! of the element matrices (if zero, the number of concurrent
+//! threads supported by the hardware).
+void XC::MatrixFreePCGSolver::setNumThreads(const int &n)
+  { numThreads= std::max(n,0); }
+
+//! @brief Return the number of threads.
+int XC::MatrixFreePCGSolver::getNumThreads(void) const
+  { return numThreads; }
+
+//! @brief Computes the product of the system matrix by p
+//! (see MatrixFreeLinSOE::formAp).
+int XC::MatrixFreePCGSolver::formAp(const Vector &p, Vector &Ap)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set." << std::endl;
+	return -1;
+      }
+    return theSOE->formAp(p,Ap,getThreadCount(numThreads));
+  }
+
+//! @brief Computes the inverse of the diagonal (jacobi) or the
+//! Cholesky factors of the nodal blocks (block_jacobi). The nodal
+//! blocks that are not positive definite are replaced by their
+//! diagonal.
+int XC::MatrixFreePCGSolver::formPreconditioner(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set." << std::endl;
+	return -1;
+      }
+    if(preconditioner=="jacobi")
+      {
+        const Vector &diag= theSOE->getDiagonal();
+        const int n= diag.Size();
+        invDiagonal.resize(n);
+        for(int i= 0;i<n;i++)
+          invDiagonal(i)= (diag(i)!=0.0 ? 1.0/diag(i) : 1.0);
+      }
+    else if(preconditioner=="block_jacobi")
+      {
+        const size_t numBlocks= theSOE->getNumBlocks();
+        blockFactors.clear();
+        for(size_t b= 0;b<numBlocks;b++)
+          {
+            const int nb= theSOE->getBlockSize(b);
+            const double *values= theSOE->getBlockValues(b);
+            const size_t first= blockFactors.size();
+            blockFactors.insert(blockFactors.end(),values,values+nb*nb);
+            double *l= &blockFactors[first];
+            if(!cholesky_factor(l,nb))
+              for(int j= 0;j<nb;j++)
+                for(int i= 0;i<nb;i++)
+                  {
+                    const double d= std::abs(values[j*nb+j]);
+                    l[j*nb+i]= (i==j ? (d>0.0 ? sqrt(d) : 1.0) : 0.0);
+                  }
+          }
+      }
+    return 0;
+  }
+
+//! @brief Solves \f$M z= r\f$ where \f$M\f$ is the preconditioner.
+int XC::MatrixFreePCGSolver::applyPreconditioner(const Vector &r, Vector &z)
+  {
+    if(preconditioner=="jacobi")
+      {
+        const int n= r.Size();
+        for(int i= 0;i<n;i++)
+          z(i)= invDiagonal(i)*r(i);
+      }
+    else if(preconditioner=="block_jacobi")
+      {
+        const size_t numBlocks= theSOE->getNumBlocks();
+        std::vector<double> tmp;
+        size_t first= 0;
+        for(size_t b= 0;b<numBlocks;b++)
+          {
+            const int nb= theSOE->getBlockSize(b);
+            const int *eqs= theSOE->getBlockEquations(b);
+            tmp.resize(nb);
+            for(int i= 0;i<nb;i++)
+              tmp[i]= r(eqs[i]);
+            cholesky_solve(&blockFactors[first],nb,tmp.data());
+            for(int i= 0;i<nb;i++)
+              z(eqs[i])= tmp[i];
+            first+= nb*nb;
+          }
+      }
+    else
+      z= r;
+    return 0;
+  }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::MatrixFreePCGSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::MatrixFreePCGSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MatrixFreePCGSolver.h
+
+#ifndef MatrixFreePCGSolver_h
+#define MatrixFreePCGSolver_h
+
+#include <solution/system_of_eqn/linearSOE/cg/ConjugateGradientSolver.h>
+#include <vector>
+#include <string>
+
+namespace XC {
+class MatrixFreeLinSOE;
+
+//! @ingroup LinearSolver
+//
+//! @brief Preconditioned conjugate gradient solver for the
+//! systems of equations whose matrix is not assembled
+//! (see MatrixFreeLinSOE).
+//!
+//! The product of the matrix by the search direction is computed
+//! element by element using numThreads threads. Available
+//! preconditioners:
+//! - none: identity.
+//! - jacobi: inverse of the diagonal of the matrix.
+//! - block_jacobi: inverse of the nodal blocks of the matrix (the
+//!   terms that couple the DOFs of each node, assembled from the
+//!   element matrices), computed by Cholesky factorization.
+class MatrixFreePCGSolver: public ConjugateGradientSolver
+  {
+  private:
+    MatrixFreeLinSOE *theSOE;
+    std::string preconditioner; //!< preconditioner type (none, jacobi or block_jacobi).
+    int numThreads; //!< number of threads (0: hardware concurrency).
+    Vector invDiagonal; //!< inverse of the diagonal (Jacobi preconditioner).
+    std::vector<double> blockFactors; //!< Cholesky factors of the nodal blocks.
+
+  protected:
+    virtual bool setLinearSOE(LinearSOE *);
+    virtual int formPreconditioner(void);
+    virtual int applyPreconditioner(const Vector &, Vector &);
+
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    MatrixFreePCGSolver(const std::string &precond= "jacobi",double tol= 1e-8,int maxNumIter= 0);
+    virtual LinearSOESolver *getCopy(void) const;
+  public:
+    bool setLinearSOE(MatrixFreeLinSOE &);
+    int formAp(const Vector &, Vector &);
+
+    void setPreconditioner(const std::string &);
+    const std::string &getPreconditioner(void) const;
+    void setNumThreads(const int &);
+    int getNumThreads(void) const;
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline LinearSOESolver *MatrixFreePCGSolver::getCopy(void) const
+   { return new MatrixFreePCGSolver(*this); }
+} // end of XC namespace
+
+#endif
+
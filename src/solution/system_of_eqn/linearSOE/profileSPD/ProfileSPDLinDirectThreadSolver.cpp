@@ -64,60 +64,42 @@
 
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h>
+#include "utility/threads/parallel_loop.h"
 #include <cmath>
+#include <algorithm>
 
-#define _REENTRANT    /* basic 3-lines for threads */
-// #include <pthread.h>
-#include <thread.h>
-
-#include <utility/Timer.h>
-
-
-// global data that will be needed by the threads
-struct thread_control_block {
-  mutex_t start_mutex;
-  mutex_t end_mutex;
-  mutex_t startBlock_mutex;
-  mutex_t endBlock_mutex;
-
-  cond_t start_cond;
-  cond_t end_cond;
-  cond_t startBlock_cond;
-  cond_t endBlock_cond;
-
-  double *A,*X,*B;
-  int *iDiagLoc;
-  int size;
-  int blockSize;
-  int  maxColHeight;
-  double minDiagTol;
-  int *RowTop;
-  double **topRowPtr, *invD;
+//! @brief Constructor.
+//!
+//! @param nThreads: number of threads (if zero use the number of
+//!                  concurrent threads supported by the hardware).
+//! @param blckSize: number of rows of each block.
+//! @param tol: minimum absolute value for the diagonal terms.
+XC::ProfileSPDLinDirectThreadSolver::ProfileSPDLinDirectThreadSolver(int nThreads, int blckSize, double tol) 
+  :ProfileSPDLinDirectBase(SOLVER_TAGS_ProfileSPDLinDirectThreadSolver,tol),
+   numThreads(nThreads), blockSize(std::max(blckSize,1)), maxColHeight(0)
+  {}
 
-  int currentBlock;
-  int workToDo;
-  int info;
-  int threadID;
-  int numThreads;
-  int threadsDone;
-  int threadsDoneBlock;
-} TCB_ProfileSPDDirectThreadSolver;
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::ProfileSPDLinDirectThreadSolver::getCopy(void) const
+   { return new ProfileSPDLinDirectThreadSolver(*this); }
 
+//! @brief Set the number of threads (if zero use the number of
+//! concurrent threads supported by the hardware).
+void XC::ProfileSPDLinDirectThreadSolver::setNumThreads(const int &nt)
+  { numThreads= std::max(nt,0); }
 
-void *ProfileSPDLinDirectThreadSolver_Worker(void *arg);
+//! @brief Return the number of threads (zero means the number of
+//! concurrent threads supported by the hardware).
+int XC::ProfileSPDLinDirectThreadSolver::getNumThreads(void) const
+  { return numThreads; }
 
-//! @brief Default constructor.
-XC::ProfileSPDLinDirectThreadSolver::ProfileSPDLinDirectThreadSolver(void)
-  :ProfileSPDLinDirectBase(SOLVER_TAGS_ProfileSPDLinDirectThreadSolver,1.0e-12),
- NP(2), running(false), blockSize(4), maxColHeight(0) {}
+//! @brief Set the number of rows of each block.
+void XC::ProfileSPDLinDirectThreadSolver::setBlockSize(const int &bs)
+  { blockSize= std::max(bs,1); }
 
-//! @brief Constructor.
-//!
-//! @param numProcessors: number of processors to use.
-XC::ProfileSPDLinDirectThreadSolver::ProfileSPDLinDirectThreadSolver(int numProcessors, int blckSize, double tol) 
-:ProfileSPDLinDirectBase(SOLVER_TAGS_ProfileSPDLinDirectThreadSolver,tol),
- NP(numProcessors), running(false), blockSize(blckSize), maxColHeight(0)
-  {}
+//! @brief Return the number of rows of each block.
+int XC::ProfileSPDLinDirectThreadSolver::getBlockSize(void) const
+  { return blockSize; }
 
 //! @brief Set system size.    
 int XC::ProfileSPDLinDirectThreadSolver::setSize(void)
@@ -129,7 +111,7 @@ int XC::ProfileSPDLinDirectThreadSolver::setSize(void)
 	return -1;
       }
 
-    // check for XC::quick return 
+    // check for quick return 
     if (theSOE->size == 0)
 	return 0;
     if(size != theSOE->size)
@@ -147,7 +129,7 @@ int XC::ProfileSPDLinDirectThreadSolver::setSize(void)
 
     // set RowTop and topRowPtr info
 
-    maxColHeight = 0;
+    maxColHeight = 1;
     RowTop[0] = 0;
     topRowPtr[0] = A;
     for (int j=1; j<size; j++) {
@@ -161,445 +143,221 @@ int XC::ProfileSPDLinDirectThreadSolver::setSize(void)
     return 0;
 }
 
-
-//! The solver first copies the B vector into X.
-//! FILL IN
-//! The solve process changes \f$A\f$ and \f$X\f$.   
-int XC::ProfileSPDLinDirectThreadSolver::solve(void)
+//! @brief Computes the terms of the rows [s,e) for the column c
+//! (the columns at the left of c must be already reduced).
+//!
+//! @param c: column to update.
+//! @param s: first row of the block.
+//! @param e: one past the last row of the block.
+//! @param last: one past the last row to compute (min(e,c)).
+void XC::ProfileSPDLinDirectThreadSolver::update_columns(const int &c,const int &s,const int &e,const int &last)
   {
-    // check for XC::quick returns
-    if (theSOE == 0) {
-	std::cerr << getClassName() << "::" << __FUNCTION__;
-	std::cerr << " - No ProfileSPDSOE has been assigned\n";
-	return -1;
-    }
-    
-    if (theSOE->size == 0)
-	return 0;
-
-    // set some pointers
-    double *A = theSOE->A;
-    double *B = theSOE->B;
-    double *X = theSOE->X;
-    int *iDiagLoc = theSOE->iDiagLoc;
-    int size = theSOE->size;
-
-    // copy B into X
-    for (int ii=0; ii<size; ii++)
-	X[ii] = B[ii];
-    
-    if (theSOE->isAfactored == false)  {
-      // start threads running
-      if (running == false) {
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.start_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.end_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.endBlock_mutex, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.start_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.end_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.startBlock_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.endBlock_cond, USYNC_THREAD, 0);
-	TCB_ProfileSPDDirectThreadSolver.workToDo = 0;
-
-        
-	// Create the threads - Bound daemon threads
-	for (int j = 0; j < NP; j++) 
-	  thr_create(nullptr,0, ProfileSPDLinDirectThreadSolver_Worker, 
-		     nullptr, THR_BOUND|THR_DAEMON, nullptr);
-
-        running = true;
+    const int rowctop = RowTop[c];
+    const int first= std::max(rowctop,s);
+    double *ajcPtr = topRowPtr[c] + (first-rowctop);
+    for(int j=first; j<std::min(e,last); j++)
+      {
+	double tmp = *ajcPtr;
+	const int rowjtop = RowTop[j];
+	double *akjPtr, *akcPtr;
+	int k= 0;
+	if(rowctop > rowjtop)
+	  {
+	    akjPtr = topRowPtr[j] + (rowctop-rowjtop);
+	    akcPtr = topRowPtr[c];
+	    k= rowctop;
+	  }
+	else
+	  {
+	    akjPtr = topRowPtr[j];
+	    akcPtr = topRowPtr[c] + (rowjtop-rowctop);
+	    k= rowjtop;
+	  }
+	for(; k<j; k++) 
+	  tmp -= *akjPtr++ * *akcPtr++ ;
+	*ajcPtr++ = tmp;
       }
-      
-  
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.start_mutex); 
-
-	invD[0] = 1.0/A[0];	
-
-        // assign the global variables the threads will need
-        TCB_ProfileSPDDirectThreadSolver.A = A;
-	TCB_ProfileSPDDirectThreadSolver.X = X;
-	TCB_ProfileSPDDirectThreadSolver.B = B;
-	TCB_ProfileSPDDirectThreadSolver.size = size;
-	TCB_ProfileSPDDirectThreadSolver.minDiagTol = minDiagTol;
-	TCB_ProfileSPDDirectThreadSolver.maxColHeight = maxColHeight;
-	TCB_ProfileSPDDirectThreadSolver.RowTop = RowTop;
-	TCB_ProfileSPDDirectThreadSolver.topRowPtr = topRowPtr;
-	TCB_ProfileSPDDirectThreadSolver.invD = invD;
-        TCB_ProfileSPDDirectThreadSolver.blockSize = blockSize;
-        TCB_ProfileSPDDirectThreadSolver.iDiagLoc = iDiagLoc;
-	
-	TCB_ProfileSPDDirectThreadSolver.info = 0;
-        TCB_ProfileSPDDirectThreadSolver.workToDo = NP;
-        TCB_ProfileSPDDirectThreadSolver.currentBlock = -1;
-	TCB_ProfileSPDDirectThreadSolver.threadID = 0;
-	TCB_ProfileSPDDirectThreadSolver.numThreads = NP;
-        TCB_ProfileSPDDirectThreadSolver.threadsDone = 0;
-        TCB_ProfileSPDDirectThreadSolver.threadsDoneBlock = NP;
+  }
 
-        // wake up the threads
-        cond_broadcast(&TCB_ProfileSPDDirectThreadSolver.start_cond);
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.start_mutex); 
-
-      // yield the LWP
-      thr_yield();
- 
-      // wait for all the threads to finish
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-
-         while (TCB_ProfileSPDDirectThreadSolver.threadsDone < NP) 
-           cond_wait(&TCB_ProfileSPDDirectThreadSolver.end_cond, &TCB_ProfileSPDDirectThreadSolver.end_mutex);
-
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-
-
-      theSOE->isAfactored = true;
-	
-      // divide by diag term 
-      double *bjPtr = X; 
-      double *aiiPtr = invD;
-      for (int j=0; j<size; j++) 
-	*bjPtr++ = *aiiPtr++ * X[j];
+//! @brief Factors the columns of the diagonal block [s,e) (the rows
+//! over the block are already reduced) and performs the forward
+//! substitution for those rows. Returns -2 if a diagonal term is
+//! too small.
+int XC::ProfileSPDLinDirectThreadSolver::factor_diagonal_block(const int &s,const int &e)
+  {
+    double *X = theSOE->getPtrX();
+    for(int i=std::max(s,1); i<e; i++)
+      {
+	update_columns(i,s,e,i);
 
-    
-      // now do the back substitution storing result in X
-      for (int k=(size-1); k>0; k--) {
-      
-	int rowktop = RowTop[k];
-	double bk = X[k];
-	double *ajiPtr = topRowPtr[k]; 		
-      
-	for (int j=rowktop; j<k; j++) 
-	  X[j] -= *ajiPtr++ * bk;
-      }   	 
-    } else { // just do forward and back substitution
-      
-      // do forward substitution 
-      for (int i=1; i<size; i++) {
-	    
-	int rowitop = RowTop[i];	    
+	// now form i'th col of [U] and determine [dii]
+	const int rowitop = RowTop[i];
+	double aii = theSOE->A[theSOE->iDiagLoc[i] -1]; // FORTRAN ARRAY INDEXING
 	double *ajiPtr = topRowPtr[i];
 	double *bjPtr  = &X[rowitop];  
 	double tmp = 0;	    
-	    
-	for (int j=rowitop; j<i; j++) 
-	  tmp -= *ajiPtr++ * *bjPtr++; 
-	    
-	X[i] += tmp;
-      }
 
-      // divide by diag term 
-      double *bjPtr = X; 
-      double *aiiPtr = invD;
-      for (int j=0; j<size; j++) 
-	*bjPtr++ = *aiiPtr++ * X[j];
+	for (int jj=rowitop; jj<i; jj++)
+	  {
+	    double aji = *ajiPtr;
+	    double lij = aji * invD[jj];
+	    tmp -= lij * *bjPtr++; 		
+	    *ajiPtr++ = lij;
+	    aii = aii - lij*aji;
+	  }
+	// check that the diag > the tolerance specified
+	if(aii == 0.0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; aii < 0 (i, aii): (" << i << ", "
+		      << aii << ")\n"; 
+	    return(-2);
+	  }
+	if(fabs(aii) <= minDiagTol)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; aii < minDiagTol (i, aii): (" << i
+		      << ", " << aii << ")\n"; 
+	    return(-2);
+	  }		
+	invD[i] = 1.0/aii; 
+	X[i] += tmp;	    
+      }
+    return 0;
+  }
 
-    
-      // now do the back substitution storing result in X
-      for (int k=(size-1); k>0; k--) {
-      
-	int rowktop = RowTop[k];
-	double bk = X[k];
+//! @brief Divide by the diagonal terms and do the back substitution
+//! storing the result in X.
+void XC::ProfileSPDLinDirectThreadSolver::substitution(void)
+  {
+    double *X = theSOE->getPtrX();
+    const int theSize = theSOE->size;
+    // divide by diag term 
+    for (int j=0; j<theSize; j++) 
+      X[j]*= invD[j];
+
+    // now do the back substitution storing result in X
+    for (int k=(theSize-1); k>0; k--)
+      {
+	const int rowktop = RowTop[k];
+	const double bk = X[k];
 	double *ajiPtr = topRowPtr[k]; 		
-
 	for (int j=rowktop; j<k; j++) 
 	  X[j] -= *ajiPtr++ * bk;
-      }   	 
-    }    
-    return 0;
-}
+      }
+  }
 
-int 
-XC::ProfileSPDLinDirectThreadSolver::setProfileSOE(ProfileSPDLinSOE &theNewSOE)
-{
-    if (theSOE != 0) {
-	std::cerr << getClassName() << "::" << __FUNCTION__ << "; ";
-	std::cerr << " has already been called \n";	
+//! The solver first copies the B vector into X.
+//! The matrix is factored by blocks of blockSize rows: the
+//! diagonal block is factored by the calling thread, then the
+//! columns at the right of the block that reach it are updated
+//! concurrently by the threads of the pool.
+//! The solve process changes \f$A\f$ and \f$X\f$.   
+int XC::ProfileSPDLinDirectThreadSolver::solve(void)
+  {
+    // check for quick returns
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been assigned\n";
 	return -1;
-    }
+      }
     
-    theSOE = &theNewSOE;
-    return 0;
-}
-	
-int XC::ProfileSPDLinDirectThreadSolver::sendSelf(CommParameters &cp)
-{
-    if (size != 0)
-	std::cerr << "XC::ProfileSPDLinDirectThreadSolver::sendSelf - does not send itself YET\n"; 
-    return 0;
-}
-
-
-int 
-XC::ProfileSPDLinDirectThreadSolver::recvSelf(const CommParameters &cp)
-{
-    return 0;
-}
-
-
-
-void *ProfileSPDLinDirectThreadSolver_Worker(void *arg)
-{
-  // Do this loop forever - or until all the Non-Daemon threads have exited
-  while(true)
-    {
-
-      // Wait for some work to do
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.start_mutex);
-
-        while (TCB_ProfileSPDDirectThreadSolver.workToDo == 0)
-          cond_wait(&TCB_ProfileSPDDirectThreadSolver.start_cond, &TCB_ProfileSPDDirectThreadSolver.start_mutex);
-
-        TCB_ProfileSPDDirectThreadSolver.workToDo--;
-
-        // get an id;
-	int myID = TCB_ProfileSPDDirectThreadSolver.threadID++;
-
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.start_mutex);
-
-      // do some initialisation for the factorization
-      double *A = TCB_ProfileSPDDirectThreadSolver.A;
-      double *B = TCB_ProfileSPDDirectThreadSolver.B;
-      double *X = TCB_ProfileSPDDirectThreadSolver.X;
-      int *iDiagLoc = TCB_ProfileSPDDirectThreadSolver.iDiagLoc;
-      int size = TCB_ProfileSPDDirectThreadSolver.size;
-      double minDiagTol = TCB_ProfileSPDDirectThreadSolver.minDiagTol;
-      int maxColHeight = TCB_ProfileSPDDirectThreadSolver.maxColHeight;
-      int *RowTop = TCB_ProfileSPDDirectThreadSolver.RowTop;
-      double **topRowPtr = TCB_ProfileSPDDirectThreadSolver.topRowPtr;
-      double *invD = TCB_ProfileSPDDirectThreadSolver.invD;
-      int blockSize = TCB_ProfileSPDDirectThreadSolver.blockSize;
-
-      int currentBlock =0;
-      int numThreads = TCB_ProfileSPDDirectThreadSolver.numThreads;
-
-
-      // FACTOR 
-      int startRow = 0;
-      int lastRow = startRow+blockSize-1;
-      int lastColEffected = lastRow+maxColHeight -1;
-      int nBlck = size/blockSize;
-      if ((size % blockSize) != 0)
-	nBlck++;
-
-      // for every block across      
-      for (int i=0; i<nBlck; i++) {
-
-        int currentDiagThread = i%numThreads;
-        if (myID == currentDiagThread) {
-
-	  // first factor the diagonal block int Ui,i and Di
-          int j;
-	  for (j=0; j<blockSize; j++) {
-            int currentRow = startRow + j;
-
-	    if (currentRow < size) { // this is for case when size%blockSize != 0
-
-	      int rowjTop = RowTop[currentRow];
-	      //	      double *akjPtr = &A[iDiagLoc[currentRow-1]];
-	      double *akjPtr = topRowPtr[currentRow];
-	      int maxRowijTop;
-	      if (rowjTop < startRow) {
-		akjPtr += startRow-rowjTop; // pointer to start of block row
-		maxRowijTop = startRow;
-	      } else
-		maxRowijTop = rowjTop;
-
-	      int k;
-	      for (k=maxRowijTop; k<currentRow; k++) {
-		double tmp = *akjPtr;
-		int rowkTop = RowTop[k];
-		int maxRowkjTop;
-		double *alkPtr, *aljPtr;
-		if (rowkTop < rowjTop) {
-		  alkPtr = topRowPtr[k] + (rowjTop - rowkTop);
-		  aljPtr = topRowPtr[currentRow];
-		  maxRowkjTop = rowjTop;
-		} else {
-		  alkPtr = topRowPtr[k];
-		  aljPtr = topRowPtr[currentRow] + (rowkTop - rowjTop);
-		  maxRowkjTop = rowkTop;
-		}
-
-		for (int l = maxRowkjTop; l<k; l++) 
-		  tmp -= *alkPtr++ * *aljPtr++;
-		
-		*akjPtr++ = tmp;
-	      }
-
-	      double ajj = *akjPtr;
-	      akjPtr = topRowPtr[currentRow];
-	      //	      akjPtr = &A[iDiagLoc[currentRow-1]];
-	      double *bjPtr  = &X[rowjTop];  
-	      double tmp = 0;	    
-
-	      for (k=rowjTop; k<currentRow; k++){
-		double akj = *akjPtr;
-		double lkj = akj * invD[k];
-		tmp -= lkj * *bjPtr++; 		
-		*akjPtr++ = lkj;
-		ajj = ajj -lkj * akj;
-	      }
-
-	      X[currentRow] += tmp;
-
-	      // check that the diag > the tolerance specified
-	      if (ajj <= 0.0) {
-		std::cerr << getClassName() << "::" << __FUNCTION__ << "; ";
-		std::cerr << " aii < 0 (i, aii): (" << currentRow << ", " << ajj << ")\n"; 
-		TCB_ProfileSPDDirectThreadSolver.info = -2;
-		return nullptr;
-	      }
-	      if (ajj <= minDiagTol) {
-		std::cerr << getClassName() << "::" << __FUNCTION__ << "; ";
-		std::cerr << " aii < minDiagTol (i, aii): (" << currentRow;
-		std::cerr << ", " << ajj << ")\n"; 
-		TCB_ProfileSPDDirectThreadSolver.info = -2;
-		return nullptr;
-	      }		
-	      invD[currentRow] = 1.0/ajj; 
+    const int theSize = theSOE->size;
+    if(theSize == 0)
+      return 0;
 
-	    } else 
-	      j = blockSize;
-
-	  }
-
-          // allow other threads to now proceed
-          mutex_lock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-	    TCB_ProfileSPDDirectThreadSolver.currentBlock = i;
-
-            cond_broadcast(&TCB_ProfileSPDDirectThreadSolver.startBlock_cond);
-          mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);        
-
-
-	  // now do rest of i'th block row belonging to thread
-	  // doing a block of columns at a time forming Ui,j*Di
-	  int currentCol = startRow + blockSize;
-	  for (j=i+1; j<nBlck; j++) {
-
-	    if (j%numThreads == myID) {
-
-	      for (int k=0; k<blockSize; k++) {
-
-		if (currentCol < size) { // this is for case when size%blockSize != 0
-
-		  int rowkTop = RowTop[currentCol];
-		  double *alkPtr = topRowPtr[currentCol];
-		  // double *alkPtr = &A[iDiagLoc[currentCol-1]];
-		  int maxRowikTop;
-		  if (rowkTop < startRow) {
-		    alkPtr += startRow-rowkTop; // pointer to start of block row
-		    maxRowikTop = startRow;
-		  } else
-		    maxRowikTop = rowkTop;
+    // copy B into X
+    double *B = theSOE->getPtrB();
+    double *X = theSOE->getPtrX();
+    for(int ii=0; ii<theSize; ii++)
+      X[ii] = B[ii];
 
-		  for (int l=maxRowikTop; l<=lastRow; l++) {
-		    double tmp = *alkPtr;
-		    int rowlTop = RowTop[l];
-		    int maxRowklTop;
-		    double *amlPtr, *amkPtr;
-		    if (rowlTop < rowkTop) {
-		      amlPtr = topRowPtr[l] + (rowkTop - rowlTop);
-		      amkPtr = topRowPtr[currentCol];
-		      maxRowklTop = rowkTop;
-		    } else {
-		      amlPtr = topRowPtr[l];
-		      amkPtr = topRowPtr[currentCol] + (rowlTop - rowkTop);
-		      maxRowklTop = rowlTop;
-		    }
-		  
-		    for (int m = maxRowklTop; m<l; m++) 
-		      tmp -= *amkPtr++ * *amlPtr++;
-		  
-		    *alkPtr++ = tmp;
-		  }
-		  currentCol++;
-		  if (currentCol > lastColEffected) {
-		    k = blockSize;
-		    j = nBlck;
-		  }
-		  
-		} else
-		  k = blockSize;
-	      }
-	    } else
-	      currentCol += blockSize;
+    if(theSOE->factored == false)
+      {
+	const double &a00 = theSOE->A[0];
+	if(a00 <= 0.0)
+	  {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; aii < 0 (i, aii): (0,0)\n"; 
+	    return(-2);
+	  }    
+        invD[0] = 1.0/a00;
+	const size_t nt= getThreadCount(numThreads);
+	for(int s= 0; s<theSize; s+= blockSize)
+	  {
+	    const int e= std::min(s+blockSize,theSize);
+	    const int ok= factor_diagonal_block(s,e);
+	    if(ok!=0)
+	      return ok;
+	    // update the columns at the right of the block.
+	    const int lastCol= std::min(theSize,e+maxColHeight-1);
+	    if(lastCol>e)
+	      parallel_for(lastCol-e,nt,[this,s,e](size_t first,size_t last,size_t)
+		{
+		  for(size_t c= first;c<last;c++)
+		    update_columns(e+c,s,e,e);
+		});
 	  }
-	} else {
-          // wait till diag i is done 
-          mutex_lock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-             while (TCB_ProfileSPDDirectThreadSolver.currentBlock < i)
-                cond_wait(&TCB_ProfileSPDDirectThreadSolver.startBlock_cond, &TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-          mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-	  // now do rest of i'th block row belonging to thread
-	  // doing a block of columns at a time forming Ui,j*Di
-	  int currentCol = startRow + blockSize;
-	  for (int j=i+1; j<nBlck; j++) {
-
-	    if (j%numThreads == myID) {
-
-	      for (int k=0; k<blockSize; k++) {
-
-		if (currentCol < size) { // this is for case when size%blockSize != 0
-
-		  int rowkTop = RowTop[currentCol];
-		  double *alkPtr = topRowPtr[currentCol];
-		  // double *alkPtr = &A[iDiagLoc[currentCol-1]];
-		  int maxRowikTop;
-		  if (rowkTop < startRow) {
-		    alkPtr += startRow-rowkTop; // pointer to start of block row
-		    maxRowikTop = startRow;
-		  } else
-		    maxRowikTop = rowkTop;
-
-		  for (int l=maxRowikTop; l<=lastRow; l++) {
-		    double tmp = *alkPtr;
-		    int rowlTop = RowTop[l];
-		    int maxRowklTop;
-		    double *amlPtr, *amkPtr;
-		    if (rowlTop < rowkTop) {
-		      amlPtr = topRowPtr[l] + (rowkTop - rowlTop);
-		      amkPtr = topRowPtr[currentCol];
-		      maxRowklTop = rowkTop;
-		    } else {
-		      amlPtr = topRowPtr[l];
-		      amkPtr = topRowPtr[currentCol] + (rowlTop - rowkTop);
-		      maxRowklTop = rowlTop;
-		    } 
-
-		    for (int m = maxRowklTop; m<l; m++) 
-		      tmp -= *amkPtr++ * *amlPtr++;
-		  
-		    *alkPtr++ = tmp;
-		  }
-		  currentCol++;
-		  if (currentCol > lastColEffected) {
-		    k = blockSize;
-		    j = nBlck;
-		  }
-		  
-		} else
-		  k = blockSize;
-	      }
-	    } else
-	      currentCol += blockSize;
-	  
+	theSOE->factored = true;
+	theSOE->numInt = 0;
+      }
+    else
+      {
+	// JUST DO SOLVE
+
+	// do forward substitution 
+	for (int i=1; i<theSize; i++)
+	  {
+	    int rowitop = RowTop[i];	    
+	    double *ajiPtr = topRowPtr[i];
+	    double *bjPtr  = &X[rowitop];  
+	    double tmp = 0;	    
+	    
+	    for (int j=rowitop; j<i; j++) 
+		tmp -= *ajiPtr++ * *bjPtr++; 
+	    
+	    X[i] += tmp;
 	  }
+      }
+    substitution();
+    return 0;
+  }
 
-	}
-
-	// update the data for the next block
-	startRow += blockSize;
-	lastRow = startRow + blockSize -1;
-	lastColEffected = lastRow + maxColHeight -1;
+//! @brief Returns the determinant.
+double XC::ProfileSPDLinDirectThreadSolver::getDeterminant(void) 
+  {
+    const int theSize = theSOE->size;
+    double determinant = 1.0;
+    for (int i=0; i<theSize; i++)
+      determinant *= invD[i];
+    determinant = 1.0/determinant;
+    return determinant;
+  }
+
+//! @brief Sets the system of equations to solve.
+int XC::ProfileSPDLinDirectThreadSolver::setProfileSOE(ProfileSPDLinSOE &theNewSOE)
+  {
+    int retval= 0;
+    if(theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << ";  has already been called \n";	
+	retval= -1;
       }
+    else
+      theSOE= &theNewSOE;
+    return retval;
+  }
+	
+int XC::ProfileSPDLinDirectThreadSolver::sendSelf(CommParameters &cp)
+  {
+    if(size != 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; does not send itself YET\n"; 
+    return 0;
+  }
 
-      // signal the XC::main thread that this thread is done with the work
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-         TCB_ProfileSPDDirectThreadSolver.threadsDone++;
 
-         cond_signal(&TCB_ProfileSPDDirectThreadSolver.end_cond);
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-    } 
-}
+int XC::ProfileSPDLinDirectThreadSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
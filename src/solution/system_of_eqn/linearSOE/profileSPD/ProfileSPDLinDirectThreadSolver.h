@@ -79,25 +79,38 @@ class ProfileSPDLinSOE;
 //! solve a ProfileSPDLinSOE object. It does this in parallel using
 //! threads by direct means, using the \f$LDL^t\f$ variation of the cholesky
 //! factorization. The matrx \f$A\f$ is factored one row block at a time using
-//! a left-looking approach. Within a row block the factorization is
-//! performed by \f$NP\f$ threads. No BLAS or LAPACK routines are called 
+//! a left-looking approach. The diagonal block is factored by the calling
+//! thread and then the columns to the right of the block that
+//! reach it are updated by the threads of the shared ThreadPool. Each entry
+//! is computed with the same operations (and in the same order) as in
+//! ProfileSPDLinDirectSolver, so both solvers give the same results.
+//! No BLAS or LAPACK routines are called 
 //! for the factorization or subsequent substitution.
 class ProfileSPDLinDirectThreadSolver : public ProfileSPDLinDirectBase
   {
   protected:
-    int NP;
-    int running;
-    
-    int blockSize;
-    int maxColHeight;
+    int numThreads; //!< number of threads (0: hardware concurrency).
+    int blockSize; //!< number of rows in each block.
+    int maxColHeight; //!< height of the highest column.
 
-    ProfileSPDLinDirectThreadSolver();      
-    ProfileSPDLinDirectThreadSolver(int numProcessors, int blockSize, double tol);    
+    int factor_diagonal_block(const int &,const int &);
+    void update_columns(const int &,const int &,const int &,const int &);
+    void substitution(void);
+
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    ProfileSPDLinDirectThreadSolver(int numThreads= 0, int blockSize= 64, double tol= 1.0e-12);
     virtual LinearSOESolver *getCopy(void) const;
   public:
 
     virtual int solve(void);        
     virtual int setSize(void);    
+    double getDeterminant(void);
+
+    void setNumThreads(const int &);
+    int getNumThreads(void) const;
+    void setBlockSize(const int &);
+    int getBlockSize(void) const;
 
     virtual int setProfileSOE(ProfileSPDLinSOE &theSOE);
 
@@ -161,6 +161,7 @@ bool XC::ProfileSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
+    clearScatterMap(); // A may be reallocated.
     size= checkSize(theGraph);
 
     // check we have enough space in iDiagLoc and iLastCol
@@ -223,6 +224,7 @@ int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
 
     if(size > B.Size())
       inic(size);
+    buildScatterMap();
 
     // invoke setSize() on the XC::Solver
     LinearSOESolver *the_Solver = this->getSolver();
@@ -236,6 +238,21 @@ int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Return the address of the term \f$a_{row,col}\f$ in A
+//! (nullptr if it's not stored, only the terms of the upper triangle
+//! inside the profile are stored).
+double *XC::ProfileSPDLinSOE::getEntryPtr(const int &row, const int &col)
+  {
+    double *retval= nullptr;
+    if(row<=col)
+      {
+        const int minColRow= (col==0 ? 0 : col - (iDiagLoc(col) - iDiagLoc(col-1)) +1);
+        if(row>=minColRow)
+          retval= &A[iDiagLoc(col)-1-(col-row)]; // -1 as fortran indexing
+      }
+    return retval;
+  }
+
 //! @brief Assembles the product of m by fact into A.
 //! 
 //! First tests that \p loc and \p M are of compatable sizes; if not
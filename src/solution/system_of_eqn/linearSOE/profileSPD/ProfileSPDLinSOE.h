@@ -125,6 +125,7 @@ class ProfileSPDLinSOE: public FactoredSOEBase
     int numInt;
   protected:
     virtual bool setSolver(LinearSOESolver *);
+    virtual double *getEntryPtr(const int &, const int &);
 
     friend class AnalysisAggregation;
     friend class FEM_ObjectBroker;
@@ -22,7 +22,13 @@
 //python_interface.tcc
 
 class_<XC::LinearSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("LinearSOE", no_init)
-.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver'" )
+.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'band_spd_lin_thread_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'matrix_free_pcg_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'profile_spd_lin_direct_thread_solver', 'sparse_gen_col_amg_solver', 'sparse_gen_row_amg_solver', 'super_lu_solver', 'supernodal_cholesky_solver', 'sym_sparse_lin_solver'" )
+.add_property("reuseSparsity", &XC::LinearSOE::getReuseSparsity, &XC::LinearSOE::setReuseSparsity,"If true, keep the size (and the symbolic factorization of the solver) when the sparsity of the system doesn't change.")
+.add_property("sparsityHits", &XC::LinearSOE::getSparsityHits,"Number of times the size of the system has been reused.")
+.add_property("sparsityMisses", &XC::LinearSOE::getSparsityMisses,"Number of times the system has been resized.")
+.def("clearSparsityCache", &XC::LinearSOE::clearSparsityCache,"Forget the stored sparsity signature and reset the hit/miss counters.")
+.add_property("useScatterMaps", &XC::LinearSOE::getUseScatterMaps, &XC::LinearSOE::setUseScatterMaps,"If true, store the position of the terms of each element matrix when the size of the system is set, so the assembly doesn't search them (uses one pointer for each term).")
+.add_property("scatterMapSize", &XC::LinearSOE::getScatterMapSize,"Number of positions stored in the scatter map of the elements.")
   ;
 
 class_<XC::LinearSOEData, bases<XC::LinearSOE>, boost::noncopyable >("LinearSOEData", no_init);
@@ -45,6 +51,11 @@ class_<XC::DiagonalSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("Diagon
 class_<XC::FullGenLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("FullGenLinSOE", no_init)
     ;
 
+class_<XC::MatrixFreeLinSOE, bases<XC::LinearSOEData>, boost::noncopyable >("MatrixFreeLinSOE", no_init)
+  .def("getDiagonal", &XC::MatrixFreeLinSOE::getDiagonal, return_internal_reference<>(),"Returns the diagonal of the system matrix.")
+  .add_property("numBlocks", &XC::MatrixFreeLinSOE::getNumBlocks,"Number of nodal blocks.")
+    ;
+
 #ifdef _PETSC
 class_<XC::PetscSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("PetscSOE", no_init)
     ;
@@ -111,9 +122,22 @@ class_<XC::BandSPDLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("B
 
 class_<XC::BandSPDLinLapackSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinLapackSolver", no_init);
 
-// class_<XC::BandSPDLinThreadSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinThreadSolver", no_init);
+class_<XC::BandSPDLinThreadSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinThreadSolver", no_init)
+  .add_property("numThreads", &XC::BandSPDLinThreadSolver::getNumThreads, &XC::BandSPDLinThreadSolver::setNumThreads,"Number of threads (0: number of concurrent threads supported by the hardware).")
+  .add_property("blockSize", &XC::BandSPDLinThreadSolver::getBlockSize, &XC::BandSPDLinThreadSolver::setBlockSize,"Number of columns of each block.")
+  ;
 
-class_<XC::ConjugateGradientSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("ConjugateGradientSolver", no_init);
+class_<XC::ConjugateGradientSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("ConjugateGradientSolver", no_init)
+  .add_property("tolerance", &XC::ConjugateGradientSolver::getTolerance, &XC::ConjugateGradientSolver::setTolerance,"Tolerance for the norm of the residual relative to the norm of the right hand side.")
+  .add_property("maxNumIter", &XC::ConjugateGradientSolver::getMaxNumIter, &XC::ConjugateGradientSolver::setMaxNumIter,"Maximum number of iterations (if zero, the number of equations).")
+  .add_property("numIter", &XC::ConjugateGradientSolver::getNumIter,"Number of iterations of the last solution.")
+  .add_property("residualNorm", &XC::ConjugateGradientSolver::getResidualNorm,"Relative norm of the residual at the end of the last solution.")
+  ;
+
+class_<XC::MatrixFreePCGSolver, bases<XC::ConjugateGradientSolver>, boost::noncopyable >("MatrixFreePCGSolver", no_init)
+  .add_property("preconditioner", make_function(&XC::MatrixFreePCGSolver::getPreconditioner, return_value_policy<copy_const_reference>()), &XC::MatrixFreePCGSolver::setPreconditioner,"Preconditioner: 'none', 'jacobi' or 'block_jacobi'.")
+  .add_property("numThreads", &XC::MatrixFreePCGSolver::getNumThreads, &XC::MatrixFreePCGSolver::setNumThreads,"Number of threads used to compute the element products (0: number of concurrent threads supported by the hardware).")
+  ;
 
 class_<XC::DiagonalSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("DiagonalSolver", no_init);
 
@@ -135,7 +159,10 @@ class_<XC::ProfileSPDLinDirectBlockSolver, bases<XC::ProfileSPDLinDirectBase>, b
 
 class_<XC::ProfileSPDLinDirectSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectSolver", no_init);
 
-// class_<XC::ProfileSPDLinDirectThreadSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectThreadSolver", no_init);
+class_<XC::ProfileSPDLinDirectThreadSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectThreadSolver", no_init)
+  .add_property("numThreads", &XC::ProfileSPDLinDirectThreadSolver::getNumThreads, &XC::ProfileSPDLinDirectThreadSolver::setNumThreads,"Number of threads (0: number of concurrent threads supported by the hardware).")
+  .add_property("blockSize", &XC::ProfileSPDLinDirectThreadSolver::getBlockSize, &XC::ProfileSPDLinDirectThreadSolver::setBlockSize,"Number of rows of each block.")
+  ;
 
 class_<XC::ProfileSPDLinSubstrSolver, bases<XC::ProfileSPDLinDirectBase,XC::DomainSolver>, boost::noncopyable >("ProfileSPDLinSubstrSolver", no_init);
 
@@ -143,12 +170,45 @@ class_<XC::ProfileSPDLinSubstrSolver, bases<XC::ProfileSPDLinDirectBase,XC::Doma
 
 class_<XC::SparseGenColLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SparseGenColLinSolver", no_init);
 
+class_<XC::AlgebraicMultigrid, boost::noncopyable >("AlgebraicMultigrid", no_init)
+  .add_property("krylov", make_function(&XC::AlgebraicMultigrid::getKrylov, return_value_policy<copy_const_reference>()), &XC::AlgebraicMultigrid::setKrylov,"Krylov method: 'cg' (symmetric positive definite systems) or 'gmres'.")
+  .add_property("tolerance", &XC::AlgebraicMultigrid::getTolerance, &XC::AlgebraicMultigrid::setTolerance,"Tolerance for the norm of the residual relative to the norm of the right hand side.")
+  .add_property("maxNumIter", &XC::AlgebraicMultigrid::getMaxNumIter, &XC::AlgebraicMultigrid::setMaxNumIter,"Maximum number of iterations.")
+  .add_property("restart", &XC::AlgebraicMultigrid::getRestart, &XC::AlgebraicMultigrid::setRestart,"Number of GMRES iterations between restarts.")
+  .add_property("maxNumLevels", &XC::AlgebraicMultigrid::getMaxNumLevels, &XC::AlgebraicMultigrid::setMaxNumLevels,"Maximum number of levels of the hierarchy.")
+  .add_property("coarseSize", &XC::AlgebraicMultigrid::getCoarseSize, &XC::AlgebraicMultigrid::setCoarseSize,"Number of equations under which a level is not coarsened.")
+  .add_property("strengthThreshold", &XC::AlgebraicMultigrid::getStrengthThreshold, &XC::AlgebraicMultigrid::setStrengthThreshold,"Threshold for the strength of the connections between nodes.")
+  .add_property("numSweeps", &XC::AlgebraicMultigrid::getNumSweeps, &XC::AlgebraicMultigrid::setNumSweeps,"Number of pre and post smoothing sweeps.")
+  .add_property("reuseHierarchy", &XC::AlgebraicMultigrid::getReuseHierarchy, &XC::AlgebraicMultigrid::setReuseHierarchy,"If true the prolongators are reused when the matrix values change.")
+  .add_property("rebuildFactor", &XC::AlgebraicMultigrid::getRebuildFactor, &XC::AlgebraicMultigrid::setRebuildFactor,"The nodes are aggregated again when the number of iterations exceeds this factor times the iterations after the last full setup.")
+  .add_property("numThreads", &XC::AlgebraicMultigrid::getNumThreads, &XC::AlgebraicMultigrid::setNumThreads,"Number of threads (0: number of concurrent threads supported by the hardware).")
+  .add_property("numIter", &XC::AlgebraicMultigrid::getNumIter,"Number of iterations of the last solution.")
+  .add_property("residualNorm", &XC::AlgebraicMultigrid::getResidualNorm,"Relative norm of the residual at the end of the last solution.")
+  .add_property("numSetups", &XC::AlgebraicMultigrid::getNumSetups,"Number of full setups of the hierarchy.")
+  .add_property("numUpdates", &XC::AlgebraicMultigrid::getNumUpdates,"Number of setups that reused the prolongators.")
+  .add_property("numLevels", &XC::AlgebraicMultigrid::getNumLevels,"Number of levels of the hierarchy.")
+  .add_property("operatorComplexity", &XC::AlgebraicMultigrid::getOperatorComplexity,"Number of terms of the matrices of all levels divided by the number of terms of the system matrix.")
+  .def("getLevelSize", &XC::AlgebraicMultigrid::getLevelSize,"getLevelSize(i): returns the number of equations of the i-th level.")
+  .def("rebuildHierarchy", &XC::AlgebraicMultigrid::rebuildHierarchy,"Forces a full setup of the hierarchy in the next solution.")
+  ;
+
+class_<XC::SparseGenColAMGSolver, bases<XC::SparseGenColLinSolver, XC::AlgebraicMultigrid>, boost::noncopyable >("SparseGenColAMGSolver", no_init);
+
 class_<XC::SuperLU, bases<XC::SparseGenColLinSolver>, boost::noncopyable >("SuperLU", no_init);
 
+class_<XC::SupernodalCholeskySolver, bases<XC::SparseGenColLinSolver>, boost::noncopyable >("SupernodalCholeskySolver", no_init)
+  .add_property("ordering", make_function(&XC::SupernodalCholeskySolver::getOrdering, return_value_policy<copy_const_reference>()), &XC::SupernodalCholeskySolver::setOrdering,"Fill reducing ordering: 'amd', 'nested_dissection' or 'natural'.")
+  .add_property("numThreads", &XC::SupernodalCholeskySolver::getNumThreads, &XC::SupernodalCholeskySolver::setNumThreads,"Number of threads (0: number of concurrent threads supported by the hardware).")
+  .add_property("numSupernodes", &XC::SupernodalCholeskySolver::getNumSupernodes,"Number of supernodes of the factor.")
+  .add_property("factorNNZ", &XC::SupernodalCholeskySolver::getFactorNNZ,"Number of terms stored for the factor.")
+  ;
+
 // class_<XC::ThreadSuperLU, bases<XC::SparseGenColLinSolver>, boost::noncopyable >("ThreadSuperLU", no_init);
 
 class_<XC::SparseGenRowLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SparseGenRowLinSolver", no_init);
 
+class_<XC::SparseGenRowAMGSolver, bases<XC::SparseGenRowLinSolver, XC::AlgebraicMultigrid>, boost::noncopyable >("SparseGenRowAMGSolver", no_init);
+
 class_<XC::SymSparseLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SymSparseLinSolver", no_init);
 
 // class_<XC::UmfpackGenLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("UmfpackGenLinSolver", no_init);
@@ -0,0 +1,1208 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AlgebraicMultigrid.cc
+
+#include "AlgebraicMultigrid.h"
+#include "utility/threads/parallel_loop.h"
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/dof_grp/DOF_Group.h>
+#include <solution/analysis/model/DOF_GrpIter.h>
+#include "domain/mesh/node/Node.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Vector.h"
+#include <iostream>
+#include <cmath>
+
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA, int *iPiv, int *INFO);
+
+extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, 
+		       int *iPiv, double *B, int *LDB, int *INFO);
+
+namespace {
+  typedef XC::AlgebraicMultigrid::CSRMatrix CSRMatrix;
+
+  //! @brief Return the node of each equation and its position inside
+  //! the node.
+  void get_dof_nodes(const std::vector<int> &nodePtr,const std::vector<int> &nodeDofs,const int &n,std::vector<int> &dofNode,std::vector<int> &dofPos)
+    {
+      dofNode.assign(n,-1);
+      dofPos.assign(n,-1);
+      const int nn= nodePtr.size()-1;
+      for(int I= 0;I<nn;I++)
+        for(int k= nodePtr[I];k<nodePtr[I+1];k++)
+          {
+            dofNode[nodeDofs[k]]= I;
+            dofPos[nodeDofs[k]]= k-nodePtr[I];
+          }
+    }
+
+  //! @brief Return a+alpha*b.
+  CSRMatrix add(const CSRMatrix &a,const CSRMatrix &b,const double &alpha)
+    {
+      CSRMatrix retval;
+      retval.nRows= a.nRows;
+      retval.nCols= a.nCols;
+      retval.ptr.assign(a.nRows+1,0);
+      retval.idx.reserve(a.nnz()+b.nnz());
+      retval.val.reserve(a.nnz()+b.nnz());
+      std::vector<int> pos(a.nCols,-1);
+      for(int i= 0;i<a.nRows;i++)
+        {
+          const int first= retval.idx.size();
+          for(int k= a.ptr[i];k<a.ptr[i+1];k++)
+            {
+              pos[a.idx[k]]= retval.idx.size();
+              retval.idx.push_back(a.idx[k]);
+              retval.val.push_back(a.val[k]);
+            }
+          for(int k= b.ptr[i];k<b.ptr[i+1];k++)
+            {
+              const int j= b.idx[k];
+              if((pos[j]>=first) && (retval.idx[pos[j]]==j))
+                retval.val[pos[j]]+= alpha*b.val[k];
+              else
+                {
+                  pos[j]= retval.idx.size();
+                  retval.idx.push_back(j);
+                  retval.val.push_back(alpha*b.val[k]);
+                }
+            }
+          retval.ptr[i+1]= retval.idx.size();
+        }
+      return retval;
+    }
+
+  //! @brief Inverts the n x n matrix a (column major) by Gauss-Jordan
+  //! elimination with partial pivoting. Returns false if the matrix
+  //! is singular.
+  bool invert(std::vector<double> &a,const int &n)
+    {
+      std::vector<double> inv(n*n,0.0);
+      for(int i= 0;i<n;i++)
+        inv[i*n+i]= 1.0;
+      double maxAbs= 0.0;
+      for(size_t i= 0;i<a.size();i++)
+        maxAbs= std::max(maxAbs,std::abs(a[i]));
+      for(int c= 0;c<n;c++)
+        {
+          int piv= c;
+          for(int r= c+1;r<n;r++)
+            if(std::abs(a[c*n+r])>std::abs(a[c*n+piv]))
+              piv= r;
+          const double p= a[c*n+piv];
+          if(std::abs(p)<=1e-14*maxAbs)
+            return false;
+          if(piv!=c)
+            for(int k= 0;k<n;k++)
+              {
+                std::swap(a[k*n+c],a[k*n+piv]);
+                std::swap(inv[k*n+c],inv[k*n+piv]);
+              }
+          for(int k= 0;k<n;k++)
+            {
+              a[k*n+c]/= p;
+              inv[k*n+c]/= p;
+            }
+          for(int r= 0;r<n;r++)
+            if(r!=c)
+              {
+                const double f= a[c*n+r];
+                if(f!=0.0)
+                  for(int k= 0;k<n;k++)
+                    {
+                      a[k*n+r]-= f*a[k*n+c];
+                      inv[k*n+r]-= f*inv[k*n+c];
+                    }
+              }
+        }
+      a.swap(inv);
+      return true;
+    }
+}
+
+//! @brief Constructor.
+XC::AlgebraicMultigrid::AlgebraicMultigrid(void)
+  : levels(1), numModes(1), validHierarchy(false), newValues(false),
+    setupNumIter(0), krylov("cg"), tolerance(1e-8), maxNumIter(1000),
+    restart(30), maxNumLevels(10), coarseSize(500),
+    strengthThreshold(0.08), numSweeps(2), reuseHierarchy(true),
+    rebuildFactor(2.0), numThreads(1), numIter(0), residualNorm(0.0),
+    numSetups(0), numUpdates(0)
+  {}
+
+//! @brief Set the Krylov method (cg or gmres).
+void XC::AlgebraicMultigrid::setKrylov(const std::string &str)
+  {
+    if((str=="cg") || (str=="gmres"))
+      krylov= str;
+    else
+      std::cerr << "AlgebraicMultigrid::" << __FUNCTION__
+	        << "; unknown Krylov method: '" << str
+		<< "', use 'cg' or 'gmres'." << std::endl;
+  }
+
+//! @brief Return the Krylov method.
+const std::string &XC::AlgebraicMultigrid::getKrylov(void) const
+  { return krylov; }
+
+//! @brief Set the number of threads (if zero, the number of concurrent
+//! threads supported by the hardware).
+void XC::AlgebraicMultigrid::setNumThreads(const int &n)
+  { numThreads= std::max(n,0); }
+
+//! @brief Return the number of threads.
+int XC::AlgebraicMultigrid::getNumThreads(void) const
+  { return numThreads; }
+
+//! @brief Return the number of levels of the hierarchy.
+int XC::AlgebraicMultigrid::getNumLevels(void) const
+  { return levels.size(); }
+
+//! @brief Return the number of equations of the i-th level.
+int XC::AlgebraicMultigrid::getLevelSize(const int &i) const
+  {
+    int retval= 0;
+    if((i>=0) && (i<int(levels.size())))
+      retval= levels[i].A.nRows;
+    return retval;
+  }
+
+//! @brief Return the sum of the number of terms of the matrices of
+//! all levels divided by the number of terms of the system matrix.
+double XC::AlgebraicMultigrid::getOperatorComplexity(void) const
+  {
+    double retval= 0.0;
+    const double nnz0= levels[0].A.nnz();
+    if(nnz0>0)
+      {
+        for(std::vector<Level>::const_iterator i= levels.begin();i!=levels.end();i++)
+          retval+= i->A.nnz();
+        retval/= nnz0;
+      }
+    return retval;
+  }
+
+//! @brief Sets the sparsity pattern of the system matrix.
+//!
+//! @param n: number of equations.
+//! @param ptr: first entry of each column (CSC) or row (CSR).
+//! @param idx: row (CSC) or column (CSR) of each entry.
+//! @param csc: true if the matrix is stored by columns.
+void XC::AlgebraicMultigrid::setPattern(const int &n, const int *ptr, const int *idx, const bool &csc)
+  {
+    levels.assign(1,Level());
+    coarseLU.clear();
+    coarsePiv.clear();
+    validHierarchy= false;
+    newValues= false;
+    CSRMatrix &A= levels[0].A;
+    A.nRows= n;
+    A.nCols= n;
+    const int nnz= (n>0 ? ptr[n] : 0);
+    A.ptr.assign(n+1,0);
+    A.idx.resize(nnz);
+    A.val.assign(nnz,0.0);
+    valueMap.resize(nnz);
+    if(csc)
+      {
+        for(int k= 0;k<nnz;k++)
+          A.ptr[idx[k]+1]++;
+        for(int i= 0;i<n;i++)
+          A.ptr[i+1]+= A.ptr[i];
+        std::vector<int> next(A.ptr.begin(),A.ptr.end()-1);
+        for(int j= 0;j<n;j++)
+          for(int k= ptr[j];k<ptr[j+1];k++)
+            {
+              const int pos= next[idx[k]]++;
+              A.idx[pos]= j;
+              valueMap[k]= pos;
+            }
+      }
+    else
+      {
+        std::copy(ptr,ptr+n+1,A.ptr.begin());
+        std::copy(idx,idx+nnz,A.idx.begin());
+        for(int k= 0;k<nnz;k++)
+          valueMap[k]= k;
+      }
+    // by default each equation is a node.
+    Level &L= levels[0];
+    numModes= 1;
+    L.nodePtr.resize(n+1);
+    L.nodeDofs.resize(n);
+    for(int i= 0;i<n;i++)
+      {
+        L.nodePtr[i]= i;
+        L.nodeDofs[i]= i;
+      }
+    L.nodePtr[n]= n;
+    L.B.assign(n,1.0);
+  }
+
+//! @brief Sets the nodal blocks (equations of each DOF_Group) and the
+//! near null space (rigid body modes) of the finest level.
+//!
+//! In three-dimensional models the rigid body modes are computed for
+//! the nodes with 3 (displacements) or 6 (displacements and
+//! rotations) DOFs; in two-dimensional models for the nodes with 2 or
+//! 3 DOFs. For the other nodes a constant vector is used for each
+//! DOF component. Equations that don't belong to a node are treated
+//! as one DOF nodes.
+void XC::AlgebraicMultigrid::setNodalBlocks(AnalysisModel *mdl)
+  {
+    Level &L= levels[0];
+    const int n= L.A.nRows;
+    if(!mdl || (n==0))
+      return;
+    // dimension and centroid.
+    int dim= 0;
+    int maxNumDOF= 1;
+    double centroid[3]= {0.0,0.0,0.0};
+    double minCrd[3]= {0.0,0.0,0.0};
+    double maxCrd[3]= {0.0,0.0,0.0};
+    size_t numNodes= 0;
+    DOF_GrpIter &theDOFs= mdl->getDOFGroups();
+    DOF_Group *dofPtr= nullptr;
+    while((dofPtr= theDOFs()) != 0)
+      {
+        maxNumDOF= std::max(maxNumDOF,dofPtr->getID().Size());
+        const Node *nodePtr= dofPtr->getNodePtr();
+        if(nodePtr)
+          {
+            const Vector &crd= nodePtr->getCrds();
+            const int sz= std::min(crd.Size(),3);
+            dim= std::max(dim,sz);
+            for(int i= 0;i<sz;i++)
+              {
+                centroid[i]+= crd(i);
+                if(numNodes==0)
+                  { minCrd[i]= crd(i); maxCrd[i]= crd(i); }
+                minCrd[i]= std::min(minCrd[i],crd(i));
+                maxCrd[i]= std::max(maxCrd[i],crd(i));
+              }
+            numNodes++;
+          }
+      }
+    double length= 0.0;
+    for(int i= 0;i<3;i++)
+      {
+        if(numNodes>0)
+          centroid[i]/= numNodes;
+        length= std::max(length,maxCrd[i]-minCrd[i]);
+      }
+    if(length<=0.0)
+      length= 1.0;
+    if(dim==3)
+      numModes= 6;
+    else if(dim==2)
+      numModes= 3;
+    else
+      numModes= maxNumDOF;
+
+    L.nodePtr.assign(1,0);
+    L.nodeDofs.clear();
+    L.B.assign(n*numModes,0.0);
+    std::vector<bool> assigned(n,false);
+    DOF_GrpIter &theDOFs2= mdl->getDOFGroups();
+    while((dofPtr= theDOFs2()) != 0)
+      {
+        const ID &id= dofPtr->getID();
+        const int ndof= id.Size();
+        double x[3]= {0.0,0.0,0.0};
+        const Node *nodePtr= dofPtr->getNodePtr();
+        if(nodePtr)
+          {
+            const Vector &crd= nodePtr->getCrds();
+            for(int i= 0;i<std::min(crd.Size(),3);i++)
+              x[i]= (crd(i)-centroid[i])/length;
+          }
+        const bool rigid3d= nodePtr && (dim==3) && ((ndof==3) || (ndof==6));
+        const bool rigid2d= nodePtr && (dim==2) && ((ndof==2) || (ndof==3));
+        const size_t first= L.nodeDofs.size();
+        for(int c= 0;c<ndof;c++)
+          {
+            const int eq= id(c);
+            if((eq<0) || (eq>=n) || assigned[eq])
+              continue;
+            assigned[eq]= true;
+            L.nodeDofs.push_back(eq);
+            double *row= &L.B[eq*numModes];
+            if(rigid3d)
+              {
+                if(c<3)
+                  {
+                    row[c]= 1.0;
+                    // rotations about x, y and z.
+                    const double rx[3]= {0.0,-x[2],x[1]};
+                    const double ry[3]= {x[2],0.0,-x[0]};
+                    const double rz[3]= {-x[1],x[0],0.0};
+                    row[3]= rx[c]; row[4]= ry[c]; row[5]= rz[c];
+                  }
+                else
+                  row[c]= 1.0;
+              }
+            else if(rigid2d)
+              {
+                if(c<2)
+                  {
+                    row[c]= 1.0;
+                    row[2]= (c==0 ? -x[1] : x[0]);
+                  }
+                else
+                  row[2]= 1.0;
+              }
+            else
+              row[c%numModes]= 1.0;
+          }
+        if(L.nodeDofs.size()>first)
+          L.nodePtr.push_back(L.nodeDofs.size());
+      }
+    // equations that don't belong to any DOF group.
+    for(int eq= 0;eq<n;eq++)
+      if(!assigned[eq])
+        {
+          L.nodeDofs.push_back(eq);
+          L.nodePtr.push_back(L.nodeDofs.size());
+          L.B[eq*numModes]= 1.0;
+        }
+    validHierarchy= false;
+  }
+
+//! @brief Sets the values of the system matrix (in the order of the
+//! pattern passed to setPattern).
+void XC::AlgebraicMultigrid::setValues(const double *values)
+  {
+    CSRMatrix &A= levels[0].A;
+    const size_t nnz= valueMap.size();
+    for(size_t k= 0;k<nnz;k++)
+      A.val[valueMap[k]]= values[k];
+    newValues= true;
+  }
+
+//! @brief Return the dot product of a and b.
+//!
+//! The partial sums are computed over blocks of fixed size and then
+//! added in order, so the result doesn't depend on the number of
+//! threads.
+double XC::AlgebraicMultigrid::dot(const std::vector<double> &a, const std::vector<double> &b)
+  {
+    const size_t blockSize= 1024;
+    const size_t n= a.size();
+    const size_t numBlocks= (n+blockSize-1)/blockSize;
+    std::vector<double> partial(numBlocks,0.0);
+    parallel_for(numBlocks,getThreadCount(numThreads),[&](size_t first,size_t last,size_t)
+      {
+        for(size_t blk= first;blk<last;blk++)
+          {
+            const size_t end= std::min(n,(blk+1)*blockSize);
+            double s= 0.0;
+            for(size_t i= blk*blockSize;i<end;i++)
+              s+= a[i]*b[i];
+            partial[blk]= s;
+          }
+      });
+    double retval= 0.0;
+    for(std::vector<double>::const_iterator i= partial.begin();i!=partial.end();i++)
+      retval+= *i;
+    return retval;
+  }
+
+//! @brief Computes y= A x.
+void XC::AlgebraicMultigrid::spmv(const CSRMatrix &A, const std::vector<double> &x, std::vector<double> &y)
+  {
+    y.resize(A.nRows);
+    parallel_for(A.nRows,getThreadCount(numThreads),[&](size_t first,size_t last,size_t)
+      {
+        for(size_t i= first;i<last;i++)
+          {
+            double s= 0.0;
+            for(int k= A.ptr[i];k<A.ptr[i+1];k++)
+              s+= A.val[k]*x[A.idx[k]];
+            y[i]= s;
+          }
+      });
+  }
+
+//! @brief Computes r= b - A x.
+void XC::AlgebraicMultigrid::residual(const CSRMatrix &A, const std::vector<double> &x, const std::vector<double> &b, std::vector<double> &r)
+  {
+    r.resize(A.nRows);
+    parallel_for(A.nRows,getThreadCount(numThreads),[&](size_t first,size_t last,size_t)
+      {
+        for(size_t i= first;i<last;i++)
+          {
+            double s= b[i];
+            for(int k= A.ptr[i];k<A.ptr[i+1];k++)
+              s-= A.val[k]*x[A.idx[k]];
+            r[i]= s;
+          }
+      });
+  }
+
+//! @brief Return the product a*b.
+//!
+//! The rows of the product are computed concurrently, each thread
+//! storing its rows in its own arrays, and then copied to the result.
+XC::AlgebraicMultigrid::CSRMatrix XC::AlgebraicMultigrid::multiply(const CSRMatrix &a, const CSRMatrix &b)
+  {
+    const size_t nt= getThreadCount(numThreads);
+    std::vector<std::vector<int> > rowCount(nt);
+    std::vector<std::vector<int> > chunkIdx(nt);
+    std::vector<std::vector<double> > chunkVal(nt);
+    std::vector<size_t> chunkFirst(nt,0);
+    parallel_for(a.nRows,nt,[&](size_t first,size_t last,size_t t)
+      {
+        std::vector<int> pos(b.nCols,-1);
+        std::vector<int> &idx= chunkIdx[t];
+        std::vector<double> &val= chunkVal[t];
+        std::vector<int> &count= rowCount[t];
+        chunkFirst[t]= first;
+        count.assign(last-first,0);
+        for(size_t i= first;i<last;i++)
+          {
+            const int rowStart= idx.size();
+            for(int ka= a.ptr[i];ka<a.ptr[i+1];ka++)
+              {
+                const int j= a.idx[ka];
+                const double v= a.val[ka];
+                for(int kb= b.ptr[j];kb<b.ptr[j+1];kb++)
+                  {
+                    const int c= b.idx[kb];
+                    if(pos[c]<rowStart)
+                      {
+                        pos[c]= idx.size();
+                        idx.push_back(c);
+                        val.push_back(v*b.val[kb]);
+                      }
+                    else
+                      val[pos[c]]+= v*b.val[kb];
+                  }
+              }
+            count[i-first]= idx.size()-rowStart;
+          }
+      });
+    CSRMatrix retval;
+    retval.nRows= a.nRows;
+    retval.nCols= b.nCols;
+    retval.ptr.assign(a.nRows+1,0);
+    for(size_t t= 0;t<nt;t++)
+      for(size_t k= 0;k<rowCount[t].size();k++)
+        retval.ptr[chunkFirst[t]+k+1]= rowCount[t][k];
+    for(int i= 0;i<a.nRows;i++)
+      retval.ptr[i+1]+= retval.ptr[i];
+    retval.idx.resize(retval.ptr[a.nRows]);
+    retval.val.resize(retval.ptr[a.nRows]);
+    for(size_t t= 0;t<nt;t++)
+      if(!rowCount[t].empty())
+        {
+          const int first= retval.ptr[chunkFirst[t]];
+          std::copy(chunkIdx[t].begin(),chunkIdx[t].end(),retval.idx.begin()+first);
+          std::copy(chunkVal[t].begin(),chunkVal[t].end(),retval.val.begin()+first);
+        }
+    return retval;
+  }
+
+//! @brief Return the transpose of a.
+XC::AlgebraicMultigrid::CSRMatrix XC::AlgebraicMultigrid::transpose(const CSRMatrix &a)
+  {
+    CSRMatrix retval;
+    retval.nRows= a.nCols;
+    retval.nCols= a.nRows;
+    retval.ptr.assign(a.nCols+1,0);
+    retval.idx.resize(a.nnz());
+    retval.val.resize(a.nnz());
+    for(size_t k= 0;k<a.nnz();k++)
+      retval.ptr[a.idx[k]+1]++;
+    for(int i= 0;i<a.nCols;i++)
+      retval.ptr[i+1]+= retval.ptr[i];
+    std::vector<int> next(retval.ptr.begin(),retval.ptr.end()-1);
+    for(int i= 0;i<a.nRows;i++)
+      for(int k= a.ptr[i];k<a.ptr[i+1];k++)
+        {
+          const int pos= next[a.idx[k]]++;
+          retval.idx[pos]= i;
+          retval.val[pos]= a.val[k];
+        }
+    return retval;
+  }
+
+//! @brief Computes the inverse of the nodal diagonal blocks of the
+//! matrix of the level (if a block is singular the inverse of its
+//! diagonal is used).
+void XC::AlgebraicMultigrid::form_block_inverse(Level &L)
+  {
+    const CSRMatrix &A= L.A;
+    const int n= A.nRows;
+    std::vector<int> dofNode, dofPos;
+    get_dof_nodes(L.nodePtr,L.nodeDofs,n,dofNode,dofPos);
+    CSRMatrix &D= L.Dinv;
+    D.nRows= n;
+    D.nCols= n;
+    D.ptr.assign(n+1,0);
+    const int nn= L.nodePtr.size()-1;
+    for(int I= 0;I<nn;I++)
+      {
+        const int nb= L.nodePtr[I+1]-L.nodePtr[I];
+        for(int k= L.nodePtr[I];k<L.nodePtr[I+1];k++)
+          D.ptr[L.nodeDofs[k]+1]= nb;
+      }
+    for(int i= 0;i<n;i++)
+      D.ptr[i+1]+= D.ptr[i];
+    D.idx.resize(D.ptr[n]);
+    D.val.resize(D.ptr[n]);
+    std::vector<double> block;
+    for(int I= 0;I<nn;I++)
+      {
+        const int first= L.nodePtr[I];
+        const int nb= L.nodePtr[I+1]-first;
+        block.assign(nb*nb,0.0);
+        for(int li= 0;li<nb;li++)
+          {
+            const int row= L.nodeDofs[first+li];
+            for(int k= A.ptr[row];k<A.ptr[row+1];k++)
+              {
+                const int col= A.idx[k];
+                if(dofNode[col]==I)
+                  block[dofPos[col]*nb+li]+= A.val[k];
+              }
+          }
+        std::vector<double> diag(nb);
+        for(int li= 0;li<nb;li++)
+          diag[li]= block[li*nb+li];
+        if(!invert(block,nb))
+          {
+            std::fill(block.begin(),block.end(),0.0);
+            for(int li= 0;li<nb;li++)
+              block[li*nb+li]= (diag[li]!=0.0 ? 1.0/diag[li] : 0.0);
+          }
+        for(int li= 0;li<nb;li++)
+          {
+            const int row= L.nodeDofs[first+li];
+            int pos= D.ptr[row];
+            for(int lj= 0;lj<nb;lj++,pos++)
+              {
+                D.idx[pos]= L.nodeDofs[first+lj];
+                D.val[pos]= block[lj*nb+li];
+              }
+          }
+      }
+  }
+
+//! @brief Estimates the spectral radius of \f$D^{-1} A\f$ by power
+//! iteration.
+double XC::AlgebraicMultigrid::estimate_spectral_radius(Level &L)
+  {
+    const int n= L.A.nRows;
+    std::vector<double> x(n), y, z;
+    for(int i= 0;i<n;i++)
+      x[i]= 1.0+0.1*(i%7);
+    double retval= 1.0;
+    double nx= sqrt(dot(x,x));
+    for(int it= 0;(it<15) && (nx>0.0);it++)
+      {
+        for(int i= 0;i<n;i++)
+          x[i]/= nx;
+        spmv(L.A,x,y);
+        spmv(L.Dinv,y,z);
+        nx= sqrt(dot(z,z));
+        retval= nx;
+        x.swap(z);
+      }
+    return std::max(retval,1e-12);
+  }
+
+//! @brief Aggregates the nodes of the level using the strength of the
+//! connections between the nodal blocks of the matrix. Returns the
+//! aggregate of each node (-1 if the node is not aggregated).
+std::vector<int> XC::AlgebraicMultigrid::aggregate(const Level &L, int &numAgg) const
+  {
+    const CSRMatrix &A= L.A;
+    const int n= A.nRows;
+    const int nn= L.nodePtr.size()-1;
+    std::vector<int> dofNode, dofPos;
+    get_dof_nodes(L.nodePtr,L.nodeDofs,n,dofNode,dofPos);
+    // Frobenius norms of the nodal blocks.
+    std::vector<double> diagNorm(nn,0.0);
+    std::vector<int> strongPtr(1,0);
+    std::vector<int> strongIdx;
+    std::vector<double> strongVal;
+    std::vector<double> acc(nn,0.0);
+    std::vector<int> marker(nn,-1);
+    std::vector<int> neighbors;
+    for(int pass= 0;pass<2;pass++)
+      {
+        marker.assign(nn,-1);
+        for(int I= 0;I<nn;I++)
+          {
+            neighbors.clear();
+            for(int k= L.nodePtr[I];k<L.nodePtr[I+1];k++)
+              {
+                const int row= L.nodeDofs[k];
+                for(int p= A.ptr[row];p<A.ptr[row+1];p++)
+                  {
+                    const int J= dofNode[A.idx[p]];
+                    if(marker[J]!=I)
+                      {
+                        marker[J]= I;
+                        acc[J]= 0.0;
+                        neighbors.push_back(J);
+                      }
+                    acc[J]+= A.val[p]*A.val[p];
+                  }
+              }
+            if(pass==0)
+              {
+                diagNorm[I]= (marker[I]==I ? sqrt(acc[I]) : 0.0);
+              }
+            else
+              {
+                for(std::vector<int>::const_iterator j= neighbors.begin();j!=neighbors.end();j++)
+                  {
+                    const int J= *j;
+                    if(J==I)
+                      continue;
+                    const double s= sqrt(acc[J]);
+                    if(s>strengthThreshold*sqrt(diagNorm[I]*diagNorm[J]))
+                      {
+                        strongIdx.push_back(J);
+                        strongVal.push_back(s);
+                      }
+                  }
+                strongPtr.push_back(strongIdx.size());
+              }
+          }
+      }
+    std::vector<int> agg(nn,-1);
+    numAgg= 0;
+    // phase 1: nodes whose strong neighbors are not aggregated.
+    for(int I= 0;I<nn;I++)
+      {
+        if(agg[I]>=0 || (strongPtr[I+1]==strongPtr[I]))
+          continue;
+        bool free= true;
+        for(int k= strongPtr[I];k<strongPtr[I+1];k++)
+          if(agg[strongIdx[k]]>=0)
+            { free= false; break; }
+        if(free)
+          {
+            agg[I]= numAgg;
+            for(int k= strongPtr[I];k<strongPtr[I+1];k++)
+              agg[strongIdx[k]]= numAgg;
+            numAgg++;
+          }
+      }
+    // phase 2: join the aggregate of the strongest neighbor.
+    const std::vector<int> phase1(agg);
+    for(int I= 0;I<nn;I++)
+      if(agg[I]<0)
+        {
+          double best= -1.0;
+          for(int k= strongPtr[I];k<strongPtr[I+1];k++)
+            {
+              const int J= strongIdx[k];
+              if((phase1[J]>=0) && (strongVal[k]>best))
+                {
+                  best= strongVal[k];
+                  agg[I]= phase1[J];
+                }
+            }
+        }
+    // phase 3: the remaining nodes form new aggregates.
+    for(int I= 0;I<nn;I++)
+      if(agg[I]<0)
+        {
+          agg[I]= numAgg;
+          for(int k= strongPtr[I];k<strongPtr[I+1];k++)
+            if(agg[strongIdx[k]]<0)
+              agg[strongIdx[k]]= numAgg;
+          numAgg++;
+        }
+    return agg;
+  }
+
+//! @brief Computes the tentative prolongator of the level (stored in
+//! L.P) and the nodal blocks and the near null space of the coarse
+//! level. Returns the number of coarse equations.
+//!
+//! For each aggregate, the rows of the near null space corresponding
+//! to its equations are orthonormalized (modified Gram-Schmidt, linearly
+//! dependent vectors are dropped); the orthonormal vectors are the
+//! columns of the prolongator and the triangular factor gives the
+//! near null space of the coarse level.
+int XC::AlgebraicMultigrid::tentative_prolongator(Level &L, const std::vector<int> &agg, const int &numAgg, Level &coarse)
+  {
+    const int n= L.A.nRows;
+    const int nn= L.nodePtr.size()-1;
+    const int m= numModes;
+    std::vector<int> aggPtr(numAgg+1,0);
+    for(int I= 0;I<nn;I++)
+      aggPtr[agg[I]+1]+= L.nodePtr[I+1]-L.nodePtr[I];
+    for(int a= 0;a<numAgg;a++)
+      aggPtr[a+1]+= aggPtr[a];
+    std::vector<int> aggDofs(aggPtr[numAgg]);
+    std::vector<int> next(aggPtr.begin(),aggPtr.end()-1);
+    for(int I= 0;I<nn;I++)
+      for(int k= L.nodePtr[I];k<L.nodePtr[I+1];k++)
+        aggDofs[next[agg[I]]++]= L.nodeDofs[k];
+
+    CSRMatrix &P= L.P;
+    P= CSRMatrix();
+    P.nRows= n;
+    std::vector<std::vector<int> > rowCols(n);
+    std::vector<std::vector<double> > rowVals(n);
+    coarse.nodePtr.assign(1,0);
+    coarse.nodeDofs.clear();
+    coarse.B.clear();
+    int nc= 0;
+    std::vector<double> q, r(m*m);
+    for(int a= 0;a<numAgg;a++)
+      {
+        const int first= aggPtr[a];
+        const int nd= aggPtr[a+1]-first;
+        q.clear();
+        std::fill(r.begin(),r.end(),0.0);
+        int kept= 0;
+        std::vector<double> v(nd);
+        for(int c= 0;c<m;c++)
+          {
+            double norm0= 0.0;
+            for(int i= 0;i<nd;i++)
+              {
+                v[i]= L.B[aggDofs[first+i]*m+c];
+                norm0+= v[i]*v[i];
+              }
+            norm0= sqrt(norm0);
+            if(norm0==0.0)
+              continue;
+            for(int kk= 0;kk<kept;kk++)
+              {
+                double s= 0.0;
+                for(int i= 0;i<nd;i++)
+                  s+= q[kk*nd+i]*v[i];
+                for(int i= 0;i<nd;i++)
+                  v[i]-= s*q[kk*nd+i];
+                r[kk*m+c]= s;
+              }
+            double norm= 0.0;
+            for(int i= 0;i<nd;i++)
+              norm+= v[i]*v[i];
+            norm= sqrt(norm);
+            if(norm>1e-8*norm0)
+              {
+                for(int i= 0;i<nd;i++)
+                  q.push_back(v[i]/norm);
+                r[kept*m+c]= norm;
+                kept++;
+              }
+          }
+        for(int kk= 0;kk<kept;kk++)
+          {
+            for(int i= 0;i<nd;i++)
+              {
+                const double value= q[kk*nd+i];
+                if(value!=0.0)
+                  {
+                    rowCols[aggDofs[first+i]].push_back(nc+kk);
+                    rowVals[aggDofs[first+i]].push_back(value);
+                  }
+              }
+            coarse.nodeDofs.push_back(nc+kk);
+            coarse.B.insert(coarse.B.end(),&r[kk*m],&r[kk*m]+m);
+          }
+        if(kept>0)
+          coarse.nodePtr.push_back(coarse.nodeDofs.size());
+        nc+= kept;
+      }
+    P.nCols= nc;
+    P.ptr.assign(n+1,0);
+    for(int i= 0;i<n;i++)
+      {
+        P.ptr[i+1]= P.ptr[i]+rowCols[i].size();
+        P.idx.insert(P.idx.end(),rowCols[i].begin(),rowCols[i].end());
+        P.val.insert(P.val.end(),rowVals[i].begin(),rowVals[i].end());
+      }
+    return nc;
+  }
+
+//! @brief Computes the LU factorization of the matrix of the
+//! coarsest level (if it is not too big, otherwise the coarsest
+//! level is smoothed).
+int XC::AlgebraicMultigrid::factor_coarsest(void)
+  {
+    const CSRMatrix &A= levels.back().A;
+    int n= A.nRows;
+    coarseLU.clear();
+    coarsePiv.clear();
+    if((n==0) || (n>4*coarseSize))
+      return 0;
+    coarseLU.assign(size_t(n)*n,0.0);
+    coarsePiv.resize(n);
+    for(int i= 0;i<n;i++)
+      for(int k= A.ptr[i];k<A.ptr[i+1];k++)
+        coarseLU[size_t(A.idx[k])*n+i]+= A.val[k];
+    int info= 0;
+    dgetrf_(&n,&n,coarseLU.data(),&n,coarsePiv.data(),&info);
+    if(info!=0)
+      {
+        std::cerr << "AlgebraicMultigrid::" << __FUNCTION__
+		  << "; the matrix of the coarsest level is singular"
+		  << " (info= " << info << ")." << std::endl;
+        coarseLU.clear();
+        coarsePiv.clear();
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Builds the hierarchy (aggregation, prolongators and coarse
+//! matrices).
+int XC::AlgebraicMultigrid::setup(void)
+  {
+    levels.resize(1);
+    for(size_t l= 0;;l++)
+      {
+        Level &L= levels[l];
+        form_block_inverse(L);
+        L.omega= 4.0/(3.0*estimate_spectral_radius(L));
+        L.x.assign(L.A.nRows,0.0);
+        L.b.assign(L.A.nRows,0.0);
+        L.r.assign(L.A.nRows,0.0);
+        L.P= CSRMatrix();
+        L.R= CSRMatrix();
+        if((L.A.nRows<=coarseSize) || (int(l)+1>=maxNumLevels))
+          break;
+        int numAgg= 0;
+        const std::vector<int> agg= aggregate(L,numAgg);
+        const int nn= L.nodePtr.size()-1;
+        if((numAgg==0) || (numAgg>=nn))
+          break;
+        Level coarse;
+        const int nc= tentative_prolongator(L,agg,numAgg,coarse);
+        if((nc==0) || (nc>0.9*L.A.nRows))
+          {
+            L.P= CSRMatrix();
+            break;
+          }
+        // smoothed prolongator: P= (I - omega D^-1 A) Pt.
+        const CSRMatrix Pt= L.P;
+        L.P= add(Pt,multiply(L.Dinv,multiply(L.A,Pt)),-L.omega);
+        L.R= transpose(L.P);
+        coarse.A= multiply(L.R,multiply(L.A,L.P));
+        levels.push_back(coarse);
+      }
+    const int retval= factor_coarsest();
+    validHierarchy= (retval==0);
+    newValues= false;
+    numSetups++;
+    return retval;
+  }
+
+//! @brief Recomputes the coarse matrices and the smoothers reusing the
+//! prolongators (used when the matrix values change but its sparsity
+//! pattern doesn't).
+int XC::AlgebraicMultigrid::update(void)
+  {
+    for(size_t l= 0;l<levels.size();l++)
+      {
+        Level &L= levels[l];
+        form_block_inverse(L);
+        L.omega= 4.0/(3.0*estimate_spectral_radius(L));
+        if(l+1<levels.size())
+          levels[l+1].A= multiply(L.R,multiply(L.A,L.P));
+      }
+    const int retval= factor_coarsest();
+    validHierarchy= (retval==0);
+    newValues= false;
+    numUpdates++;
+    return retval;
+  }
+
+//! @brief Damped nodal block Jacobi sweeps: \f$x+= \omega D^{-1}(b-A x)\f$.
+void XC::AlgebraicMultigrid::smooth(Level &L, const int &sweeps)
+  {
+    const CSRMatrix &D= L.Dinv;
+    const double omega= L.omega;
+    for(int s= 0;s<sweeps;s++)
+      {
+        residual(L.A,L.x,L.b,L.r);
+        parallel_for(D.nRows,getThreadCount(numThreads),[&](size_t first,size_t last,size_t)
+          {
+            for(size_t i= first;i<last;i++)
+              {
+                double z= 0.0;
+                for(int k= D.ptr[i];k<D.ptr[i+1];k++)
+                  z+= D.val[k]*L.r[D.idx[k]];
+                L.x[i]+= omega*z;
+              }
+          });
+      }
+  }
+
+//! @brief V-cycle starting at level l (solves \f$A_l x_l= b_l\f$
+//! approximately).
+void XC::AlgebraicMultigrid::vcycle(const size_t &l)
+  {
+    Level &L= levels[l];
+    std::fill(L.x.begin(),L.x.end(),0.0);
+    if(l+1==levels.size())
+      {
+        if(!coarseLU.empty())
+          {
+            int n= L.A.nRows;
+            int nrhs= 1;
+            int info= 0;
+            char strN[]= "N";
+            L.x= L.b;
+            dgetrs_(strN,&n,&nrhs,coarseLU.data(),&n,coarsePiv.data(),L.x.data(),&n,&info);
+          }
+        else
+          smooth(L,2*numSweeps);
+        return;
+      }
+    smooth(L,numSweeps);
+    residual(L.A,L.x,L.b,L.r);
+    Level &C= levels[l+1];
+    spmv(L.R,L.r,C.b);
+    vcycle(l+1);
+    const CSRMatrix &P= L.P;
+    parallel_for(P.nRows,getThreadCount(numThreads),[&](size_t first,size_t last,size_t)
+      {
+        for(size_t i= first;i<last;i++)
+          {
+            double s= 0.0;
+            for(int k= P.ptr[i];k<P.ptr[i+1];k++)
+              s+= P.val[k]*C.x[P.idx[k]];
+            L.x[i]+= s;
+          }
+      });
+    smooth(L,numSweeps);
+  }
+
+//! @brief Applies the preconditioner (one V-cycle): z= M^-1 r.
+void XC::AlgebraicMultigrid::precondition(const std::vector<double> &r, std::vector<double> &z)
+  {
+    levels[0].b= r;
+    vcycle(0);
+    z= levels[0].x;
+  }
+
+//! @brief Preconditioned conjugate gradient method.
+int XC::AlgebraicMultigrid::cg(const double *bPtr, double *xPtr)
+  {
+    const CSRMatrix &A= levels[0].A;
+    const int n= A.nRows;
+    std::vector<double> x(n,0.0), r(bPtr,bPtr+n), z, p, Ap;
+    const double normB= sqrt(dot(r,r));
+    numIter= 0;
+    residualNorm= 0.0;
+    if(normB==0.0)
+      {
+        std::fill(xPtr,xPtr+n,0.0);
+        return 0;
+      }
+    precondition(r,z);
+    p= z;
+    double rz= dot(r,z);
+    residualNorm= 1.0;
+    int retval= 0;
+    const size_t nt= getThreadCount(numThreads);
+    while(residualNorm>tolerance)
+      {
+        if(numIter>=maxNumIter)
+          { retval= -1; break; }
+        spmv(A,p,Ap);
+        const double pAp= dot(p,Ap);
+        if(pAp<=0.0)
+          {
+            std::cerr << "AlgebraicMultigrid::" << __FUNCTION__
+		      << "; the system matrix is not positive definite,"
+		      << " use GMRES." << std::endl;
+            retval= -2;
+            break;
+          }
+        const double alpha= rz/pAp;
+        parallel_for(n,nt,[&](size_t first,size_t last,size_t)
+          {
+            for(size_t i= first;i<last;i++)
+              {
+                x[i]+= alpha*p[i];
+                r[i]-= alpha*Ap[i];
+              }
+          });
+        numIter++;
+        residualNorm= sqrt(dot(r,r))/normB;
+        precondition(r,z);
+        const double rzOld= rz;
+        rz= dot(r,z);
+        const double beta= rz/rzOld;
+        parallel_for(n,nt,[&](size_t first,size_t last,size_t)
+          {
+            for(size_t i= first;i<last;i++)
+              p[i]= z[i]+beta*p[i];
+          });
+      }
+    std::copy(x.begin(),x.end(),xPtr);
+    return retval;
+  }
+
+//! @brief Right preconditioned restarted GMRES method.
+int XC::AlgebraicMultigrid::gmres(const double *bPtr, double *xPtr)
+  {
+    const CSRMatrix &A= levels[0].A;
+    const int n= A.nRows;
+    const int m= restart;
+    std::vector<double> x(n,0.0), r(bPtr,bPtr+n), w;
+    const double normB= sqrt(dot(r,r));
+    numIter= 0;
+    residualNorm= 0.0;
+    if(normB==0.0)
+      {
+        std::fill(xPtr,xPtr+n,0.0);
+        return 0;
+      }
+    std::vector<std::vector<double> > V(m+1), Z(m);
+    std::vector<double> H((m+1)*m), cs(m), sn(m), g(m+1), y(m);
+    const size_t nt= getThreadCount(numThreads);
+    double beta= normB;
+    residualNorm= 1.0;
+    int retval= 0;
+    while(residualNorm>tolerance)
+      {
+        if(numIter>=maxNumIter)
+          { retval= -1; break; }
+        V[0].resize(n);
+        for(int i= 0;i<n;i++)
+          V[0][i]= r[i]/beta;
+        std::fill(g.begin(),g.end(),0.0);
+        g[0]= beta;
+        int k= 0;
+        for(;(k<m) && (numIter<maxNumIter);k++)
+          {
+            precondition(V[k],Z[k]);
+            spmv(A,Z[k],w);
+            for(int i= 0;i<=k;i++)
+              {
+                const double h= dot(w,V[i]);
+                H[k*(m+1)+i]= h;
+                const std::vector<double> &vi= V[i];
+                parallel_for(n,nt,[&](size_t first,size_t last,size_t)
+                  {
+                    for(size_t j= first;j<last;j++)
+                      w[j]-= h*vi[j];
+                  });
+              }
+            const double hn= sqrt(dot(w,w));
+            H[k*(m+1)+k+1]= hn;
+            V[k+1].resize(n);
+            for(int j= 0;j<n;j++)
+              V[k+1][j]= (hn!=0.0 ? w[j]/hn : 0.0);
+            // apply the previous rotations.
+            for(int i= 0;i<k;i++)
+              {
+                const double a= H[k*(m+1)+i];
+                const double b= H[k*(m+1)+i+1];
+                H[k*(m+1)+i]= cs[i]*a+sn[i]*b;
+                H[k*(m+1)+i+1]= -sn[i]*a+cs[i]*b;
+              }
+            const double a= H[k*(m+1)+k];
+            const double b= H[k*(m+1)+k+1];
+            const double d= sqrt(a*a+b*b);
+            cs[k]= (d!=0.0 ? a/d : 1.0);
+            sn[k]= (d!=0.0 ? b/d : 0.0);
+            H[k*(m+1)+k]= d;
+            H[k*(m+1)+k+1]= 0.0;
+            g[k+1]= -sn[k]*g[k];
+            g[k]= cs[k]*g[k];
+            numIter++;
+            residualNorm= std::abs(g[k+1])/normB;
+            if((residualNorm<=tolerance) || (hn==0.0))
+              { k++; break; }
+          }
+        // solve the triangular system and update x.
+        for(int i= k-1;i>=0;i--)
+          {
+            double s= g[i];
+            for(int j= i+1;j<k;j++)
+              s-= H[j*(m+1)+i]*y[j];
+            y[i]= (H[i*(m+1)+i]!=0.0 ? s/H[i*(m+1)+i] : 0.0);
+          }
+        for(int i= 0;i<k;i++)
+          {
+            const double yi= y[i];
+            const std::vector<double> &zi= Z[i];
+            parallel_for(n,nt,[&](size_t first,size_t last,size_t)
+              {
+                for(size_t j= first;j<last;j++)
+                  x[j]+= yi*zi[j];
+              });
+          }
+        residual(A,x,std::vector<double>(bPtr,bPtr+n),r);
+        beta= sqrt(dot(r,r));
+        residualNorm= beta/normB;
+        if(beta==0.0)
+          break;
+      }
+    std::copy(x.begin(),x.end(),xPtr);
+    return retval;
+  }
+
+//! @brief Solves the system with the matrix values set by setValues.
+//!
+//! Builds the hierarchy if needed (or updates it if the matrix values
+//! have changed) and calls the Krylov method. Returns -1 if the
+//! method doesn't converge.
+int XC::AlgebraicMultigrid::amg_solve(const double *b, double *x)
+  {
+    const int n= levels[0].A.nRows;
+    if(n==0)
+      return 0;
+    int retval= 0;
+    bool fullSetup= false;
+    if(!validHierarchy || (newValues && !reuseHierarchy))
+      {
+        retval= setup();
+        fullSetup= true;
+      }
+    else if(newValues)
+      retval= update();
+    if(retval!=0)
+      return retval;
+    if(krylov=="gmres")
+      retval= gmres(b,x);
+    else
+      retval= cg(b,x);
+    if(retval==-1)
+      std::cerr << "AlgebraicMultigrid::" << __FUNCTION__
+	        << "; WARNING - no convergence after "
+		<< numIter << " iterations, relative residual: "
+		<< residualNorm << std::endl;
+    if(fullSetup)
+      setupNumIter= numIter;
+    else if((rebuildFactor>0.0) && (numIter>rebuildFactor*std::max(setupNumIter,1)))
+      validHierarchy= false; // aggregate again in the next solution.
+    return retval;
+  }
@@ -0,0 +1,240 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AlgebraicMultigrid.h
+
+#ifndef AlgebraicMultigrid_h
+#define AlgebraicMultigrid_h
+
+#include <vector>
+#include <string>
+#include <algorithm>
+
+namespace XC {
+class AnalysisModel;
+
+//! @ingroup LinearSolver
+//
+//! @brief Smoothed aggregation algebraic multigrid preconditioned
+//! iterative solver (CG or GMRES).
+//!
+//! The hierarchy of coarse systems is built from the sparse matrix
+//! of the system and from its nodal block structure (the equations
+//! of each DOF_Group):
+//! - The nodes are aggregated using the strength of the connections
+//!   between the nodal blocks of the matrix.
+//! - The tentative prolongator interpolates the rigid body modes of
+//!   the nodes (or the constant vectors for each DOF component if
+//!   the number of DOFs of the node doesn't correspond to a
+//!   translation/rotation set) and is smoothed with one step of
+//!   damped block Jacobi.
+//! - The coarse matrices are computed as \f$A_c= P^t A P\f$ and the
+//!   coarsest one is factored with LAPACK.
+//!
+//! The V-cycle uses symmetric damped nodal block Jacobi smoothing, so
+//! it can be used as preconditioner for the conjugate gradient
+//! method when the matrix is symmetric positive definite; GMRES can
+//! be used otherwise. When the matrix values change but its
+//! sparsity doesn't (i.e. Newton iterations), the prolongators are
+//! reused and only the coarse matrices and the smoothers are
+//! recomputed; the aggregation is repeated when the number of
+//! iterations grows beyond rebuildFactor times the number of
+//! iterations obtained just after the last full setup.
+//!
+//! The sparse matrix products, the smoothing and the Krylov
+//! vector operations are computed by the threads of the shared
+//! ThreadPool (the partial sums of each thread are added in thread
+//! order so the results are deterministic for a given number of
+//! threads).
+class AlgebraicMultigrid
+  {
+  public:
+    //! @brief Sparse matrix in compressed row storage.
+    struct CSRMatrix
+      {
+        int nRows; //!< number of rows.
+        int nCols; //!< number of columns.
+        std::vector<int> ptr; //!< first entry of each row.
+        std::vector<int> idx; //!< column of each entry.
+        std::vector<double> val; //!< value of each entry.
+        CSRMatrix(void)
+          : nRows(0), nCols(0), ptr(1,0) {}
+        inline size_t nnz(void) const
+          { return idx.size(); }
+      };
+  private:
+    //! @brief Level of the multigrid hierarchy.
+    struct Level
+      {
+        CSRMatrix A; //!< matrix of the level.
+        CSRMatrix P; //!< prolongator from the next (coarser) level.
+        CSRMatrix R; //!< restriction to the next level (transpose of P).
+        CSRMatrix Dinv; //!< inverse of the nodal diagonal blocks of A.
+        std::vector<int> nodePtr; //!< first position of each node in nodeDofs.
+        std::vector<int> nodeDofs; //!< equations of the nodes.
+        std::vector<double> B; //!< near null space (row major, numModes columns).
+        double omega; //!< damping factor of the smoother.
+        std::vector<double> x, b, r; //!< work vectors.
+        Level(void)
+          : omega(0.0) {}
+      };
+    std::vector<Level> levels; //!< levels of the hierarchy (the first one is the finest).
+    std::vector<double> coarseLU; //!< LU factorization of the coarsest matrix.
+    std::vector<int> coarsePiv; //!< pivots of the LU factorization.
+    std::vector<int> valueMap; //!< position in the CSR matrix of each entry of the system matrix.
+    int numModes; //!< number of near null space vectors.
+    bool validHierarchy; //!< true if the prolongators can be reused.
+    bool newValues; //!< true if the matrix values have changed since the last setup.
+    int setupNumIter; //!< iterations of the first solution after the last full setup.
+
+    double dot(const std::vector<double> &, const std::vector<double> &);
+    void spmv(const CSRMatrix &, const std::vector<double> &, std::vector<double> &);
+    void residual(const CSRMatrix &, const std::vector<double> &, const std::vector<double> &, std::vector<double> &);
+    CSRMatrix multiply(const CSRMatrix &, const CSRMatrix &);
+    static CSRMatrix transpose(const CSRMatrix &);
+    void form_block_inverse(Level &);
+    double estimate_spectral_radius(Level &);
+    std::vector<int> aggregate(const Level &, int &) const;
+    int tentative_prolongator(Level &, const std::vector<int> &, const int &, Level &);
+    int factor_coarsest(void);
+    int setup(void);
+    int update(void);
+    void smooth(Level &, const int &);
+    void vcycle(const size_t &);
+    void precondition(const std::vector<double> &, std::vector<double> &);
+    int cg(const double *, double *);
+    int gmres(const double *, double *);
+  protected:
+    std::string krylov; //!< Krylov method (cg or gmres).
+    double tolerance; //!< tolerance for the norm of the residual relative to the norm of b.
+    int maxNumIter; //!< maximum number of iterations.
+    int restart; //!< number of GMRES iterations between restarts.
+    int maxNumLevels; //!< maximum number of levels of the hierarchy.
+    int coarseSize; //!< systems smaller than this size are solved by LU factorization.
+    double strengthThreshold; //!< threshold for the strength of the connections between nodes.
+    int numSweeps; //!< number of pre and post smoothing sweeps.
+    bool reuseHierarchy; //!< if true reuse the prolongators when the matrix values change.
+    double rebuildFactor; //!< the aggregation is repeated when the number of iterations grows beyond this factor.
+    int numThreads; //!< number of threads (0: hardware concurrency).
+    int numIter; //!< number of iterations of the last solution.
+    double residualNorm; //!< relative norm of the residual at the end of the last solution.
+    size_t numSetups; //!< number of full setups of the hierarchy.
+    size_t numUpdates; //!< number of setups reusing the prolongators.
+
+    AlgebraicMultigrid(void);
+    void setPattern(const int &, const int *, const int *, const bool &);
+    void setNodalBlocks(AnalysisModel *);
+    void setValues(const double *);
+    int amg_solve(const double *, double *);
+  public:
+    virtual ~AlgebraicMultigrid(void) {}
+    void setKrylov(const std::string &);
+    const std::string &getKrylov(void) const;
+    //! @brief Return the tolerance for the norm of the residual relative
+    //! to the norm of the right hand side.
+    inline double getTolerance(void) const
+      { return tolerance; }
+    //! @brief Set the tolerance for the norm of the residual relative
+    //! to the norm of the right hand side.
+    inline void setTolerance(const double &d)
+      { tolerance= d; }
+    //! @brief Return the maximum number of iterations.
+    inline int getMaxNumIter(void) const
+      { return maxNumIter; }
+    //! @brief Set the maximum number of iterations.
+    inline void setMaxNumIter(const int &i)
+      { maxNumIter= i; }
+    //! @brief Return the number of GMRES iterations between restarts.
+    inline int getRestart(void) const
+      { return restart; }
+    //! @brief Set the number of GMRES iterations between restarts.
+    inline void setRestart(const int &i)
+      { restart= std::max(i,1); }
+    //! @brief Return the maximum number of levels of the hierarchy.
+    inline int getMaxNumLevels(void) const
+      { return maxNumLevels; }
+    //! @brief Set the maximum number of levels of the hierarchy.
+    inline void setMaxNumLevels(const int &i)
+      { maxNumLevels= std::max(i,1); validHierarchy= false; }
+    //! @brief Return the size under which the systems are solved
+    //! by LU factorization.
+    inline int getCoarseSize(void) const
+      { return coarseSize; }
+    //! @brief Set the size under which the systems are solved
+    //! by LU factorization.
+    inline void setCoarseSize(const int &i)
+      { coarseSize= std::max(i,1); validHierarchy= false; }
+    //! @brief Return the threshold for the strength of the connections.
+    inline double getStrengthThreshold(void) const
+      { return strengthThreshold; }
+    //! @brief Set the threshold for the strength of the connections.
+    inline void setStrengthThreshold(const double &d)
+      { strengthThreshold= d; validHierarchy= false; }
+    //! @brief Return the number of pre and post smoothing sweeps.
+    inline int getNumSweeps(void) const
+      { return numSweeps; }
+    //! @brief Set the number of pre and post smoothing sweeps.
+    inline void setNumSweeps(const int &i)
+      { numSweeps= std::max(i,1); }
+    //! @brief Return true if the prolongators are reused when the
+    //! matrix values change.
+    inline bool getReuseHierarchy(void) const
+      { return reuseHierarchy; }
+    //! @brief Set if the prolongators are reused when the
+    //! matrix values change.
+    inline void setReuseHierarchy(const bool &b)
+      { reuseHierarchy= b; }
+    //! @brief Return the factor that triggers a new aggregation.
+    inline double getRebuildFactor(void) const
+      { return rebuildFactor; }
+    //! @brief Set the factor that triggers a new aggregation.
+    inline void setRebuildFactor(const double &d)
+      { rebuildFactor= d; }
+    void setNumThreads(const int &);
+    int getNumThreads(void) const;
+    //! @brief Return the number of iterations of the last solution.
+    inline int getNumIter(void) const
+      { return numIter; }
+    //! @brief Return the relative norm of the residual at the end of
+    //! the last solution.
+    inline double getResidualNorm(void) const
+      { return residualNorm; }
+    //! @brief Return the number of full setups of the hierarchy.
+    inline size_t getNumSetups(void) const
+      { return numSetups; }
+    //! @brief Return the number of setups that reused the prolongators.
+    inline size_t getNumUpdates(void) const
+      { return numUpdates; }
+    //! @brief Force a full setup of the hierarchy in the next solution.
+    inline void rebuildHierarchy(void)
+      { validHierarchy= false; }
+    int getNumLevels(void) const;
+    int getLevelSize(const int &) const;
+    double getOperatorComplexity(void) const;
+  };
+} // end of XC namespace
+
+#endif
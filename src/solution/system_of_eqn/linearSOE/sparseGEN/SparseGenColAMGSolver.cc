@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseGenColAMGSolver.cc
+
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColAMGSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColLinSOE.h>
+
+//! @brief Constructor.
+XC::SparseGenColAMGSolver::SparseGenColAMGSolver(void)
+  : SparseGenColLinSolver(SOLVER_TAGS_SparseGenColAMGSolver), AlgebraicMultigrid() {}
+
+//! @brief Passes the sparsity pattern of the system and the nodal
+//! blocks of the model to the preconditioner. It's called when the
+//! structure of the system of equations changes.
+int XC::SparseGenColAMGSolver::setSize(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set.\n";
+	return -1;
+      }
+    const int n= theSOE->size;
+    setPattern(n,theSOE->colStartA.getDataPtr(),theSOE->rowA.getDataPtr(),true);
+    setNodalBlocks(theSOE->getAnalysisModelPtr());
+    return 0;
+  }
+
+//! @brief Solve the system.
+//!
+//! If the system is not marked as factored (its matrix has been
+//! assembled again) the new values are passed to the preconditioner
+//! that updates its hierarchy before the Krylov iterations.
+int XC::SparseGenColAMGSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set.\n";
+	return -1;
+      }
+    const int n= theSOE->size;
+    if(n==0)
+      return 0;
+    if(n!=getLevelSize(0))
+      {
+        const int ok= setSize();
+        if(ok<0)
+          return ok;
+      }
+    if(theSOE->factored == false)
+      {
+        setValues(theSOE->A.getDataPtr());
+        theSOE->factored= true;
+      }
+    return amg_solve(theSOE->getPtrB(),theSOE->getPtrX());
+  }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::SparseGenColAMGSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::SparseGenColAMGSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -122,6 +122,7 @@ bool XC::SparseGenColLinSOE::setSolver(LinearSOESolver *newSolver)
 int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
+    clearScatterMap(); // A may be reallocated.
     size= checkSize(theGraph);
 
     // fist iterate through the vertices of the graph to get nnz
@@ -197,6 +198,7 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
 	    startLoc = lastLoc;
           }
       }
+    buildScatterMap();
     // invoke setSize() on the Solver    
     LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -210,6 +212,21 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Return the address of the term \f$a_{row,col}\f$ in A
+//! (nullptr if it's not stored).
+double *XC::SparseGenColLinSOE::getEntryPtr(const int &row, const int &col)
+  {
+    double *retval= nullptr;
+    const int endColLoc= colStartA(col+1);
+    for(int k= colStartA(col);k<endColLoc;k++)
+      if(rowA(k) == row)
+        {
+          retval= &A[k];
+          break;
+        }
+    return retval;
+  }
+
 //! @brief Assemblies the product fact*m into the system matrix.
 //!
 //! First tests that \p loc and \p M are of compatable sizes; if not
@@ -137,6 +137,7 @@ class SparseGenColLinSOE : public SparseGenSOEBase
     ID colStartA;//!< int arrays containing info about coeficientss in A
   protected:
     virtual bool setSolver(LinearSOESolver *);
+    virtual double *getEntryPtr(const int &, const int &);
 
     friend class AnalysisAggregation;
     friend class FEM_ObjectBroker;
@@ -156,6 +157,8 @@ class SparseGenColLinSOE : public SparseGenSOEBase
 #else
     friend class SuperLU;    
 #endif
+    friend class SupernodalCholeskySolver;
+    friend class SparseGenColAMGSolver;
 
   };
 inline SystemOfEqn *SparseGenColLinSOE::getCopy(void) const
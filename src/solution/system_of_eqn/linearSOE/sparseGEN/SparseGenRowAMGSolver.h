@@ -0,0 +1,66 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseGenRowAMGSolver.h
+
+#ifndef SparseGenRowAMGSolver_h
+#define SparseGenRowAMGSolver_h
+
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseGEN/AlgebraicMultigrid.h>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Algebraic multigrid preconditioned iterative solver for
+//! systems stored in a SparseGenRowLinSOE.
+//!
+//! The hierarchy is built the first time the system is solved and,
+//! while the sparsity pattern doesn't change, it's updated (not
+//! rebuilt) each time the matrix is assembled again (i.e. between
+//! Newton iterations). The equations of each DOF_Group are treated
+//! as a nodal block.
+class SparseGenRowAMGSolver: public SparseGenRowLinSolver, public AlgebraicMultigrid
+  {
+  protected:
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    SparseGenRowAMGSolver(void);
+    virtual LinearSOESolver *getCopy(void) const;
+  public:
+    int solve(void);
+    int setSize(void);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline LinearSOESolver *SparseGenRowAMGSolver::getCopy(void) const
+   { return new SparseGenRowAMGSolver(*this); }
+} // end of XC namespace
+
+#endif
@@ -83,6 +83,7 @@ bool XC::SparseGenRowLinSOE::setSolver(LinearSOESolver *newSolver)
 int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
+    clearScatterMap(); // A may be reallocated.
     size= checkSize(theGraph);
 
     // fist iterate through the vertices of the graph to get nnz
@@ -157,6 +158,7 @@ int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
 	startLoc = lastLoc;
       }
     }
+    buildScatterMap();
     
     // invoke setSize() on the XC::Solver   
      LinearSOESolver *the_Solver = this->getSolver();
@@ -169,6 +171,21 @@ int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
     return result;
 }
 
+//! @brief Return the address of the term \f$a_{row,col}\f$ in A
+//! (nullptr if it's not stored).
+double *XC::SparseGenRowLinSOE::getEntryPtr(const int &row, const int &col)
+  {
+    double *retval= nullptr;
+    const int endRowLoc= rowStartA(row+1);
+    for(int k= rowStartA(row);k<endRowLoc;k++)
+      if(colA(k) == col)
+        {
+          retval= &A[k];
+          break;
+        }
+    return retval;
+  }
+
 int 
 XC::SparseGenRowLinSOE::addA(const XC::Matrix &m, const XC::ID &id, double fact)
 {
@@ -77,6 +77,7 @@ class SparseGenRowLinSOE : public SparseGenSOEBase
     ID rowStartA; //!< int arrays containing info about coeficientss in A
   protected:
     virtual bool setSolver(LinearSOESolver *);
+    virtual double *getEntryPtr(const int &, const int &);
 
     friend class AnalysisAggregation;
     SparseGenRowLinSOE(AnalysisAggregation *);        
@@ -88,6 +89,7 @@ class SparseGenRowLinSOE : public SparseGenSOEBase
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
     friend class PetscSparseSeqSolver;    
+    friend class SparseGenRowAMGSolver;
   };
 inline SystemOfEqn *SparseGenRowLinSOE::getCopy(void) const
   { return new SparseGenRowLinSOE(*this); }
@@ -0,0 +1,552 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalCholeskySolver.cc
+
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SupernodalCholeskySolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/sparseGEN/sparse_ordering.h>
+#include "utility/threads/parallel_loop.h"
+#include <algorithm>
+
+extern "C" int dpotrf_(char *UPLO, int *N, double *A, int *LDA, int *INFO);
+
+extern "C" int dtrsm_(char *SIDE, char *UPLO, char *TRANSA, char *DIAG,
+		      int *M, int *N, double *ALPHA, double *A, int *LDA,
+		      double *B, int *LDB);
+
+extern "C" int dsyrk_(char *UPLO, char *TRANS, int *N, int *K,
+		      double *ALPHA, double *A, int *LDA, double *BETA,
+		      double *C, int *LDC);
+
+extern "C" int dtrsv_(char *UPLO, char *TRANS, char *DIAG, int *N,
+		      double *A, int *LDA, double *X, int *INCX);
+
+extern "C" int dgemv_(char *TRANS, int *M, int *N, double *ALPHA,
+		      double *A, int *LDA, double *X, int *INCX,
+		      double *BETA, double *Y, int *INCY);
+
+//! @brief Constructor.
+//!
+//! @param ord: ordering algorithm (amd, nested_dissection or natural).
+//! @param nThreads: number of threads (if zero use the number of
+//!                  concurrent threads supported by the hardware).
+XC::SupernodalCholeskySolver::SupernodalCholeskySolver(const std::string &ord,int nThreads)
+  : SparseGenColLinSolver(SOLVER_TAGS_SupernodalCholeskySolver),
+    ordering(ord), numThreads(nThreads), size(0) {}
+
+//! @brief Set the ordering algorithm (amd, nested_dissection or natural).
+//! It will be used the next time the size of the system changes.
+void XC::SupernodalCholeskySolver::setOrdering(const std::string &ord)
+  {
+    if((ord=="amd") || (ord=="nested_dissection") || (ord=="natural"))
+      ordering= ord;
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; unknown ordering: '" << ord
+		<< "' available orderings are: 'amd',"
+		<< " 'nested_dissection' and 'natural'."
+		<< std::endl;
+  }
+
+//! @brief Return the name of the ordering algorithm.
+const std::string &XC::SupernodalCholeskySolver::getOrdering(void) const
+  { return ordering; }
+
+//! @brief Set the number of threads (if zero use the number of
+//! concurrent threads supported by the hardware).
+void XC::SupernodalCholeskySolver::setNumThreads(const int &nt)
+  { numThreads= std::max(nt,0); }
+
+//! @brief Return the number of threads (zero means the number of
+//! concurrent threads supported by the hardware).
+int XC::SupernodalCholeskySolver::getNumThreads(void) const
+  { return numThreads; }
+
+//! @brief Return the number of supernodes.
+int XC::SupernodalCholeskySolver::getNumSupernodes(void) const
+  { return std::max(int(snodeStart.size())-1,0); }
+
+//! @brief Return the number of terms stored for the factor L
+//! (including the zeros inside the supernodes).
+size_t XC::SupernodalCholeskySolver::getFactorNNZ(void) const
+  { return Lx.size(); }
+
+//! @brief Symbolic analysis: computes the ordering, the elimination
+//! tree, the supernodes and the structure of the factor.
+int XC::SupernodalCholeskySolver::symbolic(void)
+  {
+    const int n= size;
+    const ID &colStartA= theSOE->colStartA;
+    const ID &rowA= theSOE->rowA;
+
+    // graph of the matrix (without the diagonal).
+    std::vector<std::vector<int> > g(n);
+    for(int j= 0;j<n;j++)
+      for(int p= colStartA(j);p<colStartA(j+1);p++)
+        {
+          const int i= rowA(p);
+          if(i!=j)
+            { g[j].push_back(i); g[i].push_back(j); }
+        }
+    std::vector<int> xadj(n+1,0), adj;
+    for(int j= 0;j<n;j++)
+      {
+        std::vector<int> &gj= g[j];
+        std::sort(gj.begin(),gj.end());
+        gj.erase(std::unique(gj.begin(),gj.end()),gj.end());
+        adj.insert(adj.end(),gj.begin(),gj.end());
+        xadj[j+1]= adj.size();
+      }
+
+    // fill reducing ordering.
+    if(ordering=="nested_dissection")
+      perm= nested_dissection_ordering(xadj,adj);
+    else if(ordering=="natural")
+      {
+        perm.resize(n);
+        for(int k= 0;k<n;k++)
+          perm[k]= k;
+      }
+    else
+      perm= amd_ordering(xadj,adj);
+    pinv.assign(n,-1);
+    for(int k= 0;k<n;k++)
+      pinv[perm[k]]= k;
+
+    // elimination tree.
+    std::vector<int> parent(n,-1), ancestor(n,-1);
+    for(int k= 0;k<n;k++)
+      {
+        const int j= perm[k];
+        for(int p= xadj[j];p<xadj[j+1];p++)
+          {
+            int inext= -1;
+            for(int i= pinv[adj[p]];(i!=-1) && (i<k);i= inext)
+              {
+                inext= ancestor[i];
+                ancestor[i]= k;
+                if(inext==-1)
+                  parent[i]= k;
+              }
+          }
+      }
+
+    // postorder of the elimination tree.
+    std::vector<std::vector<int> > children(n);
+    std::vector<int> roots;
+    for(int k= 0;k<n;k++)
+      if(parent[k]==-1)
+        roots.push_back(k);
+      else
+        children[parent[k]].push_back(k);
+    std::vector<int> post;
+    post.reserve(n);
+    std::vector<std::pair<int,size_t> > stack;
+    for(std::vector<int>::const_iterator r= roots.begin();r!=roots.end();r++)
+      {
+        stack.push_back(std::make_pair(*r,size_t(0)));
+        while(!stack.empty())
+          {
+            std::pair<int,size_t> &top= stack.back();
+            if(top.second<children[top.first].size())
+              {
+                const int c= children[top.first][top.second++];
+                stack.push_back(std::make_pair(c,size_t(0)));
+              }
+            else
+              {
+                post.push_back(top.first);
+                stack.pop_back();
+              }
+          }
+      }
+    std::vector<int> ipost(n);
+    for(int k= 0;k<n;k++)
+      ipost[post[k]]= k;
+    std::vector<int> newPerm(n), newParent(n,-1);
+    for(int k= 0;k<n;k++)
+      {
+        newPerm[k]= perm[post[k]];
+        if(parent[post[k]]!=-1)
+          newParent[k]= ipost[parent[post[k]]];
+      }
+    perm.swap(newPerm);
+    parent.swap(newParent);
+    for(int k= 0;k<n;k++)
+      pinv[perm[k]]= k;
+
+    // column counts (including the diagonal).
+    std::vector<int> count(n,1), flag(n,-1), nchild(n,0);
+    for(int k= 0;k<n;k++)
+      {
+        if(parent[k]!=-1)
+          nchild[parent[k]]++;
+        flag[k]= k;
+        const int j= perm[k];
+        for(int p= xadj[j];p<xadj[j+1];p++)
+          for(int i= pinv[adj[p]];(i<k) && (flag[i]!=k);i= parent[i])
+            {
+              count[i]++;
+              flag[i]= k;
+            }
+      }
+
+    // fundamental supernodes.
+    snodeStart.clear();
+    std::vector<int> snodeOf(n,0);
+    if(n>0)
+      snodeStart.push_back(0);
+    for(int j= 1;j<n;j++)
+      {
+        const bool merge= (parent[j-1]==j) && (count[j-1]==count[j]+1) && (nchild[j]==1);
+        if(!merge)
+          snodeStart.push_back(j);
+        snodeOf[j]= snodeStart.size()-1;
+      }
+    const int ns= snodeStart.size();
+    snodeStart.push_back(n);
+    snodeParent.assign(ns,-1);
+    snodeChildren.assign(ns,std::vector<int>());
+    for(int s= 0;s<ns;s++)
+      {
+        const int last= snodeStart[s+1]-1;
+        if(parent[last]!=-1)
+          {
+            snodeParent[s]= snodeOf[parent[last]];
+            snodeChildren[snodeParent[s]].push_back(s);
+          }
+      }
+
+    // row structure of the supernodes (children come first).
+    rowStart.assign(ns+1,0);
+    rowIdx.clear();
+    std::fill(flag.begin(),flag.end(),-1);
+    for(int s= 0;s<ns;s++)
+      {
+        const int f= snodeStart[s];
+        const int l= snodeStart[s+1];
+        const size_t first= rowIdx.size();
+        for(int k= f;k<l;k++)
+          { rowIdx.push_back(k); flag[k]= s; }
+        for(int k= f;k<l;k++)
+          {
+            const int j= perm[k];
+            for(int p= xadj[j];p<xadj[j+1];p++)
+              {
+                const int i= pinv[adj[p]];
+                if((i>=l) && (flag[i]!=s))
+                  { rowIdx.push_back(i); flag[i]= s; }
+              }
+          }
+        for(std::vector<int>::const_iterator c= snodeChildren[s].begin();c!=snodeChildren[s].end();c++)
+          for(int p= rowStart[*c];p<rowStart[*c+1];p++)
+            {
+              const int i= rowIdx[p];
+              if((i>=l) && (flag[i]!=s))
+                { rowIdx.push_back(i); flag[i]= s; }
+            }
+        std::sort(rowIdx.begin()+first+(l-f),rowIdx.end());
+        rowStart[s+1]= rowIdx.size();
+        if(int(rowIdx.size()-first)!=count[f])
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; error in the structure of supernode: " << s
+		      << std::endl;
+            return -1;
+          }
+      }
+
+    // position of the rows in the parent fronts and values storage.
+    parentPos.assign(rowIdx.size(),-1);
+    valStart.assign(ns+1,0);
+    std::vector<int> &pos= flag;
+    for(int s= 0;s<ns;s++)
+      {
+        const size_t m= rowStart[s+1]-rowStart[s];
+        const size_t nc= snodeStart[s+1]-snodeStart[s];
+        valStart[s+1]= valStart[s]+m*nc;
+        for(int p= rowStart[s];p<rowStart[s+1];p++)
+          pos[rowIdx[p]]= p-rowStart[s];
+        for(std::vector<int>::const_iterator c= snodeChildren[s].begin();c!=snodeChildren[s].end();c++)
+          {
+            const int ncc= snodeStart[*c+1]-snodeStart[*c];
+            for(int p= rowStart[*c]+ncc;p<rowStart[*c+1];p++)
+              parentPos[p]= pos[rowIdx[p]];
+          }
+      }
+
+    // position of the terms of A in the factor storage.
+    const int nnzA= colStartA(n);
+    aMap.assign(nnzA,-1);
+    for(int s= 0;s<ns;s++)
+      {
+        const int f= snodeStart[s];
+        const long int m= rowStart[s+1]-rowStart[s];
+        for(int p= rowStart[s];p<rowStart[s+1];p++)
+          pos[rowIdx[p]]= p-rowStart[s];
+        for(int k= f;k<snodeStart[s+1];k++)
+          {
+            const int j= perm[k];
+            for(int p= colStartA(j);p<colStartA(j+1);p++)
+              {
+                const int i= pinv[rowA(p)];
+                if(i>=k)
+                  aMap[p]= valStart[s]+pos[i]+(k-f)*m;
+              }
+          }
+      }
+
+    // levels of the assembly tree.
+    std::vector<int> height(ns,0);
+    levels.clear();
+    for(int s= 0;s<ns;s++)
+      {
+        for(std::vector<int>::const_iterator c= snodeChildren[s].begin();c!=snodeChildren[s].end();c++)
+          height[s]= std::max(height[s],height[*c]+1);
+        if(height[s]>=int(levels.size()))
+          levels.resize(height[s]+1);
+        levels[height[s]].push_back(s);
+      }
+    Lx.assign(valStart[ns],0.0);
+    updates.assign(ns,std::vector<double>());
+    return 0;
+  }
+
+//! @brief Computes the columns of the supernode being passed as
+//! parameter (assembles its frontal matrix, computes the partial
+//! factorization and stores the update matrix for its parent).
+//! Returns zero if successful or the (1-based) column where
+//! the matrix is found not positive definite.
+int XC::SupernodalCholeskySolver::factor_supernode(const int &s)
+  {
+    const int f= snodeStart[s];
+    int nc= snodeStart[s+1]-f;
+    int m= rowStart[s+1]-rowStart[s];
+    int mb= m-nc;
+    double *L= &Lx[valStart[s]];
+    std::fill(L,L+size_t(m)*nc,0.0);
+    std::vector<double> &U= updates[s];
+    U.assign(size_t(mb)*mb,0.0);
+
+    // assemble the terms of A.
+    const ID &colStartA= theSOE->colStartA;
+    const Vector &A= theSOE->A;
+    for(int k= f;k<f+nc;k++)
+      {
+        const int j= perm[k];
+        for(int p= colStartA(j);p<colStartA(j+1);p++)
+          if(aMap[p]>=0)
+            Lx[aMap[p]]+= A(p);
+      }
+
+    // extend-add the update matrices of the children.
+    for(std::vector<int>::const_iterator c= snodeChildren[s].begin();c!=snodeChildren[s].end();c++)
+      {
+        const int ncc= snodeStart[*c+1]-snodeStart[*c];
+        const int mbc= rowStart[*c+1]-rowStart[*c]-ncc;
+        const std::vector<double> &Uc= updates[*c];
+        const int *pp= &parentPos[rowStart[*c]+ncc];
+        for(int b= 0;b<mbc;b++)
+          {
+            const int pb= pp[b];
+            const double *ucol= &Uc[size_t(b)*mbc];
+            if(pb<nc)
+              {
+                double *lcol= L+size_t(pb)*m;
+                for(int a= b;a<mbc;a++)
+                  lcol[pp[a]]+= ucol[a];
+              }
+            else
+              {
+                double *ccol= &U[size_t(pb-nc)*mb];
+                for(int a= b;a<mbc;a++)
+                  ccol[pp[a]-nc]+= ucol[a];
+              }
+          }
+        std::vector<double>().swap(updates[*c]);
+      }
+
+    // partial factorization.
+    char strL[]= "L", strR[]= "R", strT[]= "T", strN[]= "N";
+    int info= 0;
+    dpotrf_(strL,&nc,L,&m,&info);
+    if(info!=0)
+      return f+info;
+    if(mb>0)
+      {
+        double one= 1.0, mone= -1.0;
+        dtrsm_(strR,strL,strT,strN,&mb,&nc,&one,L,&m,L+nc,&m);
+        dsyrk_(strL,strN,&mb,&nc,&mone,L+nc,&m,&one,U.data(),&mb);
+      }
+    return 0;
+  }
+
+//! @brief Numerical factorization. The supernodes of each level of
+//! the assembly tree are factored concurrently.
+int XC::SupernodalCholeskySolver::factor(void)
+  {
+    const size_t nt= getThreadCount(numThreads);
+    std::vector<int> errors;
+    for(std::vector<std::vector<int> >::const_iterator l= levels.begin();l!=levels.end();l++)
+      {
+        const std::vector<int> &level= *l;
+        errors.assign(level.size(),0);
+        if(level.size()>1)
+          parallel_for(level.size(),nt,[this,&level,&errors](size_t first,size_t last,size_t)
+            {
+              for(size_t i= first;i<last;i++)
+                errors[i]= factor_supernode(level[i]);
+            });
+        else
+          errors[0]= factor_supernode(level[0]);
+        for(std::vector<int>::const_iterator e= errors.begin();e!=errors.end();e++)
+          if(*e!=0)
+            {
+              std::cerr << getClassName() << "::" << __FUNCTION__
+			<< "; the matrix is not positive definite"
+			<< " (equation: " << perm[*e-1] << ")."
+			<< std::endl;
+              return -2;
+            }
+      }
+    return 0;
+  }
+
+//! @brief Forward and backward substitution (the vector
+//! is in the permuted ordering).
+void XC::SupernodalCholeskySolver::substitution(double *y) const
+  {
+    const int ns= getNumSupernodes();
+    char strL[]= "L", strT[]= "T", strN[]= "N";
+    int ione= 1;
+    double one= 1.0, mone= -1.0, zero= 0.0;
+    std::vector<double> tmp;
+    for(int s= 0;s<ns;s++)
+      {
+        const int f= snodeStart[s];
+        int nc= snodeStart[s+1]-f;
+        int m= rowStart[s+1]-rowStart[s];
+        int mb= m-nc;
+        double *L= const_cast<double *>(&Lx[valStart[s]]);
+        dtrsv_(strL,strN,strN,&nc,L,&m,y+f,&ione);
+        if(mb>0)
+          {
+            tmp.assign(mb,0.0);
+            dgemv_(strN,&mb,&nc,&one,L+nc,&m,y+f,&ione,&zero,tmp.data(),&ione);
+            const int *rows= &rowIdx[rowStart[s]+nc];
+            for(int a= 0;a<mb;a++)
+              y[rows[a]]-= tmp[a];
+          }
+      }
+    for(int s= ns-1;s>=0;s--)
+      {
+        const int f= snodeStart[s];
+        int nc= snodeStart[s+1]-f;
+        int m= rowStart[s+1]-rowStart[s];
+        int mb= m-nc;
+        double *L= const_cast<double *>(&Lx[valStart[s]]);
+        if(mb>0)
+          {
+            tmp.resize(mb);
+            const int *rows= &rowIdx[rowStart[s]+nc];
+            for(int a= 0;a<mb;a++)
+              tmp[a]= y[rows[a]];
+            dgemv_(strT,&mb,&nc,&mone,L+nc,&m,tmp.data(),&ione,&one,y+f,&ione);
+          }
+        dtrsv_(strL,strT,strN,&nc,L,&m,y+f,&ione);
+      }
+  }
+
+//! @brief Computes the symbolic factorization (ordering, elimination
+//! tree and supernodes) of the matrix. It's called when the structure
+//! of the system of equations changes.
+int XC::SupernodalCholeskySolver::setSize(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set.\n";
+	return -1;
+      }
+    size= theSOE->size;
+    if(size<=0)
+      {
+        perm.clear(); pinv.clear(); snodeStart.clear();
+        Lx.clear(); updates.clear(); levels.clear();
+        return 0;
+      }
+    return symbolic();
+  }
+
+//! @brief Solve the system.
+//!
+//! Copies B into X (in the permuted ordering) and, if the system is
+//! not marked as factored, computes the numerical factorization
+//! (reusing the symbolic one). Then solves the system by forward
+//! and backward substitution.
+int XC::SupernodalCholeskySolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set.\n";
+	return -1;
+      }
+    const int n= theSOE->size;
+    if(n==0)
+      return 0;
+    if((n!=size) || (int(perm.size())!=n))
+      {
+        const int ok= setSize();
+        if(ok<0)
+          return ok;
+      }
+    if(theSOE->factored == false)
+      {
+        const int ok= factor();
+        if(ok!=0)
+          return ok;
+        theSOE->factored= true;
+      }
+    const double *B= theSOE->getPtrB();
+    double *X= theSOE->getPtrX();
+    std::vector<double> y(n);
+    for(int k= 0;k<n;k++)
+      y[k]= B[perm[k]];
+    substitution(y.data());
+    for(int k= 0;k<n;k++)
+      X[perm[k]]= y[k];
+    return 0;
+  }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::SupernodalCholeskySolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+//! @brief Does nothing but return \f$0\f$.
+int XC::SupernodalCholeskySolver::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SupernodalCholeskySolver.h
+
+#ifndef SupernodalCholeskySolver_h
+#define SupernodalCholeskySolver_h
+
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColLinSolver.h>
+#include <vector>
+#include <string>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Supernodal multifrontal Cholesky solver for symmetric positive
+//! definite systems stored in a SparseGenColLinSOE.
+//!
+//! The solver computes \f$P A P^t= L L^t\f$ where \f$P\f$ is a fill
+//! reducing permutation (approximate minimum degree, nested dissection
+//! or the natural ordering of the equations). The symbolic analysis
+//! (ordering, elimination tree, supernodes and structure of \f$L\f$) is
+//! computed in setSize(), so it is reused while the sparsity pattern
+//! of the system doesn't change (i.e. between Newton iterations). The
+//! numerical factorization processes the supernodes with dense BLAS-3
+//! kernels (dpotrf, dtrsm and dsyrk) and the supernodes of the same
+//! level of the assembly tree are factored concurrently by the threads
+//! of the shared ThreadPool.
+//!
+//! Only the lower triangle of \f$A\f$ is used (the matrix
+//! must be symmetric).
+class SupernodalCholeskySolver: public SparseGenColLinSolver
+  {
+  private:
+    std::string ordering; //!< ordering algorithm (amd, nested_dissection or natural).
+    int numThreads; //!< number of threads (0: hardware concurrency).
+    int size; //!< number of equations.
+    std::vector<int> perm; //!< perm[k]: equation eliminated in k-th place.
+    std::vector<int> pinv; //!< inverse of perm.
+    std::vector<int> snodeStart; //!< first column of each supernode.
+    std::vector<int> snodeParent; //!< parent of each supernode (-1 for roots).
+    std::vector<std::vector<int> > snodeChildren; //!< children of each supernode.
+    std::vector<std::vector<int> > levels; //!< supernodes that can be factored at the same time.
+    std::vector<int> rowStart; //!< first row index of each supernode.
+    std::vector<int> rowIdx; //!< row indexes of each supernode.
+    std::vector<int> parentPos; //!< position of the update rows in the parent front.
+    std::vector<size_t> valStart; //!< first value of each supernode in Lx.
+    std::vector<long int> aMap; //!< position in Lx of each entry of A (-1 if upper).
+    std::vector<double> Lx; //!< values of the factor.
+    std::vector<std::vector<double> > updates; //!< update matrices of the supernodes.
+
+    int symbolic(void);
+    int factor_supernode(const int &);
+    int factor(void);
+    void substitution(double *) const;
+  protected:
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    SupernodalCholeskySolver(const std::string &ord= "amd",int numThreads= 1);
+    virtual LinearSOESolver *getCopy(void) const;
+  public:
+    int solve(void);
+    int setSize(void);
+
+    void setOrdering(const std::string &);
+    const std::string &getOrdering(void) const;
+    void setNumThreads(const int &);
+    int getNumThreads(void) const;
+    int getNumSupernodes(void) const;
+    size_t getFactorNNZ(void) const;
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline LinearSOESolver *SupernodalCholeskySolver::getCopy(void) const
+   { return new SupernodalCholeskySolver(*this); }
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,396 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//sparse_ordering.cc
+
+#include "sparse_ordering.h"
+#include <map>
+#include <set>
+#include <algorithm>
+
+namespace {
+
+//! @brief Weighted sum of the vertices of the list.
+int list_weight(const std::vector<int> &l,const std::vector<int> &nv)
+  {
+    int retval= 0;
+    for(std::vector<int>::const_iterator i= l.begin();i!=l.end();i++)
+      retval+= nv[*i];
+    return retval;
+  }
+
+} // end of anonymous namespace
+
+//! @brief Approximate minimum degree ordering.
+//!
+//! The vertices with the same adjacency are first grouped in
+//! supervariables (the degrees of freedom of a node are usually
+//! indistinguishable). Then the supervariables are eliminated in
+//! the order of its approximate external degree (as in the AMD
+//! algorithm of Amestoy, Davis and Duff) using a quotient graph
+//! to represent the eliminated vertices (elements), so the memory
+//! needed doesn't grow with the fill in.
+std::vector<int> XC::amd_ordering(const std::vector<int> &xadj,const std::vector<int> &adj)
+  {
+    const int n= static_cast<int>(xadj.size())-1;
+    std::vector<int> perm;
+    if(n<=0)
+      return perm;
+    perm.reserve(n);
+
+    // supervariable detection.
+    std::vector<int> rep(n,-1);
+    std::vector<std::vector<int> > members;
+    {
+      std::map<std::vector<int>,int> keys;
+      std::vector<int> key;
+      for(int i= 0;i<n;i++)
+        {
+          key.assign(adj.begin()+xadj[i],adj.begin()+xadj[i+1]);
+          key.push_back(i);
+          std::sort(key.begin(),key.end());
+          key.erase(std::unique(key.begin(),key.end()),key.end());
+          std::map<std::vector<int>,int>::const_iterator k= keys.find(key);
+          if(k!=keys.end())
+            {
+              rep[i]= k->second;
+              members[k->second].push_back(i);
+            }
+          else
+            {
+              const int s= members.size();
+              keys[key]= s;
+              rep[i]= s;
+              members.push_back(std::vector<int>(1,i));
+            }
+        }
+    }
+    const int nsv= members.size();
+
+    std::vector<std::vector<int> > adjV(nsv); // adjacent variables.
+    std::vector<std::vector<int> > adjE(nsv); // adjacent elements.
+    std::vector<std::vector<int> > Le(nsv); // variables of each element.
+    std::vector<int> nv(nsv,0); // weight of each supervariable.
+    std::vector<int> elementWeight(nsv,0);
+    std::vector<int> status(nsv,0); // 0: variable, 1: element, 2: absorbed element.
+    std::vector<int> deg(nsv,0);
+    std::vector<int> mark(nsv,-1);
+    std::vector<int> w(nsv,0);
+    std::vector<int> wstamp(nsv,-1);
+    for(int s= 0;s<nsv;s++)
+      {
+        nv[s]= members[s].size();
+        const int i= members[s][0];
+        std::vector<int> &av= adjV[s];
+        for(int k= xadj[i];k<xadj[i+1];k++)
+          {
+            const int r= rep[adj[k]];
+            if(r!=s)
+              av.push_back(r);
+          }
+        std::sort(av.begin(),av.end());
+        av.erase(std::unique(av.begin(),av.end()),av.end());
+      }
+    std::set<std::pair<int,int> > queue;
+    for(int s= 0;s<nsv;s++)
+      {
+        deg[s]= list_weight(adjV[s],nv);
+        queue.insert(std::make_pair(deg[s],s));
+      }
+
+    int remaining= n;
+    int tag= 0;
+    std::vector<int> Lp;
+    while(!queue.empty())
+      {
+        const int p= queue.begin()->second;
+        queue.erase(queue.begin());
+        tag++;
+        // variables of the new element.
+        Lp.clear();
+        mark[p]= tag;
+        for(std::vector<int>::const_iterator j= adjV[p].begin();j!=adjV[p].end();j++)
+          if((status[*j]==0) && (mark[*j]!=tag))
+            { mark[*j]= tag; Lp.push_back(*j); }
+        for(std::vector<int>::const_iterator e= adjE[p].begin();e!=adjE[p].end();e++)
+          if(status[*e]==1)
+            {
+              for(std::vector<int>::const_iterator j= Le[*e].begin();j!=Le[*e].end();j++)
+                if((status[*j]==0) && (mark[*j]!=tag))
+                  { mark[*j]= tag; Lp.push_back(*j); }
+              status[*e]= 2; // absorbed by p.
+              std::vector<int>().swap(Le[*e]);
+            }
+        status[p]= 1;
+        std::vector<int>().swap(adjV[p]);
+        std::vector<int>().swap(adjE[p]);
+        Le[p]= Lp;
+        elementWeight[p]= list_weight(Lp,nv);
+        perm.insert(perm.end(),members[p].begin(),members[p].end());
+        remaining-= nv[p];
+
+        // update the adjacency of the variables of the new element.
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          {
+            std::vector<int> &ae= adjE[*i];
+            std::vector<int>::iterator last= std::remove_if(ae.begin(),ae.end(),[&status](const int &e){ return status[e]!=1; });
+            ae.erase(last,ae.end());
+            ae.push_back(p);
+            std::vector<int> &av= adjV[*i];
+            last= std::remove_if(av.begin(),av.end(),[&status,&mark,tag](const int &j){ return (status[j]!=0) || (mark[j]==tag); });
+            av.erase(last,av.end());
+          }
+        // external weights |Le \ Lp| of the elements.
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          for(std::vector<int>::const_iterator e= adjE[*i].begin();e!=adjE[*i].end();e++)
+            if(*e!=p)
+              {
+                if(wstamp[*e]!=tag)
+                  { wstamp[*e]= tag; w[*e]= elementWeight[*e]; }
+                w[*e]-= nv[*i];
+              }
+        // approximate degrees (elements contained in Lp are absorbed).
+        const int wLp= elementWeight[p];
+        for(std::vector<int>::const_iterator i= Lp.begin();i!=Lp.end();i++)
+          {
+            std::vector<int> &ae= adjE[*i];
+            int d= list_weight(adjV[*i],nv)+wLp-nv[*i];
+            std::vector<int>::iterator last= ae.begin();
+            for(std::vector<int>::const_iterator e= ae.begin();e!=ae.end();e++)
+              {
+                if(*e!=p)
+                  {
+                    if(w[*e]==0)
+                      {
+                        status[*e]= 2;
+                        std::vector<int>().swap(Le[*e]);
+                        continue;
+                      }
+                    if(status[*e]!=1)
+                      continue;
+                    d+= w[*e];
+                  }
+                *last++= *e;
+              }
+            ae.erase(last,ae.end());
+            d= std::min(d,remaining-nv[*i]);
+            queue.erase(std::make_pair(deg[*i],*i));
+            deg[*i]= d;
+            queue.insert(std::make_pair(d,*i));
+          }
+      }
+    return perm;
+  }
+
+namespace {
+
+//! @brief Helper for the nested dissection ordering.
+class NestedDissection
+  {
+  private:
+    const std::vector<int> &xadj;
+    const std::vector<int> &adj;
+    const size_t leafSize;
+    std::vector<int> &perm;
+    std::vector<int> where; //!< stamp of the set that contains each vertex.
+    std::vector<int> level; //!< level of each vertex in the current BFS.
+    std::vector<int> localIndex;
+    int stamp;
+
+    int bfs(const int &,const int &,std::vector<int> &,std::vector<int> &);
+    void order_leaf(const std::vector<int> &);
+  public:
+    NestedDissection(const std::vector<int> &x,const std::vector<int> &a,const size_t &ls,std::vector<int> &p)
+      : xadj(x), adj(a), leafSize(std::max(ls,size_t(1))), perm(p),
+        where(x.size()-1,-1), level(x.size()-1,-1), localIndex(x.size()-1,-1), stamp(0) {}
+    void dissect(const std::vector<int> &);
+  };
+
+//! @brief Breadth first search from the vertex being passed as parameter
+//! inside the set marked with the stamp s. Returns the number of levels;
+//! the vertices are returned in visiting order and levelStart contains
+//! the first position of each level.
+int NestedDissection::bfs(const int &root,const int &s,std::vector<int> &visited,std::vector<int> &levelStart)
+  {
+    visited.clear();
+    levelStart.clear();
+    visited.push_back(root);
+    const int lstamp= -2-stamp; // different from any set stamp.
+    level[root]= lstamp;
+    size_t first= 0;
+    while(first<visited.size())
+      {
+        levelStart.push_back(first);
+        const size_t last= visited.size();
+        for(size_t k= first;k<last;k++)
+          {
+            const int v= visited[k];
+            for(int j= xadj[v];j<xadj[v+1];j++)
+              {
+                const int u= adj[j];
+                if((where[u]==s) && (level[u]!=lstamp))
+                  {
+                    level[u]= lstamp;
+                    visited.push_back(u);
+                  }
+              }
+          }
+        first= last;
+      }
+    levelStart.push_back(visited.size());
+    return levelStart.size()-1;
+  }
+
+//! @brief Order a small set of vertices using the minimum degree
+//! algorithm on the induced subgraph.
+void NestedDissection::order_leaf(const std::vector<int> &S)
+  {
+    const int s= ++stamp;
+    for(size_t k= 0;k<S.size();k++)
+      { where[S[k]]= s; localIndex[S[k]]= k; }
+    std::vector<int> lxadj(1,0), ladj;
+    for(size_t k= 0;k<S.size();k++)
+      {
+        const int v= S[k];
+        for(int j= xadj[v];j<xadj[v+1];j++)
+          if(where[adj[j]]==s)
+            ladj.push_back(localIndex[adj[j]]);
+        lxadj.push_back(ladj.size());
+      }
+    const std::vector<int> lperm= XC::amd_ordering(lxadj,ladj);
+    for(std::vector<int>::const_iterator i= lperm.begin();i!=lperm.end();i++)
+      perm.push_back(S[*i]);
+  }
+
+//! @brief Order the vertices of the set: both parts first, then
+//! the separator.
+void NestedDissection::dissect(const std::vector<int> &S)
+  {
+    if(S.size()<=leafSize)
+      {
+        order_leaf(S);
+        return;
+      }
+    const int s= ++stamp;
+    for(std::vector<int>::const_iterator i= S.begin();i!=S.end();i++)
+      where[*i]= s;
+    std::vector<int> visited, levelStart;
+    int nlev= bfs(S[0],s,visited,levelStart);
+    if(visited.size()<S.size()) // disconnected: order each component.
+      {
+        std::vector<std::vector<int> > components(1,visited);
+        const int lstamp= -2-stamp;
+        for(std::vector<int>::const_iterator i= S.begin();i!=S.end();i++)
+          if(level[*i]!=lstamp) // not visited yet.
+            {
+              bfs(*i,s,visited,levelStart);
+              components.push_back(visited);
+            }
+        for(std::vector<std::vector<int> >::const_iterator i= components.begin();i!=components.end();i++)
+          dissect(*i);
+        return;
+      }
+    // pseudo-peripheral vertex.
+    for(int iter= 0;iter<5;iter++)
+      {
+        int root= visited[levelStart[nlev-1]];
+        for(int k= levelStart[nlev-1];k<levelStart[nlev];k++)
+          {
+            const int v= visited[k];
+            if((xadj[v+1]-xadj[v])<(xadj[root+1]-xadj[root]))
+              root= v;
+          }
+        std::vector<int> visited2, levelStart2;
+        const int nlev2= bfs(root,s,visited2,levelStart2);
+        if(nlev2<=nlev)
+          break;
+        nlev= nlev2;
+        visited.swap(visited2);
+        levelStart.swap(levelStart2);
+      }
+    if(nlev<3)
+      {
+        order_leaf(S);
+        return;
+      }
+    // separator: smallest level in the central third.
+    int m= nlev/2;
+    const int mMin= std::max(1,nlev/3);
+    const int mMax= std::min(nlev-2,(2*nlev)/3);
+    for(int l= mMin;l<=mMax;l++)
+      {
+        const int sz= levelStart[l+1]-levelStart[l];
+        const int szm= levelStart[m+1]-levelStart[m];
+        if((sz<szm) || ((sz==szm) && (std::abs(l-nlev/2)<std::abs(m-nlev/2))))
+          m= l;
+      }
+    std::vector<int> part1(visited.begin(),visited.begin()+levelStart[m]);
+    std::vector<int> part2(visited.begin()+levelStart[m+1],visited.end());
+    std::vector<int> separator;
+    // vertices of the level m not connected with the level m+1 go to part1.
+    const int s2= ++stamp;
+    for(std::vector<int>::const_iterator i= part2.begin();i!=part2.end();i++)
+      where[*i]= s2;
+    for(int k= levelStart[m];k<levelStart[m+1];k++)
+      {
+        const int v= visited[k];
+        bool touches= false;
+        for(int j= xadj[v];j<xadj[v+1];j++)
+          if(where[adj[j]]==s2)
+            { touches= true; break; }
+        if(touches)
+          separator.push_back(v);
+        else
+          part1.push_back(v);
+      }
+    dissect(part1);
+    dissect(part2);
+    perm.insert(perm.end(),separator.begin(),separator.end());
+  }
+
+} // end of anonymous namespace
+
+//! @brief Nested dissection ordering.
+//!
+//! The graph is recursively split using level structure separators
+//! (a level of a breadth first search from a pseudo-peripheral
+//! vertex); both parts are ordered before the separator. The subgraphs
+//! with less than leafSize vertices are ordered with the approximate
+//! minimum degree algorithm.
+std::vector<int> XC::nested_dissection_ordering(const std::vector<int> &xadj,const std::vector<int> &adj,const size_t &leafSize)
+  {
+    std::vector<int> perm;
+    const int n= static_cast<int>(xadj.size())-1;
+    if(n<=0)
+      return perm;
+    perm.reserve(n);
+    std::vector<int> S(n);
+    for(int i= 0;i<n;i++)
+      S[i]= i;
+    NestedDissection nd(xadj,adj,leafSize,perm);
+    nd.dissect(S);
+    return perm;
+  }
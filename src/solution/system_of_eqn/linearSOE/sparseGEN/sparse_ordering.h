@@ -0,0 +1,51 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//sparse_ordering.h
+
+#ifndef SPARSE_ORDERING_H
+#define SPARSE_ORDERING_H
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Fill reducing orderings for sparse symmetric matrices.
+//!
+//! The graph of the matrix is given in compressed form: the
+//! neighbours of the vertex i are adj[xadj[i]] ... adj[xadj[i+1]-1]
+//! (the diagonal must not be included). The returned vector
+//! contains the permutation: perm[k] is the index of the vertex
+//! eliminated in the k-th place.
+std::vector<int> amd_ordering(const std::vector<int> &xadj,const std::vector<int> &adj);
+std::vector<int> nested_dissection_ordering(const std::vector<int> &xadj,const std::vector<int> &adj,const size_t &leafSize= 256);
+
+} // end of XC namespace
+
+#endif
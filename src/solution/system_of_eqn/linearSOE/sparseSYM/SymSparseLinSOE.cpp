@@ -132,6 +132,7 @@ XC::SymSparseLinSOE::~SymSparseLinSOE(void)
 int XC::SymSparseLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
+    clearScatterMap(); // the storage is allocated again.
     size= checkSize(theGraph);
 
     // first iterarte through the vertices of the graph to get nnz
@@ -211,10 +212,49 @@ int XC::SymSparseLinSOE::setSize(Graph &theGraph)
     // call "C" function to form elimination tree and to do the symbolic factorization.
     nblks = symFactorization(rowStartA.getDataPtr(), colA.getDataPtr(), size, this->LSPARSE,
 			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
+    buildScatterMap();
 
     return result;
 }
 
+//! @brief Return the address of the term \f$a_{row,col}\f$ (nullptr
+//! if it's not stored).
+//!
+//! Only the lower triangle of the permuted matrix is stored, so the
+//! term is stored if invp[row]>=invp[col]. It can be on the diagonal,
+//! on the profile next to the diagonal or on a row segment of the
+//! column block of invp[col].
+double *XC::SymSparseLinSOE::getEntryPtr(const int &row, const int &col)
+  {
+    double *retval= nullptr;
+    if(!invp || !diag || (row>=size) || (col>=size))
+      return retval;
+    const int i_eq= invp[row];
+    const int j_eq= invp[col];
+    if(i_eq == j_eq)
+      retval= &diag[i_eq];
+    else if(i_eq > j_eq)
+      {
+        const int iblk= rowblks[i_eq];
+        if(j_eq >= xblk[iblk]) // diagonal block (profile).
+          retval= penv[i_eq+1] - i_eq + j_eq;
+        else // row segment.
+          {
+            OFFDBLK *ptr= begblk[rowblks[j_eq]];
+            while((ptr->row < i_eq) && (ptr->bnext != ptr))
+              ptr= ptr->bnext;
+            if(ptr->row == i_eq)
+              {
+                while((j_eq >= (ptr->next)->beg) && ((ptr->next)->row == i_eq))
+                  ptr= ptr->next;
+                if(j_eq >= ptr->beg)
+                  retval= ptr->nz + (j_eq - ptr->beg);
+              }
+          }
+      }
+    return retval;
+  }
+
 
 /* Perform the element stiffness assembly here.
  */
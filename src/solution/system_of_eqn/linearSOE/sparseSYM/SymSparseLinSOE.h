@@ -71,6 +71,7 @@ class SymSparseLinSOE : public SparseSOEBase
     OFFDBLK  *first;
   protected:
     virtual bool setSolver(LinearSOESolver *);
+    virtual double *getEntryPtr(const int &, const int &);
 
     friend class AnalysisAggregation;
     SymSparseLinSOE(AnalysisAggregation *,int lSparse= 0);
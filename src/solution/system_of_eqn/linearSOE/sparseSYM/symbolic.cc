@@ -51,21 +51,11 @@
 
 #include <cmath>
 #include <cassert>
+extern "C" {
 #include "utility.h"
 
-
-/* extern int mygenmmd_(int *neq, int *fxadj, int *adjncy, int *winvp, */
-/* 		     int *wperm, int *delta, int *fchild, int *parent, */
-/* 		     int *sibling, int *marker, int *maxint, int *nofsub, */
-/* 		     int *kdx); */
-int mygenmmd_(int *neq, int *fxadj, int *adjncy, int *winvp,
-		     int *wperm, int *delta, int *fchild, int *parent,
-		     int *sibling, int *marker, int *maxint, int *nofsub,
-		     int *kdx)
-  {
-    printf("Function definition not found.\n");
-    return 0;
-  }
+// The minimum degree ordering (genmmd.f) is not compiled, so
+// LSPARSE= 1 uses the reverse Cuthill-McKee ordering.
 void gennd(int neqns, int **padj, int *mask, int *perm, 
 	   int *xls, int *ls, int *work);
 void forminv(int neqns, int *perm, int *invp);
@@ -78,6 +68,7 @@ int nodfac(int *perm, int *invp, int **padj, int *ancstr , int *list, int neqns,
 	   int nblks, int *xblk, int *envlen, OFFDBLK **segfirst, 
 	   OFFDBLK **first, int *rowblks );
 int setenvlpe(int neqns, double **penv, int *envlen);
+}
 
 
 
@@ -90,170 +81,150 @@ int XC::symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
 		     OFFDBLK **firstMY, double ***penvMY, double **diagMY)
 
 {
-//     int delta, maxint;
-//     int nofsub, kdx;
-//     int ndnz;
-//     int *marker;
-//     int *winvp, *wperm;
-//     int i;
-//     int *perm, *parent, *fchild, *sibling;
-//     int **padj;
-
-//     int nblks;
-//     int *xblk;
-//     int *invp;
-//     int *rowblks;
-//     OFFDBLK **begblk;
-//     OFFDBLK *first;
-//     double **penv;
-//     double *diag;
-
-
-//  /* set up storage space and pointers */ 
-
-//     perm = (int *)calloc(neq +1   , sizeof(int)) ;
-//     invp = (int *)calloc(neq +1   , sizeof(int)) ;
-//     parent = (int *)calloc(neq +1 , sizeof(int)) ;
-//     fchild = (int *)calloc(neq +1 , sizeof(int)) ;
-//     sibling = (int *)calloc(neq +1, sizeof(int)) ;
-//     marker = (int *) calloc(neq +1, sizeof(int)) ;
-//     winvp  = (int *) calloc(neq +1, sizeof(int)) ;
-//     wperm  = (int *) calloc(neq +1, sizeof(int)) ;
-//     assert( perm && invp && parent && fchild && sibling && marker
-// 	    && winvp && wperm != nullptr) ;
-
-//     kdx = 0;
-//     delta = 1;
-//     maxint = 99999999;
-//     nofsub = 99999999;
-
-//  /* Using (fxadj, adjncy) pair to form the padj  */
-
-//     for(i=0; i<=neq; i++) {
-//         fxadj[i]++;
-//     }
-//     padj = (int **)calloc(neq+1,sizeof(int *)) ;
-//     assert(padj != nullptr) ;
-//     padj[0] = (int *)calloc(fxadj[neq]+1, sizeof(int)) ;
-//     assert(padj[0] != nullptr) ;
-//     XC::copyi(fxadj[neq], adjncy, padj[0]);
-//     for (i=1; i<=neq; i++)
-//        padj[i] = padj[0] + fxadj[i] - 1;
-//     for (i=0; i<fxadj[neq]-1; i++)
-//        adjncy[i]++ ;
-
-//  /* Choose different ordering schema */
-
-//     switch(LSPARSE)
-//     {
-//        case 1:
-//    /* Now call minimum degree ordering  ( a fortran subroutine) */
-// 	 mygenmmd_( &neq, fxadj, adjncy, winvp, wperm, &delta, fchild, parent,
-// 		    sibling, marker, &maxint, &nofsub, &kdx ) ;
-//          /* reset subscripts for c rather than fortran */
-//          for (i=0;i<=neq;i++)
-//          {
-//             winvp[i]-- ;
-//             wperm[i]-- ;
-//          }
-//          break ;
-
-//       case 2:
-// 	/* Now call the nested dissection ordering */
-
-//          gennd(neq,padj,marker,wperm,fchild,sibling,parent) ;
-//          forminv(neq,wperm,winvp) ;
-//          break ; 
-
-//       case 3:
-// 	/* Now call the general reverse chuthill-mckee ordering */
-
-//          genrcm(neq, padj, wperm, marker, fchild, sibling ) ;
-//          forminv(neq,wperm, winvp) ;
-//          break ;
-//    }
-
-//    /* free up space used just for mygenmmd and the fortran program */
-//    /*
-//     free(fxadj);
-//     free(adjncy);
-//    */
-
-//    rowblks = (int *)calloc(neq+1,sizeof(int)) ;
-//    assert(rowblks != 0) ;
-
-// /* set up the elimination tree, perform postordering           */
-//    if (LSPARSE < 4) {
-//        nblks = pfordr( neq, padj, perm, invp, parent, fchild, sibling,
-// 		       winvp, wperm, marker, rowblks ) ;
-//    } 
-//    else { 
-//       for (i=0;i<=neq;i++)
-//       { 
-// 	 invp[i] = i ;   
-// 	 perm[i] = i ;
-// 	 parent[i] = neq ;
-// 	 rowblks[i] = 0 ;
-//       }
-//       marker[0] = 0 ;
-//       marker[1] = neq ;
-//       nblks = 1 ;
-//    }
+    int ndnz;
+    int *marker;
+    int *winvp, *wperm;
+    int i;
+    int *perm, *parent, *fchild, *sibling;
+    int **padj;
+
+    int nblks;
+    int *xblk;
+    int *invp;
+    int *rowblks;
+    OFFDBLK **begblk;
+    OFFDBLK *first;
+    double **penv;
+    double *diag;
+
+
+ /* set up storage space and pointers */ 
+
+    perm = (int *)calloc(neq +1   , sizeof(int)) ;
+    invp = (int *)calloc(neq +1   , sizeof(int)) ;
+    parent = (int *)calloc(neq +1 , sizeof(int)) ;
+    fchild = (int *)calloc(neq +1 , sizeof(int)) ;
+    sibling = (int *)calloc(neq +1, sizeof(int)) ;
+    marker = (int *) calloc(neq +1, sizeof(int)) ;
+    winvp  = (int *) calloc(neq +1, sizeof(int)) ;
+    wperm  = (int *) calloc(neq +1, sizeof(int)) ;
+    assert( perm && invp && parent && fchild && sibling && marker
+	    && winvp && wperm != nullptr) ;
+
+ /* Using (fxadj, adjncy) pair to form the padj  */
+
+    for(i=0; i<=neq; i++) {
+        fxadj[i]++;
+    }
+    padj = (int **)calloc(neq+1,sizeof(int *)) ;
+    assert(padj != nullptr) ;
+    padj[0] = (int *)calloc(fxadj[neq]+1, sizeof(int)) ;
+    assert(padj[0] != nullptr) ;
+    copyi(fxadj[neq], adjncy, padj[0]);
+    for (i=1; i<=neq; i++)
+       padj[i] = padj[0] + fxadj[i] - 1;
+    for (i=0; i<fxadj[neq]-1; i++)
+       adjncy[i]++ ;
+
+ /* Choose different ordering schema */
+
+    switch(LSPARSE)
+    {
+      case 2:
+	/* Now call the nested dissection ordering */
+
+         gennd(neq,padj,marker,wperm,fchild,sibling,parent) ;
+         forminv(neq,wperm,winvp) ;
+         break ; 
+
+      default:
+	/* Now call the general reverse chuthill-mckee ordering
+	   (also used instead of the minimum degree ordering) */
+
+         genrcm(neq, padj, wperm, marker, fchild, sibling ) ;
+         forminv(neq,wperm, winvp) ;
+         break ;
+   }
+
+   /* free up space used just for the ordering */
+   /*
+    free(fxadj);
+    free(adjncy);
+   */
+
+   rowblks = (int *)calloc(neq+1,sizeof(int)) ;
+   assert(rowblks != 0) ;
+
+/* set up the elimination tree, perform postordering           */
+   if (LSPARSE < 4) {
+       nblks = pfordr( neq, padj, perm, invp, parent, fchild, sibling,
+		       winvp, wperm, marker, rowblks ) ;
+   } 
+   else { 
+      for (i=0;i<=neq;i++)
+      { 
+	 invp[i] = i ;   
+	 perm[i] = i ;
+	 parent[i] = neq ;
+	 rowblks[i] = 0 ;
+      }
+      marker[0] = 0 ;
+      marker[1] = neq ;
+      nblks = 1 ;
+   }
          
-//    free(winvp) ;
-//    free(wperm) ;
-//    free(sibling) ;
-
-// /*  set up xblk profile blocks  and space for numerical values */
-//    xblk = (int *)calloc(nblks+1, sizeof(int)) ;
-//    begblk = (OFFDBLK **)  calloc(nblks+1, sizeof(OFFDBLK *)) ;
-//    assert(xblk && begblk != nullptr) ;
+   free(winvp) ;
+   free(wperm) ;
+   free(sibling) ;
+
+/*  set up xblk profile blocks  and space for numerical values */
+   xblk = (int *)calloc(nblks+1, sizeof(int)) ;
+   begblk = (OFFDBLK **)  calloc(nblks+1, sizeof(OFFDBLK *)) ;
+   assert(xblk && begblk != nullptr) ;
          
-// /* set up xblk index: the begining row/column of each block */      
+/* set up xblk index: the begining row/column of each block */      
         
-//    pfblk( nblks, xblk, marker );
+   pfblk( nblks, xblk, marker );
         
-// /*       -------------------------------------------------
-//          perform the symbolic factorization and obtain the
-//          number of nonzeros
-//          -------------------------------------------------
-// */  
+/*       -------------------------------------------------
+         perform the symbolic factorization and obtain the
+         number of nonzeros
+         -------------------------------------------------
+*/  
            
-//    nodfac(perm, invp, padj, parent, fchild , neq, nblks,
-// 	  xblk, marker, begblk, &first, rowblks) ;
-
-//    free(perm) ;
-//    free(parent) ;
-//    free(fchild) ;
-//    free(padj[0]) ;
-//    free(padj);
-
-//    penv = (double **)calloc(neq + 1, sizeof(double *)) ;
-//    diag = (double *)calloc(neq + 1,sizeof(double )) ;
-//    assert ( penv && diag != nullptr) ;
-//    ndnz = setenvlpe(neq, penv, marker) ;
+   nodfac(perm, invp, padj, parent, fchild , neq, nblks,
+	  xblk, marker, begblk, &first, rowblks) ;
+
+   free(perm) ;
+   free(parent) ;
+   free(fchild) ;
+   free(padj[0]) ;
+   free(padj);
+
+   penv = (double **)calloc(neq + 1, sizeof(double *)) ;
+   diag = (double *)calloc(neq + 1,sizeof(double )) ;
+   assert ( penv && diag != nullptr) ;
+   ndnz = setenvlpe(neq, penv, marker) ;
         
-//    free(marker);
-
-//    *xblkMY = xblk;
-//    *invpMY = invp;
-//    *rowblksMY = rowblks;
-//    *begblkMY = begblk;
-//    *firstMY = first;
-//    *penvMY = penv;
-//    *diagMY = diag;
-
-
-//    for(i=0; i<=neq; i++) {
-//        fxadj[i]--;
-//    }
-//    for (i=0; i<fxadj[neq]; i++) {
-//        adjncy[i]-- ;
-//    }
-
-//   return(nblks);
-  std::cerr << "XC::symFactorization; doesn't work." << std::endl;
-  return 0;
+   free(marker);
+
+   *xblkMY = xblk;
+   *invpMY = invp;
+   *rowblksMY = rowblks;
+   *begblkMY = begblk;
+   *firstMY = first;
+   *penvMY = penv;
+   *diagMY = diag;
+
+
+   for(i=0; i<=neq; i++) {
+       fxadj[i]--;
+   }
+   for (i=0; i<fxadj[neq]; i++) {
+       adjncy[i]-- ;
+   }
+
+  return(nblks);
 }
 
 
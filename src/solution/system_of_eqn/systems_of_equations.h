@@ -39,7 +39,7 @@
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSolver.h>
 #include "solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h"
-//#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/DistributedBandSPDLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/diagonal/DiagonalSOE.h>
 #include <solution/system_of_eqn/linearSOE/diagonal/DistributedDiagonalSOE.h>
@@ -55,7 +55,7 @@
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectBlockSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h>
-//#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 //#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSkypackSolver.h>
 #include "solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h"
 #include "solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h"
@@ -68,6 +68,8 @@
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/cg/ConjugateGradientSolver.h>
+#include <solution/system_of_eqn/linearSOE/cg/MatrixFreeLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/cg/MatrixFreePCGSolver.h>
 
 #include <solution/system_of_eqn/eigenSOE/EigenSOE.h>
 #include <solution/system_of_eqn/eigenSOE/ArpackSOE.h>
@@ -80,6 +82,7 @@
 #include <solution/system_of_eqn/eigenSOE/EigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/BandArpackppSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymArpackSolver.h>
+#include <solution/system_of_eqn/eigenSOE/SymLanczosSolver.h>
 #include <solution/system_of_eqn/eigenSOE/BandArpackSolver.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSolver.h>
@@ -93,6 +96,9 @@
 #else
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SuperLU.h>
 #endif
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SupernodalCholeskySolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColAMGSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenRowAMGSolver.h>
 #ifdef _PETSC
 #include "solution/system_of_eqn/linearSOE/petsc/PetscSOE.h"
 #include "solution/system_of_eqn/linearSOE/petsc/PetscSolver.h"
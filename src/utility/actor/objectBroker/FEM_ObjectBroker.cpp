@@ -936,6 +936,9 @@ XC::DataOutputHandler *XC::FEM_ObjectBroker::getPtrNewDataOutputHandler(int clas
         case DATAHANDLER_TAGS_DataOutputDatabaseHandler:
              return new DataOutputDatabaseHandler();
 
+        case DATAHANDLER_TAGS_DataOutputHDF5Handler:
+             return new DataOutputHDF5Handler();
+
         default:
              std::cerr << "FEM_ObjectBroker::getPtrNewDataOutputHandler - ";
              std::cerr << " - no XC::DataOutputHandler type exists for class tag ";
@@ -1164,6 +1167,9 @@ XC::TransientIntegrator *XC::FEM_ObjectBroker::getNewTransientIntegrator(int cla
         case INTEGRATOR_TAGS_CentralDifferenceNoDamping:
           return new CentralDifferenceNoDamping(nullptr);      // must recvSelf
 
+        case INTEGRATOR_TAGS_CentralDifferenceLumpedMass:
+          return new CentralDifferenceLumpedMass(nullptr);      // must recvSelf
+
         case INTEGRATOR_TAGS_CentralDifferenceAlternative:
           return new CentralDifferenceAlternative(nullptr);      // must recvSelf
 
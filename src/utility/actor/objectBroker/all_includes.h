@@ -247,6 +247,7 @@
 #include "utility/handler/DataOutputStreamHandler.h"
 #include "utility/handler/DataOutputFileHandler.h"
 #include "utility/handler/DataOutputDatabaseHandler.h"
+#include "utility/handler/DataOutputHDF5Handler.h"
 
 #include "utility/recorder/NodeRecorder.h"
 #include "utility/recorder/ElementRecorder.h"
@@ -432,5 +433,7 @@
 #include "utility/database/NEESData.h"
 #include "utility/database/MySqlDatastore.h"
 #include "utility/database/FileDatastore.h"
+#include "utility/database/MemoryDatastore.h"
+#include "utility/database/SnapshotDatastore.h"
 
 #endif
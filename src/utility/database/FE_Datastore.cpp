@@ -167,6 +167,21 @@ int XC::FE_Datastore::commitState(int commitTag)
     return res;
   }
 
+//! @brief Removes the state identified by commitTag from the list
+//! of saved states (used by the subclasses that can free the data).
+void XC::FE_Datastore::forgetState(int commitTag)
+  { savedStates.erase(commitTag); }
+
+//! @brief Adds the state identified by commitTag to the list of saved
+//! states (used by the subclasses that can read the states saved by a
+//! previous run).
+void XC::FE_Datastore::rememberState(int commitTag)
+  { savedStates.insert(commitTag); }
+
+//! @brief Empties the list of saved states.
+void XC::FE_Datastore::forgetAllStates(void)
+  { savedStates.clear(); }
+
 //! @brief Returns true if the state identified by commitTag was
 //! previously saved on the database.
 bool XC::FE_Datastore::isSaved(int commitTag) const
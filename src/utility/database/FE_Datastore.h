@@ -86,6 +86,9 @@ class FE_Datastore: public Channel
     std::set<int> savedStates;
   protected:
     FEM_ObjectBroker *getObjectBroker(void);
+    void forgetState(int commitTag);
+    void rememberState(int commitTag);
+    void forgetAllStates(void);
     const Preprocessor *getPreprocessor(void) const;
     Preprocessor *getPreprocessor(void);
   public:
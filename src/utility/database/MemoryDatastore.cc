@@ -0,0 +1,157 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryDatastore.cc
+
+#include "MemoryDatastore.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include <limits>
+#include <algorithm>
+
+//! @brief Constructor.
+XC::MemoryDatastore::MemoryDatastore(Preprocessor &preprocessor, FEM_ObjectBroker &theObjBroker)
+  :FE_Datastore(preprocessor, theObjBroker) {}
+
+//! @brief Removes from the container the data corresponding to the
+//! commit tag being passed as parameter.
+template <class C>
+void XC::MemoryDatastore::erase_commit_tag(C &c,const int &commitTag)
+  {
+    typename C::iterator first= c.lower_bound(key_type(commitTag,std::numeric_limits<int>::min()));
+    typename C::iterator last= c.upper_bound(key_type(commitTag,std::numeric_limits<int>::max()));
+    c.erase(first,last);
+  }
+
+//! @brief Stores the data in the container.
+template <class C,class T>
+int XC::MemoryDatastore::store(C &c,const int &dbTag,const int &commitTag,const T *ptr,const int &sz)
+  {
+    typename C::mapped_type &v= c[key_type(commitTag,dbTag)];
+    v.assign(ptr,ptr+sz);
+    return 0;
+  }
+
+//! @brief Retrieves the data from the container.
+template <class C,class T>
+int XC::MemoryDatastore::retrieve(const C &c,const int &dbTag,const int &commitTag,T *ptr,const int &sz,const std::string &objType) const
+  {
+    typename C::const_iterator i= c.find(key_type(commitTag,dbTag));
+    if(i==c.end())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; " << objType << " with dbTag: " << dbTag
+                  << " and commitTag: " << commitTag
+                  << " not found." << std::endl;
+        return -1;
+      }
+    const typename C::mapped_type &v= i->second;
+    if(v.size()!=size_t(sz))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; " << objType << " with dbTag: " << dbTag
+                  << " and commitTag: " << commitTag
+                  << " has size: " << v.size()
+                  << " (" << sz << " expected)." << std::endl;
+        return -2;
+      }
+    std::copy(v.begin(),v.end(),ptr);
+    return 0;
+  }
+
+//! @brief Not implemented (as in the other datastores).
+int XC::MemoryDatastore::sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not yet implemented\n";
+    return -1;
+  }
+
+//! @brief Not implemented (as in the other datastores).
+int XC::MemoryDatastore::recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not yet implemented\n";
+    return -1;
+  }
+
+//! @brief Stores the matrix.
+int XC::MemoryDatastore::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+  { return store(matrices,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize()); }
+
+//! @brief Retrieves the matrix (it must have the right size).
+int XC::MemoryDatastore::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+  { return retrieve(matrices,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),"matrix"); }
+
+//! @brief Stores the vector.
+int XC::MemoryDatastore::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+  { return store(vectors,dbTag,commitTag,theVector.getDataPtr(),theVector.Size()); }
+
+//! @brief Retrieves the vector (it must have the right size).
+int XC::MemoryDatastore::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+  { return retrieve(vectors,dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),"vector"); }
+
+//! @brief Stores the ID.
+int XC::MemoryDatastore::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+  { return store(ids,dbTag,commitTag,theID.getDataPtr(),theID.Size()); }
+
+//! @brief Retrieves the ID (it must have the right size).
+int XC::MemoryDatastore::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+  { return retrieve(ids,dbTag,commitTag,theID.getDataPtr(),theID.Size(),"ID"); }
+
+//! @brief Frees the memory used by the state identified by the
+//! commit tag being passed as parameter.
+void XC::MemoryDatastore::clearState(int commitTag)
+  {
+    erase_commit_tag(matrices,commitTag);
+    erase_commit_tag(vectors,commitTag);
+    erase_commit_tag(ids,commitTag);
+    forgetState(commitTag);
+  }
+
+//! @brief Frees the memory used by all the saved states.
+void XC::MemoryDatastore::clearAll(void)
+  {
+    matrices.clear();
+    vectors.clear();
+    ids.clear();
+    forgetAllStates();
+  }
+
+//! @brief Returns the approximate amount of memory (in bytes)
+//! used to store the data.
+size_t XC::MemoryDatastore::getMemorySize(void) const
+  {
+    size_t retval= 0;
+    for(dbl_container::const_iterator i= matrices.begin();i!=matrices.end();i++)
+      retval+= i->second.size()*sizeof(double);
+    for(dbl_container::const_iterator i= vectors.begin();i!=vectors.end();i++)
+      retval+= i->second.size()*sizeof(double);
+    for(int_container::const_iterator i= ids.begin();i!=ids.end();i++)
+      retval+= i->second.size()*sizeof(int);
+    return retval;
+  }
@@ -0,0 +1,86 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryDatastore.h
+
+#ifndef MemoryDatastore_h
+#define MemoryDatastore_h
+
+#include "utility/database/FE_Datastore.h"
+#include <map>
+#include <vector>
+
+namespace XC {
+
+//! @ingroup Database
+//!
+//! @brief Keeps the saved states of the model in memory.
+//!
+//! Stores the data sent by the model objects (matrices, vectors and
+//! ID's) in containers indexed by commit tag and database tag. It's
+//! intended to keep intermediate states (i.e. the state reached by a
+//! load combination that will be used as starting point for another
+//! one) without the overhead of writing them to disk. The data is lost
+//! when the object is destroyed.
+class MemoryDatastore: public FE_Datastore
+  {
+  public:
+    typedef std::pair<int,int> key_type; //!< (commitTag, dbTag) pair.
+  private:
+    typedef std::map<key_type, std::vector<double> > dbl_container;
+    typedef std::map<key_type, std::vector<int> > int_container;
+    dbl_container matrices; //!< Data for the matrices.
+    dbl_container vectors; //!< Data for the vectors.
+    int_container ids; //!< Data for the ID's.
+
+    template <class C>
+    static void erase_commit_tag(C &,const int &);
+    template <class C,class T>
+    int store(C &,const int &,const int &,const T *,const int &);
+    template <class C,class T>
+    int retrieve(const C &,const int &,const int &,T *,const int &,const std::string &) const;
+  public:
+    MemoryDatastore(Preprocessor &, FEM_ObjectBroker &theBroker);
+
+    int sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress= nullptr);    
+    int recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress= nullptr);        
+
+    int sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress= nullptr);
+    int recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress= nullptr);
+  
+    int sendVector(int dbTag, int commitTag, const Vector &,ChannelAddress *theAddress= nullptr);
+    int recvVector(int dbTag, int commitTag, Vector &,ChannelAddress *theAddress= nullptr);
+  
+    int sendID(int dbTag, int commitTag, const ID &,ChannelAddress *theAddress= nullptr);
+    int recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress= nullptr);
+
+    void clearState(int commitTag);
+    void clearAll(void);
+    size_t getMemorySize(void) const;
+  };
+} // end of XC namespace
+
+#endif
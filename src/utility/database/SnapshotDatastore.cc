@@ -0,0 +1,656 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SnapshotDatastore.cc
+
+#include "SnapshotDatastore.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include <zlib.h>
+#include <cstring>
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace {
+  const char snapshot_magic[8]= {'X','C','S','N','A','P','0','1'};
+  const uint32_t chunk_block= 1; //!< block with object data.
+  const uint32_t index_block= 2; //!< block with the index of a snapshot.
+
+  const int matrix_type= 1;
+  const int vector_type= 2;
+  const int id_type= 3;
+
+  //! @brief Header of each block of the file.
+  struct BlockHeader
+    {
+      uint32_t type; //!< chunk_block or index_block.
+      int32_t commitTag; //!< commit tag of the snapshot.
+      uint64_t rawSize; //!< size of the uncompressed data.
+      uint64_t storedSize; //!< size of the data that follows the header.
+    };
+
+  //! @brief Chunk description in the index block.
+  struct ChunkEntry
+    {
+      uint64_t fileOffset;
+      uint64_t rawSize;
+      uint64_t storedSize;
+    };
+
+  //! @brief Object description in the index block.
+  struct RecordEntry
+    {
+      int32_t type;
+      int32_t dbTag;
+      uint64_t chunk;
+      uint64_t offset;
+      uint64_t numBytes;
+    };
+
+  //! @brief Appends the bytes of the object to the buffer.
+  template <class T>
+  void put(std::vector<char> &buffer,const T &t)
+    {
+      const char *ptr= reinterpret_cast<const char *>(&t);
+      buffer.insert(buffer.end(),ptr,ptr+sizeof(T));
+    }
+
+  //! @brief Reads an object from the buffer (returns false if there
+  //! are not enough bytes).
+  template <class T>
+  bool get(const char *&ptr,const char *end,T &t)
+    {
+      if(ptr+sizeof(T)>end)
+        return false;
+      memcpy(&t,ptr,sizeof(T));
+      ptr+= sizeof(T);
+      return true;
+    }
+}
+
+//! @brief Constructor.
+//!
+//! @param file_name: name of the snapshot file (if it exists its
+//! snapshots can be restored).
+//! @param preprocessor: preprocessor used to build the finite element model.
+//! @param theObjBroker: deals with object serialization.
+XC::SnapshotDatastore::SnapshotDatastore(const std::string &file_name, Preprocessor &preprocessor, FEM_ObjectBroker &theObjBroker)
+  :FE_Datastore(preprocessor, theObjBroker), fileName(file_name), fd(-1),
+   mappedData(nullptr), mappedSize(0), fileSize(0),
+   compressionLevel(1), chunkSize(1<<20)
+  { open_file(); }
+
+//! @brief Destructor (writes the pending data).
+XC::SnapshotDatastore::~SnapshotDatastore(void)
+  {
+    while(!pending.empty())
+      flush(pending.begin()->first);
+    close_file();
+  }
+
+//! @brief Returns the record with the key being passed as parameter
+//! (nullptr if not found).
+//! @param records: records sorted by key.
+//! @param key: key to search for.
+const XC::SnapshotDatastore::Record *XC::SnapshotDatastore::find_record(const record_vector &records,const key_type &key)
+  {
+    record_vector::const_iterator i= std::lower_bound(records.begin(),records.end(),key,[](const std::pair<key_type,Record> &r,const key_type &k)
+                                                      { return r.first<k; });
+    if((i!=records.end()) && (i->first==key))
+      return &(i->second);
+    return nullptr;
+  }
+
+//! @brief Returns true if the chunks of the snapshot lie inside
+//! the first bytes of the file and its records inside its chunks.
+//! @param snap: snapshot to check.
+//! @param limit: number of bytes of the file that can be
+//! occupied by the chunks.
+bool XC::SnapshotDatastore::check_snapshot(const Snapshot &snap,const size_t &limit)
+  {
+    for(std::vector<Chunk>::const_iterator i= snap.chunks.begin();i!=snap.chunks.end();i++)
+      {
+        if((i->storedSize>limit) || (i->fileOffset>limit-i->storedSize))
+          return false;
+        if(i->storedSize>i->rawSize)
+          return false;
+      }
+    for(record_vector::const_iterator i= snap.records.begin();i!=snap.records.end();i++)
+      {
+        const Record &r= i->second;
+        if(r.chunk>=snap.chunks.size())
+          return false;
+        const size_t rawSize= snap.chunks[r.chunk].rawSize;
+        if((r.numBytes>rawSize) || (r.offset>rawSize-r.numBytes))
+          return false;
+        if((i!=snap.records.begin()) && !((i-1)->first<i->first)) //find_record needs them sorted.
+          return false;
+      }
+    return true;
+  }
+
+//! @brief Opens the file and reads the index of the snapshots
+//! stored on it.
+void XC::SnapshotDatastore::open_file(void)
+  {
+    fd= open(fileName.c_str(),O_RDWR|O_CREAT,0644);
+    if(fd<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; ERROR can't open file: '" << fileName
+                  << "': " << strerror(errno) << std::endl;
+        return;
+      }
+    struct stat st;
+    if(fstat(fd,&st)==0)
+      fileSize= st.st_size;
+    if(fileSize==0)
+      append(snapshot_magic,sizeof(snapshot_magic));
+    else
+      read_index();
+  }
+
+//! @brief Closes the file.
+void XC::SnapshotDatastore::close_file(void)
+  {
+    releaseCache();
+    unmap_file();
+    if(fd>=0)
+      close(fd);
+    fd= -1;
+  }
+
+//! @brief Maps the file in memory (if it has grown since the
+//! last call).
+bool XC::SnapshotDatastore::map_file(void)
+  {
+    if(mappedData && (mappedSize==fileSize))
+      return true;
+    unmap_file();
+    if((fd<0) || (fileSize==0))
+      return false;
+    void *ptr= mmap(nullptr,fileSize,PROT_READ,MAP_SHARED,fd,0);
+    if(ptr==MAP_FAILED)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; ERROR can't map file: '" << fileName
+                  << "': " << strerror(errno) << std::endl;
+        return false;
+      }
+    mappedData= static_cast<const char *>(ptr);
+    mappedSize= fileSize;
+    return true;
+  }
+
+//! @brief Removes the memory map.
+void XC::SnapshotDatastore::unmap_file(void)
+  {
+    if(mappedData)
+      munmap(const_cast<char *>(mappedData),mappedSize);
+    mappedData= nullptr;
+    mappedSize= 0;
+  }
+
+//! @brief Reads the indexes of the snapshots stored on the file.
+//!
+//! If the last block is incomplete (i.e. the program was interrupted
+//! while writing it) the file is truncated at the end of the previous
+//! block. The snapshots with an inconsistent index are discarded
+//! (and hide the previous snapshots with the same commit tag).
+int XC::SnapshotDatastore::read_index(void)
+  {
+    if(!map_file())
+      return -1;
+    if((fileSize<sizeof(snapshot_magic)) || (memcmp(mappedData,snapshot_magic,sizeof(snapshot_magic))!=0))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; ERROR file: '" << fileName
+                  << "' is not a snapshot file." << std::endl;
+        close_file();
+        return -1;
+      }
+    const char *end= mappedData+fileSize;
+    const char *ptr= mappedData+sizeof(snapshot_magic);
+    while(ptr<end)
+      {
+        const char *blockBegin= ptr;
+        BlockHeader header;
+        if(!get(ptr,end,header) || (header.storedSize>size_t(end-ptr)))
+          {
+            const size_t validSize= blockBegin-mappedData;
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING incomplete block at the end of file: '"
+                      << fileName << "', it will be ignored." << std::endl;
+            unmap_file();
+            if(ftruncate(fd,validSize)==0)
+              fileSize= validSize;
+            return -2;
+          }
+        if(header.type==index_block)
+          {
+            const char *p= ptr;
+            const char *indexEnd= ptr+header.storedSize;
+            std::vector<char> buffer;
+            if(header.storedSize<header.rawSize) //Compressed.
+              {
+                buffer.resize(header.rawSize);
+                uLongf destLen= header.rawSize;
+                if((uncompress(reinterpret_cast<Bytef *>(buffer.data()),&destLen,reinterpret_cast<const Bytef *>(ptr),header.storedSize)!=Z_OK) || (destLen!=header.rawSize))
+                  buffer.clear();
+                p= buffer.data();
+                indexEnd= p+buffer.size();
+              }
+            Snapshot snap;
+            uint64_t numChunks= 0;
+            bool ok= get(p,indexEnd,numChunks);
+            for(uint64_t i= 0;ok && (i<numChunks);i++)
+              {
+                ChunkEntry c;
+                ok= get(p,indexEnd,c);
+                Chunk chunk= {c.fileOffset,c.rawSize,c.storedSize};
+                snap.chunks.push_back(chunk);
+              }
+            uint64_t numRecords= 0;
+            ok= ok && get(p,indexEnd,numRecords);
+            for(uint64_t i= 0;ok && (i<numRecords);i++)
+              {
+                RecordEntry r;
+                ok= get(p,indexEnd,r);
+                Record record= {r.chunk,r.offset,r.numBytes};
+                snap.records.push_back(std::make_pair(key_type(r.type,r.dbTag),record));
+              }
+            //The chunks of a snapshot are written before its index.
+            if(ok && check_snapshot(snap,blockBegin-mappedData))
+              {
+                snapshots[header.commitTag]= snap;
+                rememberState(header.commitTag);
+              }
+            else
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; ERROR corrupted index of the snapshot: "
+                          << header.commitTag << ", it will be ignored."
+                          << std::endl;
+                snapshots.erase(header.commitTag);
+                forgetState(header.commitTag);
+              }
+          }
+        ptr+= header.storedSize;
+      }
+    return 0;
+  }
+
+//! @brief Writes the data at the end of the file.
+int XC::SnapshotDatastore::append(const void *data,const size_t &sz)
+  {
+    if(fd<0)
+      return -1;
+    const char *ptr= static_cast<const char *>(data);
+    size_t written= 0;
+    while(written<sz)
+      {
+        const ssize_t n= pwrite(fd,ptr+written,sz-written,fileSize+written);
+        if(n<0)
+          {
+            if(errno==EINTR)
+              continue;
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; ERROR writing file: '" << fileName
+                      << "': " << strerror(errno) << std::endl;
+            return -1;
+          }
+        written+= n;
+      }
+    fileSize+= sz;
+    return 0;
+  }
+
+//! @brief Writes the data sent with the commit tag being passed
+//! as parameter as a new snapshot at the end of the file.
+int XC::SnapshotDatastore::flush(const int &commitTag)
+  {
+    std::map<int,PendingSnapshot>::iterator p= pending.find(commitTag);
+    if(p==pending.end())
+      return 0;
+    const PendingSnapshot &data= p->second;
+    const record_vector &sent= data.records;
+    const size_t numSent= sent.size();
+    //Sort the objects by key keeping the last version of each one.
+    std::vector<size_t> order(numSent);
+    for(size_t i= 0;i<numSent;i++)
+      order[i]= i;
+    std::stable_sort(order.begin(),order.end(),[&sent](const size_t &a,const size_t &b)
+                     { return sent[a].first<sent[b].first; });
+    std::vector<size_t> position(numSent,numSent); //Position in the index (numSent if overwritten).
+    Snapshot snap;
+    for(size_t k= 0;k<numSent;k++)
+      {
+        const size_t i= order[k];
+        if((k+1==numSent) || (sent[order[k+1]].first!=sent[i].first))
+          {
+            position[i]= snap.records.size();
+            snap.records.push_back(std::make_pair(sent[i].first,Record()));
+          }
+      }
+    std::vector<char> out; //Data to write.
+    std::vector<char> chunk; //Chunk being filled.
+    chunk.reserve(chunkSize);
+    std::vector<Bytef> compressed;
+    //Appends a block to the output buffer (compressed if possible).
+    auto write_block= [&](const uint32_t &type,const std::vector<char> &raw)
+      {
+        BlockHeader header= {type,commitTag,uint64_t(raw.size()),uint64_t(raw.size())};
+        const char *src= raw.data();
+        if(compressionLevel>0)
+          {
+            uLongf destLen= compressBound(raw.size());
+            compressed.resize(destLen);
+            const int zret= compress2(compressed.data(),&destLen,reinterpret_cast<const Bytef *>(raw.data()),raw.size(),compressionLevel);
+            if((zret==Z_OK) && (destLen<raw.size()))
+              {
+                header.storedSize= destLen;
+                src= reinterpret_cast<const char *>(compressed.data());
+              }
+          }
+        put(out,header);
+        const Chunk retval= {fileSize+out.size(),header.rawSize,header.storedSize};
+        out.insert(out.end(),src,src+header.storedSize);
+        return retval;
+      };
+    //Appends the current chunk to the output buffer.
+    auto write_chunk= [&](void)
+      {
+        snap.chunks.push_back(write_block(chunk_block,chunk));
+        chunk.clear();
+      };
+    //The objects are written in the order they were sent, so
+    //the objects restored together are in the same chunks.
+    for(size_t i= 0;i<numSent;i++)
+      {
+        if(position[i]==numSent) //Overwritten.
+          continue;
+        const Record &r= sent[i].second;
+        if(!chunk.empty() && (chunk.size()+r.numBytes>chunkSize))
+          write_chunk();
+        const Record stored= {snap.chunks.size(),chunk.size(),r.numBytes};
+        snap.records[position[i]].second= stored;
+        const char *src= data.data.data()+r.offset;
+        chunk.insert(chunk.end(),src,src+r.numBytes);
+      }
+    if(!chunk.empty())
+      write_chunk();
+    //Index.
+    std::vector<char> index;
+    put(index,uint64_t(snap.chunks.size()));
+    for(std::vector<Chunk>::const_iterator i= snap.chunks.begin();i!=snap.chunks.end();i++)
+      {
+        const ChunkEntry c= {uint64_t(i->fileOffset),uint64_t(i->rawSize),uint64_t(i->storedSize)};
+        put(index,c);
+      }
+    put(index,uint64_t(snap.records.size()));
+    for(record_vector::const_iterator i= snap.records.begin();i!=snap.records.end();i++)
+      {
+        const RecordEntry r= {i->first.first,i->first.second,uint64_t(i->second.chunk),uint64_t(i->second.offset),uint64_t(i->second.numBytes)};
+        put(index,r);
+      }
+    write_block(index_block,index);
+    pending.erase(p);
+    int retval= append(out.data(),out.size());
+    if(retval==0)
+      {
+        //Forget the chunks of the previous snapshot with the same tag.
+        std::map<std::pair<int,size_t>,std::vector<char> >::iterator first= chunkCache.lower_bound(std::make_pair(commitTag,size_t(0)));
+        std::map<std::pair<int,size_t>,std::vector<char> >::iterator last= chunkCache.lower_bound(std::make_pair(commitTag+1,size_t(0)));
+        chunkCache.erase(first,last);
+        snapshots[commitTag]= snap;
+      }
+    return retval;
+  }
+
+//! @brief Returns a pointer to the uncompressed data of the chunk.
+const char *XC::SnapshotDatastore::get_chunk(const int &commitTag,const size_t &i)
+  {
+    std::map<int,Snapshot>::const_iterator s= snapshots.find(commitTag);
+    if((s==snapshots.end()) || (i>=s->second.chunks.size()))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; ERROR chunk: " << i
+                  << " of the snapshot: " << commitTag
+                  << " doesn't exist." << std::endl;
+        return nullptr;
+      }
+    const Chunk &c= s->second.chunks[i];
+    if((c.fileOffset+c.storedSize>mappedSize) && !map_file())
+      return nullptr;
+    if(c.fileOffset+c.storedSize>mappedSize)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; ERROR chunk: " << i
+                  << " of the snapshot: " << commitTag
+                  << " is beyond the end of file: '" << fileName
+                  << "'." << std::endl;
+        return nullptr;
+      }
+    const char *src= mappedData+c.fileOffset;
+    if(c.storedSize==c.rawSize) //Not compressed.
+      return src;
+    const std::pair<int,size_t> key(commitTag,i);
+    std::map<std::pair<int,size_t>,std::vector<char> >::iterator j= chunkCache.find(key);
+    if(j==chunkCache.end())
+      {
+        std::vector<char> buffer(c.rawSize);
+        uLongf destLen= c.rawSize;
+        const int zret= uncompress(reinterpret_cast<Bytef *>(buffer.data()),&destLen,reinterpret_cast<const Bytef *>(src),c.storedSize);
+        if((zret!=Z_OK) || (destLen!=c.rawSize))
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; ERROR can't uncompress chunk: " << i
+                      << " of the snapshot: " << commitTag << std::endl;
+            return nullptr;
+          }
+        j= chunkCache.insert(std::make_pair(key,std::vector<char>())).first;
+        j->second.swap(buffer);
+      }
+    return j->second.data();
+  }
+
+//! @brief Stores the data of the object in the snapshot being written.
+int XC::SnapshotDatastore::store(const int &type,const int &dbTag,const int &commitTag,const void *ptr,const size_t &numBytes)
+  {
+    PendingSnapshot &p= pending[commitTag];
+    const Record r= {0,p.data.size(),numBytes};
+    p.records.push_back(std::make_pair(key_type(type,dbTag),r));
+    const char *src= static_cast<const char *>(ptr);
+    if(numBytes>0)
+      p.data.insert(p.data.end(),src,src+numBytes);
+    return 0;
+  }
+
+//! @brief Retrieves the data of the object.
+int XC::SnapshotDatastore::retrieve(const int &type,const int &dbTag,const int &commitTag,void *ptr,const size_t &numBytes,const std::string &objType)
+  {
+    const key_type key(type,dbTag);
+    const char *src= nullptr;
+    size_t storedBytes= 0;
+    std::map<int,PendingSnapshot>::const_iterator p= pending.find(commitTag);
+    if(p!=pending.end()) //Not written yet (the last version is the good one).
+      {
+        const record_vector &records= p->second.records;
+        for(record_vector::const_reverse_iterator i= records.rbegin();i!=records.rend();i++)
+          if(i->first==key)
+            {
+              src= p->second.data.data()+i->second.offset;
+              storedBytes= i->second.numBytes;
+              break;
+            }
+      }
+    if(!src)
+      {
+        std::map<int,Snapshot>::const_iterator s= snapshots.find(commitTag);
+        if(s!=snapshots.end())
+          {
+            const Record *i= find_record(s->second.records,key);
+            if(i)
+              {
+                const Record &r= *i;
+                const char *chunk= get_chunk(commitTag,r.chunk);
+                if(!chunk)
+                  return -3;
+                const size_t rawSize= s->second.chunks[r.chunk].rawSize;
+                if((r.numBytes>rawSize) || (r.offset>rawSize-r.numBytes))
+                  {
+                    std::cerr << getClassName() << "::" << __FUNCTION__
+                              << "; ERROR " << objType << " with dbTag: "
+                              << dbTag << " and commitTag: " << commitTag
+                              << " is outside its chunk." << std::endl;
+                    return -3;
+                  }
+                src= chunk+r.offset;
+                storedBytes= r.numBytes;
+              }
+          }
+      }
+    if(!src)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; " << objType << " with dbTag: " << dbTag
+                  << " and commitTag: " << commitTag
+                  << " not found." << std::endl;
+        return -1;
+      }
+    if(storedBytes!=numBytes)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; " << objType << " with dbTag: " << dbTag
+                  << " and commitTag: " << commitTag
+                  << " has " << storedBytes << " bytes ("
+                  << numBytes << " expected)." << std::endl;
+        return -2;
+      }
+    if(numBytes>0)
+      memcpy(ptr,src,numBytes);
+    return 0;
+  }
+
+//! @brief Saves the current state of the model and writes it
+//! at the end of the file.
+int XC::SnapshotDatastore::commitState(int commitTag)
+  {
+    pending.erase(commitTag);
+    int retval= FE_Datastore::commitState(commitTag);
+    if(retval>=0)
+      {
+        if(flush(commitTag)<0)
+          {
+            forgetState(commitTag);
+            retval= -1;
+          }
+      }
+    else
+      pending.erase(commitTag);
+    return retval;
+  }
+
+//! @brief Restores the state of the model and frees the
+//! decompressed chunks.
+int XC::SnapshotDatastore::restoreState(int commitTag)
+  {
+    const int retval= FE_Datastore::restoreState(commitTag);
+    releaseCache();
+    return retval;
+  }
+
+//! @brief Not implemented (as in the other datastores).
+int XC::SnapshotDatastore::sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not yet implemented\n";
+    return -1;
+  }
+
+//! @brief Not implemented (as in the other datastores).
+int XC::SnapshotDatastore::recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not yet implemented\n";
+    return -1;
+  }
+
+//! @brief Stores the matrix.
+int XC::SnapshotDatastore::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+  { return store(matrix_type,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize()*sizeof(double)); }
+
+//! @brief Retrieves the matrix (it must have the right size).
+int XC::SnapshotDatastore::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+  { return retrieve(matrix_type,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize()*sizeof(double),"matrix"); }
+
+//! @brief Stores the vector.
+int XC::SnapshotDatastore::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+  { return store(vector_type,dbTag,commitTag,theVector.getDataPtr(),theVector.Size()*sizeof(double)); }
+
+//! @brief Retrieves the vector (it must have the right size).
+int XC::SnapshotDatastore::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+  { return retrieve(vector_type,dbTag,commitTag,theVector.getDataPtr(),theVector.Size()*sizeof(double),"vector"); }
+
+//! @brief Stores the ID.
+int XC::SnapshotDatastore::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+  { return store(id_type,dbTag,commitTag,theID.getDataPtr(),theID.Size()*sizeof(int)); }
+
+//! @brief Retrieves the ID (it must have the right size).
+int XC::SnapshotDatastore::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+  { return retrieve(id_type,dbTag,commitTag,theID.getDataPtr(),theID.Size()*sizeof(int),"ID"); }
+
+//! @brief Sets the zlib compression level (0: no compression,
+//! 9: best compression).
+void XC::SnapshotDatastore::setCompressionLevel(const int &l)
+  { compressionLevel= std::max(0,std::min(l,9)); }
+
+//! @brief Sets the maximum size of the uncompressed chunks.
+void XC::SnapshotDatastore::setChunkSize(const size_t &sz)
+  { chunkSize= std::max(sz,size_t(4096)); }
+
+//! @brief Returns the size of the file (bytes).
+size_t XC::SnapshotDatastore::getFileSize(void) const
+  { return fileSize; }
+
+//! @brief Returns the number of chunks of the snapshot.
+size_t XC::SnapshotDatastore::getNumChunks(int commitTag) const
+  {
+    size_t retval= 0;
+    std::map<int,Snapshot>::const_iterator s= snapshots.find(commitTag);
+    if(s!=snapshots.end())
+      retval= s->second.chunks.size();
+    return retval;
+  }
+
+//! @brief Frees the memory used by the decompressed chunks.
+void XC::SnapshotDatastore::releaseCache(void)
+  { chunkCache.clear(); }
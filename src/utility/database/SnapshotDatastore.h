@@ -0,0 +1,151 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SnapshotDatastore.h
+
+#ifndef SnapshotDatastore_h
+#define SnapshotDatastore_h
+
+#include "utility/database/FE_Datastore.h"
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace XC {
+
+//! @ingroup Database
+//!
+//! @brief Stores the saved states of the model in a single binary file.
+//!
+//! The data sent by the model objects (matrices, vectors and ID's) while
+//! a state is saved is kept in memory and, when the preprocessor has
+//! sent all its data, it is appended to the file as a sequence of
+//! chunks (compressed with zlib if the compression level is greater
+//! than zero) followed by an index that gives the chunk and the offset
+//! of each object. The file is never rewritten: saving again a commit
+//! tag appends a new snapshot that hides the previous one.
+//!
+//! The file is read through a memory map and only the chunks that
+//! contain the requested objects are decompressed, so restoring part
+//! of the model (i.e. a single object with recvObj) doesn't read the
+//! whole snapshot. When the datastore is created over an existing file
+//! its index is rebuilt so the states saved by a previous run can be
+//! restored; the snapshots whose index points outside the file or
+//! outside its chunks are discarded. The data is written in the native
+//! byte order.
+class SnapshotDatastore: public FE_Datastore
+  {
+  public:
+    typedef std::pair<int,int> key_type; //!< (object type, dbTag) pair.
+  private:
+    //! @brief Position of the data of an object inside a snapshot.
+    struct Record
+      {
+        size_t chunk; //!< index of the chunk that contains the data.
+        size_t offset; //!< position of the data inside the chunk (bytes).
+        size_t numBytes; //!< size of the data (bytes).
+      };
+    //! @brief Position of a chunk inside the file.
+    struct Chunk
+      {
+        size_t fileOffset; //!< position of the chunk data in the file.
+        size_t rawSize; //!< size of the uncompressed data.
+        size_t storedSize; //!< size of the data in the file.
+      };
+    typedef std::vector<std::pair<key_type,Record> > record_vector;
+    //! @brief Index of a snapshot.
+    struct Snapshot
+      {
+        std::vector<Chunk> chunks; //!< chunks of the snapshot.
+        record_vector records; //!< objects of the snapshot sorted by key.
+      };
+    //! @brief Data of a snapshot not written yet.
+    struct PendingSnapshot
+      {
+        std::vector<char> data; //!< object data in the order it was sent.
+        record_vector records; //!< objects in the order they were sent (offsets refer to data).
+      };
+
+    std::string fileName; //!< name of the snapshot file.
+    int fd; //!< file descriptor.
+    const char *mappedData; //!< memory map of the file.
+    size_t mappedSize; //!< size of the memory map.
+    size_t fileSize; //!< size of the file.
+    int compressionLevel; //!< zlib compression level (0: no compression).
+    size_t chunkSize; //!< maximum size of the uncompressed chunks (bytes).
+    std::map<int,Snapshot> snapshots; //!< index of the saved snapshots.
+    std::map<int,PendingSnapshot> pending; //!< data not written yet.
+    std::map<std::pair<int,size_t>,std::vector<char> > chunkCache; //!< decompressed chunks.
+
+    static const Record *find_record(const record_vector &,const key_type &);
+    static bool check_snapshot(const Snapshot &,const size_t &);
+    void open_file(void);
+    void close_file(void);
+    bool map_file(void);
+    void unmap_file(void);
+    int read_index(void);
+    int append(const void *,const size_t &);
+    int flush(const int &);
+    const char *get_chunk(const int &,const size_t &);
+    int store(const int &,const int &,const int &,const void *,const size_t &);
+    int retrieve(const int &,const int &,const int &,void *,const size_t &,const std::string &);
+    SnapshotDatastore(const SnapshotDatastore &);
+    SnapshotDatastore &operator=(const SnapshotDatastore &);
+  public:
+    SnapshotDatastore(const std::string &, Preprocessor &, FEM_ObjectBroker &theBroker);
+    ~SnapshotDatastore(void);
+
+    int commitState(int commitTag);
+    int restoreState(int commitTag);
+
+    int sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress= nullptr);    
+    int recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress= nullptr);        
+
+    int sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress= nullptr);
+    int recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress= nullptr);
+  
+    int sendVector(int dbTag, int commitTag, const Vector &,ChannelAddress *theAddress= nullptr);
+    int recvVector(int dbTag, int commitTag, Vector &,ChannelAddress *theAddress= nullptr);
+  
+    int sendID(int dbTag, int commitTag, const ID &,ChannelAddress *theAddress= nullptr);
+    int recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress= nullptr);
+
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+    inline int getCompressionLevel(void) const
+      { return compressionLevel; }
+    void setCompressionLevel(const int &);
+    inline size_t getChunkSize(void) const
+      { return chunkSize; }
+    void setChunkSize(const size_t &);
+    size_t getFileSize(void) const;
+    size_t getNumChunks(int commitTag) const;
+    void releaseCache(void);
+  };
+} // end of XC namespace
+
+#endif
@@ -47,3 +47,18 @@ class_<XC::NEESData, bases<XC::FE_Datastore>, boost::noncopyable  >("NEESData",
 
 class_<XC::FileDatastore, bases<XC::FE_Datastore>, boost::noncopyable  >("FileDatastore", no_init)
   ;
+
+class_<XC::MemoryDatastore, bases<XC::FE_Datastore>, boost::noncopyable  >("MemoryDatastore", no_init)
+  .def("clearState",&XC::MemoryDatastore::clearState,"clearState(commitTag): frees the memory used by the state saved with the commit tag.")
+  .def("clearAll",&XC::MemoryDatastore::clearAll,"Frees the memory used by all the saved states.")
+  .add_property("memorySize",&XC::MemoryDatastore::getMemorySize,"Approximate amount of memory (in bytes) used by the saved states.")
+  ;
+
+class_<XC::SnapshotDatastore, bases<XC::FE_Datastore>, boost::noncopyable  >("SnapshotDatastore", no_init)
+  .add_property("fileName",make_function(&XC::SnapshotDatastore::getFileName,return_value_policy<copy_const_reference>()),"Name of the snapshot file.")
+  .add_property("compressionLevel",&XC::SnapshotDatastore::getCompressionLevel,&XC::SnapshotDatastore::setCompressionLevel,"zlib compression level (0: no compression, 9: best compression).")
+  .add_property("chunkSize",&XC::SnapshotDatastore::getChunkSize,&XC::SnapshotDatastore::setChunkSize,"Maximum size (in bytes) of the uncompressed chunks.")
+  .add_property("fileSize",&XC::SnapshotDatastore::getFileSize,"Size (in bytes) of the snapshot file.")
+  .def("getNumChunks",&XC::SnapshotDatastore::getNumChunks,"getNumChunks(commitTag): returns the number of chunks of the state saved with the commit tag.")
+  .def("releaseCache",&XC::SnapshotDatastore::releaseCache,"Frees the memory used by the decompressed chunks.")
+  ;
@@ -23,6 +23,7 @@
 
 #include "FEProblem.h"
 #include "python_interface.h"
+#include "utility/matrix/python_buffer.h"
 
 void export_utility(void)
   {
@@ -41,6 +42,7 @@ void export_utility(void)
 
 #include "actor/channel/python_interface.tcc"
 #include "database/python_interface.tcc"
+#include "handler/python_interface.tcc"
 #include "recorder/python_interface.tcc"
 
   }
@@ -0,0 +1,412 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DataOutputHDF5Handler.cc
+
+#include "utility/handler/DataOutputHDF5Handler.h"
+#include "utility/handler/DataOutputQueue.h"
+#include <utility/matrix/Vector.h>
+#include "utility/actor/actor/CommMetaData.h"
+#include <map>
+#include <set>
+#include <algorithm>
+#include <sys/stat.h>
+
+//! @brief HDF5 file opened by one or more handlers.
+struct XC::DataOutputHDF5Handler::SharedFile
+  {
+    hid_t id; //!< file identifier.
+    explicit SharedFile(const hid_t &i)
+      : id(i) {}
+    ~SharedFile(void)
+      {
+        std::lock_guard<std::recursive_mutex> hdf5_lock(get_hdf5_mutex());
+        if(id>=0)
+          H5Fclose(id);
+      }
+  };
+
+//! @brief Returns the mutex that serializes the calls to the
+//! HDF5 library.
+//!
+//! It must never be held while waiting for the writer threads
+//! (see DataOutputQueue::flushHandler), because they take it too.
+std::recursive_mutex &XC::DataOutputHDF5Handler::get_hdf5_mutex(void)
+  {
+    static std::recursive_mutex hdf5_mtx;
+    return hdf5_mtx;
+  }
+
+//! @brief Returns the open file with the name being passed as parameter.
+//!
+//! The handlers of the same file share the HDF5 file identifier. When
+//! the file is not open yet it's created (mode OVERWRITE or file
+//! doesn't exist) or opened for writing (mode APPEND). A file is
+//! truncated only the first time it's opened in the process, so
+//! closing all its handlers and opening them again (i.e. restarting
+//! the recorders) doesn't lose the datasets written before.
+std::shared_ptr<XC::DataOutputHDF5Handler::SharedFile> XC::DataOutputHDF5Handler::get_file(const std::string &name,const openMode &mode)
+  {
+    std::lock_guard<std::recursive_mutex> hdf5_lock(get_hdf5_mutex());
+    static std::map<std::string,std::weak_ptr<SharedFile> > open_files;
+    static std::set<std::string> created_files;
+    std::shared_ptr<SharedFile> retval= open_files[name].lock();
+    if(!retval)
+      {
+        struct stat st;
+        const bool exists= (stat(name.c_str(),&st)==0);
+        const bool created= (created_files.find(name)!=created_files.end());
+        hid_t id= -1;
+        if(exists && ((mode==APPEND) || created))
+          id= H5Fopen(name.c_str(),H5F_ACC_RDWR,H5P_DEFAULT);
+        else
+          {
+            id= H5Fcreate(name.c_str(),H5F_ACC_TRUNC,H5P_DEFAULT,H5P_DEFAULT);
+            if(id>=0)
+              created_files.insert(name);
+          }
+        if(id<0)
+          {
+            std::cerr << "DataOutputHDF5Handler::" << __FUNCTION__
+                      << "; could not open file: '" << name
+                      << "'." << std::endl;
+            open_files.erase(name);
+          }
+        else
+          {
+            retval= std::make_shared<SharedFile>(id);
+            open_files[name]= retval;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Constructor.
+//!
+//! @param theFileName: name of the HDF5 file.
+//! @param theDatasetName: path of the dataset inside the file (intermediate groups are created if needed).
+//! @param theOMode: OVERWRITE: the file is truncated when it's first opened, APPEND: the rows are added to the existing dataset.
+XC::DataOutputHDF5Handler::DataOutputHDF5Handler(const std::string &theFileName, const std::string &theDatasetName, openMode theOMode)
+  :DataOutputHandler(DATAHANDLER_TAGS_DataOutputHDF5Handler),
+   fileName(theFileName), datasetName(theDatasetName), theOpenMode(theOMode),
+   chunkRows(256), compressionLevel(4), bufferRows(256), numColumns(-1),
+   file(), dataset(-1), buffer(), numBufferedRows(0), numWrittenRows(0)
+  {}
+
+//! @brief Destructor (writes the pending rows).
+XC::DataOutputHDF5Handler::~DataOutputHDF5Handler(void)
+  { close(); }
+
+//! @brief Sets the number of rows of each chunk of the dataset (used
+//! when the dataset is created).
+void XC::DataOutputHDF5Handler::setChunkRows(const size_t &n)
+  { chunkRows= std::max(n,size_t(1)); }
+
+//! @brief Sets the deflate compression level (0: no compression,
+//! 9: best compression; used when the dataset is created).
+void XC::DataOutputHDF5Handler::setCompressionLevel(const int &l)
+  {
+    if((l<0) || (l>9))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; compression level: " << l
+                << " out of range [0,9]." << std::endl;
+    compressionLevel= std::min(std::max(l,0),9);
+  }
+
+//! @brief Sets the number of rows that are kept in memory before
+//! writing them to the file.
+void XC::DataOutputHDF5Handler::setBufferRows(const size_t &n)
+  {
+    flush();
+    bufferRows= std::max(n,size_t(1));
+    if(numColumns>0)
+      buffer.resize(bufferRows*numColumns);
+  }
+
+//! @brief Creates the dataset (or opens it in APPEND mode if it already
+//! exists with the same number of columns).
+int XC::DataOutputHDF5Handler::create_dataset(const std::vector<std::string> &dataDescription)
+  {
+    std::lock_guard<std::recursive_mutex> hdf5_lock(get_hdf5_mutex());
+    const hid_t fid= file->id;
+    htri_t exists= 0;
+    H5E_BEGIN_TRY
+      { exists= H5Lexists(fid,datasetName.c_str(),H5P_DEFAULT); }
+    H5E_END_TRY;
+    if(exists>0)
+      {
+        if(theOpenMode==APPEND)
+          {
+            dataset= H5Dopen2(fid,datasetName.c_str(),H5P_DEFAULT);
+            if(dataset>=0)
+              {
+                const hid_t space= H5Dget_space(dataset);
+                hsize_t dims[2]= {0,0};
+                const int rank= H5Sget_simple_extent_dims(space,dims,nullptr);
+                H5Sclose(space);
+                if((rank==2) && (dims[1]==hsize_t(numColumns)))
+                  {
+                    numWrittenRows= dims[0];
+                    return 0;
+                  }
+                H5Dclose(dataset);
+                dataset= -1;
+              }
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; dataset: '" << datasetName
+                      << "' has not " << numColumns
+                      << " columns, it will be replaced." << std::endl;
+          }
+        H5Ldelete(fid,datasetName.c_str(),H5P_DEFAULT);
+      }
+
+    const hsize_t dims[2]= {0,hsize_t(numColumns)};
+    const hsize_t maxDims[2]= {H5S_UNLIMITED,hsize_t(numColumns)};
+    const hsize_t chunkDims[2]= {hsize_t(chunkRows),hsize_t(numColumns)};
+    const hid_t space= H5Screate_simple(2,dims,maxDims);
+    const hid_t dcpl= H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(dcpl,2,chunkDims);
+    if(compressionLevel>0)
+      {
+        H5Pset_shuffle(dcpl);
+        H5Pset_deflate(dcpl,compressionLevel);
+      }
+    const hid_t lcpl= H5Pcreate(H5P_LINK_CREATE);
+    H5Pset_create_intermediate_group(lcpl,1);
+    dataset= H5Dcreate2(fid,datasetName.c_str(),H5T_IEEE_F64LE,space,lcpl,dcpl,H5P_DEFAULT);
+    H5Pclose(lcpl);
+    H5Pclose(dcpl);
+    H5Sclose(space);
+    if(dataset<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; could not create dataset: '" << datasetName
+                  << "' in file: '" << fileName << "'." << std::endl;
+        return -1;
+      }
+    numWrittenRows= 0;
+
+    // Column descriptions.
+    std::vector<const char *> columns(numColumns);
+    for(int i= 0;i<numColumns;i++)
+      columns[i]= dataDescription[i].c_str();
+    const hsize_t attrDims[1]= {hsize_t(numColumns)};
+    const hid_t attrSpace= H5Screate_simple(1,attrDims,nullptr);
+    const hid_t strType= H5Tcopy(H5T_C_S1);
+    H5Tset_size(strType,H5T_VARIABLE);
+    const hid_t attr= H5Acreate2(dataset,"columns",strType,attrSpace,H5P_DEFAULT,H5P_DEFAULT);
+    if(attr>=0)
+      {
+        H5Awrite(attr,strType,columns.data());
+        H5Aclose(attr);
+      }
+    H5Tclose(strType);
+    H5Sclose(attrSpace);
+    return 0;
+  }
+
+//! @brief Opens the file and creates the dataset with one column for
+//! each item of the data description.
+int XC::DataOutputHDF5Handler::open(const std::vector<std::string> &dataDescription)
+  {
+    close();
+    if(fileName.empty())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; no filename." << std::endl;
+        return -1;
+      }
+    if(datasetName.empty())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; no dataset name." << std::endl;
+        return -1;
+      }
+    numColumns= dataDescription.size();
+    if(numColumns<1)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; nothing to record." << std::endl;
+        return -1;
+      }
+    file= get_file(fileName,theOpenMode);
+    if(!file)
+      return -1;
+    const int res= create_dataset(dataDescription);
+    if(res<0)
+      {
+        std::lock_guard<std::recursive_mutex> hdf5_lock(get_hdf5_mutex());
+        file.reset();
+        return res;
+      }
+    buffer.resize(bufferRows*numColumns);
+    numBufferedRows= 0;
+    return 0;
+  }
+
+//! @brief Appends the vector to the buffer (the rows are written to
+//! the file when the buffer is full).
+int XC::DataOutputHDF5Handler::write(Vector &data)
+  {
+    if(dataset<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the dataset is not open." << std::endl;
+        return -1;
+      }
+    if(data.Size()!=numColumns)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; vector size: " << data.Size()
+                  << " must be " << numColumns << std::endl;
+        return -1;
+      }
+    double *row= buffer.data()+numBufferedRows*numColumns;
+    for(int i= 0;i<numColumns;i++)
+      row[i]= data(i);
+    numBufferedRows++;
+    int retval= 0;
+    if(numBufferedRows>=bufferRows)
+      retval= write_buffer();
+    return retval;
+  }
+
+//! @brief Writes the buffered rows at the end of the dataset.
+int XC::DataOutputHDF5Handler::write_buffer(void)
+  {
+    if((dataset<0) || (numBufferedRows==0))
+      return 0;
+    std::lock_guard<std::recursive_mutex> hdf5_lock(get_hdf5_mutex());
+    const hsize_t newDims[2]= {hsize_t(numWrittenRows+numBufferedRows),hsize_t(numColumns)};
+    herr_t status= H5Dset_extent(dataset,newDims);
+    if(status>=0)
+      {
+        const hid_t fileSpace= H5Dget_space(dataset);
+        const hsize_t start[2]= {hsize_t(numWrittenRows),0};
+        const hsize_t count[2]= {hsize_t(numBufferedRows),hsize_t(numColumns)};
+        H5Sselect_hyperslab(fileSpace,H5S_SELECT_SET,start,nullptr,count,nullptr);
+        const hid_t memSpace= H5Screate_simple(2,count,nullptr);
+        status= H5Dwrite(dataset,H5T_NATIVE_DOUBLE,memSpace,fileSpace,H5P_DEFAULT,buffer.data());
+        H5Sclose(memSpace);
+        H5Sclose(fileSpace);
+      }
+    if(status<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; could not write " << numBufferedRows
+                  << " rows to dataset: '" << datasetName
+                  << "'." << std::endl;
+        numBufferedRows= 0;
+        return -1;
+      }
+    numWrittenRows+= numBufferedRows;
+    numBufferedRows= 0;
+    H5Fflush(file->id,H5F_SCOPE_LOCAL);
+    return 0;
+  }
+
+//! @brief Writes the pending rows at the end of the dataset.
+//!
+//! If asynchronous recording is active, waits first until the
+//! writer threads have passed all the queued rows of this handler
+//! (see DataOutputQueue::flushHandler).
+int XC::DataOutputHDF5Handler::flush(void)
+  {
+    DataOutputQueue::flushHandler(this);
+    return write_buffer();
+  }
+
+//! @brief Writes the pending rows and closes the dataset (the file is
+//! closed when no other handler uses it). The rows queued for
+//! asynchronous recording are written first (before taking the
+//! HDF5 mutex, see get_hdf5_mutex).
+void XC::DataOutputHDF5Handler::close(void)
+  {
+    DataOutputQueue::flushHandler(this);
+    std::lock_guard<std::recursive_mutex> hdf5_lock(get_hdf5_mutex());
+    if(dataset>=0)
+      {
+        write_buffer();
+        H5Dclose(dataset);
+        dataset= -1;
+      }
+    file.reset();
+  }
+
+//! @brief Sends object members through the communicator being passed as parameter.
+int XC::DataOutputHDF5Handler::sendData(CommParameters &cp)
+  {
+    int res= cp.sendString(fileName,getDbTagData(),CommMetaData(0));
+    res+= cp.sendString(datasetName,getDbTagData(),CommMetaData(1));
+    const int om= (theOpenMode == OVERWRITE ? 0 : 1);
+    const int cr= chunkRows, br= bufferRows;
+    res+= cp.sendInts(om,cr,compressionLevel,br,numColumns,getDbTagData(),CommMetaData(2));
+    return res;
+  }
+
+//! @brief Receives object members through the communicator being passed as parameter.
+int XC::DataOutputHDF5Handler::recvData(const CommParameters &cp)
+  {
+    close();
+    int res= cp.receiveString(fileName,getDbTagData(),CommMetaData(0));
+    res+= cp.receiveString(datasetName,getDbTagData(),CommMetaData(1));
+    int om= 0, cr= 0, br= 0;
+    res+= cp.receiveInts(om,cr,compressionLevel,br,numColumns,getDbTagData(),CommMetaData(2));
+    theOpenMode= (om==0 ? OVERWRITE : APPEND);
+    chunkRows= std::max(cr,1);
+    bufferRows= std::max(br,1);
+    return res;
+  }
+
+//! @brief Send the object through the communicator argument.
+int XC::DataOutputHDF5Handler::sendSelf(CommParameters &cp)
+  {
+    inicComm(3);
+    setDbTag(cp);
+    const int dataTag= getDbTag();
+    int res= sendData(cp);
+
+    res+= cp.sendIdData(getDbTagData(),dataTag);
+    if(res < 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; " << dataTag << " failed to send." << std::endl;
+    return res;
+  }
+
+//! @brief Receive the object through the communicator argument.
+int XC::DataOutputHDF5Handler::recvSelf(const CommParameters &cp)
+  {
+    inicComm(3);
+    const int dataTag= getDbTag();
+    int res= cp.receiveIdData(getDbTagData(),dataTag);
+
+    if(res<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; " << dataTag << " failed to receive ID." << std::endl;
+    else
+      res+= recvData(cp);
+    return res;
+  }
@@ -0,0 +1,124 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DataOutputHDF5Handler.h
+
+#ifndef _DataOutputHDF5Handler
+#define _DataOutputHDF5Handler
+
+#include <utility/handler/DataOutputHandler.h>
+#include <utility/handler/OPS_Stream.h>
+#include <hdf5.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <string>
+
+namespace XC {
+
+//! @ingroup Recorder
+//
+//! @brief Writes the recorder output to a dataset of an HDF5 file.
+//!
+//! Each handler writes to its own two-dimensional dataset (one row for
+//! each recorded step and one column for each value) so the handlers
+//! of different recorders can share the same file. The dataset is
+//! chunked, it can grow without limit along the rows and, if the
+//! compression level is greater than zero, it is compressed with the
+//! shuffle and deflate filters. The column descriptions are stored in
+//! the "columns" attribute of the dataset.
+//!
+//! The rows are kept in memory and written to the file in blocks of
+//! bufferRows rows, so a time history with many steps doesn't issue one
+//! write for each step. The pending rows are written when the handler
+//! is flushed, closed or destroyed; when the recorders write
+//! asynchronously (see DataOutputQueue) these methods wait first for
+//! the rows of the handler that are still in the queue.
+//!
+//! The HDF5 library is not thread-safe unless it is built with that
+//! option, and the handlers can be used from several writer threads
+//! at the same time, so all the HDF5 calls of the handlers are
+//! serialized behind a single process-wide mutex.
+class DataOutputHDF5Handler: public DataOutputHandler
+  {
+  private:
+    struct SharedFile;
+    std::string fileName; //!< name of the HDF5 file.
+    std::string datasetName; //!< path of the dataset inside the file.
+    openMode theOpenMode; //!< OVERWRITE: truncate the file, APPEND: add rows to an existing dataset.
+    size_t chunkRows; //!< number of rows of each chunk of the dataset.
+    int compressionLevel; //!< deflate compression level (0: no compression).
+    size_t bufferRows; //!< number of rows written at once.
+    int numColumns; //!< number of values of each row.
+    std::shared_ptr<SharedFile> file; //!< open HDF5 file (shared with the other handlers of the same file).
+    hid_t dataset; //!< identifier of the open dataset.
+    std::vector<double> buffer; //!< rows not written yet.
+    size_t numBufferedRows; //!< number of rows in the buffer.
+    size_t numWrittenRows; //!< number of rows of the dataset.
+
+    static std::recursive_mutex &get_hdf5_mutex(void);
+    static std::shared_ptr<SharedFile> get_file(const std::string &,const openMode &);
+    int create_dataset(const std::vector<std::string> &);
+    int write_buffer(void);
+    DataOutputHDF5Handler(const DataOutputHDF5Handler &);
+    DataOutputHDF5Handler &operator=(const DataOutputHDF5Handler &);
+  protected:
+    int sendData(CommParameters &cp);
+    int recvData(const CommParameters &cp);
+
+  public:
+    DataOutputHDF5Handler(const std::string &fileName= "", const std::string &datasetName= "data", openMode mode= OVERWRITE);
+    ~DataOutputHDF5Handler(void);
+
+    int open(const std::vector<std::string> &dataDescription);
+    int write(Vector &data);
+    int flush(void);
+    void close(void);
+
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+    inline const std::string &getDatasetName(void) const
+      { return datasetName; }
+    inline size_t getChunkRows(void) const
+      { return chunkRows; }
+    void setChunkRows(const size_t &);
+    inline int getCompressionLevel(void) const
+      { return compressionLevel; }
+    void setCompressionLevel(const int &);
+    inline size_t getBufferRows(void) const
+      { return bufferRows; }
+    void setBufferRows(const size_t &);
+    inline int getNumColumns(void) const
+      { return numColumns; }
+    inline size_t getNumRows(void) const
+      { return numWrittenRows+numBufferedRows; }
+
+    int sendSelf(CommParameters &);  
+    int recvSelf(const CommParameters &);
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,186 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DataOutputQueue.cc
+
+#include "utility/handler/DataOutputQueue.h"
+#include "utility/handler/DataOutputHandler.h"
+#include <algorithm>
+
+namespace {
+  //! @brief Queue served by the calling thread (null if the
+  //! calling thread is not a writer).
+  thread_local const XC::DataOutputQueue *writerQueue= nullptr;
+}
+
+//! @brief Returns the queues that exist in the process.
+std::set<XC::DataOutputQueue *> &XC::DataOutputQueue::get_queues(void)
+  {
+    static std::set<DataOutputQueue *> queues;
+    return queues;
+  }
+
+//! @brief Returns the mutex that protects the set of queues.
+std::mutex &XC::DataOutputQueue::get_queues_mutex(void)
+  {
+    static std::mutex queues_mtx;
+    return queues_mtx;
+  }
+
+//! @brief Constructor.
+//!
+//! @param capacity: maximum number of rows waiting to be written.
+XC::DataOutputQueue::DataOutputQueue(const size_t &capacity)
+  : slots(std::max(capacity,size_t(1))), head(0), count(0),
+    stop(false), numErrors(0)
+  {
+    for(std::vector<Item>::iterator i= slots.begin();i!=slots.end();i++)
+      (*i).handler= nullptr;
+    writer= std::thread(&DataOutputQueue::writer_loop,this);
+    std::lock_guard<std::mutex> queues_lock(get_queues_mutex());
+    get_queues().insert(this);
+  }
+
+//! @brief Destructor (writes the pending rows before finishing the
+//! writer thread).
+XC::DataOutputQueue::~DataOutputQueue(void)
+  {
+    {
+      std::lock_guard<std::mutex> queues_lock(get_queues_mutex());
+      get_queues().erase(this);
+    }
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      stop= true;
+    }
+    not_empty.notify_one();
+    writer.join();
+  }
+
+//! @brief Writes the rows in the order they were pushed. The slot of
+//! the row being written is freed after the write, so the recorders
+//! can't overwrite it meanwhile and flush doesn't return before the
+//! last row has been written.
+void XC::DataOutputQueue::writer_loop(void)
+  {
+    writerQueue= this;
+    std::unique_lock<std::mutex> lock(mtx);
+    while(true)
+      {
+        not_empty.wait(lock,[this]{ return (count>0) || stop; });
+        if(count==0) // stop and nothing to write.
+          break;
+        Item &item= slots[head];
+        lock.unlock();
+        const int res= item.handler->write(item.data);
+        lock.lock();
+        if(res<0)
+          numErrors++;
+        head= (head+1)%slots.size();
+        count--;
+        not_full.notify_one();
+        written.notify_all();
+      }
+  }
+
+//! @brief Copies the row into the buffer. If the buffer is full, waits
+//! until the writer frees a slot.
+//!
+//! @param handler: handler that will write the row.
+//! @param data: values of the row.
+int XC::DataOutputQueue::push(DataOutputHandler *handler,const Vector &data)
+  {
+    if(!handler)
+      {
+        std::cerr << "DataOutputQueue::" << __FUNCTION__
+                  << "; null output handler." << std::endl;
+        return -1;
+      }
+    std::unique_lock<std::mutex> lock(mtx);
+    not_full.wait(lock,[this]{ return count<slots.size(); });
+    Item &item= slots[(head+count)%slots.size()];
+    item.handler= handler;
+    item.data= data;
+    count++;
+    lock.unlock();
+    not_empty.notify_one();
+    return 0;
+  }
+
+//! @brief Waits until all the rows in the buffer have been written.
+void XC::DataOutputQueue::flush(void)
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    written.wait(lock,[this]{ return count==0; });
+  }
+
+//! @brief Returns true if there are rows of the handler in the
+//! buffer (including the one being written). The mutex must be
+//! locked by the caller.
+bool XC::DataOutputQueue::has_rows(const DataOutputHandler *handler) const
+  {
+    for(size_t i= 0;i<count;i++)
+      if(slots[(head+i)%slots.size()].handler==handler)
+        return true;
+    return false;
+  }
+
+//! @brief Waits until all the rows of the handler being passed as
+//! parameter have been written.
+void XC::DataOutputQueue::flush(const DataOutputHandler *handler)
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    written.wait(lock,[this,handler]{ return !has_rows(handler); });
+  }
+
+//! @brief Waits until the rows of the handler being passed as
+//! parameter in any queue have been written. The handlers call it
+//! before flushing or closing its output, so those methods don't
+//! run concurrently with the writer threads. When called from a
+//! writer thread the rows of its own queue are not waited for (they
+//! are written by the caller).
+void XC::DataOutputQueue::flushHandler(const DataOutputHandler *handler)
+  {
+    std::lock_guard<std::mutex> queues_lock(get_queues_mutex());
+    const std::set<DataOutputQueue *> &queues= get_queues();
+    for(std::set<DataOutputQueue *>::const_iterator i= queues.begin();i!=queues.end();i++)
+      if(*i!=writerQueue)
+        (*i)->flush(handler);
+  }
+
+//! @brief Returns the number of rows waiting to be written.
+size_t XC::DataOutputQueue::getNumPending(void)
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    return count;
+  }
+
+//! @brief Returns the number of writes that failed.
+size_t XC::DataOutputQueue::getNumErrors(void)
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    return numErrors;
+  }
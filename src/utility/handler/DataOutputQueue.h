@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DataOutputQueue.h
+
+#ifndef DataOutputQueue_h
+#define DataOutputQueue_h
+
+#include <utility/matrix/Vector.h>
+#include <vector>
+#include <set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace XC {
+class DataOutputHandler;
+
+//! @ingroup Recorder
+//
+//! @brief Rows waiting to be written by a background thread.
+//!
+//! The recorders copy their response vectors into a ring buffer
+//! and return immediately; a writer thread takes the rows in the order
+//! they were pushed and passes them to the write method of their
+//! output handler. When the buffer is full the recorders wait until
+//! the writer frees a slot, so the memory used is bounded by the
+//! capacity of the buffer. The slots are reused so, once each slot
+//! has received a vector of the right size, pushing a row doesn't
+//! allocate memory.
+//!
+//! Only the writer thread calls the write method of the handlers; the
+//! queue must be flushed before calling any other method of a handler
+//! that has rows in the queue (i.e. open, close,...). The handlers
+//! whose methods can be called by the user do it themselves calling
+//! flushHandler (see DataOutputHDF5Handler::flush).
+class DataOutputQueue
+  {
+  private:
+    //! @brief Row waiting to be written.
+    struct Item
+      {
+        DataOutputHandler *handler; //!< handler that writes the row.
+        Vector data; //!< values of the row.
+      };
+    std::vector<Item> slots; //!< ring buffer.
+    size_t head; //!< first row waiting to be written.
+    size_t count; //!< number of rows in the buffer.
+    bool stop; //!< true when the writer must finish.
+    size_t numErrors; //!< number of failed writes.
+    std::mutex mtx; //!< protects the members above.
+    std::condition_variable not_empty; //!< signals new rows.
+    std::condition_variable not_full; //!< signals free slots.
+    std::condition_variable written; //!< signals that a row has been written.
+    std::thread writer; //!< writer thread.
+
+    void writer_loop(void);
+    bool has_rows(const DataOutputHandler *) const;
+    static std::set<DataOutputQueue *> &get_queues(void);
+    static std::mutex &get_queues_mutex(void);
+    DataOutputQueue(const DataOutputQueue &);
+    DataOutputQueue &operator=(const DataOutputQueue &);
+  public:
+    explicit DataOutputQueue(const size_t &capacity= 1024);
+    ~DataOutputQueue(void);
+    int push(DataOutputHandler *,const Vector &);
+    void flush(void);
+    void flush(const DataOutputHandler *);
+    static void flushHandler(const DataOutputHandler *);
+    inline size_t getCapacity(void) const
+      { return slots.size(); }
+    size_t getNumPending(void);
+    size_t getNumErrors(void);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,37 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::DataOutputHandler, bases<XC::MovableObject,CommandEntity>, boost::noncopyable >("DataOutputHandler", no_init)
+  ;
+
+class_<XC::DataOutputHDF5Handler, bases<XC::DataOutputHandler>, boost::noncopyable >("DataOutputHDF5Handler", no_init)
+  .add_property("fileName",make_function(&XC::DataOutputHDF5Handler::getFileName,return_value_policy<copy_const_reference>()),"Name of the HDF5 file.")
+  .add_property("datasetName",make_function(&XC::DataOutputHDF5Handler::getDatasetName,return_value_policy<copy_const_reference>()),"Path of the dataset inside the file.")
+  .add_property("chunkRows",&XC::DataOutputHDF5Handler::getChunkRows,&XC::DataOutputHDF5Handler::setChunkRows,"Number of rows of each chunk of the dataset.")
+  .add_property("compressionLevel",&XC::DataOutputHDF5Handler::getCompressionLevel,&XC::DataOutputHDF5Handler::setCompressionLevel,"Deflate compression level (0: no compression, 9: best compression).")
+  .add_property("bufferRows",&XC::DataOutputHDF5Handler::getBufferRows,&XC::DataOutputHDF5Handler::setBufferRows,"Number of rows kept in memory before writing them to the file.")
+  .add_property("numColumns",&XC::DataOutputHDF5Handler::getNumColumns,"Number of columns of the dataset.")
+  .add_property("numRows",&XC::DataOutputHDF5Handler::getNumRows,"Number of rows recorded.")
+  .def("flush",&XC::DataOutputHDF5Handler::flush,"Writes the buffered rows to the file (waits first for the rows queued by asynchronous recording).")
+  .def("close",&XC::DataOutputHDF5Handler::close,"Writes the buffered rows and closes the dataset (waits first for the rows queued by asynchronous recording).")
+  ;
@@ -0,0 +1,310 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedMatrix.h
+
+#ifndef FixedMatrix_h
+#define FixedMatrix_h
+
+#include "Matrix.h"
+#include "Vector.h"
+#include <iostream>
+
+namespace XC {
+
+//! @ingroup Matrix
+//
+//! @brief Small matrix whose dimensions are known at compile time.
+//!
+//! Plain storage (no owner, no virtual table and no heap memory) for the
+//! temporary matrices used in the element and material kernels. The
+//! components are stored column by column like in the Matrix class,
+//! so the data can be shared with it through getView() without copying.
+template <int R, int C>
+class FixedMatrix
+  {
+  private:
+    double theData[R*C];
+  public:
+    FixedMatrix(void)
+      { Zero(); }
+    explicit FixedMatrix(const Matrix &);
+
+    //! @brief Return the number of rows.
+    static inline int noRows(void)
+      { return R; }
+    //! @brief Return the number of columns.
+    static inline int noCols(void)
+      { return C; }
+    inline const double *getDataPtr(void) const
+      { return theData; }
+    inline double *getDataPtr(void)
+      { return theData; }
+    //! @brief Return the i-th component in storage order (the
+    //! i-th component of a FixedVector).
+    inline double &operator[](int i)
+      { return theData[i]; }
+    //! @brief Return the i-th component in storage order (the
+    //! i-th component of a FixedVector).
+    inline const double &operator[](int i) const
+      { return theData[i]; }
+    //! @brief Return the (i,j) component.
+    inline double &operator()(int i, int j)
+      { return theData[j*R+i]; }
+    //! @brief Return the (i,j) component.
+    inline const double &operator()(int i, int j) const
+      { return theData[j*R+i]; }
+
+    void Zero(void);
+    FixedMatrix &operator+=(const FixedMatrix &);
+    FixedMatrix &operator-=(const FixedMatrix &);
+    FixedMatrix &operator*=(const double &);
+    FixedMatrix<C,R> getTrn(void) const;
+
+    template <int K>
+    void addMatrixProduct(const double &thisFact, const FixedMatrix<R,K> &, const FixedMatrix<K,C> &, const double &otherFact);
+    template <int K>
+    void addMatrixTransposeProduct(const double &thisFact, const FixedMatrix<K,R> &, const FixedMatrix<K,C> &, const double &otherFact);
+    template <int K>
+    void addMatrixTripleProduct(const double &thisFact, const FixedMatrix<K,R> &, const FixedMatrix<K,K> &, const double &otherFact);
+
+    Matrix getMatrix(void) const;
+    Matrix getView(void);
+    void copyTo(Matrix &) const;
+    void addTo(Matrix &, const double &fact= 1.0) const;
+  };
+
+//! @brief Constructor (copies the components of the matrix argument).
+template <int R, int C>
+FixedMatrix<R,C>::FixedMatrix(const Matrix &m)
+  {
+    if((m.noRows()!=R) || (m.noCols()!=C))
+      {
+        std::cerr << "FixedMatrix::" << __FUNCTION__
+                  << "; matrix dimensions (" << m.noRows() << 'x' << m.noCols()
+                  << ") don't match (" << R << 'x' << C << ")." << std::endl;
+        Zero();
+      }
+    else
+      {
+        const double *src= m.getDataPtr();
+        for(int i= 0;i<R*C;i++)
+          theData[i]= src[i];
+      }
+  }
+
+//! @brief Zeroes all the components.
+template <int R, int C>
+void FixedMatrix<R,C>::Zero(void)
+  {
+    for(int i= 0;i<R*C;i++)
+      theData[i]= 0.0;
+  }
+
+//! @brief Adds the argument.
+template <int R, int C>
+FixedMatrix<R,C> &FixedMatrix<R,C>::operator+=(const FixedMatrix &other)
+  {
+    for(int i= 0;i<R*C;i++)
+      theData[i]+= other.theData[i];
+    return *this;
+  }
+
+//! @brief Subtracts the argument.
+template <int R, int C>
+FixedMatrix<R,C> &FixedMatrix<R,C>::operator-=(const FixedMatrix &other)
+  {
+    for(int i= 0;i<R*C;i++)
+      theData[i]-= other.theData[i];
+    return *this;
+  }
+
+//! @brief Multiplies all the components by the argument.
+template <int R, int C>
+FixedMatrix<R,C> &FixedMatrix<R,C>::operator*=(const double &fact)
+  {
+    for(int i= 0;i<R*C;i++)
+      theData[i]*= fact;
+    return *this;
+  }
+
+//! @brief Returns the transpose.
+template <int R, int C>
+FixedMatrix<C,R> FixedMatrix<R,C>::getTrn(void) const
+  {
+    FixedMatrix<C,R> retval;
+    for(int j= 0;j<C;j++)
+      for(int i= 0;i<R;i++)
+        retval(j,i)= (*this)(i,j);
+    return retval;
+  }
+
+//! @brief this= thisFact*this + otherFact*(A*B).
+template <int R, int C> template <int K>
+void FixedMatrix<R,C>::addMatrixProduct(const double &thisFact, const FixedMatrix<R,K> &A, const FixedMatrix<K,C> &B, const double &otherFact)
+  {
+    if(thisFact!=1.0)
+      (*this)*= thisFact;
+    for(int j= 0;j<C;j++)
+      for(int k= 0;k<K;k++)
+        {
+          const double bkj= otherFact*B(k,j);
+          if(bkj!=0.0)
+            for(int i= 0;i<R;i++)
+              (*this)(i,j)+= A(i,k)*bkj;
+        }
+  }
+
+//! @brief this= thisFact*this + otherFact*(A^T*B).
+template <int R, int C> template <int K>
+void FixedMatrix<R,C>::addMatrixTransposeProduct(const double &thisFact, const FixedMatrix<K,R> &A, const FixedMatrix<K,C> &B, const double &otherFact)
+  {
+    if(thisFact!=1.0)
+      (*this)*= thisFact;
+    for(int j= 0;j<C;j++)
+      for(int i= 0;i<R;i++)
+        {
+          double sum= 0.0;
+          for(int k= 0;k<K;k++)
+            sum+= A(k,i)*B(k,j);
+          (*this)(i,j)+= otherFact*sum;
+        }
+  }
+
+//! @brief this= thisFact*this + otherFact*(T^T*B*T) (square matrices only).
+template <int R, int C> template <int K>
+void FixedMatrix<R,C>::addMatrixTripleProduct(const double &thisFact, const FixedMatrix<K,R> &T, const FixedMatrix<K,K> &B, const double &otherFact)
+  {
+    static_assert(R==C,"addMatrixTripleProduct needs a square matrix.");
+    FixedMatrix<K,C> BT;
+    BT.addMatrixProduct(0.0,B,T,1.0);
+    addMatrixTransposeProduct(thisFact,T,BT,otherFact);
+  }
+
+//! @brief Returns a Matrix object with a copy of the components.
+template <int R, int C>
+Matrix FixedMatrix<R,C>::getMatrix(void) const
+  {
+    Matrix retval(R,C);
+    copyTo(retval);
+    return retval;
+  }
+
+//! @brief Returns a Matrix object that shares the storage of this one
+//! (no copy, no heap allocation). The returned object must not outlive
+//! this one.
+template <int R, int C>
+Matrix FixedMatrix<R,C>::getView(void)
+  { return Matrix(theData,R,C); }
+
+//! @brief Copies the components on the matrix argument (that must
+//! have the same dimensions).
+template <int R, int C>
+void FixedMatrix<R,C>::copyTo(Matrix &m) const
+  {
+    if((m.noRows()!=R) || (m.noCols()!=C))
+      std::cerr << "FixedMatrix::" << __FUNCTION__
+                << "; matrix dimensions (" << m.noRows() << 'x' << m.noCols()
+                << ") don't match (" << R << 'x' << C << ")." << std::endl;
+    else
+      {
+        double *dest= m.getDataPtr();
+        for(int i= 0;i<R*C;i++)
+          dest[i]= theData[i];
+      }
+  }
+
+//! @brief Adds fact times this matrix to the argument (that must
+//! have the same dimensions).
+template <int R, int C>
+void FixedMatrix<R,C>::addTo(Matrix &m, const double &fact) const
+  {
+    if((m.noRows()!=R) || (m.noCols()!=C))
+      std::cerr << "FixedMatrix::" << __FUNCTION__
+                << "; matrix dimensions (" << m.noRows() << 'x' << m.noCols()
+                << ") don't match (" << R << 'x' << C << ")." << std::endl;
+    else
+      {
+        double *dest= m.getDataPtr();
+        for(int i= 0;i<R*C;i++)
+          dest[i]+= fact*theData[i];
+      }
+  }
+
+//! @brief Matrix product.
+template <int R, int K, int C>
+inline FixedMatrix<R,C> operator*(const FixedMatrix<R,K> &A, const FixedMatrix<K,C> &B)
+  {
+    FixedMatrix<R,C> retval;
+    retval.addMatrixProduct(0.0,A,B,1.0);
+    return retval;
+  }
+
+//! @brief Product by a scalar.
+template <int R, int C>
+inline FixedMatrix<R,C> operator*(const double &a, const FixedMatrix<R,C> &B)
+  {
+    FixedMatrix<R,C> retval(B);
+    retval*= a;
+    return retval;
+  }
+
+//! @brief Column vector whose dimension is known at compile time.
+template <int N>
+using FixedVector= FixedMatrix<N,1>;
+
+//! @brief Product of a fixed matrix by a Vector object (the
+//! dimension of the vector must be C).
+template <int R, int C>
+FixedVector<R> operator*(const FixedMatrix<R,C> &A, const Vector &v)
+  {
+    FixedVector<R> retval;
+    if(v.Size()!=C)
+      std::cerr << "FixedMatrix::" << __FUNCTION__
+                << "; vector dimension (" << v.Size()
+                << ") doesn't match (" << C << ")." << std::endl;
+    else
+      for(int j= 0;j<C;j++)
+        for(int i= 0;i<R;i++)
+          retval(i,0)+= A(i,j)*v(j);
+    return retval;
+  }
+
+template <int R, int C>
+std::ostream &operator<<(std::ostream &os, const FixedMatrix<R,C> &m)
+  {
+    for(int i= 0;i<R;i++)
+      {
+        for(int j= 0;j<C;j++)
+          os << m(i,j) << ' ';
+        os << std::endl;
+      }
+    return os;
+  }
+
+} // end of XC namespace
+
+#endif
@@ -74,7 +74,7 @@
 #define MATRIX_WORK_AREA 400
 #define INT_WORK_AREA 20
 
-XC::AuxMatrix XC::Matrix::auxMatrix(MATRIX_WORK_AREA,INT_WORK_AREA);
+thread_local XC::AuxMatrix XC::Matrix::auxMatrix(MATRIX_WORK_AREA,INT_WORK_AREA);
 double XC::Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
 
 //! @brief Default constructor.
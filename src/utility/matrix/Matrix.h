@@ -109,7 +109,7 @@ class Matrix: public CommandEntity
   {
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-    static AuxMatrix auxMatrix;
+    static thread_local AuxMatrix auxMatrix; //!< per-thread work area for solve and invert.
 
     int numRows;
     int numCols;
@@ -0,0 +1,268 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_buffer.cc
+
+#include "python_buffer.h"
+#include <boost/python/extract.hpp>
+#include <boost/python/raw_function.hpp>
+#include <boost/python/object/instance.hpp>
+#include <boost/python/object/value_holder.hpp>
+#include <map>
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+
+//! @brief Returns the number of live buffers exported by each object
+//! (access is serialized by the GIL).
+static std::map<PyObject *,size_t> &get_exports(void)
+  {
+    static std::map<PyObject *,size_t> exports;
+    return exports;
+  }
+
+//! @brief Returns the number of live buffers exported by the object.
+static size_t get_num_exports(PyObject *obj)
+  {
+    const std::map<PyObject *,size_t> &exports= get_exports();
+    std::map<PyObject *,size_t>::const_iterator i= exports.find(obj);
+    return (i!=exports.end() ? i->second : 0);
+  }
+
+//! @brief Returns true if the Python object holds its C++ object by
+//! value (i.e. it was created from Python or returned by value, as the
+//! get*Array accessors do). The objects returned by reference can be
+//! resized or destroyed by its C++ owner, so they don't export
+//! their data.
+template <class T>
+static bool owns_value(PyObject *obj)
+  {
+    typedef boost::python::objects::instance<> instance_t;
+    const instance_t *inst= reinterpret_cast<const instance_t *>(obj);
+    for(boost::python::instance_holder *h= inst->objects;h;h= h->next())
+      if(dynamic_cast<boost::python::objects::value_holder<T> *>(h))
+        return true;
+    return false;
+  }
+
+//! @brief Fills the buffer description (the shape and strides arrays
+//! are stored in view->internal and freed by release_buffer).
+//!
+//! @param obj: Python object that owns the data.
+//! @param view: buffer description to fill.
+//! @param flags: buffer request flags.
+//! @param data: pointer to the data.
+//! @param itemSize: size of the items.
+//! @param format: struct module format of the items.
+//! @param rows: number of rows.
+//! @param cols: number of columns (0 for one-dimensional buffers).
+//! @param fortranOrder: true if the data is stored by columns.
+static int fill_buffer(PyObject *obj, Py_buffer *view, int flags, void *data, const Py_ssize_t &itemSize, const char *format, const Py_ssize_t &rows, const Py_ssize_t &cols, const bool &fortranOrder)
+  {
+    const int ndim= (cols>0 ? 2 : 1);
+    const Py_ssize_t numItems= (cols>0 ? rows*cols : rows);
+    const bool trivial= (ndim==1) || (rows<2) || (cols<2);
+    const bool cContiguous= trivial || !fortranOrder;
+    const bool fContiguous= trivial || fortranOrder;
+    if(((flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS) && !cContiguous)
+      {
+        PyErr_SetString(PyExc_BufferError,"matrix data is not C-contiguous.");
+        return -1;
+      }
+    if(((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS) && !fContiguous)
+      {
+        PyErr_SetString(PyExc_BufferError,"matrix data is not Fortran-contiguous.");
+        return -1;
+      }
+    if(((flags & PyBUF_STRIDES) != PyBUF_STRIDES) && !cContiguous)
+      {
+        PyErr_SetString(PyExc_BufferError,"matrix data needs strides.");
+        return -1;
+      }
+    Py_ssize_t *dims= new Py_ssize_t[4]; // shape and strides.
+    get_exports()[obj]++;
+    dims[0]= rows;
+    dims[1]= cols;
+    if(ndim==1)
+      dims[2]= itemSize;
+    else if(fortranOrder)
+      { dims[2]= itemSize; dims[3]= rows*itemSize; }
+    else
+      { dims[2]= cols*itemSize; dims[3]= itemSize; }
+    view->obj= obj;
+    Py_INCREF(obj);
+    view->buf= data;
+    view->len= numItems*itemSize;
+    view->readonly= 0;
+    view->itemsize= itemSize;
+    view->format= ((flags & PyBUF_FORMAT) ? const_cast<char *>(format) : nullptr);
+    view->ndim= ((flags & PyBUF_ND) ? ndim : 0);
+    view->shape= ((flags & PyBUF_ND) ? dims : nullptr);
+    view->strides= (((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? dims+2 : nullptr);
+    view->suboffsets= nullptr;
+    view->internal= dims;
+    return 0;
+  }
+
+//! @brief Frees the shape and strides of the buffer.
+static void release_buffer(PyObject *obj, Py_buffer *view)
+  {
+    std::map<PyObject *,size_t> &exports= get_exports();
+    std::map<PyObject *,size_t>::iterator i= exports.find(obj);
+    if(i!=exports.end())
+      {
+        i->second--;
+        if(i->second==0)
+          exports.erase(i);
+      }
+    Py_ssize_t *dims= static_cast<Py_ssize_t *>(view->internal);
+    delete[] dims;
+    view->internal= nullptr;
+  }
+
+//! @brief Exposes the data of a Vector (one-dimensional buffer).
+static int vector_get_buffer(PyObject *obj, Py_buffer *view, int flags)
+  {
+    boost::python::extract<XC::Vector &> e(obj);
+    if(!e.check())
+      {
+        PyErr_SetString(PyExc_BufferError,"object is not a Vector.");
+        return -1;
+      }
+    if(!owns_value<XC::Vector>(obj))
+      {
+        PyErr_SetString(PyExc_BufferError,"the vector is owned by another object, copy it first.");
+        return -1;
+      }
+    XC::Vector &v= e();
+    return fill_buffer(obj,view,flags,v.getDataPtr(),sizeof(double),"d",v.Size(),0,false);
+  }
+
+//! @brief Exposes the data of a Matrix (two-dimensional buffer stored
+//! by columns).
+static int matrix_get_buffer(PyObject *obj, Py_buffer *view, int flags)
+  {
+    boost::python::extract<XC::Matrix &> e(obj);
+    if(!e.check())
+      {
+        PyErr_SetString(PyExc_BufferError,"object is not a Matrix.");
+        return -1;
+      }
+    if(!owns_value<XC::Matrix>(obj))
+      {
+        PyErr_SetString(PyExc_BufferError,"the matrix is owned by another object, copy it first.");
+        return -1;
+      }
+    XC::Matrix &m= e();
+    return fill_buffer(obj,view,flags,m.getDataPtr(),sizeof(double),"d",m.noRows(),m.noCols(),true);
+  }
+
+//! @brief Exposes the data of an ID (one-dimensional buffer).
+static int id_get_buffer(PyObject *obj, Py_buffer *view, int flags)
+  {
+    boost::python::extract<XC::ID &> e(obj);
+    if(!e.check())
+      {
+        PyErr_SetString(PyExc_BufferError,"object is not an ID.");
+        return -1;
+      }
+    if(!owns_value<XC::ID>(obj))
+      {
+        PyErr_SetString(PyExc_BufferError,"the ID is owned by another object, copy it first.");
+        return -1;
+      }
+    XC::ID &id= e();
+    return fill_buffer(obj,view,flags,id.getDataPtr(),sizeof(int),"i",id.Size(),0,false);
+  }
+
+//! @brief Wraps a method that can resize the object so it raises
+//! BufferError while the object has exported buffers (as bytearray
+//! does).
+class ResizeGuard
+  {
+    boost::python::object method; //!< wrapped method.
+    bool onlySlices; //!< if true, only check the calls whose index is a slice.
+  public:
+    ResizeGuard(const boost::python::object &m,const bool &slices)
+      : method(m), onlySlices(slices) {}
+    boost::python::object operator()(boost::python::tuple args, boost::python::dict kw)
+      {
+        const bool resizes= !onlySlices || ((boost::python::len(args)>1) && PySlice_Check(boost::python::object(args[1]).ptr()));
+        if(resizes && (get_num_exports(boost::python::object(args[0]).ptr())>0))
+          {
+            PyErr_SetString(PyExc_BufferError,"existing exports of data: object cannot be re-sized.");
+            boost::python::throw_error_already_set();
+          }
+        PyObject *retval= PyObject_Call(method.ptr(),args.ptr(),kw.ptr());
+        return boost::python::object(boost::python::handle<>(retval));
+      }
+  };
+
+//! @brief Replaces the method of the class with a ResizeGuard.
+static void guard_resize(boost::python::object cls,const char *name,const bool &onlySlices)
+  {
+    boost::python::object method= cls.attr("__dict__")[name];
+    boost::python::setattr(cls,name,boost::python::raw_function(ResizeGuard(method,onlySlices),1));
+  }
+
+//! @brief Installs the buffer functions in the Python class.
+static void set_buffer_procs(boost::python::object cls, getbufferproc get)
+  {
+    PyTypeObject *type= reinterpret_cast<PyTypeObject *>(cls.ptr());
+    type->tp_as_buffer->bf_getbuffer= get;
+    type->tp_as_buffer->bf_releasebuffer= release_buffer;
+#if PY_MAJOR_VERSION < 3
+    type->tp_flags|= Py_TPFLAGS_HAVE_NEWBUFFER;
+#endif
+    PyType_Modified(type);
+  }
+
+//! @brief Makes the Python Vector class support the buffer protocol,
+//! so numpy.asarray(v) returns an array that shares the vector data
+//! (only for the vectors owned by Python, see owns_value).
+void XC::setVectorBufferProtocol(boost::python::object cls)
+  { set_buffer_procs(cls,vector_get_buffer); }
+
+//! @brief Makes the Python Matrix class support the buffer protocol,
+//! so numpy.asarray(m) returns an array (Fortran order) that shares
+//! the matrix data (only for the matrices owned by Python, see
+//! owns_value).
+void XC::setMatrixBufferProtocol(boost::python::object cls)
+  { set_buffer_procs(cls,matrix_get_buffer); }
+
+//! @brief Makes the Python ID class support the buffer protocol,
+//! so numpy.asarray(id) returns an array that shares the ID data.
+//! The methods that can change the size of the ID (append, extend,
+//! slice assignment and deletion) raise BufferError while there are
+//! arrays that share its data.
+void XC::setIDBufferProtocol(boost::python::object cls)
+  {
+    set_buffer_procs(cls,id_get_buffer);
+    guard_resize(cls,"append",false);
+    guard_resize(cls,"extend",false);
+    guard_resize(cls,"__delitem__",false);
+    guard_resize(cls,"__setitem__",true);
+  }
@@ -100,5 +100,10 @@ class_<XC::Matrix, bases<CommandEntity> >("Matrix")
   .def("getInverse",&XC::Matrix::getInverse,"Return the inverse of the matrix-")
    ;
 
+// numpy.asarray(obj) returns an array that shares the data of the object.
+XC::setIDBufferProtocol(scope().attr("ID"));
+XC::setVectorBufferProtocol(scope().attr("Vector"));
+XC::setMatrixBufferProtocol(scope().attr("Matrix"));
+
 
 #include "nDarray/python_interface.tcc"
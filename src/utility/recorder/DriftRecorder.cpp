@@ -208,7 +208,7 @@ int XC::DriftRecorder::record(int commitTag, double timeStamp)
           data(i+timeOffset) = 0.0;
       }
 
-    theHandler->write(data);
+    write_handler(data);
     return 0;
   }
 
@@ -370,7 +370,7 @@ int XC::DriftRecorder::initialize(void)
     //
 
     if(theHandler)
-      theHandler->open(dbColumns);
+      open_handler(dbColumns);
 
     //
     // mark as having been done & return
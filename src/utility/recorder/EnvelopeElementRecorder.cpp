@@ -104,7 +104,7 @@ XC::EnvelopeElementRecorder::~EnvelopeElementRecorder(void)
             int size = currentData->Size();
             for(int j=0; j<size; j++)
               (*currentData)(j) = (*data)(i,j);
-            theHandler->write(*currentData);
+            write_handler(*currentData);
           }
       }
   }
@@ -405,7 +405,7 @@ int XC::EnvelopeElementRecorder::initialize(void)
     // call open in the handler with the data description
     //
 
-    theHandler->open(dbColumns);
+    open_handler(dbColumns);
 
     initializationDone = true;  
     return 0;
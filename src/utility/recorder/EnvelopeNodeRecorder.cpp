@@ -166,7 +166,7 @@ XC::EnvelopeNodeRecorder::~EnvelopeNodeRecorder(void)
             int size= currentData->Size();
             for(int j=0; j<size; j++)
 	      (*currentData)(j) = (*data)(i,j);
-            theHandler->write(*currentData);
+            write_handler(*currentData);
           }
       }
   }
@@ -526,7 +526,7 @@ int XC::EnvelopeNodeRecorder::initialize(void)
   //
 
   if(theHandler != 0)
-    theHandler->open(dbColumns);
+    open_handler(dbColumns);
 
   initializationDone = true;
 
@@ -28,17 +28,52 @@
 
 #include <utility/recorder/HandlerRecorder.h>
 #include <utility/handler/DataOutputHandler.h>
+#include <utility/handler/DataOutputQueue.h>
 
 XC::HandlerRecorder::HandlerRecorder(int classTag)
-  :DomainRecorderBase(classTag,nullptr), theHandler(nullptr), initializationDone(false), echoTimeFlag(false)
+  :DomainRecorderBase(classTag,nullptr), theHandler(nullptr), outputQueue(nullptr), initializationDone(false), echoTimeFlag(false)
   {}
 
 XC::HandlerRecorder::HandlerRecorder(int classTag,Domain &theDom,DataOutputHandler &theOutputHandler,bool tf)
-  :DomainRecorderBase(classTag,&theDom), theHandler(&theOutputHandler), initializationDone(false), echoTimeFlag(tf) {}
+  :DomainRecorderBase(classTag,&theDom), theHandler(&theOutputHandler), outputQueue(nullptr), initializationDone(false), echoTimeFlag(tf) {}
 
 //! @brief Sets de data output handler
 void XC::HandlerRecorder::SetOutputHandler(DataOutputHandler *tH)
-  { theHandler= tH; }
+  {
+    if(outputQueue)
+      outputQueue->flush();
+    theHandler= tH;
+  }
+
+//! @brief Sets the queue that writes the rows in a background thread
+//! (if null the rows are written by the recorder itself).
+void XC::HandlerRecorder::setOutputQueue(DataOutputQueue *q)
+  {
+    if(outputQueue && (outputQueue!=q))
+      outputQueue->flush();
+    outputQueue= q;
+  }
+
+//! @brief Opens the output handler (the rows in the queue are written
+//! before).
+int XC::HandlerRecorder::open_handler(const std::vector<std::string> &dataDescription)
+  {
+    if(outputQueue)
+      outputQueue->flush();
+    return theHandler->open(dataDescription);
+  }
+
+//! @brief Writes the row through the output handler, or copies it
+//! into the output queue if there is one.
+int XC::HandlerRecorder::write_handler(Vector &data)
+  {
+    int retval= 0;
+    if(outputQueue)
+      retval= outputQueue->push(theHandler,data);
+    else
+      retval= theHandler->write(data);
+    return retval;
+  }
 
 
 //! @brief Sends objet through the communicator being passed as parameter.
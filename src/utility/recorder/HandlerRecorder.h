@@ -30,10 +30,14 @@
 #define HandlerRecorder_h
 
 #include <utility/recorder/DomainRecorderBase.h>
+#include <vector>
+#include <string>
 
 namespace XC {
 class Domain;
 class DataOutputHandler;
+class DataOutputQueue;
+class Vector;
 
 //! @ingroup Recorder
 //
@@ -43,8 +47,11 @@ class HandlerRecorder: public DomainRecorderBase
   {
   protected:
     DataOutputHandler *theHandler; //!< Output handler (TO DEPRECATE).
+    DataOutputQueue *outputQueue; //!< If not null, the rows are written by a background thread.
     bool initializationDone;
     bool echoTimeFlag;   // flag indicating whether time to be included in o/p
+    int open_handler(const std::vector<std::string> &);
+    int write_handler(Vector &);
   protected:
     int sendData(CommParameters &);  
     int receiveData(const CommParameters &);
@@ -53,6 +60,7 @@ class HandlerRecorder: public DomainRecorderBase
     HandlerRecorder(int classTag);
     HandlerRecorder(int classTag, Domain &theDomain, DataOutputHandler &theOutputHandler,bool timeFlag);
     void SetOutputHandler(DataOutputHandler *tH);
+    void setOutputQueue(DataOutputQueue *);
 
   };
 } // end of XC namespace
@@ -94,6 +94,12 @@ class NodeRecorder: public NodeRecorderBase
 		 double deltaT = 0.0, bool echoTimeFlag = true); 
 
     void setupDataFlag(const std::string &dataToStore);
+    void setNodes(const ID &);
+    void setDofs(const ID &);
+    inline bool getEchoTimeFlag(void) const
+      { return echoTimeFlag; }
+    inline void setEchoTimeFlag(const bool &b)
+      { echoTimeFlag= b; }
     int record(int commitTag, double timeStamp);
 
     int sendSelf(CommParameters &);  
@@ -64,12 +64,32 @@
 #include <utility/recorder/PatternRecorder.h>
 #include <utility/recorder/NodePropRecorder.h>
 #include <utility/recorder/ElementPropRecorder.h>
+#include <utility/recorder/HandlerRecorder.h>
+#include <utility/handler/DataOutputQueue.h>
+#include <algorithm>
 
 
 #include "boost/any.hpp"
 
 XC::ObjWithRecorders::ObjWithRecorders(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh)
-  : CommandEntity(owr), theRecorders(), output_handlers(oh) {}
+  : CommandEntity(owr), theRecorders(), output_handlers(oh),
+    outputQueue(nullptr), outputQueueCapacity(1024) {}
+
+//! @brief Copy constructor (the output queue is not copied).
+XC::ObjWithRecorders::ObjWithRecorders(const ObjWithRecorders &other)
+  : CommandEntity(other), theRecorders(other.theRecorders),
+    output_handlers(other.output_handlers), outputQueue(nullptr),
+    outputQueueCapacity(other.outputQueueCapacity) {}
+
+//! @brief Assignment operator (the output queue is not copied).
+XC::ObjWithRecorders &XC::ObjWithRecorders::operator=(const ObjWithRecorders &other)
+  {
+    CommandEntity::operator=(other);
+    theRecorders= other.theRecorders;
+    output_handlers= other.output_handlers;
+    outputQueueCapacity= other.outputQueueCapacity;
+    return *this;
+  }
 
 
 //! @brief Read a Recorder object from file.
@@ -155,7 +175,16 @@ XC::Recorder *XC::ObjWithRecorders::newRecorder(const std::string &cod,DataOutpu
       std::cerr << "Recorder type: '" << cod
                 << "' unknown." << std::endl;
     if(retval)
-      addRecorder(*retval);
+      {
+        HandlerRecorder *tmp= dynamic_cast<HandlerRecorder *>(retval);
+        if(tmp)
+          {
+            Domain *dom= get_domain_ptr();
+            if(dom)
+              tmp->setDomain(*dom);
+          }
+        addRecorder(*retval);
+      }
     return retval;
   }
 
@@ -165,6 +194,11 @@ XC::ObjWithRecorders::~ObjWithRecorders(void)
     for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
       delete *i; 
     theRecorders.erase(theRecorders.begin(),theRecorders.end());
+    if(outputQueue)
+      {
+        delete outputQueue; //Writes the pending rows.
+        outputQueue= nullptr;
+      }
   }
 
 //! @brief Adds a recorder.
@@ -174,6 +208,9 @@ XC::ObjWithRecorders::~ObjWithRecorders(void)
 int XC::ObjWithRecorders::addRecorder(Recorder &theRecorder)
   {
     theRecorders.push_back(&theRecorder);
+    HandlerRecorder *tmp= dynamic_cast<HandlerRecorder *>(&theRecorder);
+    if(tmp)
+      tmp->setOutputQueue(outputQueue);
     return 0;
   }
 
@@ -190,6 +227,7 @@ int XC::ObjWithRecorders::record(int cTag, double timeStamp)
 //! which have been added.
 void XC::ObjWithRecorders::restart(void)
   {
+    flushRecorders();
     for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
       (*i)->restart();
   }
@@ -200,9 +238,63 @@ int XC::ObjWithRecorders::removeRecorders(void)
     for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
       delete *i; 
     theRecorders.erase(theRecorders.begin(),theRecorders.end());
+    flushRecorders(); //Rows written by the recorders destructors.
     return 0;
   }
 
+//! @brief Assigns the output queue to the recorders that write
+//! through an output handler.
+void XC::ObjWithRecorders::set_output_queue(DataOutputQueue *q)
+  {
+    for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
+      {
+        HandlerRecorder *tmp= dynamic_cast<HandlerRecorder *>(*i);
+        if(tmp)
+          tmp->setOutputQueue(q);
+      }
+  }
+
+//! @brief Activates or deactivates the asynchronous recording.
+//!
+//! When activated, the recorders copy their output into a buffer and
+//! return immediately; a background thread writes the rows through
+//! the output handlers. The rows waiting to be written are flushed
+//! before deactivating it.
+void XC::ObjWithRecorders::setAsyncRecording(const bool &b)
+  {
+    if(b && !outputQueue)
+      {
+        outputQueue= new DataOutputQueue(outputQueueCapacity);
+        set_output_queue(outputQueue);
+      }
+    else if(!b && outputQueue)
+      {
+        set_output_queue(nullptr);
+        delete outputQueue;
+        outputQueue= nullptr;
+      }
+  }
+
+//! @brief Sets the maximum number of rows waiting to be written (when
+//! the buffer is full the recorders wait for the writer thread).
+void XC::ObjWithRecorders::setOutputQueueCapacity(const size_t &c)
+  {
+    outputQueueCapacity= std::max(c,size_t(1));
+    if(outputQueue)
+      {
+        setAsyncRecording(false);
+        setAsyncRecording(true);
+      }
+  }
+
+//! @brief Waits until all the rows of the asynchronous recorders have
+//! been written.
+void XC::ObjWithRecorders::flushRecorders(void)
+  {
+    if(outputQueue)
+      outputQueue->flush();
+  }
+
 //! @brief Asigna el domain a los recorders.
 void XC::ObjWithRecorders::setLinks(Domain *ptr_dom)
   {
@@ -36,7 +36,8 @@
 
 namespace XC {
 class Recorder;
- class Domain;
+class Domain;
+class DataOutputQueue;
 
 //! @ingroup Recorder
 //
@@ -50,6 +51,10 @@ class ObjWithRecorders: public CommandEntity
   private:
     lista_recorders theRecorders; //!< recorders list.
     DataOutputHandler::map_output_handlers *output_handlers; //!< output handlers.
+    DataOutputQueue *outputQueue; //!< if not null, the recorder output is written by a background thread.
+    size_t outputQueueCapacity; //!< maximum number of rows waiting to be written.
+
+    void set_output_queue(DataOutputQueue *);
 
   protected:
     int sendData(CommParameters &cp);
@@ -61,6 +66,8 @@ class ObjWithRecorders: public CommandEntity
     virtual Domain *get_domain_ptr(void)= 0;
   public:
     ObjWithRecorders(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh= nullptr);
+    ObjWithRecorders(const ObjWithRecorders &);
+    ObjWithRecorders &operator=(const ObjWithRecorders &);
     virtual ~ObjWithRecorders(void);
 
     Recorder *newRecorder(const std::string &,DataOutputHandler *oh= nullptr);
@@ -77,6 +84,13 @@ class ObjWithRecorders: public CommandEntity
     void restart(void);
     virtual int removeRecorders(void);
     void setLinks(Domain *dom);
+    inline bool getAsyncRecording(void) const
+      { return (outputQueue!=nullptr); }
+    void setAsyncRecording(const bool &);
+    inline size_t getOutputQueueCapacity(void) const
+      { return outputQueueCapacity; }
+    void setOutputQueueCapacity(const size_t &);
+    void flushRecorders(void);
     void SetOutputHandlers(DataOutputHandler::map_output_handlers *oh);
   };
 } // end of XC namespace
@@ -75,7 +75,12 @@ class_<XC::ElementRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable
 
 class_<XC::NodeRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable >("NodeRecorderBase", no_init);
 
-class_<XC::NodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("NodeRecorder", no_init);
+class_<XC::NodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("NodeRecorder", no_init)
+  .def("setNodes",&XC::NodeRecorder::setNodes,"setNodes(tags): assigns the nodes to record.")
+  .def("setDofs",&XC::NodeRecorder::setDofs,"setDofs(dofs): assigns the degrees of freedom to record.")
+  .def("setDataToStore",&XC::NodeRecorder::setupDataFlag,"setDataToStore(str): assigns the nodal response to record (disp, vel, accel, incrDisp, incrDeltaDisp, unbalance, reaction,...).")
+  .add_property("echoTimeFlag",&XC::NodeRecorder::getEchoTimeFlag,&XC::NodeRecorder::setEchoTimeFlag,"If true the first column is the time.")
+  ;
 
 class_<XC::EnvelopeNodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("EnvelopeNodeRecorder", no_init);
 
@@ -86,6 +91,9 @@ class_<XC::EnvelopeElementRecorder, bases<XC::ElementRecorderBase>, boost::nonco
 class_<XC::ObjWithRecorders, bases<CommandEntity>, boost::noncopyable >("ObjWithRecorders", no_init)
   .def("newRecorder",make_function(&XC::ObjWithRecorders::newRecorder,return_internal_reference<>()),"Creates a new recorder.")  
   .def("removeRecorders",&XC::ObjWithRecorders::removeRecorders,"Deletes all the recorders.")  
+  .add_property("asyncRecording",&XC::ObjWithRecorders::getAsyncRecording,&XC::ObjWithRecorders::setAsyncRecording,"If true the output of the recorders is written by a background thread.")
+  .add_property("outputQueueCapacity",&XC::ObjWithRecorders::getOutputQueueCapacity,&XC::ObjWithRecorders::setOutputQueueCapacity,"Maximum number of rows waiting to be written when asyncRecording is true.")
+  .def("flushRecorders",&XC::ObjWithRecorders::flushRecorders,"Waits until all the output of the recorders has been written.")
   ;
 
 
@@ -0,0 +1,194 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadPool.cc
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace {
+  //! @brief True if the calling thread is processing a chunk of
+  //! a parallel loop.
+  thread_local bool insideParallelLoop= false;
+
+  //! @brief Sets the flag of the calling thread while the object
+  //! lives (restores the previous value even if an exception is thrown).
+  class ParallelLoopGuard
+    {
+      bool previous;
+    public:
+      ParallelLoopGuard(void)
+        : previous(insideParallelLoop)
+        { insideParallelLoop= true; }
+      ~ParallelLoopGuard(void)
+        { insideParallelLoop= previous; }
+    };
+
+  std::mutex sharedPoolMutex; //!< protects sharedPool.
+  std::shared_ptr<XC::ThreadPool> sharedPool; //!< process-wide pool.
+}
+
+//! @brief Constructor.
+//!
+//! @param numThreads: number of threads (including the calling one)
+//! that will process the loops.
+XC::ThreadPool::ThreadPool(const size_t &numThreads)
+  : task(nullptr), activeThreads(0), generation(0), pending(0), stop(false)
+  {
+    const size_t nt= std::max(numThreads,size_t(1));
+    errors.resize(nt);
+    workers.reserve(nt-1);
+    for(size_t i= 1;i<nt;i++)
+      workers.push_back(std::thread(&ThreadPool::worker_loop,this,i));
+  }
+
+//! @brief Destructor; waits until the workers finish.
+XC::ThreadPool::~ThreadPool(void)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      stop= true;
+    }
+    start_cond.notify_all();
+    for(std::vector<std::thread>::iterator i= workers.begin();i!=workers.end();i++)
+      i->join();
+  }
+
+//! @brief Return the number of threads (including the calling one).
+size_t XC::ThreadPool::getNumThreads(void) const
+  { return workers.size()+1; }
+
+//! @brief Loop executed by the worker with the index being passed
+//! as parameter.
+void XC::ThreadPool::worker_loop(const size_t &idx)
+  {
+    setThreadIndex(idx);
+    insideParallelLoop= true;
+    size_t lastGeneration= 0;
+    while(true)
+      {
+        const ChunkFunction *f= nullptr;
+        size_t first= 0, last= 0;
+        {
+          std::unique_lock<std::mutex> lock(mtx);
+          start_cond.wait(lock,[this,&lastGeneration]{ return stop || (generation!=lastGeneration); });
+          if(stop)
+            return;
+          lastGeneration= generation;
+          if(idx>=activeThreads)
+            continue;
+          f= task;
+          first= bounds[idx];
+          last= bounds[idx+1];
+        }
+        try
+          { (*f)(first,last,idx); }
+        catch(...)
+          { errors[idx]= std::current_exception(); }
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          pending--;
+          if(pending==0)
+            end_cond.notify_one();
+        }
+      }
+  }
+
+//! @brief Split the [0,n) range in contiguous chunks (one for each
+//! thread of the pool) and process them concurrently.
+//!
+//! @param n: number of indexes to process.
+//! @param f: function to call on each chunk.
+void XC::ThreadPool::run(const size_t &n,const ChunkFunction &f)
+  { run(n,getNumThreads(),f); }
+
+//! @brief Split the [0,n) range in contiguous chunks (one for each
+//! of the first numThreads threads of the pool) and process them
+//! concurrently. Returns when all the chunks are processed; exceptions
+//! thrown inside a chunk are re-thrown in the calling thread.
+//!
+//! The chunk boundaries depend only on n and the number of threads
+//! used (the minimum of numThreads and the size of the pool), so
+//! the results don't depend on the size of the pool when it has at
+//! least numThreads threads. When called from inside a chunk the
+//! whole range is processed serially by the calling thread.
+//!
+//! @param n: number of indexes to process.
+//! @param numThreads: maximum number of threads to use.
+//! @param f: function to call on each chunk.
+void XC::ThreadPool::run(const size_t &n,const size_t &numThreads,const ChunkFunction &f)
+  {
+    const size_t nt= std::max(std::min(std::min(getNumThreads(),numThreads),n),size_t(1));
+    if((nt<2) || insideParallelLoop)
+      {
+        f(0,n,0);
+        return;
+      }
+    std::lock_guard<std::mutex> run_lock(run_mtx);
+    ParallelLoopGuard guard;
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      const size_t chunk= n/nt;
+      const size_t remainder= n%nt;
+      bounds.assign(nt+1,0);
+      for(size_t i= 0;i<nt;i++)
+        bounds[i+1]= bounds[i]+chunk+(i<remainder ? 1 : 0);
+      std::fill(errors.begin(),errors.end(),std::exception_ptr());
+      task= &f;
+      activeThreads= nt;
+      pending= nt-1;
+      generation++;
+    }
+    start_cond.notify_all();
+    try
+      { f(bounds[0],bounds[1],0); }
+    catch(...)
+      { errors[0]= std::current_exception(); }
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      end_cond.wait(lock,[this]{ return pending==0; });
+      task= nullptr;
+    }
+    for(std::vector<std::exception_ptr>::const_iterator i= errors.begin();i!=errors.end();i++)
+      if(*i)
+        std::rethrow_exception(*i);
+  }
+
+//! @brief Return the thread pool shared by all the objects of the
+//! process. The pool is created on the first call and replaced by a
+//! larger one when more threads are requested; the previous pool stays
+//! alive while its users hold the returned pointer.
+//!
+//! @param numThreads: number of threads (including the calling one)
+//! the caller needs.
+std::shared_ptr<XC::ThreadPool> XC::getSharedThreadPool(const size_t &numThreads)
+  {
+    const size_t nt= std::max(numThreads,size_t(1));
+    std::lock_guard<std::mutex> lock(sharedPoolMutex);
+    if(!sharedPool || (sharedPool->getNumThreads()<nt))
+      sharedPool= std::make_shared<ThreadPool>(nt);
+    return sharedPool;
+  }
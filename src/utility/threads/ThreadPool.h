@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadPool.h
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include "parallel_loop.h"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Set of threads that stay alive between parallel loops.
+//!
+//! Equivalent to parallel_for but the worker threads are created only
+//! once, so it can be used by algorithms that run many short parallel
+//! loops (i.e. the block steps of a factorization). The calling thread
+//! processes the first chunk; the chunk boundaries depend only on the
+//! number of indexes and the number of threads, so the work assigned
+//! to each thread is deterministic.
+//!
+//! A loop launched from inside a chunk (by any pool) runs serially in
+//! the calling thread, so nested parallel loops do not deadlock.
+//! The objects that need threads should not create their own pools;
+//! they share the process-wide pool returned by getSharedThreadPool
+//! (or simply call parallel_for).
+class ThreadPool
+  {
+  private:
+    std::vector<std::thread> workers; //!< worker threads.
+    std::mutex mtx; //!< protects the members below.
+    std::mutex run_mtx; //!< serializes the calls to run.
+    std::condition_variable start_cond; //!< signals new work.
+    std::condition_variable end_cond; //!< signals the end of the work.
+    const ChunkFunction *task; //!< function to run.
+    std::vector<size_t> bounds; //!< chunk boundaries.
+    std::vector<std::exception_ptr> errors; //!< exceptions thrown by the chunks.
+    size_t activeThreads; //!< number of threads that take part in the current loop.
+    size_t generation; //!< number of loops launched.
+    size_t pending; //!< number of worker chunks not finished yet.
+    bool stop; //!< true when the workers must finish.
+
+    void worker_loop(const size_t &);
+    ThreadPool(const ThreadPool &);
+    ThreadPool &operator=(const ThreadPool &);
+  public:
+    explicit ThreadPool(const size_t &numThreads);
+    ~ThreadPool(void);
+    size_t getNumThreads(void) const;
+    void run(const size_t &,const ChunkFunction &);
+    void run(const size_t &,const size_t &,const ChunkFunction &);
+  };
+
+std::shared_ptr<ThreadPool> getSharedThreadPool(const size_t &);
+
+} // end of XC namespace
+
+#endif
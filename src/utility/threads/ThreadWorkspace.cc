@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadWorkspace.cc
+
+#include "ThreadWorkspace.h"
+
+//! @brief Constructor.
+XC::ThreadWorkspace::ThreadWorkspace(void)
+  {}
+
+//! @brief Destructor.
+XC::ThreadWorkspace::~ThreadWorkspace(void)
+  {}
+
+//! @brief Return a scratch matrix with the dimensions being passed
+//! as parameter.
+//!
+//! @param nRows: number of rows.
+//! @param nCols: number of columns.
+//! @param slot: identifier of the matrix (to use several matrices with
+//!              the same dimensions).
+XC::Matrix &XC::ThreadWorkspace::getMatrix(const size_t &nRows,const size_t &nCols,const size_t &slot)
+  {
+    const MatrixKey key(nRows,nCols,slot);
+    std::map<MatrixKey,Matrix>::iterator i= matrices.find(key);
+    if(i==matrices.end())
+      i= matrices.insert(std::make_pair(key,Matrix(nRows,nCols))).first;
+    return i->second;
+  }
+
+//! @brief Return a scratch vector with the size being passed
+//! as parameter.
+//!
+//! @param sz: size of the vector.
+//! @param slot: identifier of the vector (to use several vectors with
+//!              the same size).
+XC::Vector &XC::ThreadWorkspace::getVector(const size_t &sz,const size_t &slot)
+  {
+    const VectorKey key(sz,slot);
+    std::map<VectorKey,Vector>::iterator i= vectors.find(key);
+    if(i==vectors.end())
+      i= vectors.insert(std::make_pair(key,Vector(sz))).first;
+    return i->second;
+  }
+
+//! @brief Release the memory used by the workspace.
+//!
+//! The references obtained previously become invalid.
+void XC::ThreadWorkspace::clear(void)
+  {
+    matrices.clear();
+    vectors.clear();
+  }
+
+//! @brief Return the workspace of the calling thread.
+XC::ThreadWorkspace &XC::ThreadWorkspace::get(void)
+  {
+    static thread_local ThreadWorkspace retval;
+    return retval;
+  }
@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadWorkspace.h
+
+#ifndef THREADWORKSPACE_H
+#define THREADWORKSPACE_H
+
+#include <cstddef>
+#include <map>
+#include <tuple>
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Scratch matrices and vectors owned by a thread.
+//!
+//! Objects that need temporary storage to compute their results
+//! (i.e. element damping matrices, nodal reactions,...) can take it
+//! from the workspace of the calling thread instead of sharing
+//! class-wide (static) objects, so they can be used concurrently
+//! from different threads. Each object is identified by its dimensions
+//! and a slot number (so several objects of the same size can be used
+//! at the same time); the returned references remain valid until
+//! the thread finishes.
+class ThreadWorkspace
+  {
+  private:
+    typedef std::tuple<size_t,size_t,size_t> MatrixKey;
+    typedef std::pair<size_t,size_t> VectorKey;
+    std::map<MatrixKey,Matrix> matrices; //!< scratch matrices.
+    std::map<VectorKey,Vector> vectors; //!< scratch vectors.
+
+    ThreadWorkspace(void);
+    ThreadWorkspace(const ThreadWorkspace &);
+    ThreadWorkspace &operator=(const ThreadWorkspace &);
+  public:
+    ~ThreadWorkspace(void);
+    Matrix &getMatrix(const size_t &,const size_t &,const size_t &slot= 0);
+    Vector &getVector(const size_t &,const size_t &slot= 0);
+    void clear(void);
+
+    static ThreadWorkspace &get(void);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,93 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//parallel_loop.cc
+
+#include "parallel_loop.h"
+#include "ThreadPool.h"
+#include <thread>
+#include <algorithm>
+
+namespace {
+  //! @brief Index of the current thread inside the parallel loop
+  //! (zero for the thread that launches the loop).
+  thread_local size_t currentThreadIndex= 0;
+}
+
+//! @brief Return the index of the calling thread inside the running
+//! parallel loop; the thread that launches the loop (and any thread
+//! outside a parallel loop) has index zero.
+//!
+//! Objects that keep class wide scratch storage (see
+//! UnbalAndTangentStorage) use this index to select the storage bank
+//! of the calling thread.
+size_t XC::getThreadIndex(void)
+  { return currentThreadIndex; }
+
+//! @brief Set the index of the calling thread (used by the
+//! objects that run the chunks of a parallel loop, see ThreadPool).
+void XC::setThreadIndex(const size_t &i)
+  { currentThreadIndex= i; }
+
+//! @brief Return the number of concurrent threads supported by the
+//! hardware (one if it cannot be determined).
+size_t XC::getHardwareConcurrency(void)
+  {
+    const size_t retval= std::thread::hardware_concurrency();
+    return (retval>0 ? retval : 1);
+  }
+
+//! @brief Return the number of threads to use when numThreads are
+//! requested: numThreads if it's positive, the number of concurrent
+//! threads supported by the hardware otherwise.
+size_t XC::getThreadCount(const int &numThreads)
+  { return (numThreads>0 ? size_t(numThreads) : getHardwareConcurrency()); }
+
+//! @brief Split the [0,n) range in numThreads contiguous chunks and
+//! process each of them in a different thread.
+//!
+//! The chunks are processed by the threads of the shared pool (see
+//! getSharedThreadPool) so no threads are created on each call and
+//! the thread_local storage of the workers survives between loops.
+//! The first chunk is processed by the calling thread, so the work of
+//! the loop is the same as the serial one when numThreads is one. The
+//! chunk boundaries depend only on n and numThreads, so the
+//! assignment of indexes to threads is deterministic. Exceptions thrown
+//! inside a chunk are re-thrown in the calling thread once all the
+//! chunks have finished. Loops launched from inside a chunk run
+//! serially.
+//!
+//! @param n: number of indexes to process.
+//! @param numThreads: number of threads to use.
+//! @param f: function to call on each chunk.
+void XC::parallel_for(const size_t &n,const size_t &numThreads,const ChunkFunction &f)
+  {
+    const size_t nt= std::min(std::max(numThreads,size_t(1)),std::max(n,size_t(1)));
+    if(nt<2)
+      f(0,n,0);
+    else
+      getSharedThreadPool(nt)->run(n,nt,f);
+  }
@@ -0,0 +1,52 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//parallel_loop.h
+
+#ifndef PARALLEL_LOOP_H
+#define PARALLEL_LOOP_H
+
+#include <cstddef>
+#include <functional>
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Function called on each chunk of a parallel loop. The
+//! arguments are the first index of the chunk, one past the last
+//! index of the chunk and the index of the thread that processes it.
+typedef std::function<void(size_t,size_t,size_t)> ChunkFunction;
+
+size_t getThreadIndex(void);
+void setThreadIndex(const size_t &);
+size_t getHardwareConcurrency(void);
+size_t getThreadCount(const int &);
+void parallel_for(const size_t &,const size_t &,const ChunkFunction &);
+
+} // end of XC namespace
+
+#endif
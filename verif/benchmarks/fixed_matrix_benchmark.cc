@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//fixed_matrix_benchmark.cc
+//
+// Benchmark: counts the heap allocations and measures the time needed
+// to compute the transverse shear B matrix of the MITC4 shell element
+// (Bs= Rot*(Ms*G)) using the Matrix class and using FixedMatrix.
+//
+// Build (against an installed XC library):
+//   g++ -std=c++11 -O2 -I<xc_src_dir> fixed_matrix_benchmark.cc -lxc -o fixed_matrix_benchmark
+// Usage:
+//   ./fixed_matrix_benchmark [numIterations]
+
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/FixedMatrix.h"
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <iostream>
+
+static size_t numAllocations= 0; //!< number of calls to operator new.
+
+void *operator new(size_t sz)
+  {
+    numAllocations++;
+    void *retval= std::malloc(sz ? sz : 1);
+    if(!retval)
+      throw std::bad_alloc();
+    return retval;
+  }
+
+void *operator new[](size_t sz)
+  {
+    numAllocations++;
+    void *retval= std::malloc(sz ? sz : 1);
+    if(!retval)
+      throw std::bad_alloc();
+    return retval;
+  }
+
+void operator delete(void *p) noexcept
+  { std::free(p); }
+
+void operator delete[](void *p) noexcept
+  { std::free(p); }
+
+void operator delete(void *p, size_t) noexcept
+  { std::free(p); }
+
+void operator delete[](void *p, size_t) noexcept
+  { std::free(p); }
+
+//! @brief Fills the G matrix like ShellMITC4Base::calculateG does.
+template <class M>
+void fillG(M &G, const double &d)
+  {
+    G(0,0)=-0.5; G(0,1)=-0.25*d; G(0,2)=0.25; G(0,9)=0.5; G(0,10)=-0.25*d; G(0,11)=0.25;
+    G(1,0)=-0.5; G(1,1)=-0.25; G(1,2)=0.25*d; G(1,3)=0.5; G(1,4)=-0.25; G(1,5)=0.25*d;
+    G(2,3)=-0.5; G(2,4)=-0.25*d; G(2,5)=0.25; G(2,6)=0.5; G(2,7)=-0.25*d; G(2,8)=0.25;
+    G(3,6)=0.5; G(3,7)=-0.25; G(3,8)=0.25*d; G(3,9)=-0.5; G(3,10)=-0.25; G(3,11)=0.25*d;
+  }
+
+//! @brief Shear B matrix computed with the Matrix class (code used
+//! by ShellMITC4Base before FixedMatrix).
+double matrixKernel(const double &r, const double &s)
+  {
+    XC::Matrix G(4,12);
+    G.Zero();
+    fillG(G,r);
+    XC::Matrix Ms(2,4);
+    Ms.Zero();
+    XC::Matrix Bsv(2,12);
+    Bsv.Zero();
+    XC::Matrix Rot(2,2);
+    Rot.Zero();
+    Rot(0,0)= 1.0; Rot(0,1)= -s; Rot(1,0)= -s; Rot(1,1)= 1.0;
+    XC::Matrix Bs(2,12);
+    Ms(1,0)=1-r; Ms(0,1)=1-s; Ms(1,2)=1+r; Ms(0,3)=1+s;
+    Bsv= Ms*G;
+    Bs= Rot*Bsv;
+    return Bs(0,0)+Bs(1,11);
+  }
+
+//! @brief Shear B matrix computed with FixedMatrix (code used
+//! by ShellMITC4Base now).
+double fixedMatrixKernel(const double &r, const double &s)
+  {
+    XC::FixedMatrix<4,12> G;
+    fillG(G,r);
+    XC::FixedMatrix<2,4> Ms;
+    XC::FixedMatrix<2,12> Bsv;
+    XC::FixedMatrix<2,2> Rot;
+    Rot(0,0)= 1.0; Rot(0,1)= -s; Rot(1,0)= -s; Rot(1,1)= 1.0;
+    XC::FixedMatrix<2,12> Bs;
+    Ms(1,0)=1-r; Ms(0,1)=1-s; Ms(1,2)=1+r; Ms(0,3)=1+s;
+    Bsv= Ms*G;
+    Bs= Rot*Bsv;
+    return Bs(0,0)+Bs(1,11);
+  }
+
+template <class F>
+void run(const std::string &name, F kernel, const size_t &n)
+  {
+    double sum= 0.0;
+    const size_t allocs0= numAllocations;
+    const auto t0= std::chrono::steady_clock::now();
+    for(size_t i= 0;i<n;i++)
+      sum+= kernel(1e-3*(i%1000),-1e-3*(i%777));
+    const auto t1= std::chrono::steady_clock::now();
+    const size_t allocs= numAllocations-allocs0;
+    const double us= std::chrono::duration<double,std::micro>(t1-t0).count();
+    std::cout << name << ": " << double(allocs)/n << " allocations/iteration, "
+              << us*1e3/n << " ns/iteration (checksum: " << sum << ")" << std::endl;
+  }
+
+int main(int argc, char *argv[])
+  {
+    size_t n= 1000000;
+    if(argc>1)
+      n= std::atol(argv[1]);
+    run("Matrix     ",matrixKernel,n);
+    run("FixedMatrix",fixedMatrixKernel,n);
+    return 0;
+  }
@@ -0,0 +1,201 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//parallel_assembly_benchmark.cc
+//
+// Benchmark: measures the time needed to assemble the stiffness matrix
+// of a strip of four node plane stress quads following the algorithm of
+// IncrementalIntegrator::formElementTangentParallel (the tangents of
+// each chunk of numThreads*batchSize elements are computed concurrently
+// and then added to the band matrix by the calling thread). The loops
+// run on the shared ThreadPool (parallel_for) and, for comparison, on
+// threads created for each chunk.
+//
+// Build (only the thread utilities are needed):
+//   g++ -std=c++11 -O2 -pthread -I<xc_src_dir> parallel_assembly_benchmark.cc
+//       <xc_src_dir>/utility/threads/ThreadPool.cc
+//       <xc_src_dir>/utility/threads/parallel_loop.cc -o parallel_assembly_benchmark
+// Usage:
+//   ./parallel_assembly_benchmark [numElementsX] [numRepetitions]
+
+#include "utility/threads/parallel_loop.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cmath>
+
+const size_t numElementsY= 4; //!< number of elements across the strip.
+const size_t batchSize= 64; //!< elements computed by each thread before assembling.
+
+//! @brief Scratch storage of the calling thread (as ThreadWorkspace).
+std::vector<double> &scratch(void)
+  {
+    thread_local std::vector<double> retval(3*8);
+    return retval;
+  }
+
+//! @brief Stiffness matrix of a rectangular plane stress quad of
+//! dimensions a x b (2x2 Gauss points, unit thickness).
+void quadStiffness(const double &a, const double &b, double K[64])
+  {
+    const double E= 2.1e9, nu= 0.3;
+    const double c= E/(1.0-nu*nu);
+    const double D[3][3]= {{c,c*nu,0.0},{c*nu,c,0.0},{0.0,0.0,c*(1.0-nu)/2.0}};
+    const double xi[4]= {-1.0,1.0,1.0,-1.0};
+    const double eta[4]= {-1.0,-1.0,1.0,1.0};
+    const double g= 1.0/std::sqrt(3.0);
+    std::vector<double> &B= scratch();
+    std::fill(K,K+64,0.0);
+    for(size_t gp= 0;gp<4;gp++)
+      {
+        const double r= xi[gp]*g, s= eta[gp]*g;
+        std::fill(B.begin(),B.end(),0.0);
+        for(size_t n= 0;n<4;n++)
+          {
+            const double dNdx= xi[n]*(1.0+eta[n]*s)/(2.0*a);
+            const double dNdy= eta[n]*(1.0+xi[n]*r)/(2.0*b);
+            B[0*8+2*n]= dNdx;
+            B[1*8+2*n+1]= dNdy;
+            B[2*8+2*n]= dNdy;
+            B[2*8+2*n+1]= dNdx;
+          }
+        const double w= a*b/4.0;
+        for(size_t i= 0;i<8;i++)
+          for(size_t j= 0;j<8;j++)
+            {
+              double tmp= 0.0;
+              for(size_t k= 0;k<3;k++)
+                for(size_t l= 0;l<3;l++)
+                  tmp+= B[k*8+i]*D[k][l]*B[l*8+j];
+              K[i*8+j]+= w*tmp;
+            }
+      }
+  }
+
+//! @brief Parallel loop that creates the threads on each call (the
+//! parallel_for implementation before the shared ThreadPool).
+void spawn_for(const size_t &n,const size_t &numThreads,const XC::ChunkFunction &f)
+  {
+    const size_t nt= std::max(std::min(numThreads,n),size_t(1));
+    std::vector<size_t> bounds(nt+1,0);
+    for(size_t i= 0;i<nt;i++)
+      bounds[i+1]= bounds[i]+n/nt+(i<n%nt ? 1 : 0);
+    std::vector<std::thread> workers;
+    for(size_t i= 1;i<nt;i++)
+      workers.push_back(std::thread([&f,&bounds,i]() { f(bounds[i],bounds[i+1],i); }));
+    f(bounds[0],bounds[1],0);
+    for(size_t i= 0;i<workers.size();i++)
+      workers[i].join();
+  }
+
+typedef void (*LoopFunction)(const size_t &,const size_t &,const XC::ChunkFunction &);
+
+//! @brief Assembles the band matrix and returns the time in seconds.
+double assemble(const size_t &nx, const size_t &numThreads, LoopFunction loop, std::vector<double> &band, const size_t &halfBand)
+  {
+    const size_t numEle= nx*numElementsY;
+    const size_t chunkSize= numThreads*batchSize;
+    std::vector<double> tangents(std::min(chunkSize,numEle)*64);
+    std::fill(band.begin(),band.end(),0.0);
+    const auto t0= std::chrono::steady_clock::now();
+    for(size_t first= 0;first<numEle;first+= chunkSize)
+      {
+        const size_t last= std::min(first+chunkSize,numEle);
+        loop(last-first,numThreads,[&](size_t b,size_t e,size_t)
+          {
+            for(size_t i= b;i<e;i++)
+              quadStiffness(1.0,1.0+1e-6*((first+i)%7),&tangents[i*64]);
+          });
+        for(size_t i= first;i<last;i++)
+          {
+            const size_t ex= i/numElementsY, ey= i%numElementsY;
+            const size_t nodes[4]= {ex*(numElementsY+1)+ey,(ex+1)*(numElementsY+1)+ey,(ex+1)*(numElementsY+1)+ey+1,ex*(numElementsY+1)+ey+1};
+            const double *K= &tangents[(i-first)*64];
+            for(size_t r= 0;r<8;r++)
+              for(size_t c= 0;c<8;c++)
+                {
+                  const size_t row= 2*nodes[r/2]+r%2, col= 2*nodes[c/2]+c%2;
+                  if(col>=row)
+                    band[row*(halfBand+1)+col-row]+= K[r*8+c];
+                }
+          }
+      }
+    const auto t1= std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(t1-t0).count();
+  }
+
+//! @brief Returns the mean time (in microseconds) needed to launch
+//! an empty loop.
+double loopOverhead(const size_t &numThreads, LoopFunction loop)
+  {
+    const size_t n= 2000;
+    const auto t0= std::chrono::steady_clock::now();
+    for(size_t i= 0;i<n;i++)
+      loop(numThreads,numThreads,[](size_t,size_t,size_t) {});
+    const auto t1= std::chrono::steady_clock::now();
+    return std::chrono::duration<double,std::micro>(t1-t0).count()/n;
+  }
+
+int main(int argc, char *argv[])
+  {
+    size_t nx= 20000;
+    if(argc>1)
+      nx= std::atol(argv[1]);
+    size_t numRepetitions= 10;
+    if(argc>2)
+      numRepetitions= std::atol(argv[2]);
+    const size_t numEqn= 2*(nx+1)*(numElementsY+1);
+    const size_t halfBand= 2*(numElementsY+2);
+    std::vector<double> band(numEqn*(halfBand+1));
+    std::printf("%zu quads, %zu hardware threads.\n",nx*numElementsY,XC::getHardwareConcurrency());
+    double reference= 0.0;
+    const size_t threads[3]= {1,2,4};
+    for(size_t k= 0;k<3;k++)
+      {
+        const size_t nt= threads[k];
+        const char *names[2]= {"threads per chunk","shared pool"};
+        const LoopFunction loops[2]= {spawn_for,XC::parallel_for};
+        for(size_t m= 0;m<2;m++)
+          {
+            if((nt==1) && (m==0))
+              continue;
+            assemble(nx,nt,loops[m],band,halfBand); // warm up.
+            double elapsed= 0.0;
+            for(size_t i= 0;i<numRepetitions;i++)
+              elapsed+= assemble(nx,nt,loops[m],band,halfBand);
+            elapsed/= numRepetitions;
+            if(reference==0.0)
+              reference= elapsed;
+            std::printf("%-20s %zu threads: %8.4f s  speedup: %5.2f  (checksum: %g)\n",(nt==1 ? "serial" : names[m]),nt,elapsed,reference/elapsed,band[0]+band[band.size()/2]);
+          }
+      }
+    for(size_t k= 1;k<3;k++)
+      std::printf("overhead of an empty loop with %zu threads: %8.2f us (threads per chunk), %8.2f us (shared pool)\n",threads[k],loopOverhead(threads[k],spawn_for),loopOverhead(threads[k],XC::parallel_for));
+    return 0;
+  }
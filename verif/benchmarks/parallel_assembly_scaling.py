@@ -0,0 +1,91 @@
+# -*- coding: utf-8 -*-
+''' Benchmark: compares the time needed to analyze a strip of four
+    node plane stress quads computing the element tangents and
+    residuals with one thread (serial assembly) and with several
+    threads (IncrementalIntegrator.numThreads). The strip is narrow
+    so the band of the matrix is small and most of the time is spent
+    assembling the system.
+
+    Usage: python parallel_assembly_scaling.py [numElementsX]'''
+
+import sys
+import time
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numDivX= 20000 # Number of divisions along the strip.
+if(len(sys.argv)>1):
+  numDivX= int(sys.argv[1])
+numDivY= 4 # Number of divisions across the strip.
+numSteps= 5 # each step assembles the tangent and the residual.
+
+def solveStrip(numThreads, batchSize= 64):
+  ''' Defines the model and returns the mean time needed by each
+      analysis step.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1
+  for i in range(0,numDivX+1):
+    for j in range(0,numDivY+1):
+      nodes.newNodeXY(float(i),float(j))
+  mat= typical_materials.defElasticIsotropicPlaneStress(preprocessor,"mat",2.1e9,0.3,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "mat"
+  elements.defaultTag= 1
+  def nodeTag(i,j):
+    return i*(numDivY+1)+j+1
+  for i in range(0,numDivX):
+    for j in range(0,numDivY):
+      elements.newElement("FourNodeQuad",xc.ID([nodeTag(i,j),nodeTag(i+1,j),nodeTag(i+1,j+1),nodeTag(i,j+1)]))
+  constraints= preprocessor.getBoundaryCondHandler
+  for j in range(0,numDivY+1):
+    constraints.newSPConstraint(nodeTag(0,j),0,0.0)
+    constraints.newSPConstraint(nodeTag(0,j),1,0.0)
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("linear_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(nodeTag(numDivX,numDivY),xc.Vector([1e3,-1e3]))
+  lPatterns.addToDomain("0")
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  integ.numThreads= numThreads
+  integ.batchSize= batchSize
+  soe= analysisAggregation.newSystemOfEqn("band_spd_lin_soe")
+  solver= soe.newSolver("band_spd_lin_lapack_solver")
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  analysis.analyze(1) # builds the analysis model.
+  start= time.time()
+  analysis.analyze(numSteps)
+  return (time.time()-start)/numSteps
+
+print "mesh: ", numDivX, "x", numDivY, " quads."
+reference= None
+for nt in [1,2,4]:
+  t= solveStrip(nt)
+  if(not reference):
+    reference= t
+  label= "assembly with "+str(nt)+" threads"
+  print '%-50s %8.3f s  speedup: %5.2f' % (label, t, reference/t)
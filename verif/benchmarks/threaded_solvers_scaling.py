@@ -0,0 +1,99 @@
+# -*- coding: utf-8 -*-
+''' Benchmark: compares the time needed to solve a plane stress
+    plate (square mesh of four node quads) using the serial direct
+    solvers (profile SPD, band SPD LAPACK and SuperLU) and the
+    threaded ones with different number of threads.
+
+    Usage: python threaded_solvers_scaling.py [numDivisions]'''
+
+import sys
+import time
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numDiv= 120 # Number of divisions on each side.
+if(len(sys.argv)>1):
+  numDiv= int(sys.argv[1])
+numRepetitions= 3 # number of times the system is solved.
+
+def solvePlate(soeType, solverType, numThreads= None):
+  ''' Defines the model and returns the mean time needed to factor
+      and solve the system of equations.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1
+  for j in range(0,numDiv+1):
+    for i in range(0,numDiv+1):
+      nodes.newNodeXY(float(i),float(j))
+  mat= typical_materials.defElasticIsotropicPlaneStress(preprocessor,"mat",2.1e9,0.3,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "mat"
+  elements.defaultTag= 1
+  def nodeTag(i,j):
+    return j*(numDiv+1)+i+1
+  for j in range(0,numDiv):
+    for i in range(0,numDiv):
+      elements.newElement("FourNodeQuad",xc.ID([nodeTag(i,j),nodeTag(i+1,j),nodeTag(i+1,j+1),nodeTag(i,j+1)]))
+  constraints= preprocessor.getBoundaryCondHandler
+  for i in range(0,numDiv+1):
+    constraints.newSPConstraint(nodeTag(i,0),0,0.0)
+    constraints.newSPConstraint(nodeTag(i,0),1,0.0)
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(nodeTag(numDiv,numDiv),xc.Vector([1e3,-1e3]))
+  lPatterns.addToDomain("0")
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("rcm")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  if(numThreads):
+    solver.numThreads= numThreads
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  elapsed= 0.0
+  for i in range(0,numRepetitions):
+    start= time.time()
+    analysis.analyze(1) # each step assembles and factors the matrix.
+    elapsed+= time.time()-start
+  return elapsed/numRepetitions
+
+cases= [("profile_spd_lin_soe","profile_spd_lin_direct_solver",None),
+        ("band_spd_lin_soe","band_spd_lin_lapack_solver",None),
+        ("sparse_gen_col_lin_soe","super_lu_solver",None)]
+for nt in [1,2,4]:
+  cases.append(("profile_spd_lin_soe","profile_spd_lin_direct_thread_solver",nt))
+  cases.append(("band_spd_lin_soe","band_spd_lin_thread_solver",nt))
+
+print "mesh: ", numDiv, "x", numDiv, " quads."
+reference= None
+for soeType, solverType, nt in cases:
+  t= solvePlate(soeType,solverType,nt)
+  if(not reference):
+    reference= t
+  label= solverType
+  if(nt):
+    label+= " ("+str(nt)+" threads)"
+  print '%-50s %8.3f s  speedup: %5.2f' % (label, t, reference/t)
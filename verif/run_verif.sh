@@ -33,6 +33,9 @@ python tests/combinations/test_combination03.py
 python tests/combinations/test_combination05.py
 python tests/combinations/test_combination06.py
 python tests/combinations/test_combination07.py
+python tests/combinations/test_combination08.py
+python tests/combinations/test_combination09.py
+python tests/combinations/test_combination10.py
 python tests/combinations/test_davit_01.py
 python tests/combinations/test_davit_02.py
 
@@ -168,6 +171,17 @@ python tests/elements/kill_elements_02.py
 
 echo "$BLEU" "Solver tests." "$NORMAL"
 python tests/solution/superlu_solver_test_01.py
+python tests/solution/parallel_assembly_test_01.py
+python tests/solution/parallel_mesh_update_test_01.py
+python tests/solution/parallel_assembly_test_02.py
+python tests/solution/threaded_solvers_test_01.py
+python tests/solution/supernodal_cholesky_test_01.py
+python tests/solution/matrix_free_pcg_test_01.py
+python tests/solution/amg_solver_test_01.py
+python tests/solution/sparsity_cache_test_01.py
+python tests/solution/scatter_map_test_01.py
+python tests/solution/adaptive_newton_test_01.py
+python tests/solution/explicit_lumped_mass_test_01.py
 
 #Constraint handlers tests.
 echo "$BLEU" "  Constraint handler tests." "$NORMAL"
@@ -196,8 +210,11 @@ python tests/solution/eigenvalues/modal_analysis_test_02.py
 python tests/solution/eigenvalues/modal_analysis_test_03.py
 python tests/solution/eigenvalues/modal_analysis_test_04.py
 python tests/solution/eigenvalues/modal_analysis_test_05.py
+python tests/solution/eigenvalues/modal_analysis_test_06.py
 python tests/solution/eigenvalues/test_cqc_01.py
+python tests/solution/eigenvalues/test_cqc_02.py
 python tests/solution/eigenvalues/test_band_arpackpp_solver_01.py
+python tests/solution/eigenvalues/test_sym_lanczos_solver_01.py
 
 #Preprocessor tests
 echo "$BLEU" "Preprocessor tests." "$NORMAL"
@@ -255,10 +272,12 @@ python tests/preprocessor/sets/test_set_01.py
 python tests/preprocessor/sets/une_sets.py
 python tests/preprocessor/sets/sets_boolean_operations_01.py
 python tests/preprocessor/sets/sets_boolean_operations_02.py
+python tests/preprocessor/sets/sets_boolean_operations_03.py
 python tests/preprocessor/sets/test_resisting_svd01.py
 python tests/preprocessor/sets/test_get_contours_01.py
 python tests/preprocessor/sets/test_get_contours_02.py
 python tests/preprocessor/sets/test_pick_entities.py
+python tests/preprocessor/sets/test_pick_entities_02.py
 python tests/preprocessor/sets/test_sets_and_grids.py
 python tests/preprocessor/sets/test_get_bnd_01.py
 python tests/preprocessor/sets/test_fill_downwards_01.py
@@ -333,6 +352,7 @@ python tests/materials/uniaxial/test_steel01.py
 python tests/materials/uniaxial/test_steel02.py
 python tests/materials/uniaxial/test_steel02_prestressing.py
 python tests/materials/uniaxial/test_concrete01.py
+python tests/materials/uniaxial/uniaxial_batch_test_01.py
 python tests/materials/uniaxial/test_concrete02_01.py
 python tests/materials/uniaxial/test_concrete02_02.py
 python tests/materials/uniaxial/test_HA25_01.py
@@ -415,6 +435,7 @@ python tests/materials/fiber_section/test_fiber3d_06.py
 python tests/materials/fiber_section/test_fiber3d_07.py
 python tests/materials/fiber_section/test_fiber3d_08.py
 python tests/materials/fiber_section/test_fiber3d_09.py
+python tests/materials/fiber_section/fiber_section_batch_01.py
 python tests/materials/fiber_section/test_fiber_section_01.py
 python tests/materials/fiber_section/test_fiber_section_02.py
 python tests/materials/fiber_section/test_fiber_section_03.py
@@ -543,6 +564,9 @@ python tests/database/readln_test_01.py
 
 echo "$BLEU" "Verifiyng misc. utilities." "$NORMAL"
 python tests/utility/rcond.py
+python tests/utility/test_hdf5_output_handler_01.py
+python tests/utility/test_hdf5_output_handler_02.py
+python tests/utility/test_numpy_result_arrays_01.py
 
 echo "$BLEU" "Verifiying routines for rough calculations,..." "$NORMAL"
 python tests/rough_calculations/test_punzo01.py
@@ -0,0 +1,135 @@
+# -*- coding: utf-8 -*-
+'''Checks that the results obtained by superposition of the load pattern
+   responses (LoadCombinationGroup.computePrimaryResponses and
+   applyBySuperposition) are the same that those obtained by solving
+   each combination. Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2015, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+numElem= 4 # Number of elements.
+
+# Load
+f= 1.5e3 # Load magnitude (kN/m)
+F= 2.0e3 # Load magnitude (kN)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor  
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,numElem+1):
+  nodes.newNodeXYZ(i*L/numElem,0.0,0.0)
+
+# Geometric transformation(s)
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,-1,0]))
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(1,numElem+1):
+  beam3d= elements.newElement("ElasticBeam3d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000_000(1)
+
+# Loads definition
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+#Load modulation.
+ts= lPatterns.newTimeSeries("constant_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+lpA= lPatterns.newLoadPattern("default","A")
+lpB= lPatterns.newLoadPattern("default","B")
+lpC= lPatterns.newLoadPattern("default","C")
+eleTags= xc.ID(range(1,numElem+1))
+eleLoad= lpA.newElementalLoad("beam3d_uniform_load")
+eleLoad.elementTags= eleTags
+eleLoad.axialComponent= f
+eleLoad= lpB.newElementalLoad("beam3d_uniform_load")
+eleLoad.elementTags= eleTags
+eleLoad.transComponent= -f
+lpC.newNodalLoad(numElem+1,xc.Vector([0,F,-F,0,0,0]))
+combs= loadHandler.getLoadCombinations
+combs.newLoadCombination("ELU01","1.33*A+1.5*B")
+combs.newLoadCombination("ELU02","1.0*A+1.0*B+0.8*C")
+combs.newLoadCombination("ELU03","1.35*C")
+combs.newLoadCombination("ELU04","0.9*A-1.5*C")
+
+def getResults(computeReactions):
+  ''' Returns the tip displacements, the internal forces at the
+      fixed end and the reactions (applyBySuperposition must
+      compute them).'''
+  tip= nodes.getNode(numElem+1).getDisp
+  elem1= elements.getElement(1)
+  elem1.getResistingForce()
+  if(computeReactions):
+    preprocessor.getNodeHandler.calculateNodalReactions(False,1e-7)
+  R= nodes.getNode(1).getReaction
+  return [tip[0],tip[1],tip[2],elem1.getN1,elem1.getMz1,elem1.getVy1,elem1.getMy1,R[0],R[1],R[2]]
+
+# Solve each combination.
+direct= dict()
+for key in combs.getKeys():
+  comb= combs[key]
+  preprocessor.resetLoadCase()
+  comb.addToDomain()
+  analysis= predefined_solutions.simple_static_linear(feProblem)
+  result= analysis.analyze(1)
+  direct[key]= getResults(True)
+  comb.removeFromDomain()
+
+# Superposition.
+analysis= predefined_solutions.simple_static_linear(feProblem)
+result= combs.computePrimaryResponses(analysis)
+err= 0.0
+maxVal= 0.0
+for key in combs.getKeys():
+  result+= combs.applyBySuperposition(key)
+  values= getResults(False)
+  for d,s in zip(direct[key],values):
+    err+= (d-s)**2
+    maxVal= max(maxVal,abs(d))
+err= err**0.5/maxVal
+
+'''
+print "direct= ", direct
+print "err= ", err
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) & (err<1e-10) & combs.hasPrimaryResponses:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,106 @@
+# -*- coding: utf-8 -*-
+''' Checks the stress resultant and the tangent stiffness of fiber
+    sections with many fibers of different materials against the
+    values obtained by adding the contributions of each fiber.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+Es= 2.1e6 # Elastic modulus.
+fy= 2600 # Yield stress.
+Ec= 3e5 # Elastic modulus of the second material.
+nY= 20 # Number of fibers along y.
+nZ= 10 # Number of fibers along z.
+width= 0.3 # Section width.
+depth= 0.5 # Section depth.
+fiberArea= width*depth/nY/nZ
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+steel= typical_materials.defSteel01(preprocessor,"steel",Es,fy,0.001)
+elast= typical_materials.defElasticMaterial(preprocessor,"elast",Ec)
+
+materials= preprocessor.getMaterialHandler
+section2d= materials.newMaterial("fiber_section_2d","section2d")
+section3d= materials.newMaterial("fiber_section_3d","section3d")
+for i in range(0,nY):
+  y= -depth/2.0+(i+0.5)*depth/nY
+  for j in range(0,nZ):
+    z= -width/2.0+(j+0.5)*width/nZ
+    matName= "steel" if ((i+j)%2==0) else "elast" # interleaved materials.
+    section3d.addFiber(matName,fiberArea,xc.Vector([y,z]))
+  section2d.addFiber("steel" if (i%2==0) else "elast",fiberArea*nZ,xc.Vector([y]))
+
+def sumFibers(section, dim):
+  ''' Return the stress resultant and the stiffness obtained from
+      the fiber stresses and tangents.'''
+  R= [0.0]*dim
+  K= [[0.0]*dim for i in range(0,dim)]
+  for f in section.getFibers():
+    mat= f.getMaterial()
+    A= f.getArea()
+    pos= [1.0,f.getLocY(),f.getLocZ()][0:dim]
+    for i in range(0,dim):
+      R[i]+= mat.getStress()*A*pos[i]
+      for j in range(0,dim):
+        K[i][j]+= mat.getTangent()*A*pos[i]*pos[j]
+  return R,K
+
+def relErr(section, dim):
+  ''' Return the relative difference between the section values and
+      the values obtained by adding the fiber contributions.'''
+  R,K= sumFibers(section,dim)
+  sR= section.getStressResultant()
+  sK= section.getTangentStiffness()
+  errR= 0.0; normR= 0.0
+  errK= 0.0; normK= 0.0
+  for i in range(0,dim):
+    errR+= (sR[i]-R[i])**2; normR+= R[i]**2
+    for j in range(0,dim):
+      errK+= (sK.at(i+1,j+1)-K[i][j])**2; normK+= K[i][j]**2
+  return (errR/normR)**0.5,(errK/normK)**0.5
+
+eps0= 0.4*fy/Es
+curvZ= 4.0*fy/Es/depth # Yields the outer fibers.
+curvY= 2.0*fy/Es/width
+err= 0.0
+for k in range(1,4): # several trial deformations.
+  section2d.setTrialSectionDeformation(xc.Vector([k*eps0,k*curvZ]))
+  section3d.setTrialSectionDeformation(xc.Vector([k*eps0,k*curvZ,-k*curvY]))
+  for e in relErr(section2d,2)+relErr(section3d,3):
+    err= max(err,e)
+
+# Bending stiffness of the 2D section in the elastic range.
+# Nothing has been committed so the materials start from the initial state.
+section2d.setTrialSectionDeformation(xc.Vector([0.0,0.0]))
+EI= section2d.getTangentStiffness().at(2,2)
+EIRef= 0.0
+for f in section2d.getFibers():
+  EIRef+= f.getMaterial().getInitialTangent()*f.getArea()*f.getLocY()**2
+ratio= abs(EI-EIRef)/EIRef
+
+'''
+print "err= ", err
+print "EI= ", EI, " EIRef= ", EIRef, " ratio= ", ratio
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-12) & (ratio<1e-12):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
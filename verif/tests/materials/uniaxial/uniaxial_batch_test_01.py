@@ -0,0 +1,80 @@
+# -*- coding: utf-8 -*-
+''' Checks that the trial state computed for the materials of a fiber
+    section (which are updated in groups of the same type) is the same
+    that the one obtained updating each material by itself.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+fy= 2600 # Yield stress of the steel.
+Es= 2.1e6 # Young modulus of the steel.
+Ee= 3e5 # Young modulus of the elastic material.
+epsy= fy/Es # Yield strain.
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+def defMaterial(kind, name):
+  if(kind==0):
+    return typical_materials.defSteel01(preprocessor,name,Es,fy,0.01)
+  elif(kind==1):
+    return typical_materials.defConcrete01(preprocessor,name,-2e-3,-300,-250,-3.5e-3)
+  else:
+    return typical_materials.defElasticMaterial(preprocessor,name,Ee)
+
+kindNames= ["steel","concrete","elast"]
+for k in range(0,3):
+  defMaterial(k,kindNames[k])
+
+# Section with interleaved fibers of the three materials and, for each
+# fiber, a material of the same type that will be updated alone.
+section= preprocessor.getMaterialHandler.newMaterial("fiber_section_3d","section")
+references= list()
+nY= 8; nZ= 5
+for i in range(0,nY):
+  y= -0.25+(i+0.5)*0.5/nY
+  for j in range(0,nZ):
+    z= -0.15+(j+0.5)*0.3/nZ
+    kind= (i*nZ+j)%3
+    section.addFiber(kindNames[kind],0.01,xc.Vector([y,z]))
+    references.append(defMaterial(kind,"ref%d_%d" % (i,j)))
+
+# Cyclic loading (with commits) that yields and unloads the fibers.
+loads= [(0.5,1.0,0.0),(1.0,2.0,0.5),(0.2,3.0,1.0),(-0.5,1.0,0.5),(-1.0,-2.0,-1.0),(-0.5,-3.0,0.5),(0.0,0.0,0.0)]
+err= 0.0
+for (e0,kz,ky) in loads:
+  for trial in [0.5,1.0]: # two trials per step.
+    d= [trial*e0*epsy,trial*kz*epsy/0.25,trial*ky*epsy/0.15]
+    section.setTrialSectionDeformation(xc.Vector(d))
+    for f,ref in zip(section.getFibers(),references):
+      ref.setTrialStrain(d[0]+f.getLocY()*d[1]+f.getLocZ()*d[2],0.0)
+      mat= f.getMaterial()
+      err= max(err,abs(mat.getStress()-ref.getStress()))
+      err= max(err,abs(mat.getTangent()-ref.getTangent()))
+  section.commitState()
+  for ref in references:
+    ref.commitState()
+
+'''
+print "err= ", err
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (err==0.0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
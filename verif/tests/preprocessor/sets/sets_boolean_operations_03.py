@@ -0,0 +1,62 @@
+# -*- coding: utf-8 -*-
+''' Boolean operations with large node sets (checks that the membership
+    queries don't make the set operations quadratic).'''
+
+import xc_base
+import geom
+import xc
+import time
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numDiv= 150 # Number of divisions in each direction.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+nodes.defaultTag= 1
+nodeList= list()
+for i in range(0,numDiv+1):
+  for j in range(0,numDiv+1):
+    nodeList.append(nodes.newNodeXYZ(i,j,0))
+numNodes= len(nodeList)
+
+s1= preprocessor.getSets.defSet("S1")
+s2= preprocessor.getSets.defSet("S2")
+
+start_time= time.time()
+for n in nodeList:
+  s1.getNodes.append(n)
+  s1.getNodes.append(n) # Already in the set, must be ignored.
+  if(n.tag%2==0):
+    s2.getNodes.append(n)
+
+s3= s1+s2 # union.
+s4= s1*s2 # intersection.
+s5= s1-s2 # difference.
+s2-= s1
+lapse= time.time()-start_time
+
+sz1= s1.getNodes.size
+sz3= s3.getNodes.size
+sz4= s4.getNodes.size
+sz5= s5.getNodes.size
+sz2= s2.getNodes.size
+
+''' 
+print "number of nodes: ", numNodes
+print "sz1= ", sz1, " sz3= ", sz3, " sz4= ", sz4, " sz5= ", sz5, " sz2= ", sz2
+print "lapse: ", lapse
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (sz1==numNodes) and (sz3==numNodes) and (sz4==numNodes/2) and (sz5==numNodes-numNodes/2) and (sz2==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
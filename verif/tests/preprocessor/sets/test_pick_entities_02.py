@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+''' Selection of the nodes and elements inside a geometric object in a
+    mesh with many nodes (the result must be the same than the one obtained
+    checking all the nodes and elements, also after moving some nodes
+    through another set) and search of the nodes nearest to a list
+    of positions.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from miscUtils import LogMessages as lmsg
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numDiv= 40 # Number of divisions in each direction.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1
+for i in range(0,numDiv+1):
+  for j in range(0,numDiv+1):
+    nodes.newNodeXY(i,j) # Tag: i*(numDiv+1)+j+1
+
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",2.1e6)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast"
+elements.dimElem= 2 # Dimension of element space
+elements.defaultTag= 1
+for i in range(0,numDiv):
+  for j in range(0,numDiv+1):
+    n1= i*(numDiv+1)+j+1
+    truss= elements.newElement("Truss",xc.ID([n1,n1+numDiv+1]))
+    truss.area= 1.0
+
+xcTotalSet= preprocessor.getSets.getSet('total')
+geomObj= geom.BND3d(geom.Pos3d(9.5,4.0,-1.0),geom.Pos3d(20.0,17.5,1.0))
+tol= 0.6
+
+pickedNodes= xcTotalSet.nodes.pickNodesInside(geomObj,tol)
+pickedElements= xcTotalSet.elements.pickElemsInside(geomObj,tol)
+
+# Brute force.
+refNodes= list()
+for n in xcTotalSet.nodes:
+  if(n.In(geomObj,0.0,tol)):
+    refNodes.append(n.tag)
+refElements= list()
+for e in xcTotalSet.elements:
+  if(e.In(geomObj,0.0,tol)):
+    refElements.append(e.tag)
+
+nodeTags= [n.tag for n in pickedNodes]
+elementTags= [e.tag for e in pickedElements]
+
+# Nearest nodes.
+positions= [geom.Pos3d(0.1,0.2,0.0),geom.Pos3d(10.4,30.6,0.0),geom.Pos3d(39.8,40.3,0.0)]
+nearestTags= xcTotalSet.nodes.getNearestNodeTags(positions)
+refNearestTags= [1,10*(numDiv+1)+31+1,numDiv*(numDiv+1)+numDiv+1]
+
+# Move the first column of nodes (x= 0) to x= 12 through another set,
+# the KD trees of the total set must not be stale.
+movedSet= preprocessor.getSets.defSet("moved")
+for j in range(0,numDiv+1):
+  movedSet.getNodes.append(nodes.getNode(j+1))
+trfs= preprocessor.getMultiBlockTopology.getGeometricTransformations
+transl= trfs.newTransformation("translation")
+transl.setVector(geom.Vector3d(12.0,0.0,0.0))
+movedSet.transforms(transl)
+
+movedNodeTags= [n.tag for n in xcTotalSet.nodes.pickNodesInside(geomObj,tol)]
+movedElementTags= [e.tag for e in xcTotalSet.elements.pickElemsInside(geomObj,tol)]
+refMovedNodes= list()
+for n in xcTotalSet.nodes:
+  if(n.In(geomObj,0.0,tol)):
+    refMovedNodes.append(n.tag)
+refMovedElements= list()
+for e in xcTotalSet.elements:
+  if(e.In(geomObj,0.0,tol)):
+    refMovedElements.append(e.tag)
+
+''' 
+print len(nodeTags), ' nodes inside.'
+print len(elementTags), ' element(s) inside.'
+print nearestTags, refNearestTags
+print len(movedNodeTags), ' nodes inside after moving.'
+'''
+
+import os
+fname= os.path.basename(__file__)
+if (nodeTags==refNodes) and (elementTags==refElements) and (len(nodeTags)==12*15) and (len(elementTags)==11*15) and (nearestTags==refNearestTags) and (movedNodeTags==refMovedNodes) and (movedElementTags==refMovedElements) and (len(movedNodeTags)==13*15):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
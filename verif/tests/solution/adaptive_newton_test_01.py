@@ -0,0 +1,106 @@
+# -*- coding: utf-8 -*-
+''' Checks that the adaptive Newton algorithm (reusing the factorized
+    tangent while the convergence rate is good) gives the same results
+    that the Newton-Raphson algorithm with less factorizations
+    (prestressed cable under vertical loads).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDiv= 20
+E= 30e6 # Young modulus (psi)
+lng= 10.0 # Cable length in inches
+sigmaPret= 1500 # Prestressing stress (psi)
+area= 2.0
+F= 100.0/NumDiv # Vertical load on each node (pounds)
+Nstep= 10 # Number of load steps.
+
+def solveCable(algorithmType):
+  ''' Defines and solves the model, returns the vertical displacement
+      of the mid node and the solution algorithm.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for i in range(0,NumDiv+1):
+    nodes.newNodeXY(i*lng/NumDiv,0.0)
+  typical_materials.defCableMaterial(preprocessor, "cable",E,sigmaPret,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "cable"
+  elements.dimElem= 2 # Dimension of element space
+  elements.defaultTag= 1 #Tag for the next element.
+  for i in range(1,NumDiv+1):
+    truss= elements.newElement("CorotTruss",xc.ID([i,i+1]))
+    truss.area= area
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  for tag in [1,NumDiv+1]:
+    constraints.newSPConstraint(tag,0,0.0)
+    constraints.newSPConstraint(tag,1,0.0)
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  for tag in range(2,NumDiv+1):
+    lp0.newNodalLoad(tag,xc.Vector([0,-F]))
+  lPatterns.addToDomain("0")
+  # Solution
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm(algorithmType)
+  if(algorithmType=="adaptive_newton_soln_algo"):
+    solAlgo.useCostModel= False # Repeatable decisions.
+    solAlgo.reuseAcrossSteps= True
+  ctest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+  ctest.tol= 1e-9
+  ctest.maxNumIter= 100
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  integ.dLambda1= 1.0/Nstep
+  soe= analysisAggregation.newSystemOfEqn("band_gen_lin_soe")
+  solver= soe.newSolver("band_gen_lin_lapack_solver")
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(Nstep)
+  deltaY= nodes.getNode(NumDiv/2+1).getDisp[1]
+  return result, deltaY, solAlgo
+
+resultNR, deltaNR, algoNR= solveCable("newton_raphson_soln_algo")
+resultAN, deltaAN, algoAN= solveCable("adaptive_newton_soln_algo")
+
+ratio1= abs(deltaAN-deltaNR)/abs(deltaNR)
+
+'''
+print "deltaNR= ", deltaNR
+print "deltaAN= ", deltaAN
+print "ratio1= ", ratio1
+print "steps= ", algoAN.numSteps
+print "iterations= ", algoAN.numIterations
+print "factorizations= ", algoAN.numFactorizations
+print "saved= ", algoAN.numFactorizationsSaved
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (resultNR==0) & (resultAN==0) & (ratio1<1e-6) & (algoAN.numSteps==Nstep) & (algoAN.numFactorizations<algoAN.numIterations) & (algoAN.numFactorizationsSaved==algoAN.numIterations-algoAN.numFactorizations):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
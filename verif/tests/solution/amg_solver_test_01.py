@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+''' Checks that the algebraic multigrid solvers give the same results
+    that the band SPD LAPACK solver (plane stress plate clamped
+    at its bottom edge).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numDiv= 20 # Number of divisions on each side.
+
+def solvePlate(soeType, solverType, krylov= None, numThreads= None):
+  ''' Defines and solves the model, returns the nodal displacements.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1
+  for j in range(0,numDiv+1):
+    for i in range(0,numDiv+1):
+      nodes.newNodeXY(float(i),float(j))
+  mat= typical_materials.defElasticIsotropicPlaneStress(preprocessor,"mat",2.1e9,0.3,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "mat"
+  elements.defaultTag= 1
+  def nodeTag(i,j):
+    return j*(numDiv+1)+i+1
+  for j in range(0,numDiv):
+    for i in range(0,numDiv):
+      elements.newElement("FourNodeQuad",xc.ID([nodeTag(i,j),nodeTag(i+1,j),nodeTag(i+1,j+1),nodeTag(i,j+1)]))
+  constraints= preprocessor.getBoundaryCondHandler
+  for i in range(0,numDiv+1):
+    constraints.newSPConstraint(nodeTag(i,0),0,0.0)
+    constraints.newSPConstraint(nodeTag(i,0),1,0.0)
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("linear_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(nodeTag(numDiv,numDiv),xc.Vector([1e3,-1e3]))
+  lp0.newNodalLoad(nodeTag(0,numDiv),xc.Vector([1e3,0.0]))
+  lPatterns.addToDomain("0")
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+  ctest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+  ctest.tol= 1e-6
+  ctest.maxNumIter= 10
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  integ.dLambda1= 0.5
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  info= None
+  if(krylov):
+    solver.krylov= krylov
+    solver.tolerance= 1e-12
+    solver.coarseSize= 40 # force some coarse levels.
+  if(numThreads):
+    solver.numThreads= numThreads
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(2) # two steps: hierarchy reused.
+  if(krylov):
+    info= (solver.numLevels, solver.numSetups, solver.numUpdates)
+  retval= list()
+  for tag in range(1,(numDiv+1)**2+1):
+    disp= nodes.getNode(tag).getDisp
+    retval.append((disp[0],disp[1]))
+  return result, retval, info
+
+def sqrDiff(a,b):
+  retval= 0.0
+  for s,p in zip(a,b):
+    retval+= (s[0]-p[0])**2+(s[1]-p[1])**2
+  return retval
+
+r0, ref, info0= solvePlate("band_spd_lin_soe","band_spd_lin_lapack_solver")
+r1, cg, info1= solvePlate("sparse_gen_col_lin_soe","sparse_gen_col_amg_solver","cg",2)
+r2, gmres, info2= solvePlate("sparse_gen_col_lin_soe","sparse_gen_col_amg_solver","gmres",1)
+r3, row, info3= solvePlate("sparse_gen_row_lin_soe","sparse_gen_row_amg_solver","gmres",2)
+
+refNorm= sqrDiff(ref,[(0.0,0.0)]*len(ref))
+errCg= sqrDiff(ref,cg)/refNorm
+errGmres= sqrDiff(ref,gmres)/refNorm
+errRow= sqrDiff(ref,row)/refNorm
+# more than one level and the hierarchy reused
+# in the following solutions.
+hierarchyOk= True
+for info in [info1,info2,info3]:
+  hierarchyOk= hierarchyOk and (info[0]>1) and (info[1]>=1) and (info[2]>0)
+
+'''
+print "ref= ", ref[-1]
+print "cg= ", cg[-1]
+print "info1= ", info1
+print "errCg= ", errCg
+print "errGmres= ", errGmres
+print "errRow= ", errRow
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (r0==0) & (r1==0) & (r2==0) & (r3==0) & (refNorm>0.0) & (errCg<1e-16) & (errGmres<1e-16) & (errRow<1e-16) & hierarchyOk:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
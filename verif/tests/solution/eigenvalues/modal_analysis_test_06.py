@@ -0,0 +1,112 @@
+# -*- coding: utf-8 -*-
+''' Modal participation factors, distribution factors and effective
+    modal masses of a shear building with more modes than the block
+    size used to compute them. The sum of the effective modal masses
+    of all the modes must be equal to the total mass. '''
+import xc_base
+import geom
+import xc
+
+from model import predefined_spaces
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numStoreys= 20
+storeyMass= 134.4e3
+nodeMassMatrix= xc.Matrix([[storeyMass,0,0],
+                            [0,storeyMass,0],
+                            [0,0,0]])
+Ehorm= 200000*1e5 # Concrete elastic modulus.
+B= 0.40 # Columns size.
+I= 1/12.0*B**4 # Cross section moment of inertia.
+H= 3 # Storey height.
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 0
+nod= nodes.newNodeXY(0,0)
+nod.fix(xc.ID([0,1,2]),xc.Vector([0,0,0]))
+for i in range(1,numStoreys+1):
+  nod= nodes.newNodeXY(0,i*H)
+  nod.mass= nodeMassMatrix
+  nod.fix(xc.ID([1,2]),xc.Vector([0,0]))
+
+# Materials definition
+scc= typical_materials.defElasticSection2d(preprocessor, "scc",20*B*B,Ehorm,20*I) 
+
+# Geometric transformation(s)
+lin= modelSpace.newLinearCrdTransf("lin")
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+elements.defaultTag= 1 #Tag for next element.
+for i in range(0,numStoreys):
+  beam2d= elements.newElement("ElasticBeam2d",xc.ID([i,i+1]))
+  beam2d.h= B
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("frequency_soln_algo")
+integ= analysisAggregation.newIntegrator("eigen_integrator",xc.Vector([1.0,1,1.0,1.0]))
+soe= analysisAggregation.newSystemOfEqn("full_gen_eigen_soe")
+solver= soe.newSolver("full_gen_eigen_solver")
+analysis= solu.newAnalysis("modal_analysis","analysisAggregation","")
+analOk= analysis.analyze(numStoreys)
+
+modos= analysis.getNormalizedEigenvectors()
+modalParticipationFactors= analysis.getModalParticipationFactors()
+effectiveModalMasses= analysis.getEffectiveModalMasses()
+totalMass= analysis.getTotalMass()
+distributionFactors= analysis.getDistributionFactors()
+
+# Reference values (the mass matrix is storeyMass*I).
+ratio1= abs(totalMass-numStoreys*storeyMass)/(numStoreys*storeyMass)
+sumEffectiveMasses= 0.0
+for i in range(0,numStoreys):
+  sumEffectiveMasses+= effectiveModalMasses[i]
+ratio2= abs(sumEffectiveMasses-totalMass)/totalMass
+ratio3= 0.0
+for j in range(0,numStoreys):
+  s1= 0.0; s2= 0.0
+  for i in range(0,numStoreys):
+    s1+= modos(i,j)
+    s2+= modos(i,j)**2
+  tau= s1/s2 # participation factor of the normalized mode.
+  for i in range(0,numStoreys):
+    ratio3= max(ratio3,abs(distributionFactors(i,j)-tau*modos(i,j)))
+
+'''
+print "totalMass: ",totalMass
+print "sumEffectiveMasses: ",sumEffectiveMasses
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "ratio3= ",ratio3
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((analOk==0) & (ratio1<1e-12) & (ratio2<1e-6) & (ratio3<1e-6)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
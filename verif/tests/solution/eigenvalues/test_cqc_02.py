@@ -0,0 +1,221 @@
+# -*- coding: utf-8 -*-
+''' Response spectrum SRSS and CQC combination computed in bulk (ModalAnalysis
+    getSRSSDisplacements, getCQCDisplacements and getCQCElementForces)
+    compared with the combination made node by node in Python. Model taken
+    from modal_analysis_test_02.py.'''
+from __future__ import division
+import xc_base
+import geom
+import xc
+
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+storeyMass= 134.4e3
+nodeMassMatrix= xc.Matrix([[storeyMass,0,0],[0,0,0],[0,0,0]])
+Ehorm= 200000*1e5 # Concrete elastic modulus.
+
+Bbaja= 0.45 # Columns size.
+Ibaja= 1/12.0*Bbaja**4 # Cross section moment of inertia.
+Hbaja= 4 # Altura de la planta baja.
+B1a= 0.40 # Columns size.
+I1a= 1/12.0*B1a**4 # Cross section moment of inertia.
+H= 3 # Altura del resto de plantas.
+B3a= 0.35 # Columns size.
+I3a= 1/12.0*B3a**4 # Cross section moment of inertia.
+
+kPlBaja= 20*12*Ehorm*Ibaja/(Hbaja**3)
+kPl1a= 20*12*Ehorm*I1a/(H**3)
+kPl2a= kPl1a
+kPl3a= 20*12*Ehorm*I3a/(H**3)
+kPl4a= kPl3a
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 0;
+nod0= nodes.newNodeXY(0,0)
+nod0.mass= nodeMassMatrix
+nod0.setProp("gdlsCoartados",xc.ID([0,1,2]))
+nod1= nodes.newNodeXY(0,4) 
+nod1.mass= nodeMassMatrix
+nod1.setProp("gdlsCoartados",xc.ID([1,2]))
+nod2= nodes.newNodeXY(0,4+3) 
+nod2.mass= nodeMassMatrix
+nod2.setProp("gdlsCoartados",xc.ID([1,2]))
+nod3= nodes.newNodeXY(0,4+3+3) 
+nod3.mass= nodeMassMatrix
+nod3.setProp("gdlsCoartados",xc.ID([1,2]))
+nod4= nodes.newNodeXY(0,4+3+3+3) 
+nod4.mass= nodeMassMatrix
+nod4.setProp("gdlsCoartados",xc.ID([1,2]))
+nod5= nodes.newNodeXY(0,4+3+3+3+3) 
+nod5.mass= nodeMassMatrix
+nod5.setProp("gdlsCoartados",xc.ID([1,2]))
+setTotal= preprocessor.getSets.getSet("total")
+nodes= setTotal.getNodes
+for n in nodes:
+  n.fix(n.getProp("gdlsCoartados"),xc.Vector([0,0,0]))
+
+# Materials definition
+sccPlBaja= typical_materials.defElasticSection2d(preprocessor, "sccPlBaja",20*Bbaja*Bbaja,Ehorm,20*Ibaja)
+sccPl1a= typical_materials.defElasticSection2d(preprocessor, "sccPl1a",20*B1a*B1a,Ehorm,20*I1a) 
+sccPl2a= typical_materials.defElasticSection2d(preprocessor, "sccPl2a",20*B1a*B1a,Ehorm,20*I1a) 
+sccPl3a= typical_materials.defElasticSection2d(preprocessor, "sccPl3a",20*B3a*B3a,Ehorm,20*I3a) 
+sccPl4a= typical_materials.defElasticSection2d(preprocessor, "sccPl4a",20*B3a*B3a,Ehorm,20*I3a)
+
+# Geometric transformation(s)
+lin= modelSpace.newLinearCrdTransf("lin")
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "sccPlBaja"
+elements.defaultTag= 1 #Tag for next element.
+beam2d= elements.newElement("ElasticBeam2d",xc.ID([0,1]))
+beam2d.h= Bbaja
+elements.defaultMaterial= "sccPl1a" 
+beam2d= elements.newElement("ElasticBeam2d",xc.ID([1,2]))
+beam2d.h= B1a
+elements.defaultMaterial= "sccPl2a" 
+beam2d= elements.newElement("ElasticBeam2d",xc.ID([2,3]))
+beam2d.h= B1a
+elements.defaultMaterial= "sccPl3a" 
+beam2d= elements.newElement("ElasticBeam2d",xc.ID([3,4]))
+beam2d.h= B3a
+elements.defaultMaterial= "sccPl4a" 
+beam2d= elements.newElement("ElasticBeam2d",xc.ID([4,5]))
+beam2d.h= B3a
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("frequency_soln_algo")
+integ= analysisAggregation.newIntegrator("eigen_integrator",xc.Vector([1.0,1,1.0,1.0]))
+
+soe= analysisAggregation.newSystemOfEqn("sym_band_eigen_soe")
+solver= soe.newSolver("sym_band_eigen_solver")
+
+analysis= solu.newAnalysis("modal_analysis","analysisAggregation","")
+ac= 0.69 # Design acceleration.
+T0= 0.24
+T1= 0.68
+meseta= 2.28
+
+spectrum= geom.FunctionGraph1D()
+
+spectrum.append(0.0,1.0)
+spectrum.append(T0,meseta)
+t=T1
+while(t<2.0):
+  spectrum.append(t,meseta*T1/t)
+  t+=1
+
+spectrum*=(ac)
+analysis.spectrum= spectrum
+
+analOk= analysis.analyze(5)
+periods= analysis.getPeriods()
+angularFrequencies= analysis.getAngularFrequencies()
+modalParticipationFactors= analysis.getModalParticipationFactors()
+nModes= periods.size()
+accelerations= []
+for i in range(0,nModes):
+  accelerations.append(analysis.spectrum(periods[i]))
+zetas= xc.Vector([0.05]*nModes)
+rho= analysis.getCQCModalCrossCorrelationCoefficients(zetas)
+
+# Combination node by node.
+def getModalDisp(n,i):
+  factor= modalParticipationFactors[i]*accelerations[i]/angularFrequencies[i]**2
+  return factor*n.getEigenvector(i+1)[0]
+
+srssRef= dict()
+cqcRef= dict()
+for n in setTotal.getNodes:
+  modalDisp= [getModalDisp(n,i) for i in range(0,nModes)]
+  srss= 0.0
+  cqc= 0.0
+  for i in range(0,nModes):
+    srss+= modalDisp[i]**2
+    for j in range(0,nModes):
+      cqc+= rho(i,j)*modalDisp[i]*modalDisp[j]
+  srssRef[n.tag]= math.sqrt(srss)
+  cqcRef[n.tag]= math.sqrt(cqc)
+
+# Modal base shears (sum of the equivalent static loads).
+baseShears= [0.0]*nModes
+for n in setTotal.getNodes:
+  for i in range(0,nModes):
+    baseShears[i]+= n.getEquivalentStaticLoad(i+1,accelerations[i])[0]
+baseShearCQC= 0.0
+for i in range(0,nModes):
+  for j in range(0,nModes):
+    baseShearCQC+= rho(i,j)*baseShears[i]*baseShears[j]
+baseShearCQC= math.sqrt(baseShearCQC)
+
+# Bulk combination.
+analysis.cqcTolerance= 0.0
+nodeTags= analysis.getResponseNodeTags()
+srssDisp= analysis.getSRSSDisplacements([])
+cqcDisp= analysis.getCQCDisplacements(zetas,[])
+err= 0.0
+maxDisp= 0.0
+for i in range(0,len(nodeTags)):
+  tag= nodeTags[i]
+  err+= (srssDisp(i,0)-srssRef[tag])**2+(cqcDisp(i,0)-cqcRef[tag])**2
+  maxDisp= max(maxDisp,cqcRef[tag])
+ratio1= math.sqrt(err)/maxDisp
+
+elementTags= analysis.getResponseElementTags()
+cqcForces= analysis.getCQCElementForces(zetas,[])
+row= list(elementTags).index(1) # Element at the base.
+ratio2= abs(abs(cqcForces(row,0))-baseShearCQC)/baseShearCQC
+# The committed state of the mesh must not change.
+ratio3= (analysis.getCQCElementForces(zetas,[])-cqcForces).Norm()+nod5.getDisp.Norm()
+
+# Skipping the negligible cross terms.
+analysis.cqcTolerance= 1e-3
+cqcDispTol= analysis.getCQCDisplacements(zetas,[])
+ratio4= (cqcDispTol-cqcDisp).Norm()/cqcDisp.Norm()
+
+'''
+print "srssDisp= ", srssDisp
+print "cqcDisp= ", cqcDisp
+print "ratio1= ", ratio1
+print "baseShearCQC= ", baseShearCQC
+print "cqcForces= ", cqcForces
+print "ratio2= ", ratio2
+print "ratio3= ", ratio3
+print "ratio4= ", ratio4
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((ratio1<1e-10) & (ratio2<1e-8) & (ratio3<1e-10) & (ratio4<1e-2)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,134 @@
+# -*- coding: utf-8 -*-
+''' Shift-invert Lanczos solver: compares the modes of a cantilever
+    with those obtained with the band solver and checks that the
+    factorization is reused when only the shift changes.'''
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 1 # Cantilever length in meters
+b= 0.05 # Cross section width in meters
+h= 0.10 # Cross section depth in meters
+A= b*h # Cross section area en m2
+I= 1/12.0*b*h**3 # Moment of inertia in m4
+E=2.0E11 # Elastic modulus en N/m2
+dens= 7800 # Steel density kg/m3
+m= A*dens
+
+NumDiv= 20
+
+def defineModel():
+  ''' Cantilever beam.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+  scc= typical_materials.defElasticSection2d(preprocessor, "scc",A,E,I)
+  nodes.newSeedNode()
+  lin= modelSpace.newLinearCrdTransf("lin")
+  seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+  seedElemHandler.defaultTransformation= "lin"
+  seedElemHandler.defaultMaterial= "scc"
+  seedElemHandler.defaultTag= 1 #Tag for next element.
+  beam2d= seedElemHandler.newElement("ElasticBeam2d",xc.ID([0,0]))
+  beam2d.h= h
+  beam2d.rho= m
+  points= preprocessor.getMultiBlockTopology.getPoints
+  pt= points.newPntIDPos3d(1,geom.Pos3d(0.0,0.0,0.0))
+  pt= points.newPntIDPos3d(2,geom.Pos3d(L,0.0,0.0))
+  lines= preprocessor.getMultiBlockTopology.getLines
+  lines.defaultTag= 1
+  l= lines.newLine(1,2)
+  l.nDiv= NumDiv
+  constraints= preprocessor.getBoundaryCondHandler
+  spc= constraints.newSPConstraint(1,0,0.0)
+  spc= constraints.newSPConstraint(1,1,0.0)
+  spc= constraints.newSPConstraint(1,2,0.0)
+  setTotal= preprocessor.getSets.getSet("total")
+  setTotal.genMesh(xc.meshDir.I)
+  return feProblem
+
+def defineAnalysis(feProblem, soeType, solverType):
+  ''' Eigen analysis with the system of equations and solver
+      being passed as parameters.'''
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("rcm")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("frequency_soln_algo")
+  integ= analysisAggregation.newIntegrator("eigen_integrator",xc.Vector([1.0,1,1.0,1.0]))
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  analysis= solu.newAnalysis("eigen_analysis","analysisAggregation","")
+  return analysis, solAlgo, soe, solver
+
+# Reference values.
+feProblemRef= defineModel()
+analysisRef, solAlgoRef, soeRef, solverRef= defineAnalysis(feProblemRef,"sym_band_eigen_soe","sym_band_eigen_solver")
+analOk= analysisRef.analyze(6)
+eigRef= [analysisRef.getEigenvalue(i) for i in range(1,7)]
+
+# Shift-invert Lanczos.
+feProblem= defineModel()
+analysis, solAlgo, soe, solver= defineAnalysis(feProblem,"sym_arpack_soe","sym_lanczos_solver")
+solAlgo.reuseMatrices= True
+analOk= analysis.analyze(4)
+eig= [analysis.getEigenvalue(i) for i in range(1,5)]
+err= 0.0
+for e,r in zip(eig,eigRef):
+  err= max(err,abs(e-r)/r)
+numFact0= solver.numFactorizations
+
+# Modes around a shift (matrices not formed again).
+sigma= 0.5*(eigRef[2]+eigRef[3])
+soe.shift= sigma
+analOk+= analysis.analyze(2)
+errShift= max(abs(analysis.getEigenvalue(1)-eigRef[2])/eigRef[2],abs(analysis.getEigenvalue(2)-eigRef[3])/eigRef[3])
+numFact1= solver.numFactorizations
+numNegativePivots= solver.numNegativePivots # eigenvalues smaller than sigma.
+
+# Same shift: the factorization is reused.
+analOk+= analysis.analyze(2)
+numFact2= solver.numFactorizations
+
+# Two shifts.
+soe.shift= 0.0
+solver.shifts= xc.Vector([0.0,sigma])
+analOk+= analysis.analyze(4)
+errShifts= 0.0
+for i in range(0,4):
+  errShifts= max(errShifts,abs(analysis.getEigenvalue(i+1)-eigRef[i])/eigRef[i])
+
+'''
+print "eigRef= ", eigRef
+print "eig= ", eig
+print "err= ", err
+print "errShift= ", errShift
+print "errShifts= ", errShifts
+print "numFact= ", numFact0, numFact1, numFact2
+print "numNegativePivots= ", numNegativePivots
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (analOk==0) & (err<1e-6) & (errShift<1e-6) & (errShifts<1e-6) & (numFact0==1) & (numFact1==2) & (numFact2==2) & (numNegativePivots==3):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,128 @@
+# -*- coding: utf-8 -*-
+''' Checks the central difference integrator with lumped mass that
+    doesn't use the system of equations: the results must be the same
+    that those obtained with the CentralDifferenceNoDamping integrator,
+    they must not depend on the number of threads and the estimated
+    stable time step must be the one of the spring-mass chain
+    (sqrt(m/k)). Damped models must be rejected (the integrator
+    ignores the damping forces).'''
+
+import math
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+A= 1.0 # Bar area.
+numDiv= 20 # Number of elements.
+lng= 100.0 # Bar length.
+l= lng/numDiv # Element length.
+m= 0.1 # Mass of each node.
+F= 1000 # Force magnitude (pounds)
+k= E*A/l # Stiffness of each element.
+numSteps= 200
+
+def solveBar(integratorType, numThreads, dampingFactors= None):
+  ''' Defines and solves the model, returns the displacements of
+      the free end, the integrator and the analysis result.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  nodeMass= xc.Matrix([[m,0],[0,m]])
+  for i in range(0,numDiv+1):
+    n= nodes.newNodeXY(i*l,0.0)
+    n.mass= nodeMass
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2 # Dimension of element space
+  elements.defaultTag= 1 #Tag for the next element.
+  for i in range(1,numDiv+1):
+    truss= elements.newElement("Truss",xc.ID([i,i+1]))
+    truss.area= A
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  constraints.newSPConstraint(1,0,0.0)
+  for i in range(1,numDiv+2):
+    constraints.newSPConstraint(i,1,0.0)
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(numDiv+1,xc.Vector([F,0]))
+  lPatterns.addToDomain("0")
+  if(dampingFactors):
+    feProblem.getDomain.setRayleighDampingFactors(dampingFactors)
+  # Solution
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+  integ= analysisAggregation.newIntegrator(integratorType,xc.Vector([]))
+  integ.numThreads= numThreads
+  integ.batchSize= 4
+  soe= analysisAggregation.newSystemOfEqn("diagonal_soe")
+  solver= soe.newSolver("diagonal_direct_solver")
+  analysis= solu.newAnalysis("direct_integration_analysis","analysisAggregation","")
+  dT= 0.5*math.sqrt(m/k)
+  result= analysis.analyze(numSteps,dT)
+  retval= list()
+  for tag in range(1,numDiv+2):
+    retval.append(nodes.getNode(tag).getDisp[0])
+  return retval, integ, result
+
+ref, integNoDamping, resultRef= solveBar("central_difference_no_damping_integrator",1)
+disp1, integ1, result1= solveBar("central_difference_lumped_mass_integrator",1)
+disp4, integ4, result4= solveBar("central_difference_lumped_mass_integrator",4)
+dispDamped, integDamped, resultDamped= solveBar("central_difference_lumped_mass_integrator",1,xc.RayleighDampingFactors(0.1,0.0,0.0,0.0))
+
+err1= 0.0
+err4= 0.0
+norm= 0.0
+for r,d1,d4 in zip(ref,disp1,disp4):
+  norm+= r**2
+  err1+= (d1-r)**2
+  err4+= (d4-d1)**2
+err1= math.sqrt(err1/norm)
+
+dTStable= math.sqrt(m/k)
+ratio1= abs(integ1.stableTimeStep-dTStable)/dTStable
+massVector= integ1.lumpedMass
+ratio2= abs(massVector[0]-m)/m
+
+'''
+print "ref= ", ref[-1]
+print "disp1= ", disp1[-1]
+print "err1= ", err1
+print "err4= ", err4
+print "stable time step= ", integ1.stableTimeStep
+print "ratio1= ", ratio1
+print "ratio2= ", ratio2
+print "resultDamped= ", resultDamped
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (resultRef==0) & (result1==0) & (result4==0) & (resultDamped!=0) & (norm>0.0) & (err1<1e-12) & (err4==0.0) & (ratio1<1e-12) & (ratio2<1e-12):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,141 @@
+# -*- coding: utf-8 -*-
+''' Checks that the matrix-free preconditioned conjugate gradient solver
+    gives the same results that the band SPD LAPACK solver (column of
+    8-node bricks clamped at its base) in a static analysis and in a
+    transient one (Newmark integrator with nodal masses).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+nx= 3 # Number of divisions along x.
+ny= 3 # Number of divisions along y.
+nz= 6 # Number of divisions along z.
+nodeMass= 1000.0 # Mass of each node (transient analysis).
+numSteps= 5 # Number of steps (transient analysis).
+dT= 1e-3 # Time step (transient analysis).
+
+def nodeTag(i,j,k):
+  return (k*(ny+1)+j)*(nx+1)+i+1
+
+def solveColumn(soeType, solverType, preconditioner= None, numThreads= None, transient= False):
+  ''' Defines and solves the model, returns the nodal displacements
+      and the number of iterations of the solver.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+  for k in range(0,nz+1):
+    for j in range(0,ny+1):
+      for i in range(0,nx+1):
+        n= nodes.newNodeIDXYZ(nodeTag(i,j,k),float(i),float(j),float(k))
+        if(transient):
+          n.mass= xc.Matrix([[nodeMass,0,0],[0,nodeMass,0],[0,0,nodeMass]])
+  mat= typical_materials.defElasticIsotropic3d(preprocessor,"elast3d",30e9,0.25,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast3d"
+  elements.defaultTag= 1
+  for k in range(0,nz):
+    for j in range(0,ny):
+      for i in range(0,nx):
+        elements.newElement("Brick",xc.ID([nodeTag(i,j,k),nodeTag(i+1,j,k),nodeTag(i+1,j+1,k),nodeTag(i,j+1,k),nodeTag(i,j,k+1),nodeTag(i+1,j,k+1),nodeTag(i+1,j+1,k+1),nodeTag(i,j+1,k+1)]))
+  constraints= preprocessor.getBoundaryCondHandler
+  for j in range(0,ny+1):
+    for i in range(0,nx+1):
+      for dof in range(0,3):
+        constraints.newSPConstraint(nodeTag(i,j,0),dof,0.0)
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("linear_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(nodeTag(nx,ny,nz),xc.Vector([1e5,0.0,-1e5]))
+  lp0.newNodalLoad(nodeTag(0,ny,nz),xc.Vector([0.0,1e5,0.0]))
+  lPatterns.addToDomain("0")
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+  ctest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+  ctest.tol= 1e-4
+  ctest.maxNumIter= 10
+  if(transient):
+    integ= analysisAggregation.newIntegrator("newmark_integrator",xc.Vector([0.5,0.25]))
+  else:
+    integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+    integ.dLambda1= 1.0
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  if(preconditioner):
+    solver.preconditioner= preconditioner
+    solver.tolerance= 1e-12
+  if(numThreads):
+    solver.numThreads= numThreads
+  if(transient):
+    analysis= solu.newAnalysis("direct_integration_analysis","analysisAggregation","")
+    result= analysis.analyze(numSteps,dT)
+  else:
+    analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+    result= analysis.analyze(1)
+  numIter= 0
+  if(preconditioner):
+    numIter= solver.numIter
+  retval= list()
+  for k in range(0,nz+1):
+    for j in range(0,ny+1):
+      for i in range(0,nx+1):
+        disp= nodes.getNode(nodeTag(i,j,k)).getDisp
+        retval.append((disp[0],disp[1],disp[2]))
+  return result, retval, numIter
+
+def sqrDiff(a,b):
+  retval= 0.0
+  for s,p in zip(a,b):
+    retval+= (s[0]-p[0])**2+(s[1]-p[1])**2+(s[2]-p[2])**2
+  return retval
+
+r0, ref, it0= solveColumn("band_spd_lin_soe","band_spd_lin_lapack_solver")
+r1, none, it1= solveColumn("matrix_free_lin_soe","matrix_free_pcg_solver","none",1)
+r2, jacobi, it2= solveColumn("matrix_free_lin_soe","matrix_free_pcg_solver","jacobi",2)
+r3, block, it3= solveColumn("matrix_free_lin_soe","matrix_free_pcg_solver","block_jacobi",2)
+r4, refTransient, it4= solveColumn("band_spd_lin_soe","band_spd_lin_lapack_solver",transient= True)
+r5, blockTransient, it5= solveColumn("matrix_free_lin_soe","matrix_free_pcg_solver","block_jacobi",2,transient= True)
+
+refNorm= sqrDiff(ref,[(0.0,0.0,0.0)]*len(ref))
+errNone= sqrDiff(ref,none)/refNorm
+errJacobi= sqrDiff(ref,jacobi)/refNorm
+errBlock= sqrDiff(ref,block)/refNorm
+refTransientNorm= sqrDiff(refTransient,[(0.0,0.0,0.0)]*len(refTransient))
+errTransient= sqrDiff(refTransient,blockTransient)/refTransientNorm
+
+'''
+print "ref= ", ref[-1]
+print "block= ", block[-1]
+print "errNone= ", errNone, " iterations: ", it1
+print "errJacobi= ", errJacobi, " iterations: ", it2
+print "errBlock= ", errBlock, " iterations: ", it3
+print "errTransient= ", errTransient, " iterations: ", it5
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (r0==0) & (r1==0) & (r2==0) & (r3==0) & (refNorm>0.0) & (errNone<1e-16) & (errJacobi<1e-16) & (errBlock<1e-16) & (it3>0) & (r4==0) & (r5==0) & (refTransientNorm>0.0) & (errTransient<1e-16):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
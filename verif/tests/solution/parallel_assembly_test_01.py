@@ -0,0 +1,94 @@
+# -*- coding: utf-8 -*-
+''' Checks that the element contributions computed with several threads
+    give the same results that the serial assembly (cantilever truss
+    loaded at its tip).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+A= 1.0 # Bar area.
+l= 10.0 # Bay length in inches.
+h= 5.0 # Truss height.
+numBays= 20 # Number of bays.
+F= 1000 # Force magnitude (pounds)
+
+def solveTruss(numThreads, batchSize):
+  ''' Defines and solves the model, returns the nodal displacements.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for i in range(0,numBays+1):
+    nodes.newNodeXY(i*l,0.0) # Bottom chord: 2*i+1
+    nodes.newNodeXY(i*l,h) # Top chord: 2*i+2
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2 # Dimension of element space
+  elements.defaultTag= 1 #Tag for the next element.
+  def newBar(i,j):
+    truss= elements.newElement("Truss",xc.ID([i,j]))
+    truss.area= A
+  for i in range(0,numBays):
+    n1= 2*i+1; n2= 2*i+2; n3= 2*i+3; n4= 2*i+4
+    newBar(n1,n3) # Bottom chord.
+    newBar(n2,n4) # Top chord.
+    newBar(n3,n4) # Vertical.
+    newBar(n1,n4) # Diagonal.
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  for tag in [1,2]:
+    constraints.newSPConstraint(tag,0,0.0)
+    constraints.newSPConstraint(tag,1,0.0)
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(2*numBays+1,xc.Vector([0,-F]))
+  lPatterns.addToDomain("0")
+  # Solution
+  solution= predefined_solutions.SolutionProcedure()
+  solution.numThreads= numThreads
+  analysis= solution.simpleStaticLinear(feProblem)
+  solution.integ.batchSize= batchSize
+  result= analysis.analyze(1)
+  retval= list()
+  for tag in range(1,2*numBays+3):
+    disp= nodes.getNode(tag).getDisp
+    retval.append((disp[0],disp[1]))
+  return retval
+
+serial= solveTruss(1,64)
+parallel= solveTruss(4,3) # small batch to exercise several chunks.
+
+err= 0.0
+for s,p in zip(serial,parallel):
+  err+= (s[0]-p[0])**2+(s[1]-p[1])**2
+
+'''
+print "serial= ", serial[-1]
+print "parallel= ", parallel[-1]
+print "err= ", err
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (len(serial)==len(parallel)) & (err==0.0) & (abs(serial[-1][1])>0.0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,92 @@
+# -*- coding: utf-8 -*-
+''' Checks that the stiffness and resisting forces of thread safe
+    elements (four node quads) computed concurrently give the same
+    results that the serial assembly.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+L= 6.0 # Beam length expressed in inches.
+h= 0.8 # Beam cross-section depth expressed in inches.
+t= 1 # Beam cross-section width expressed in inches.
+E= 30000 # Young modulus of the material expressed in ksi.
+nu= 0.3 # Poisson's ratio.
+F= 10 # Load magnitude en kips
+nx= 30 # Number of divisions along the beam axis.
+ny= 4 # Number of divisions along the depth.
+
+def solveBeam(numThreads):
+  ''' Defines and solves the model, returns the nodal displacements.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1
+  for j in range(0,ny+1):
+    for i in range(0,nx+1):
+      nodes.newNodeXY(i*L/nx,j*h/ny)
+  elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast2d"
+  for j in range(0,ny):
+    for i in range(0,nx):
+      n1= j*(nx+1)+i+1
+      n2= n1+1
+      n3= n2+nx+1
+      n4= n1+nx+1
+      quad= elements.newElement("FourNodeQuad",xc.ID([n1,n2,n3,n4]))
+      quad.thickness= t
+  constraints= preprocessor.getBoundaryCondHandler
+  for j in range(0,ny+1):
+    tag= j*(nx+1)+1
+    constraints.newSPConstraint(tag,0,0.0)
+    constraints.newSPConstraint(tag,1,0.0)
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad((ny+1)*(nx+1),xc.Vector([0,-F]))
+  lPatterns.addToDomain("0")
+  solution= predefined_solutions.SolutionProcedure()
+  solution.numThreads= numThreads
+  analysis= solution.simpleNewtonRaphsonBandGen(feProblem)
+  result= analysis.analyze(1)
+  nodes.calculateNodalReactions(True,1e-7)
+  retval= list()
+  for tag in range(1,(ny+1)*(nx+1)+1):
+    nod= nodes.getNode(tag)
+    retval.append((nod.getDisp[0],nod.getDisp[1],nod.getReaction[0],nod.getReaction[1]))
+  return result, retval
+
+ok1, serial= solveBeam(1)
+ok4, parallel= solveBeam(4)
+
+err= 0.0
+for s,p in zip(serial,parallel):
+  for a,b in zip(s,p):
+    err+= (a-b)**2
+
+'''
+print "serial= ", serial[-1]
+print "parallel= ", parallel[-1]
+print "err= ", err
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ok1==0) & (ok4==0) & (err==0.0) & (abs(serial[-1][1])>0.0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
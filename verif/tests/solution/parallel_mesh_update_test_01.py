@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+''' Checks that committing and updating the state of the mesh with
+    several threads gives the same results that the serial sweeps
+    (nonlinear truss with yielding bars).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+fy= 36e3 # Yield stress (psi)
+A= 1.0 # Bar area.
+l= 10.0 # Bay length in inches.
+h= 5.0 # Truss height.
+numBays= 20 # Number of bays.
+F= 1200 # Force magnitude (pounds), yields the chords near the support.
+numSteps= 5 # Number of load steps.
+
+def solveTruss(numThreads):
+  ''' Defines and solves the model, returns the nodal displacements
+      and the bar stresses.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for i in range(0,numBays+1):
+    nodes.newNodeXY(i*l,0.0) # Bottom chord: 2*i+1
+    nodes.newNodeXY(i*l,h) # Top chord: 2*i+2
+  steel= typical_materials.defSteel01(preprocessor,"steel",E,fy,0.02)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "steel"
+  elements.dimElem= 2 # Dimension of element space
+  elements.defaultTag= 1 #Tag for the next element.
+  def newBar(i,j):
+    truss= elements.newElement("Truss",xc.ID([i,j]))
+    truss.area= A
+  for i in range(0,numBays):
+    n1= 2*i+1; n2= 2*i+2; n3= 2*i+3; n4= 2*i+4
+    newBar(n1,n3) # Bottom chord.
+    newBar(n2,n4) # Top chord.
+    newBar(n3,n4) # Vertical.
+    newBar(n1,n4) # Diagonal.
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  for tag in [1,2]:
+    constraints.newSPConstraint(tag,0,0.0)
+    constraints.newSPConstraint(tag,1,0.0)
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("linear_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(2*numBays+1,xc.Vector([0,-F/numSteps]))
+  lPatterns.addToDomain("0")
+  # Solution
+  solution= predefined_solutions.SolutionProcedure()
+  solution.numThreads= numThreads
+  solution.maxNumIter= 50
+  analysis= solution.simpleNewtonRaphson(feProblem)
+  result= analysis.analyze(numSteps)
+  retval= list()
+  for tag in range(1,2*numBays+3):
+    disp= nodes.getNode(tag).getDisp
+    retval.append(disp[0])
+    retval.append(disp[1])
+  for tag in range(1,4*numBays+1):
+    retval.append(elements.getElement(tag).getMaterial().getStress())
+  return result,retval
+
+resultSerial,serial= solveTruss(1)
+resultParallel,parallel= solveTruss(4)
+
+err= 0.0
+for s,p in zip(serial,parallel):
+  err+= (s-p)**2
+maxStress= max([abs(s) for s in serial[-4*numBays:]])
+
+'''
+print "err= ", err
+print "maxStress= ", maxStress
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (resultSerial==0) & (resultParallel==0) & (len(serial)==len(parallel)) & (err==0.0) & (maxStress>fy):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
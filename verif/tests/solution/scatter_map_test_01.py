@@ -0,0 +1,103 @@
+# -*- coding: utf-8 -*-
+''' Checks that the assembly with the scatter maps of the elements
+    gives the same results that the assembly that searches the position
+    of each term (plane stress plate clamped at its bottom edge).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numDiv= 12 # Number of divisions on each side.
+
+def solvePlate(soeType, solverType, useScatterMaps):
+  ''' Defines and solves the model, returns the nodal displacements.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1
+  for j in range(0,numDiv+1):
+    for i in range(0,numDiv+1):
+      nodes.newNodeXY(float(i),float(j))
+  mat= typical_materials.defElasticIsotropicPlaneStress(preprocessor,"mat",2.1e9,0.3,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "mat"
+  elements.defaultTag= 1
+  def nodeTag(i,j):
+    return j*(numDiv+1)+i+1
+  for j in range(0,numDiv):
+    for i in range(0,numDiv):
+      elements.newElement("FourNodeQuad",xc.ID([nodeTag(i,j),nodeTag(i+1,j),nodeTag(i+1,j+1),nodeTag(i,j+1)]))
+  constraints= preprocessor.getBoundaryCondHandler
+  for i in range(0,numDiv+1):
+    constraints.newSPConstraint(nodeTag(i,0),0,0.0)
+    constraints.newSPConstraint(nodeTag(i,0),1,0.0)
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("linear_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(nodeTag(numDiv,numDiv),xc.Vector([1e3,-1e3]))
+  lp0.newNodalLoad(nodeTag(0,numDiv),xc.Vector([1e3,0.0]))
+  lPatterns.addToDomain("0")
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+  ctest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+  ctest.tol= 1e-6
+  ctest.maxNumIter= 10
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  integ.dLambda1= 0.5
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  soe.useScatterMaps= useScatterMaps
+  solver= soe.newSolver(solverType)
+  if(solverType=="sparse_gen_row_amg_solver"):
+    solver.tolerance= 1e-14
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(2) # two steps: maps reused.
+  retval= list()
+  for tag in range(1,(numDiv+1)**2+1):
+    disp= nodes.getNode(tag).getDisp
+    retval.append((disp[0],disp[1]))
+  return result, retval, soe.scatterMapSize
+
+def sqrDiff(a,b):
+  retval= 0.0
+  for s,p in zip(a,b):
+    retval+= (s[0]-p[0])**2+(s[1]-p[1])**2
+  return retval
+
+cases= [("sparse_gen_col_lin_soe","super_lu_solver"), ("sparse_gen_row_lin_soe","sparse_gen_row_amg_solver"), ("profile_spd_lin_soe","profile_spd_lin_direct_solver"), ("sym_sparse_lin_soe","sym_sparse_lin_solver")]
+
+ok= True
+for soeType, solverType in cases:
+  r0, ref, sz0= solvePlate(soeType,solverType,False)
+  r1, disp, sz1= solvePlate(soeType,solverType,True)
+  refNorm= sqrDiff(ref,[(0.0,0.0)]*len(ref))
+  err= sqrDiff(ref,disp)/refNorm
+  # print soeType, sz0, sz1, err
+  ok= ok and (r0==0) and (r1==0) and (refNorm>0.0) and (err<1e-20) and (sz0==0) and (sz1>0)
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,100 @@
+# -*- coding: utf-8 -*-
+''' Checks that the DOF ordering and the size of the system of equations
+    are reused when only the loads change between analysis stages (the
+    connectivity doesn't change) and that the results are the same
+    that those obtained without reuse (cantilever truss).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+A= 1.0 # Bar area.
+l= 10.0 # Bay length in inches.
+h= 5.0 # Truss height.
+numBays= 10 # Number of bays.
+F= 1000 # Force magnitude (pounds)
+
+def solveTruss(reuse):
+  ''' Defines and solves the model for three load stages, returns
+      the nodal displacements and the cache counters.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for i in range(0,numBays+1):
+    nodes.newNodeXY(i*l,0.0) # Bottom chord: 2*i+1
+    nodes.newNodeXY(i*l,h) # Top chord: 2*i+2
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2 # Dimension of element space
+  elements.defaultTag= 1 #Tag for the next element.
+  def newBar(i,j):
+    truss= elements.newElement("Truss",xc.ID([i,j]))
+    truss.area= A
+  for i in range(0,numBays):
+    n1= 2*i+1; n2= 2*i+2; n3= 2*i+3; n4= 2*i+4
+    newBar(n1,n3) # Bottom chord.
+    newBar(n2,n4) # Top chord.
+    newBar(n3,n4) # Vertical.
+    newBar(n1,n4) # Diagonal.
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  for tag in [1,2]:
+    constraints.newSPConstraint(tag,0,0.0)
+    constraints.newSPConstraint(tag,1,0.0)
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  stageLoads= [xc.Vector([0,-F]), xc.Vector([F,0]), xc.Vector([F,-F])]
+  # Solution
+  solution= predefined_solutions.SolutionProcedure()
+  analysis= solution.simpleStaticLinear(feProblem)
+  solution.numberer.reuseOrdering= reuse
+  solution.soe.reuseSparsity= reuse
+  retval= list()
+  for i, load in enumerate(stageLoads):
+    lp= lPatterns.newLoadPattern("default",str(i))
+    lp.newNodalLoad(2*numBays+2,load)
+    lPatterns.addToDomain(str(i))
+    result= analysis.analyze(1)
+    for tag in range(1,2*numBays+3):
+      disp= nodes.getNode(tag).getDisp
+      retval.append((disp[0],disp[1]))
+    lp.removeFromDomain()
+  counters= (solution.numberer.orderingHits, solution.numberer.orderingMisses, solution.soe.sparsityHits, solution.soe.sparsityMisses)
+  return retval, counters
+
+plain, plainCounters= solveTruss(False)
+cached, cachedCounters= solveTruss(True)
+
+err= 0.0
+for s,p in zip(plain,cached):
+  err+= (s[0]-p[0])**2+(s[1]-p[1])**2
+
+'''
+print "plain counters= ", plainCounters
+print "cached counters= ", cachedCounters
+print "err= ", err
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (len(plain)==len(cached)) & (err==0.0) & (plainCounters[0]==0) & (plainCounters[2]==0) & (cachedCounters[0]>=2) & (cachedCounters[2]>=2) & (cachedCounters[1]>=1) & (cachedCounters[3]>=1):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,112 @@
+# -*- coding: utf-8 -*-
+''' Checks that the supernodal Cholesky solver gives the same results
+    that the band SPD LAPACK solver (plane stress plate clamped
+    at its bottom edge).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numDiv= 12 # Number of divisions on each side.
+
+def solvePlate(soeType, solverType, ordering= None, numThreads= None):
+  ''' Defines and solves the model, returns the nodal displacements.'''
+  feProblem= xc.FEProblem()
+  feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1
+  for j in range(0,numDiv+1):
+    for i in range(0,numDiv+1):
+      nodes.newNodeXY(float(i),float(j))
+  mat= typical_materials.defElasticIsotropicPlaneStress(preprocessor,"mat",2.1e9,0.3,0.0)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "mat"
+  elements.defaultTag= 1
+  def nodeTag(i,j):
+    return j*(numDiv+1)+i+1
+  for j in range(0,numDiv):
+    for i in range(0,numDiv):
+      elements.newElement("FourNodeQuad",xc.ID([nodeTag(i,j),nodeTag(i+1,j),nodeTag(i+1,j+1),nodeTag(i,j+1)]))
+  constraints= preprocessor.getBoundaryCondHandler
+  for i in range(0,numDiv+1):
+    constraints.newSPConstraint(nodeTag(i,0),0,0.0)
+    constraints.newSPConstraint(nodeTag(i,0),1,0.0)
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("linear_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(nodeTag(numDiv,numDiv),xc.Vector([1e3,-1e3]))
+  lp0.newNodalLoad(nodeTag(0,numDiv),xc.Vector([1e3,0.0]))
+  lPatterns.addToDomain("0")
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("simple")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+  ctest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+  ctest.tol= 1e-6
+  ctest.maxNumIter= 10
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  integ.dLambda1= 0.5
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  if(ordering):
+    solver.ordering= ordering
+  if(numThreads):
+    solver.numThreads= numThreads
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(2) # two steps: symbolic factorization reused.
+  retval= list()
+  for tag in range(1,(numDiv+1)**2+1):
+    disp= nodes.getNode(tag).getDisp
+    retval.append((disp[0],disp[1]))
+  return result, retval
+
+def sqrDiff(a,b):
+  retval= 0.0
+  for s,p in zip(a,b):
+    retval+= (s[0]-p[0])**2+(s[1]-p[1])**2
+  return retval
+
+r0, ref= solvePlate("band_spd_lin_soe","band_spd_lin_lapack_solver")
+r1, amd= solvePlate("sparse_gen_col_lin_soe","supernodal_cholesky_solver","amd",2)
+r2, nd= solvePlate("sparse_gen_col_lin_soe","supernodal_cholesky_solver","nested_dissection",2)
+r3, nat= solvePlate("sparse_gen_col_lin_soe","supernodal_cholesky_solver","natural",1)
+
+refNorm= sqrDiff(ref,[(0.0,0.0)]*len(ref))
+errAmd= sqrDiff(ref,amd)/refNorm
+errNd= sqrDiff(ref,nd)/refNorm
+errNat= sqrDiff(ref,nat)/refNorm
+
+'''
+print "ref= ", ref[-1]
+print "amd= ", amd[-1]
+print "nd= ", nd[-1]
+print "errAmd= ", errAmd
+print "errNd= ", errNd
+print "errNat= ", errNat
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (r0==0) & (r1==0) & (r2==0) & (r3==0) & (refNorm>0.0) & (errAmd<1e-20) & (errNd<1e-20) & (errNat<1e-20):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,121 @@
+# -*- coding: utf-8 -*-
+''' Checks that the threaded direct solvers (profile and band SPD)
+    give the same results that their serial counterparts (truss
+    loaded at its tip).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+A= 1.0 # Bar area.
+l= 10.0 # Bay length in inches.
+h= 5.0 # Truss height.
+numBays= 30 # Number of bays.
+F= 1000 # Force magnitude (pounds)
+
+def solveTruss(soeType, solverType, numThreads= None, blockSize= None):
+  ''' Defines and solves the model, returns the nodal displacements.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for i in range(0,numBays+1):
+    nodes.newNodeXY(i*l,0.0) # Bottom chord: 2*i+1
+    nodes.newNodeXY(i*l,h) # Top chord: 2*i+2
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2 # Dimension of element space
+  elements.defaultTag= 1 #Tag for the next element.
+  def newBar(i,j):
+    truss= elements.newElement("Truss",xc.ID([i,j]))
+    truss.area= A
+  for i in range(0,numBays):
+    n1= 2*i+1; n2= 2*i+2; n3= 2*i+3; n4= 2*i+4
+    newBar(n1,n3) # Bottom chord.
+    newBar(n2,n4) # Top chord.
+    newBar(n3,n4) # Vertical.
+    newBar(n1,n4) # Diagonal.
+    newBar(n2,n3) # Counter diagonal.
+  # Constraints
+  constraints= preprocessor.getBoundaryCondHandler
+  for tag in [1,2]:
+    constraints.newSPConstraint(tag,0,0.0)
+    constraints.newSPConstraint(tag,1,0.0)
+  # Loads definition
+  loadHandler= preprocessor.getLoadHandler
+  lPatterns= loadHandler.getLoadPatterns
+  ts= lPatterns.newTimeSeries("constant_ts","ts")
+  lPatterns.currentTimeSeries= "ts"
+  lp0= lPatterns.newLoadPattern("default","0")
+  lp0.newNodalLoad(2*numBays+1,xc.Vector([0,-F]))
+  lp0.newNodalLoad(2*numBays+2,xc.Vector([F/2.0,0]))
+  lPatterns.addToDomain("0")
+  # Solution
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("rcm")
+  cHandler= sm.newConstraintHandler("plain_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  if(numThreads):
+    solver.numThreads= numThreads
+  if(blockSize):
+    solver.blockSize= blockSize
+  analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analysis.analyze(1)
+  retval= list()
+  for tag in range(1,2*numBays+3):
+    disp= nodes.getNode(tag).getDisp
+    retval.append((disp[0],disp[1]))
+  return retval
+
+def sqrDiff(a,b):
+  retval= 0.0
+  for s,p in zip(a,b):
+    retval+= (s[0]-p[0])**2+(s[1]-p[1])**2
+  return retval
+
+profileSerial= solveTruss("profile_spd_lin_soe","profile_spd_lin_direct_solver")
+# small blocks to exercise several block steps.
+profileThread= solveTruss("profile_spd_lin_soe","profile_spd_lin_direct_thread_solver",4,3)
+bandSerial= solveTruss("band_spd_lin_soe","band_spd_lin_lapack_solver")
+bandThread= solveTruss("band_spd_lin_soe","band_spd_lin_thread_solver",4,2)
+
+ref= sqrDiff(bandSerial,[(0.0,0.0)]*len(bandSerial))
+errProfile= sqrDiff(profileSerial,profileThread) # must be exactly equal.
+errBand= sqrDiff(bandSerial,bandThread)/ref
+
+'''
+print "profile serial= ", profileSerial[-1]
+print "profile thread= ", profileThread[-1]
+print "band serial= ", bandSerial[-1]
+print "band thread= ", bandThread[-1]
+print "errProfile= ", errProfile
+print "errBand= ", errBand
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (len(profileSerial)==len(profileThread)) & (errProfile==0.0) & (errBand<1e-20) & (ref>0.0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,120 @@
+# -*- coding: utf-8 -*-
+# home made test
+'''Asynchronous recording of node displacements in an HDF5 dataset.'''
+
+import xc_base
+import geom
+import xc
+import os
+import h5py
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+
+# Load
+F= 1.5e3 # Load magnitude (kN)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXYZ(0,0.0,0.0)
+nod= nodes.newNodeXYZ(L,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+    
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+elements.defaultTag= 1 #Tag for next element.
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([1,2]));
+
+modelSpace.fixNode000_000(1)
+
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+#Load modulation.
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+#Load case definition
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([F,0,0,0,0,0]))
+#We add the load case to domain.
+lPatterns.addToDomain("0")
+
+# Output handler and recorder.
+fileName= "/tmp/test_hdf5_output_handler_02.h5"
+handler= feProblem.newOutputHandler("HDF5","h5",fileName,"nodes/disp")
+handler.bufferRows= 4 # Written in blocks of 4 steps.
+handler.chunkRows= 8
+domain= feProblem.getDomain
+domain.outputQueueCapacity= 3 # Small buffer (the recorder waits for the writer).
+domain.asyncRecording= True # Rows written by a background thread.
+recorder= domain.newRecorder("node_recorder",handler)
+recorder.setNodes(xc.ID([2]))
+recorder.setDofs(xc.ID([0,1]))
+recorder.setDataToStore("disp")
+recorder.echoTimeFlag= True
+
+# Solution
+numSteps= 10
+analisis= predefined_solutions.simple_static_linear(feProblem)
+result= analisis.analyze(numSteps)
+handler.close() # Waits for the writer thread and writes pending rows.
+
+# Read the results.
+f= h5py.File(fileName,'r')
+dset= f['nodes/disp']
+data= dset[:,:]
+columns= list(dset.attrs['columns'])
+f.close()
+
+deltateor= (F*L/(E*A))
+err= 0.0
+for i in range(0,numSteps):
+  lmbd= i+1.0
+  err+= (data[i,0]-lmbd)**2 # Time (load factor).
+  err+= ((data[i,1]-lmbd*deltateor)/deltateor)**2 # x displacement.
+  err+= (data[i,2]/deltateor)**2 # y displacement.
+
+''' 
+print "shape= ",data.shape
+print "columns= ",columns
+print "data= ",data
+print "err= ",err
+   '''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (data.shape==(numSteps,3)) & (columns==['time','Node2_disp_1','Node2_disp_2']) & (err<1e-10):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
+
+os.system("rm -f "+fileName) # Your garbage you clean it
@@ -0,0 +1,135 @@
+# -*- coding: utf-8 -*-
+# home made test
+'''Node results as numpy arrays that share the memory of the returned matrix.'''
+
+import xc_base
+import geom
+import xc
+import os
+import numpy
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+
+# Load
+F= 1.5e3 # Load magnitude (kN)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXYZ(0,0.0,0.0)
+nod= nodes.newNodeXYZ(L,0.0,0.0)
+nod= nodes.newNodeXYZ(2*L,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+    
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+elements.defaultTag= 1 #Tag for next element.
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([1,2]));
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([2,3]));
+
+modelSpace.fixNode000_000(1)
+
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+#Load modulation.
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= "ts"
+#Load case definition
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(3,xc.Vector([F,0,0,0,0,0]))
+#We add the load case to domain.
+lPatterns.addToDomain("0")
+
+# Solution
+analisis= predefined_solutions.simple_static_linear(feProblem)
+result= analisis.analyze(1)
+nodes.calculateNodalReactions(True,1e-7)
+
+mesh= feProblem.getDomain.getMesh
+tags= numpy.asarray(mesh.getNodeTagArray())
+dispMatrix= mesh.getNodeDisplacementArray()
+disp= numpy.asarray(dispMatrix) # No copy.
+reactions= numpy.asarray(mesh.getNodeReactionArray())
+
+# Compare with the values obtained node by node.
+err= 0.0
+for i, tag in enumerate(tags):
+  nodeDisp= mesh.getNode(int(tag)).getDisp
+  for j in range(0,6):
+    err+= (disp[i,j]-nodeDisp[j])**2
+deltateor= (2*F*L/(E*A))
+iNode3= list(tags).index(3)
+err+= ((disp[iNode3,0]-deltateor)/deltateor)**2
+iNode1= list(tags).index(1)
+err+= ((reactions[iNode1,0]+F)/F)**2
+
+# The array shares the memory of the matrix.
+disp[0,0]= 1e3
+shared= (dispMatrix(0,0)==1e3)
+
+elementForces= numpy.asarray(mesh.getElementResistingForceArray())
+
+# The vectors owned by other objects (i.e. the node coordinates)
+# don't export their data.
+try:
+  memoryview(mesh.getNode(1).getCoo)
+  refusedNotOwned= False
+except BufferError:
+  refusedNotOwned= True
+
+# The ID can't be resized while an array shares its data.
+tagsID= mesh.getNodeTagArray()
+tagsView= numpy.asarray(tagsID)
+try:
+  tagsID.append(4)
+  refusedResize= False
+except BufferError:
+  refusedResize= True
+del tagsView
+tagsID.append(4)
+resizedAfterRelease= (len(tagsID)==4)
+
+''' 
+print "tags= ",tags
+print "disp= ",disp
+print "reactions= ",reactions
+print "elementForces= ",elementForces
+print "err= ",err
+   '''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (disp.shape==(3,6)) & (elementForces.shape==(2,12)) & shared & (err<1e-10) & refusedNotOwned & refusedResize & resizedAfterRelease:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')